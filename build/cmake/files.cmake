@@ -7,6 +7,7 @@ set(BASE_UNIX_AND_DARWIN_SRC
     src/unix/appunix.cpp
     src/unix/dir.cpp
     src/unix/dlunix.cpp
+    src/unix/elfsymbols.cpp
     src/unix/epolldispatcher.cpp
     src/unix/evtloopunix.cpp
     src/unix/fdiounix.cpp
@@ -409,6 +410,7 @@ set(BASE_CMN_SRC
     src/common/dynload.cpp
     src/common/encconv.cpp
     src/common/evtloopcmn.cpp
+    src/common/evtprofiler.cpp
     src/common/extended.c
     src/common/ffile.cpp
     src/common/file.cpp
@@ -430,12 +432,15 @@ set(BASE_CMN_SRC
     src/common/languageinfo.cpp
     src/common/list.cpp
     src/common/log.cpp
+    src/common/logasync.cpp
+    src/common/logbinary.cpp
     src/common/longlong.cpp
     src/common/mimecmn.cpp
     src/common/module.cpp
     src/common/mstream.cpp
     src/common/numformatter.cpp
     src/common/object.cpp
+    src/common/parallel.cpp
     src/common/platinfo.cpp
     src/common/process.cpp
     src/common/regex.cpp
@@ -453,6 +458,7 @@ set(BASE_CMN_SRC
     src/common/tarstrm.cpp
     src/common/textbuf.cpp
     src/common/textfile.cpp
+    src/common/threadpool.cpp
     src/common/time.cpp
     src/common/timercmn.cpp
     src/common/timerimpl.cpp
@@ -496,6 +502,7 @@ set(BASE_CMN_HDR
     wx/arrstr.h
     wx/atomic.h
     wx/base64.h
+    wx/base64stream.h
     wx/beforestd.h
     wx/buffer.h
     wx/build.h
@@ -528,6 +535,7 @@ set(BASE_CMN_HDR
     wx/eventfilter.h
     wx/evtloop.h
     wx/evtloopsrc.h
+    wx/evtprofiler.h
     wx/except.h
     wx/features.h
     wx/flags.h
@@ -559,6 +567,8 @@ set(BASE_CMN_HDR
     wx/list.h
     wx/listimpl.cpp
     wx/log.h
+    wx/logasync.h
+    wx/logbinary.h
     wx/longlong.h
     wx/math.h
     wx/memconf.h
@@ -572,6 +582,7 @@ set(BASE_CMN_HDR
     wx/mstream.h
     wx/numformatter.h
     wx/object.h
+    wx/parallel.h
     wx/platform.h
     wx/platinfo.h
     wx/process.h
@@ -603,6 +614,7 @@ set(BASE_CMN_HDR
     wx/textbuf.h
     wx/textfile.h
     wx/thread.h
+    wx/threadpool.h
     wx/thrimpl.cpp
     wx/time.h
     wx/timer.h
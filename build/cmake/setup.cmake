@@ -651,6 +651,15 @@ if(NOT HAVE_GETTIMEOFDAY)
     wx_check_funcs(ftime)
 endif()
 
+if(UNIX)
+    wx_check_funcs_if_not_linux(posix_spawnp)
+    # these functions are only available in the recent glibc versions
+    wx_check_funcs(
+        posix_spawn_file_actions_addchdir_np
+        posix_spawn_file_actions_addclosefrom_np
+        )
+endif()
+
 # Check includes
 if(NOT WIN32)
     wx_check_funcs_if_not_linux(fsync)
@@ -15,6 +15,7 @@
 #if wxUSE_ANY
 
 #include <new> // for placement new
+#include <utility> // for std::move
 #include "wx/string.h"
 #include "wx/meta/if.h"
 #include "wx/typeinfo.h"
@@ -92,6 +93,19 @@ public:
     virtual void CopyBuffer(const wxAnyValueBuffer& src,
                             wxAnyValueBuffer& dst) const = 0;
 
+    /**
+        Move the value from one buffer to another one.
+
+        After this call, src is in the freed state. The default
+        implementation simply copies the value and deletes the source.
+    */
+    virtual void MoveBuffer(wxAnyValueBuffer& src,
+                            wxAnyValueBuffer& dst) const
+    {
+        CopyBuffer(src, dst);
+        DeleteValue(src);
+    }
+
     /**
         Convert value into buffer of different type. Return false if
         not possible.
@@ -230,6 +244,24 @@ public:
 
         return *u.ptr;
     }
+
+    static void MoveValue(wxAnyValueBuffer& src, wxAnyValueBuffer& dst)
+    {
+        T& value = const_cast<T&>(GetValue(src));
+
+#ifdef WXDEBUG_NEW
+    #undef new
+#endif
+
+        void* const place = dst.m_buffer;
+        ::new(place) T(std::move(value));
+
+#ifdef WXDEBUG_NEW
+    #define new WXDEBUG_NEW
+#endif
+
+        value.~T();
+    }
 };
 
 
@@ -270,6 +302,13 @@ public:
         DataHolder<T>* holder = static_cast<DataHolder<T>*>(buf.m_ptr);
         return holder->m_value;
     }
+
+    static void MoveValue(wxAnyValueBuffer& src, wxAnyValueBuffer& dst)
+    {
+        // Just steal the holder, there is no need to move the value itself.
+        dst.m_ptr = src.m_ptr;
+        src.m_ptr = nullptr;
+    }
 };
 
 
@@ -309,6 +348,12 @@ public:
         Ops::SetValue(Ops::GetValue(src), dst);
     }
 
+    virtual void MoveBuffer(wxAnyValueBuffer& src,
+                            wxAnyValueBuffer& dst) const override
+    {
+        Ops::MoveValue(src, dst);
+    }
+
     /**
         It is important to reimplement this in any specialized template
         classes that inherit from wxAnyValueTypeImplBase.
@@ -774,6 +819,12 @@ public:
         AssignAny(any);
     }
 
+    wxAny(wxAny&& any)
+    {
+        m_type = wxAnyNullValueType;
+        MoveAny(any);
+    }
+
 #if wxUSE_VARIANT
     wxAny(const wxVariant& variant)
     {
@@ -856,6 +907,13 @@ public:
         return *this;
     }
 
+    wxAny& operator=(wxAny&& any)
+    {
+        if (this != &any)
+            MoveAny(any);
+        return *this;
+    }
+
 #if wxUSE_VARIANT
     wxAny& operator=(const wxVariant &variant)
     {
@@ -1040,6 +1098,16 @@ private:
         newType->CopyBuffer(any.m_buffer, m_buffer);
     }
 
+    void MoveAny(wxAny& any)
+    {
+        m_type->DeleteValue(m_buffer);
+
+        m_type = any.m_type;
+        m_type->MoveBuffer(any.m_buffer, m_buffer);
+
+        any.m_type = wxAnyNullValueType;
+    }
+
 #if wxUSE_VARIANT
     void AssignVariant(const wxVariant& variant)
     {
@@ -545,6 +545,12 @@ protected:
 
     // pending events management vars:
 
+    // the stack of the handlers to which the events were queued since the last
+    // call to ProcessPendingEvents(): they're added to it without locking, by
+    // AppendPendingEventHandler(), and moved to m_handlersWithPendingEvents
+    // all at once by TakeNewPendingEventHandlers()
+    std::atomic<wxEvtHandler*> m_handlersWithNewPendingEvents{nullptr};
+
     // the array of the handlers with pending events which needs to be processed
     // inside ProcessPendingEvents()
     wxEvtHandlerArray m_handlersWithPendingEvents;
@@ -556,7 +562,7 @@ protected:
     wxEvtHandlerArray m_handlersWithPendingDelayedEvents;
 
 #if wxUSE_THREADS
-    // this critical section protects both the lists above
+    // this critical section protects both the arrays above
     wxCriticalSection m_handlersWithPendingEventsLocker;
 #endif
 
@@ -564,6 +570,10 @@ protected:
     bool m_bDoPendingEventProcessing = true;
 
 private:
+    // move the handlers from m_handlersWithNewPendingEvents to the end of
+    // m_handlersWithPendingEvents, must be called with the locker held
+    void TakeNewPendingEventHandlers();
+
     // flag set to true at the end of wxApp ctor, call WXAppConstructed() to
     // set it
     bool m_fullyConstructed = false;
@@ -89,6 +89,9 @@ public:
     void Sort(CompareFunction function);
     void Sort(CMPFUNCwxString function) { wxBaseArray<wxString>::Sort(function); }
 
+    void SortParallel(bool reverseOrder = false);
+    void SortParallel(CompareFunction function);
+
     size_t Add(const wxString& string, size_t copies = 1)
     {
         wxBaseArray<wxString>::Add(string, copies);
@@ -125,19 +128,21 @@ public:
         { }
     wxSortedArrayString(const wxArrayString& src)
         : wxSortedArrayStringBase(wxStringSortAscending)
-    {
-        reserve(src.size());
-
-        for ( const auto& str : src )
-            Add(str);
-    }
+        { AssignSorted(src); }
     explicit wxSortedArrayString(wxArrayString::CompareFunction compareFunction)
         : wxSortedArrayStringBase(compareFunction)
         { }
+    wxSortedArrayString(const wxArrayString& src,
+                        wxArrayString::CompareFunction compareFunction)
+        : wxSortedArrayStringBase(compareFunction)
+        { AssignSorted(src); }
 
     int Index(const wxString& str, bool bCase = true, bool bFromEnd = false) const;
 
 private:
+    // Fill the array with the strings from src sorting them all at once.
+    void AssignSorted(const wxArrayString& src);
+
     void Insert()
     {
         wxFAIL_MSG( "wxSortedArrayString::Insert() is not to be used" );
@@ -269,6 +274,9 @@ public:
     // sort array elements using specified comparison function
   void Sort(CompareFunction compareFunction);
   void Sort(CompareFunction2 compareFunction);
+    // same as Sort() but use multiple threads for sorting big arrays
+  void SortParallel(bool reverseOrder = false);
+  void SortParallel(CompareFunction compareFunction);
 
   // comparison
     // compare two arrays case sensitively
@@ -401,6 +409,7 @@ public:
 
 protected:
   void Copy(const wxArrayString& src);  // copies the contents of another array
+  void AssignSorted(const wxArrayString& src); // same, but sort them all at once
 
   CompareFunction m_compareFunction = nullptr; // set only from wxSortedArrayString
 
@@ -429,11 +438,16 @@ public:
   wxSortedArrayString() : wxArrayString(true)
     { }
   wxSortedArrayString(const wxArrayString& array) : wxArrayString(true)
-    { Copy(array); }
+    { AssignSorted(array); }
 
   explicit wxSortedArrayString(CompareFunction compareFunction)
       : wxArrayString(true)
     { m_compareFunction = compareFunction; }
+
+  wxSortedArrayString(const wxArrayString& array,
+                      CompareFunction compareFunction)
+      : wxArrayString(true)
+    { m_compareFunction = compareFunction; AssignSorted(array); }
 };
 
 #endif // !wxUSE_STD_CONTAINERS
@@ -0,0 +1,131 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/base64stream.h
+// Purpose:     Filter streams encoding and decoding BASE64 data
+// Author:      wxWidgets team
+// Created:     2026-10-19
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_BASE64STREAM_H_
+#define _WX_BASE64STREAM_H_
+
+#include "wx/defs.h"
+
+#if wxUSE_BASE64 && wxUSE_STREAMS
+
+#include "wx/base64.h"
+#include "wx/stream.h"
+
+// ----------------------------------------------------------------------------
+// Filter for decoding BASE64 data read from another stream
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_BASE wxBase64DecoderInputStream : public wxFilterInputStream
+{
+public:
+    explicit wxBase64DecoderInputStream(wxInputStream& stream,
+                                        wxBase64DecodeMode mode
+                                            = wxBase64DecodeMode_SkipWS)
+        : wxFilterInputStream(stream)
+    {
+        Init(mode);
+    }
+
+    explicit wxBase64DecoderInputStream(wxInputStream* stream,
+                                        wxBase64DecodeMode mode
+                                            = wxBase64DecodeMode_SkipWS)
+        : wxFilterInputStream(stream)
+    {
+        Init(mode);
+    }
+
+    char Peek() override { return wxInputStream::Peek(); }
+    wxFileOffset GetLength() const override { return wxInputStream::GetLength(); }
+
+protected:
+    size_t OnSysRead(void *buffer, size_t size) override;
+    wxFileOffset OnSysTell() const override { return m_pos; }
+
+private:
+    void Init(wxBase64DecodeMode mode);
+
+    // Read the next chunk of the encoded data from the parent stream and
+    // decode it into m_decoded. Returns false, after updating m_lasterror, if
+    // no more data could be decoded.
+    bool ReadAndDecode();
+
+    wxBase64DecodeMode m_mode;
+    wxFileOffset m_pos;
+
+    // Decoded data not returned from OnSysRead() yet starts at m_decodedPos.
+    wxMemoryBuffer m_decoded;
+    size_t m_decodedPos;
+
+    // The characters of the last incomplete quartet read from the parent.
+    char m_quartet[4];
+    size_t m_quartetLen;
+
+    // Set when padding was found, i.e. nothing but whitespace may follow.
+    bool m_padded;
+
+    wxDECLARE_NO_COPY_CLASS(wxBase64DecoderInputStream);
+};
+
+// ----------------------------------------------------------------------------
+// Filter for encoding data as BASE64 before writing it to another stream
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_BASE wxBase64EncoderOutputStream : public wxFilterOutputStream
+{
+public:
+    explicit wxBase64EncoderOutputStream(wxOutputStream& stream)
+        : wxFilterOutputStream(stream)
+    {
+        Init();
+    }
+
+    explicit wxBase64EncoderOutputStream(wxOutputStream* stream)
+        : wxFilterOutputStream(stream)
+    {
+        Init();
+    }
+
+    virtual ~wxBase64EncoderOutputStream() { Close(); }
+
+    void Sync() override;
+    bool Close() override;
+    wxFileOffset GetLength() const override { return m_pos; }
+
+protected:
+    size_t OnSysWrite(const void *buffer, size_t size) override;
+    wxFileOffset OnSysTell() const override { return m_pos; }
+
+private:
+    void Init();
+
+    // Encode the given number of bytes, which must be a multiple of 3 unless
+    // this is the end of the data, into the output buffer, writing it out
+    // when it becomes full. Returns false on error.
+    bool Encode(const unsigned char *data, size_t size);
+
+    // Write out the contents of the output buffer, returns false on error.
+    bool FlushOutput();
+
+    enum { BUF_SIZE = 4096 };
+
+    wxFileOffset m_pos;
+
+    // Bytes not forming a complete triplet which can't be encoded yet.
+    unsigned char m_pending[3];
+    size_t m_pendingLen;
+
+    // Encoded data not written to the parent stream yet.
+    char m_out[BUF_SIZE];
+    size_t m_outLen;
+
+    wxDECLARE_NO_COPY_CLASS(wxBase64EncoderOutputStream);
+};
+
+#endif // wxUSE_BASE64 && wxUSE_STREAMS
+
+#endif // _WX_BASE64STREAM_H_
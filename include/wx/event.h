@@ -36,6 +36,11 @@
 #include "wx/meta/convertible.h"
 #include "wx/meta/removeref.h"
 
+#include <atomic>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
 // This is now always defined, but keep it for backwards compatibility.
 #define wxHAS_CALL_AFTER
 
@@ -74,6 +79,7 @@ class WXDLLIMPEXP_FWD_BASE wxEventFilter;
 
 class WXDLLIMPEXP_FWD_BASE wxMSVC_FWD_MULTIPLE_BASES wxEvtHandler;
 class wxEventConnectionRef;
+class wxCoalescedEvents;
 
 // ----------------------------------------------------------------------------
 // Event types
@@ -969,6 +975,25 @@ enum wxEventCategory
         wxEVT_CATEGORY_CLIPBOARD
 };
 
+// ----------------------------------------------------------------------------
+// wxEventPool: allocator used for the events created on the heap
+// ----------------------------------------------------------------------------
+
+// Events are allocated on the heap mostly when they're queued, often from the
+// worker threads and at high rate, so instead of using the global heap for
+// them, their memory is reused: the freed blocks are kept in per-thread free
+// lists, one for each size class, with the excess moved in batches to the
+// global depot from which the other threads can take them.
+//
+// This class is used by wxEvent operator new and delete and is not supposed
+// to be used directly.
+class WXDLLIMPEXP_BASE wxEventPool
+{
+public:
+    static void* Allocate(size_t size);
+    static void Free(void* p);
+};
+
 /*
  * wxWidgets events, covering all interesting things that might happen
  * (button clicking, resizing, setting text in widgets, etc.).
@@ -1098,6 +1123,35 @@ public:
         m_handlerToProcessOnlyIn = nullptr;
     }
 
+    // Allocate the events created on the heap, and notably their clones, from
+    // the pool.
+#ifdef WXDEBUG_NEW
+    #undef new
+#endif
+
+    static void* operator new(size_t size)
+        { return wxEventPool::Allocate(size); }
+    static void operator delete(void* p)
+        { wxEventPool::Free(p); }
+
+    // Placement new must still be usable with the events.
+    static void* operator new(size_t WXUNUSED(size), void* place) noexcept
+        { return place; }
+    static void operator delete(void* WXUNUSED(p), void* WXUNUSED(place)) noexcept
+        { }
+
+#ifdef __VISUALC__
+    // This is used by MSVC debug CRT, see wx/msw/msvcrt.h.
+    static void* operator new(size_t size, int, const char*, int)
+        { return wxEventPool::Allocate(size); }
+    static void operator delete(void* p, int, const char*, int)
+        { wxEventPool::Free(p); }
+#endif // __VISUALC__
+
+#ifdef WXDEBUG_NEW
+    #define new WXDEBUG_NEW
+#endif
+
 protected:
     wxObject*         m_eventObject;
     wxEventType       m_eventType;
@@ -1146,6 +1200,13 @@ private:
     // and this one needs to access our m_handlerToProcessOnlyIn
     friend class WXDLLIMPEXP_FWD_BASE wxEventProcessInHandlerOnly;
 
+    // and this one uses m_nextPending for linking the queued events together
+    friend class WXDLLIMPEXP_FWD_BASE wxEvtHandler;
+
+    // The next event in the queue of the pending events of wxEvtHandler, this
+    // is only used while the event is queued and is not copied.
+    wxEvent*          m_nextPending;
+
 
     wxDECLARE_ABSTRACT_CLASS(wxEvent);
 };
@@ -1270,6 +1331,8 @@ public:
     {
     }
 
+    wxEventBasicPayloadMixin(wxEventBasicPayloadMixin&&) = default;
+
     void SetString(const wxString& s) { m_cmdString = s; }
     const wxString& GetString() const { return m_cmdString; }
 
@@ -1293,6 +1356,8 @@ class WXDLLIMPEXP_BASE wxEventAnyPayloadMixin : public wxEventBasicPayloadMixin
 {
 public:
     wxEventAnyPayloadMixin() : wxEventBasicPayloadMixin() {}
+    wxEventAnyPayloadMixin(const wxEventAnyPayloadMixin&) = default;
+    wxEventAnyPayloadMixin(wxEventAnyPayloadMixin&&) = default;
 
 #if wxUSE_ANY
     template<typename T>
@@ -1387,6 +1452,15 @@ public:
         SetString(GetString().Clone());
     }
 
+    // Moving the event doesn't copy its string nor its payload, so it is
+    // cheaper than copying it and is still safe to do, as the moved string
+    // is not shared with any other wxString.
+    wxThreadEvent(wxThreadEvent&& event)
+        : wxEvent(event),
+          wxEventAnyPayloadMixin(std::move(event))
+    {
+    }
+
     wxNODISCARD virtual wxEvent *Clone() const override
     {
         return new wxThreadEvent(*this);
@@ -1568,6 +1642,12 @@ public:
     {
     }
 
+    wxAsyncMethodCallEventFunctor(wxObject *object, FunctorType&& fn)
+        : wxAsyncMethodCallEvent(object),
+          m_fn(std::move(fn))
+    {
+    }
+
     wxAsyncMethodCallEventFunctor(const wxAsyncMethodCallEventFunctor& other)
         : wxAsyncMethodCallEvent(other),
           m_fn(other.m_fn)
@@ -1637,6 +1717,16 @@ public:
             m_cmdString = event.GetString();
     }
 
+    wxCommandEvent(wxCommandEvent&& event)
+        : wxEvent(event),
+          wxEventBasicPayloadMixin(std::move(event)),
+          m_clientData(event.m_clientData),
+          m_clientObject(event.m_clientObject)
+    {
+        if ( m_cmdString.empty() )
+            m_cmdString = event.GetString();
+    }
+
     // Set/Get client data from controls
     void SetClientData(void* clientData) { m_clientData = clientData; }
     void *GetClientData() const { return m_clientData; }
@@ -3825,6 +3915,12 @@ public:
     // buffer as other wxString objects in this thread.
     virtual void QueueEvent(wxEvent *event);
 
+    // Schedule the given event to be processed later, like QueueEvent(), but
+    // if an event of the same type queued with the same key is still pending,
+    // replace it with this one instead of queuing another event: this allows
+    // to avoid accumulating the events faster than they can be processed.
+    void QueueCoalescedEvent(wxEvent *event, wxIntPtr key = 0);
+
     // Add an event to be processed later: notice that this function is not
     // safe to call from threads other than main, use QueueEvent()
     virtual void AddPendingEvent(const wxEvent& event)
@@ -3898,10 +3994,56 @@ public:
         );
     }
 
+    // The functor is moved, rather than copied, if possible.
     template <typename T>
-    void CallAfter(const T& fn)
+    void CallAfter(T&& fn)
     {
-        QueueEvent(new wxAsyncMethodCallEventFunctor<T>(this, fn));
+        typedef typename std::decay<T>::type FunctorType;
+
+        QueueEvent(new wxAsyncMethodCallEventFunctor<FunctorType>(
+                        this, std::forward<T>(fn)));
+    }
+
+    // Versions of CallAfter() replacing the call scheduled with the same key
+    // by a previous call to them, if it hasn't been executed yet, so that only
+    // the latest call is executed.
+    template <typename T>
+    void CallAfterCoalesced(wxIntPtr key, void (T::*method)())
+    {
+        QueueCoalescedEvent(
+            new wxAsyncMethodCallEvent0<T>(static_cast<T*>(this), method),
+            key
+        );
+    }
+
+    template <typename T, typename T1, typename P1>
+    void CallAfterCoalesced(wxIntPtr key, void (T::*method)(T1 x1), P1 x1)
+    {
+        QueueCoalescedEvent(
+            new wxAsyncMethodCallEvent1<T, T1>(
+                static_cast<T*>(this), method, x1),
+            key
+        );
+    }
+
+    template <typename T, typename T1, typename T2, typename P1, typename P2>
+    void CallAfterCoalesced(wxIntPtr key,
+                            void (T::*method)(T1 x1, T2 x2), P1 x1, P2 x2)
+    {
+        QueueCoalescedEvent(
+            new wxAsyncMethodCallEvent2<T, T1, T2>(
+                static_cast<T*>(this), method, x1, x2),
+            key
+        );
+    }
+
+    template <typename T>
+    void CallAfterCoalesced(wxIntPtr key, T&& fn)
+    {
+        typedef typename std::decay<T>::type FunctorType;
+
+        QueueCoalescedEvent(new wxAsyncMethodCallEventFunctor<FunctorType>(
+                                this, std::forward<T>(fn)), key);
     }
 
 
@@ -4155,18 +4297,64 @@ protected:
 
     struct DynamicEvents
     {
+        // all entries in the order in which they were bound, with the unbound
+        // entries replaced by nulls until they're pruned
         wxVector<wxDynamicEventTableEntry*> m_entries;
+
+        // the indices of the entries in m_entries for each event type, only
+        // used if there are enough entries for it to be worth it and valid if
+        // m_indexed is true
+        std::unordered_map<wxEventType, wxVector<size_t>> m_index;
+        bool m_indexed = false;
+
+        // the number of null (unbound) entries in m_entries
+        size_t m_numUnbound = 0;
+
         wxRecursionGuardFlag m_flag = 0;
+
+        // add the entry to m_entries, updating the index if necessary
+        void Add(wxDynamicEventTableEntry* entry);
+
+        // replace the entry at the given position with null
+        void Unbind(size_t n);
+
+        // build the index if it's not built yet and return true, or return
+        // false if there are too few entries to use the index
+        bool UpdateIndex();
+
+        // remove the null entries from m_entries
+        void Prune();
     };
     // use wxSharedPtr so that SearchDynamicEventTable() can use another
     // instance of wxSharedPtr to extend the life of the wxRecursionGuardFlag
     // to outlive wxRecursionGuard
     wxSharedPtr<DynamicEvents> m_dynamicEvents;
 
-    wxList*             m_pendingEvents;
+    // The events queued by QueueEvent() are pushed, without locking, on this
+    // stack which is linked by wxEvent::m_nextPending and contains the most
+    // recently queued event at its top. ProcessPendingEvents() takes all the
+    // events from it at once and moves them, in FIFO order, to the list below.
+    std::atomic<wxEvent*> m_pendingEventsIncoming;
+
+    // The pending events in the order in which they need to be processed,
+    // only used by the thread processing them.
+    wxEvent*            m_pendingEventsHead;
+    wxEvent*            m_pendingEventsTail;
+
+    // True if this handler is in one of wxApp lists of the handlers with the
+    // pending events (or is being added to it), only the thread changing this
+    // flag from false to true adds the handler to the list.
+    std::atomic<bool>   m_hasPendingEvents;
+
+    // The next handler in wxApp stack of the handlers with new pending events.
+    wxEvtHandler*       m_nextWithPendingEvents;
+
+    // The latest events queued by QueueCoalescedEvent(), allocated on demand.
+    std::atomic<wxCoalescedEvents*> m_coalescedEvents;
 
 #if wxUSE_THREADS
-    // critical section protecting m_pendingEvents
+    // critical section protecting m_pendingEventsHead and m_pendingEventsTail,
+    // notice that it is never locked by the threads queuing the events
     wxCriticalSection m_pendingEventsLock;
 #endif // wxUSE_THREADS
 
@@ -4205,6 +4393,18 @@ private:
     // try to process events in all handlers chained to this one
     bool DoTryChain(wxEvent& event);
 
+    // move the events from m_pendingEventsIncoming to the end of the list of
+    // pending events, must be called with m_pendingEventsLock held
+    void TakeIncomingPendingEvents();
+
+    // return the event to process instead of the given pending one, which is
+    // different from it if it's a placeholder for a coalesced event, must be
+    // called with m_pendingEventsLock held
+    wxEvent* GetEventToProcess(wxEvent* pending);
+
+    // it needs to access m_hasPendingEvents and m_nextWithPendingEvents
+    friend class WXDLLIMPEXP_FWD_BASE wxAppConsoleBase;
+
     // Head of the event filter linked list.
     static wxEventFilter* ms_filterList;
 
@@ -4294,6 +4494,27 @@ inline void wxQueueEvent(wxEvtHandler *dest, wxEvent *event)
     dest->QueueEvent(event);
 }
 
+// Queue an event by moving it to a new heap-allocated object: this avoids
+// copying its string or payload, unlike Clone(). Notice that the static type
+// of the event is used, so it must be the same as its dynamic type.
+template <typename T>
+inline typename std::enable_if<std::is_base_of<wxEvent, T>::value>::type
+wxQueueEvent(wxEvtHandler *dest, T&& event)
+{
+    wxCHECK_RET( dest, "need an object to queue event for" );
+
+    dest->QueueEvent(new T(std::move(event)));
+}
+
+// Queue an event replacing the still pending event queued with the same key.
+inline void wxQueueCoalescedEvent(wxEvtHandler *dest, wxEvent *event,
+                                  wxIntPtr key = 0)
+{
+    wxCHECK_RET( dest, "need an object to queue event for" );
+
+    dest->QueueCoalescedEvent(event, key);
+}
+
 typedef void (wxEvtHandler::*wxEventFunction)(wxEvent&);
 typedef void (wxEvtHandler::*wxIdleEventFunction)(wxIdleEvent&);
 typedef void (wxEvtHandler::*wxThreadEventFunction)(wxThreadEvent&);
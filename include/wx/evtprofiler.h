@@ -0,0 +1,166 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/evtprofiler.h
+// Purpose:     wxEventProfiler class for measuring event dispatch times
+// Author:      wxWidgets team
+// Created:     2026-10-19
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_EVTPROFILER_H_
+#define _WX_EVTPROFILER_H_
+
+#include "wx/event.h"
+
+#include <atomic>
+#include <map>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+// wxEventDispatchStats: statistics about the dispatch times
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_BASE wxEventDispatchStats
+{
+public:
+    // The histogram uses logarithmic buckets: the first one contains the
+    // dispatches taking less than 1us, the bucket N > 0 the ones taking
+    // between 2^(N-1) and 2^N us, and the last one all the longer ones.
+    enum { HISTOGRAM_SIZE = 32 };
+
+    wxEventDispatchStats() = default;
+
+    // Record another dispatch which took the given number of microseconds.
+    void Add(wxUint64 usec);
+
+    // Add all the dispatches recorded in another object to this one.
+    void Merge(const wxEventDispatchStats& other);
+
+    unsigned long GetCount() const { return m_count; }
+    wxUint64 GetTotalTime() const { return m_total; }
+    wxUint64 GetMaxTime() const { return m_max; }
+    double GetAverageTime() const
+    {
+        return m_count ? static_cast<double>(m_total) / m_count : 0.;
+    }
+
+    unsigned long GetHistogramCount(int n) const;
+
+    // Return the upper bound, exclusive, of the times in the given bucket.
+    static wxUint64 GetHistogramLimit(int n);
+
+private:
+    unsigned long m_count = 0;
+    wxUint64 m_total = 0;
+    wxUint64 m_max = 0;
+    unsigned long m_histogram[HISTOGRAM_SIZE] = { 0 };
+};
+
+// ----------------------------------------------------------------------------
+// Records of the problems found by wxEventProfiler
+// ----------------------------------------------------------------------------
+
+// A dispatch of an event to a handler taking longer than the threshold.
+struct wxEventSlowDispatch
+{
+    wxEventType eventType = wxEVT_NULL;
+
+    // The class name of the event handler.
+    wxString handler;
+
+    // The dispatch time in microseconds.
+    wxUint64 duration = 0;
+};
+
+// An event dispatch blocking the main event loop for too long.
+struct wxEventLoopStall
+{
+    wxEventType eventType = wxEVT_NULL;
+
+    // The class name of the event handler the event was sent to.
+    wxString handler;
+
+    // The duration of the stall in milliseconds, which is only the time
+    // elapsed until its detection if it's still ongoing.
+    wxUint64 duration = 0;
+
+    // Main thread stack at the moment when the stall was detected, one frame
+    // per line, or empty if it couldn't be retrieved.
+    wxString stack;
+};
+
+// ----------------------------------------------------------------------------
+// wxEventProfiler: collects statistics about event dispatching
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_BASE wxEventProfiler
+{
+public:
+    // Enable or disable collecting the statistics, this is disabled by default
+    // and doesn't have any noticeable overhead then.
+    static void Enable(bool enable = true);
+    static bool IsEnabled() { return (ms_flags & Flag_Stats) != 0; }
+
+    // Forget all the statistics collected so far.
+    static void Reset();
+
+    // Dispatches of the events to a handler taking longer than this number of
+    // microseconds are remembered and can be retrieved by GetSlowDispatches().
+    static void SetSlowDispatchThreshold(wxUint64 usec);
+    static wxUint64 GetSlowDispatchThreshold();
+
+    // Return the statistics for each event type, measured from the moment it
+    // starts being processed until the end of processing, including all the
+    // handlers and any nested events dispatching.
+    static std::map<wxEventType, wxEventDispatchStats> GetEventTypeStats();
+
+    // Return the statistics for the events processed by each event handler
+    // class, indexed by class name.
+    static std::map<wxString, wxEventDispatchStats> GetHandlerStats();
+
+    // Return the most recent slow dispatches.
+    static std::vector<wxEventSlowDispatch> GetSlowDispatches();
+
+
+    // Start a watchdog thread checking that the main thread doesn't spend
+    // more than the given number of milliseconds processing a single event.
+    // Must be called from the main thread.
+    static bool StartStallDetection(unsigned long thresholdMs);
+    static void StopStallDetection();
+    static bool IsStallDetectionRunning() { return (ms_flags & Flag_Stalls) != 0; }
+
+    // Return all the stalls detected so far.
+    static std::vector<wxEventLoopStall> GetStalls();
+
+    // Set the signal used to retrieve the stack of the main thread when a
+    // stall is detected under Unix, 0 disables retrieving it. This must be
+    // called before starting stall detection to have any effect.
+    static void SetStallStackSignal(int sig);
+    static int GetStallStackSignal();
+
+
+    // Return all the collected data as a JSON object.
+    static wxString DumpAsJSON();
+
+
+    // Implementation only from now on.
+
+    // Return true if either statistics collection or stall detection is on.
+    static bool IsActive() { return ms_flags.load(std::memory_order_relaxed) != 0; }
+
+    // Called when an event loop starts and stops running.
+    static void WXOnMainLoopEnter();
+    static void WXOnMainLoopExit();
+
+private:
+    enum
+    {
+        Flag_Stats  = 1,
+        Flag_Stalls = 2
+    };
+
+    static std::atomic<int> ms_flags;
+
+    wxDECLARE_NO_COPY_CLASS(wxEventProfiler);
+};
+
+#endif // _WX_EVTPROFILER_H_
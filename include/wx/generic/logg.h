@@ -15,6 +15,7 @@
 class WXDLLIMPEXP_FWD_CORE wxTextCtrl;
 class WXDLLIMPEXP_FWD_CORE wxLogFrame;
 class WXDLLIMPEXP_FWD_CORE wxWindow;
+class WXDLLIMPEXP_FWD_CORE wxWindowDestroyEvent;
 
 // ----------------------------------------------------------------------------
 // the following log targets are only compiled in if the we're compiling the
@@ -30,14 +31,60 @@ class WXDLLIMPEXP_CORE wxLogTextCtrl : public wxLog
 public:
     wxLogTextCtrl(wxTextCtrl *pTextCtrl);
 
+    // appends all the pending messages to the control, if it still exists
+    virtual ~wxLogTextCtrl();
+
+    // set the maximal number of lines kept in the control, the oldest ones
+    // are removed when it is exceeded; 0 (default) means no limit
+    void SetMaxLines(int maxLines) { m_maxLines = maxLines; }
+    int GetMaxLines() const { return m_maxLines; }
+
+    // enable or disable collecting the messages and appending all of them
+    // at once when the log is flushed, enabled by default
+    void EnableBatching(bool enable = true);
+
+    // enable or disable not appending the messages while the control is
+    // scrolled away from its end, disabled by default
+    void EnablePauseOnScroll(bool enable = true) { m_pauseOnScroll = enable; }
+
+    // append the pending messages to the control
+    virtual void Flush() override;
+
 protected:
     // implement sink function
     virtual void DoLogText(const wxString& msg) override;
 
 private:
-    // the control we use
+    // append the pending messages unless the output is paused
+    void AppendPending();
+
+    // remove the oldest lines from the pending text if it alone exceeds the
+    // maximal number of lines
+    void TrimPending();
+
+    // remove the oldest lines from the control if there are too many of them
+    void TrimControl();
+
+    // return true if the control is scrolled to the end
+    bool IsScrolledToEnd() const;
+
+    void OnTextCtrlDestroy(wxWindowDestroyEvent& event);
+
+    // the control we use, reset to null when it's destroyed
     wxTextCtrl *m_pTextCtrl;
 
+    // the messages not appended to the control yet and their number of lines
+    wxString m_pending;
+    int m_pendingLines = 0;
+
+    // the time of the last append, used to update the control periodically
+    // even if the log is not flushed
+    wxLongLong_t m_lastAppendMS = 0;
+
+    int m_maxLines = 0;
+    bool m_batching = true;
+    bool m_pauseOnScroll = false;
+
     wxDECLARE_NO_COPY_CLASS(wxLogTextCtrl);
 };
 
@@ -140,6 +187,12 @@ public:
         // always be called unlike OnFrameClose()
     virtual void OnFrameDelete(wxFrame *frame);
 
+    // set the maximal number of lines kept in the window, 0 means no limit
+    void SetMaxLines(int maxLines);
+
+    // update the window with the messages logged since the last flush
+    virtual void Flush() override;
+
 protected:
     virtual void DoLogTextAtLevel(wxLogLevel level, const wxString& msg) override;
 
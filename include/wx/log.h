@@ -57,6 +57,7 @@ class WXDLLIMPEXP_FWD_BASE wxObject;
     #include "wx/thread.h"
 #endif // wxUSE_THREADS
 
+#include <type_traits>
 #include <unordered_map>
 
 // wxUSE_LOG_DEBUG enables the debug log messages
@@ -308,6 +309,162 @@ struct wxLogRecord
     wxLogRecordInfo info;
 };
 
+// ----------------------------------------------------------------------------
+// deferred log record: format string and arguments, formatted only if needed
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_BASE wxLogDeferredRecord
+{
+public:
+    // the maximal number of arguments which can be stored in a record
+    enum { MAX_ARGS = 8 };
+
+    // the kinds of the stored arguments
+    enum ArgType
+    {
+        Arg_Int,        // any signed integer type, including char
+        Arg_UInt,       // any unsigned integer type, including bool
+        Arg_Double,     // float, double or long double
+        Arg_Pointer,    // any pointer other than to a string
+        Arg_String      // narrow or wide C string, wxString or std::string
+    };
+
+    // the format string must have static storage duration, as only the
+    // pointer to it is stored, and must use printf()-like format specifiers
+    // (using '*' for the width or precision is not supported, but positional
+    // arguments are)
+    wxLogDeferredRecord(wxLogLevel level_,
+                        const char *format_,
+                        const wxLogRecordInfo& info_)
+        : level(level_),
+          format(format_),
+          info(info_)
+    {
+    }
+
+    // add the arguments: all of them must be added in the order in which they
+    // appear in the format string
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value &&
+                                std::is_signed<T>::value>::type
+    AddArg(T value)
+    {
+        DoAddArg(Arg_Int).i = value;
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value &&
+                                !std::is_signed<T>::value>::type
+    AddArg(T value)
+    {
+        DoAddArg(Arg_UInt).u = value;
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_enum<T>::value>::type
+    AddArg(T value)
+    {
+        AddArg(static_cast<typename std::underlying_type<T>::type>(value));
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_floating_point<T>::value>::type
+    AddArg(T value)
+    {
+        DoAddArg(Arg_Double).d = static_cast<double>(value);
+    }
+
+    template <typename T>
+    void AddArg(const T *ptr)
+    {
+        DoAddArg(Arg_Pointer).p = wxPtrToUInt(ptr);
+    }
+
+    void AddArg(const char *s);
+    void AddArg(const wchar_t *s);
+    void AddArg(const wxString& s);
+    void AddArg(const wxCStrData& s) { AddArg(s.AsString()); }
+    void AddArg(const wxUniChar& ch) { AddArg(ch.GetValue()); }
+    void AddArg(const wxUniCharRef& ch) { AddArg(ch.GetValue()); }
+    void AddArg(const std::string& s);
+    void AddArg(const std::wstring& s) { AddArg(wxString(s)); }
+
+    // these non-const overloads are needed to take precedence over the
+    // template overload for the pointers above
+    void AddArg(char *s) { AddArg(const_cast<const char*>(s)); }
+    void AddArg(wchar_t *s) { AddArg(const_cast<const wchar_t*>(s)); }
+
+    template <typename... Targs>
+    void AddArgs(const Targs&... args)
+    {
+        static_assert(sizeof...(Targs) <= MAX_ARGS,
+                      "too many arguments for a deferred log record");
+
+        const int dummy[] = { 0, (AddArg(args), 0)... };
+        wxUnusedVar(dummy);
+    }
+
+
+    // access the stored arguments
+    size_t GetArgCount() const { return m_numArgs; }
+    ArgType GetArgType(size_t n) const { return m_args[n].type; }
+
+    wxLongLong_t GetIntArg(size_t n) const { return m_args[n].i; }
+    wxULongLong_t GetUIntArg(size_t n) const { return m_args[n].u; }
+    double GetDoubleArg(size_t n) const { return m_args[n].d; }
+    wxUIntPtr GetPointerArg(size_t n) const { return m_args[n].p; }
+    wxString GetStringArg(size_t n) const
+    {
+        return m_strings.substr(m_args[n].str.start, m_args[n].str.len);
+    }
+
+
+    // format the message using the format string and the stored arguments
+    wxString Format() const;
+
+
+    wxLogLevel level;
+    const char *format;
+    wxLogRecordInfo info;
+
+private:
+    struct StringPos
+    {
+        wxUint32 start;
+        wxUint32 len;
+    };
+
+    struct Arg
+    {
+        ArgType type;
+        union
+        {
+            wxLongLong_t i;
+            wxULongLong_t u;
+            double d;
+            wxUIntPtr p;
+
+            // position of the string in m_strings
+            StringPos str;
+        };
+    };
+
+    Arg& DoAddArg(ArgType type)
+    {
+        wxASSERT_MSG( m_numArgs < MAX_ARGS, "too many arguments" );
+
+        Arg& arg = m_args[m_numArgs++];
+        arg.type = type;
+        return arg;
+    }
+
+    Arg m_args[MAX_ARGS];
+    unsigned m_numArgs = 0;
+
+    // all the string arguments concatenated together
+    wxString m_strings;
+};
+
 // ----------------------------------------------------------------------------
 // Derive from this class to customize format of log messages.
 // ----------------------------------------------------------------------------
@@ -413,6 +570,24 @@ public:
     // parent component and to the default global log level if necessary
     static wxLogLevel GetComponentLevel(const wxString& component);
 
+    // limit the number of messages logged from each location in this
+    // component (or from the component itself for the messages without
+    // location) to the given number per second on average, allowing bursts of
+    // up to the given number of messages (by default, the rate rounded up);
+    // use 0 rate to remove the limit and empty component to set the default
+    // limit for all the components without their own one
+    static void SetComponentRateLimit(const wxString& component,
+                                      double messagesPerSecond,
+                                      unsigned burst = 0);
+
+    // log only the given fraction, between 0 and 1, of randomly chosen
+    // messages from this component (which may be empty as above)
+    static void SetComponentSampling(const wxString& component, double ratio);
+
+    // set the minimal interval between the messages giving the number of
+    // messages suppressed due to rate limiting or sampling, 10s by default
+    static void SetSuppressedSummaryInterval(int milliseconds);
+
 
     // is logging of messages from this component enabled at this level?
     //
@@ -558,6 +733,13 @@ public:
         DoLogText(msg);
     }
 
+    // this one should be called from DoLogDeferredRecord() implementations
+    // passing the record to another log target
+    void LogDeferredRecord(const wxLogDeferredRecord& rec)
+    {
+        DoLogDeferredRecord(rec);
+    }
+
     // this is a helper used by wxLogXXX() functions, don't call it directly
     // and see DoLog() for function to overload in the derived classes
     static void OnLog(wxLogLevel level,
@@ -575,6 +757,10 @@ public:
         OnLog(level, msg, time(nullptr));
     }
 
+    // this is a helper used by wxLogXXXDeferred() functions, don't call it
+    // directly and see DoLogDeferredRecord() for function to overload
+    static void OnLogDeferred(const wxLogDeferredRecord& rec);
+
 
     // this method exists for backwards compatibility only, don't use
     bool HasPendingMessages() const { return true; }
@@ -602,6 +788,12 @@ protected:
     // this one as the default implementation of it simply asserts
     virtual void DoLogText(const wxString& msg);
 
+    // override this method to handle the records logged by the deferred
+    // logging functions without formatting them (e.g. to format them later or
+    // to save them in binary form), the default implementation formats the
+    // message and logs it as any other one, i.e. passes it to DoLogRecord()
+    virtual void DoLogDeferredRecord(const wxLogDeferredRecord& rec);
+
     // log a message indicating the number of times the previous message was
     // repeated if previous repetition counter is strictly positive, does
     // nothing otherwise; return the old value of repetition counter
@@ -619,6 +811,21 @@ private:
     static bool EnableThreadLogging(bool enable = true);
 #endif // wxUSE_THREADS
 
+    // called by OnLog() after checking the rate limits to either log the
+    // message immediately or to buffer it if called from a background thread
+    static void DoOnLog(wxLogLevel level,
+                        const wxString& msg,
+                        const wxLogRecordInfo& info);
+
+    // log the message with the number of the suppressed messages
+    static void LogSuppressed(wxLogLevel level,
+                              unsigned count,
+                              const wxLogRecordInfo& info);
+
+    // called from FlushActive() to log the number of messages suppressed
+    // since the last time for all locations
+    static void LogPendingSuppressed();
+
     // get the active log target for the main thread, auto-creating it if
     // necessary
     //
@@ -633,6 +840,9 @@ private:
                       const wxString& msg,
                       const wxLogRecordInfo& info);
 
+    // same as CallDoLogNow() but for the deferred records
+    void CallDoLogDeferredNow(const wxLogDeferredRecord& rec);
+
 
     // variables
     // ----------------
@@ -1092,8 +1302,59 @@ public:
         DoCallOnLog(s);
     }
 
+
+    // deferred versions of the functions above: they don't format the message
+    // but only store the format string, which must be a string literal, and
+    // the arguments in wxLogDeferredRecord, so that the message is only
+    // formatted later, and only if really necessary
+    template <size_t N, typename... Targs>
+    void LogDeferred(const char (&format)[N], const Targs&... args)
+    {
+        DoCallOnLogDeferred(m_level, format, args...);
+    }
+
+    template <size_t N, typename... Targs>
+    void LogAtLevelDeferred(wxLogLevel level,
+                            const char (&format)[N],
+                            const Targs&... args)
+    {
+        if ( !wxLog::IsLevelEnabled(level, wxASCII_STR(m_info.component)) )
+            return;
+
+        DoCallOnLogDeferred(level, format, args...);
+    }
+
+    template <size_t N, typename... Targs>
+    void LogTraceDeferred(const wxString& mask,
+                          const char (&format)[N],
+                          const Targs&... args)
+    {
+        if ( !wxLog::IsAllowedTraceMask(mask) )
+            return;
+
+        Store(wxLOG_KEY_TRACE_MASK, mask);
+
+        DoCallOnLogDeferred(m_level, format, args...);
+    }
+
+    // only the pointer to the format string is stored, so prevent passing
+    // non-const arrays, e.g. local buffers, which would be already destroyed
+    // when the message is formatted, to the functions above
+    template <size_t N, typename... Targs>
+    void LogDeferred(char (&format)[N], const Targs&... args) = delete;
+
+    template <size_t N, typename... Targs>
+    void LogAtLevelDeferred(wxLogLevel level,
+                            char (&format)[N],
+                            const Targs&... args) = delete;
+
+    template <size_t N, typename... Targs>
+    void LogTraceDeferred(const wxString& mask,
+                          char (&format)[N],
+                          const Targs&... args) = delete;
+
 private:
-    void DoCallOnLog(wxLogLevel level, const wxString& msg)
+    void SetTimestamp()
     {
         // As explained in wxLogRecordInfo ctor, we don't initialize its
         // timestamp to avoid calling time() unnecessary, but now that we are
@@ -1103,10 +1364,28 @@ private:
 #if WXWIN_COMPATIBILITY_3_0
         m_info.timestamp = m_info.timestampMS / 1000;
 #endif // WXWIN_COMPATIBILITY_3_0
+    }
+
+    void DoCallOnLog(wxLogLevel level, const wxString& msg)
+    {
+        SetTimestamp();
 
         wxLog::OnLog(level, msg, m_info);
     }
 
+    template <typename... Targs>
+    void DoCallOnLogDeferred(wxLogLevel level,
+                             const char *format,
+                             const Targs&... args)
+    {
+        SetTimestamp();
+
+        wxLogDeferredRecord rec(level, format, m_info);
+        rec.AddArgs(args...);
+
+        wxLog::OnLogDeferred(rec);
+    }
+
     void DoCallOnLog(const wxString& msg)
     {
         DoCallOnLog(m_level, msg);
@@ -1234,6 +1513,10 @@ WXDLLIMPEXP_BASE wxString wxSysErrorMsgStr(unsigned long nErrCode = 0);
 // notice that because of this, arguments of wxLogGeneric() are currently
 // always evaluated, unlike for the other log functions
 #define wxLogGeneric wxMAKE_LOGGER(Max).LogAtLevel
+
+// deferred version of wxLogGeneric(): the message is only formatted when it
+// is really output, if at all, and not when this function is called
+#define wxLogGenericDeferred wxMAKE_LOGGER(Max).LogAtLevelDeferred
 #define wxVLogGeneric(level, format, argptr) \
     wxDO_IF(wxLOG_IS_ENABLED(level))                                          \
     wxDO_LOGV(level, format, argptr)
@@ -1311,6 +1594,10 @@ wxDEFINE_EMPTY_LOG_FUNCTION(Verbose);
 
 wxDEFINE_EMPTY_LOG_FUNCTION2(Generic, wxLogLevel);
 
+template <typename... Targs>
+void wxLogGenericDeferred(wxLogLevel WXUNUSED(level),
+                          const char* WXUNUSED(format), Targs...) { }
+
 #if wxUSE_GUI
     wxDEFINE_EMPTY_LOG_FUNCTION(Status);
     wxDEFINE_EMPTY_LOG_FUNCTION2(Status, wxFrame *);
@@ -1360,9 +1647,12 @@ inline void wxLogNop() { }
 #if wxUSE_LOG_TRACE
     #define wxLogTrace wxDO_LOG_IF_ENABLED_WITH_FUNC(Trace, LogTrace)
     #define wxVLogTrace wxDO_LOG_IF_ENABLED_WITH_FUNC(Trace, LogVTrace)
+    #define wxLogTraceDeferred \
+        wxDO_LOG_IF_ENABLED_WITH_FUNC(Trace, LogTraceDeferred)
 #else  // !wxUSE_LOG_TRACE
     #define wxVLogTrace(mask, fmt, valist) wxLogNop()
     #define wxLogTrace(mask, fmt, ...) wxLogNop()
+    #define wxLogTraceDeferred(mask, fmt, ...) wxLogNop()
 #endif // wxUSE_LOG_TRACE/!wxUSE_LOG_TRACE
 
 // wxLogFatalError helper: show the (fatal) error to the user in a safe way,
@@ -0,0 +1,99 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/logasync.h
+// Purpose:     wxLogAsync: log target writing messages in a background thread
+// Author:      wxWidgets team
+// Created:     2026-10-19
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_LOGASYNC_H_
+#define _WX_LOGASYNC_H_
+
+#include "wx/log.h"
+
+#if wxUSE_LOG && wxUSE_THREADS
+
+class wxLogAsyncWriter;
+
+// what to do when a message is logged while the queue is full
+enum wxLogAsyncOverflowPolicy
+{
+    wxLOG_ASYNC_BLOCK,          // wait until there is space in the queue
+    wxLOG_ASYNC_DROP,           // discard the new message
+    wxLOG_ASYNC_DROP_OLDEST     // discard the oldest message in the queue
+};
+
+// ----------------------------------------------------------------------------
+// wxLogAsync: passes all messages to another log target from a separate thread
+//
+// Logging to this target only queues the message, while formatting it and
+// writing it out is done by the dedicated writer thread, so that logging
+// never blocks the calling thread on I/O.
+//
+// The wrapped log target is owned by this object and must be MT-safe in the
+// sense that it must be possible to use it from a thread other than the main
+// one, so GUI log targets can't be used with it.
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_BASE wxLogAsync : public wxLog
+{
+public:
+    // the queue can contain up to the given number of messages, rounded up to
+    // the next power of 2
+    explicit wxLogAsync(wxLog *logger,
+                        size_t capacity = 4096,
+                        wxLogAsyncOverflowPolicy policy = wxLOG_ASYNC_BLOCK);
+
+    // writes all the messages still in the queue and deletes the wrapped log
+    // target
+    virtual ~wxLogAsync();
+
+    // get the wrapped log target
+    wxLog *GetLog() const;
+
+    // change the overflow policy, can be done at any time
+    void SetOverflowPolicy(wxLogAsyncOverflowPolicy policy);
+    wxLogAsyncOverflowPolicy GetOverflowPolicy() const;
+
+    // get the total number of messages dropped because the queue was full
+    wxUint64 GetDroppedCount() const;
+
+    // ask the writer thread to flush the wrapped log target once it writes
+    // all the messages logged so far, but don't wait for it
+    virtual void Flush() override;
+
+    // wait until all the messages logged so far are written and the wrapped
+    // log target is flushed or the timeout (in milliseconds, if positive)
+    // expires, return false in the latter case
+    bool FlushAndWait(long timeout = -1);
+
+protected:
+    virtual void DoLogRecord(wxLogLevel level,
+                             const wxString& msg,
+                             const wxLogRecordInfo& info) override;
+
+    // the deferred records are formatted in the writer thread
+    virtual void DoLogDeferredRecord(const wxLogDeferredRecord& rec) override;
+
+private:
+    // called by wxLog::OnLog() before terminating the program because of a
+    // fatal error: this writes the message to all the existing wxLogAsync
+    // objects and waits (for a reasonable time) until they are flushed
+    static void OnFatalError(const wxString& msg, const wxLogRecordInfo& info);
+
+    // stop the writer threads of all the existing objects, after this the
+    // messages are written synchronously, this is called during the library
+    // shutdown
+    static void StopAllWriters();
+
+    wxLogAsyncWriter *m_writer;
+
+    friend class wxLog;
+    friend class wxLogAsyncModule;
+
+    wxDECLARE_NO_COPY_CLASS(wxLogAsync);
+};
+
+#endif // wxUSE_LOG && wxUSE_THREADS
+
+#endif // _WX_LOGASYNC_H_
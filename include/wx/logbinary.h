@@ -0,0 +1,158 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/logbinary.h
+// Purpose:     wxLogBinaryFile and wxLogBinaryReader: compact binary log files
+// Author:      wxWidgets team
+// Created:     2026-10-19
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_LOGBINARY_H_
+#define _WX_LOGBINARY_H_
+
+#include "wx/log.h"
+
+#if wxUSE_LOG && wxUSE_FFILE
+
+#include "wx/ffile.h"
+#include "wx/thread.h"
+
+#include <deque>
+#include <string>
+#include <unordered_map>
+
+// ----------------------------------------------------------------------------
+// wxLogBinaryFile: log target writing the records to a compact binary file
+//
+// The records logged using the deferred logging functions, such as
+// wxLogTraceDeferred(), are written without formatting them: only their
+// arguments are stored, while the format strings, as well as the source file
+// and function names, are written only once. The other messages are written
+// as is. The file can be read by wxLogBinaryReader, e.g. using the logdecode
+// utility.
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_BASE wxLogBinaryFile : public wxLog
+{
+public:
+    // default ctor doesn't open any file, Open() must be called later
+    wxLogBinaryFile() = default;
+
+    // create the file, overwriting it if it already exists, use IsOk() to
+    // check if this succeeded
+    explicit wxLogBinaryFile(const wxString& filename) { Open(filename); }
+
+    // writes all the buffered data and closes the file
+    virtual ~wxLogBinaryFile();
+
+    // create the file, closing the previously opened one, if any
+    bool Open(const wxString& filename);
+
+    // check if the file is opened and no write errors occurred
+    bool IsOk() const { return m_file.IsOpened() && !m_error; }
+
+    // write all the buffered data and close the file
+    bool Close();
+
+    // write all the buffered data to the file
+    virtual void Flush() override;
+
+protected:
+    virtual void DoLogRecord(wxLogLevel level,
+                             const wxString& msg,
+                             const wxLogRecordInfo& info) override;
+
+    virtual void DoLogDeferredRecord(const wxLogDeferredRecord& rec) override;
+
+private:
+    // get the identifier of the given static string, writing its definition
+    // to the buffer if it's used for the first time, returns 0 for null
+    wxUint32 GetStringId(const char *s);
+
+    // write the record, the format may be null for already formatted records
+    // in which case the message must be provided
+    void WriteRecord(wxLogLevel level,
+                     const char *format,
+                     const wxLogRecordInfo& info,
+                     const wxLogDeferredRecord *rec,
+                     const wxString& msg = wxString());
+
+    // write the buffer contents to the file, must be called with m_cs locked
+    void DoFlush();
+
+    wxFFile m_file;
+
+    // the data not written to the file yet
+    std::string m_buffer;
+
+    // the identifiers of the strings already written to the file
+    std::unordered_map<const char*, wxUint32> m_stringIds;
+
+    // the time stamp of the last record, the next one is stored as a delta
+    wxLongLong_t m_lastTimestamp = 0;
+
+    bool m_error = false;
+
+    // protects all the fields above, as this target may be used from several
+    // threads simultaneously
+    wxCRIT_SECT_DECLARE_MEMBER(m_cs);
+
+    wxDECLARE_NO_COPY_CLASS(wxLogBinaryFile);
+};
+
+// ----------------------------------------------------------------------------
+// wxLogBinaryReader: reads and formats the records from a binary log file
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_BASE wxLogBinaryReader
+{
+public:
+    // open the file created by wxLogBinaryFile, use IsOk() to check if this
+    // succeeded and the file is in the supported format
+    explicit wxLogBinaryReader(const wxString& filename);
+
+    bool IsOk() const { return m_file.IsOpened() && !m_error; }
+
+    // read the next record and format its message, return false at the end
+    // of the file or if an error occurred, use HasError() to distinguish
+    // between these cases
+    //
+    // the string pointers in the info (file, function and component names)
+    // remain valid for the lifetime of this object
+    bool ReadRecord(wxLogLevel& level, wxString& msg, wxLogRecordInfo& info);
+
+    // return true if the file is invalid or truncated
+    bool HasError() const { return m_error; }
+
+private:
+    // low level helpers, all of them set m_error and return false on error
+    bool ReadByte(unsigned char& b);
+    bool ReadVarUInt(wxULongLong_t& value);
+    bool ReadString(wxString& s);
+    bool ReadStringDef();
+
+    // check that the file contains at least the given number of bytes after
+    // the current position, this is used before allocating memory for them
+    bool CheckRemaining(wxULongLong_t len);
+
+    // get the string with the given identifier, returns false if it's invalid
+    bool GetString(wxULongLong_t id, const char*& s);
+
+    wxFFile m_file;
+
+    // the length of the file when it was last checked
+    wxFileOffset m_length = 0;
+
+    // all the strings defined in the file so far, deque is used to keep
+    // the pointers to them valid when adding more strings
+    std::deque<std::string> m_strings;
+
+    wxLongLong_t m_lastTimestamp = 0;
+
+    bool m_error = false;
+
+    wxDECLARE_NO_COPY_CLASS(wxLogBinaryReader);
+};
+
+#endif // wxUSE_LOG && wxUSE_FFILE
+
+#endif // _WX_LOGBINARY_H_
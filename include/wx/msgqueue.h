@@ -21,8 +21,13 @@
 #include "wx/stopwatch.h"
 
 #include "wx/beforestd.h"
+#include <atomic>
+#include <memory>
+#include <new>
 #include <queue>
+#include <type_traits>
 #include <utility>
+#include <vector>
 #include "wx/afterstd.h"
 
 enum wxMessageQueueError
@@ -180,6 +185,551 @@ private:
     std::queue<T>   m_messages;
 };
 
+// ---------------------------------------------------------------------------
+// Bounded lock-free message queues
+// ---------------------------------------------------------------------------
+
+// The kinds of wxBoundedMessageQueue: the queue supporting only a single
+// producer and a single consumer thread is cheaper than the general one.
+enum wxBoundedQueueKind
+{
+    wxQUEUE_MPMC,   // multiple producers, multiple consumers
+    wxQUEUE_SPSC    // single producer, single consumer
+};
+
+namespace wxPrivate
+{
+
+// Size used for padding the data modified by different threads to avoid
+// false sharing between them.
+const size_t QUEUE_CACHE_LINE_SIZE = 64;
+
+// Return the smallest power of 2 greater or equal to the given capacity.
+inline size_t GetRingCapacity(size_t capacity)
+{
+    size_t n = 2;
+    while ( n < capacity )
+        n <<= 1;
+    return n;
+}
+
+// Raw storage for a single message.
+template <typename T>
+struct RingSlot
+{
+    T* Get() { return reinterpret_cast<T*>(m_data); }
+
+    template <typename U>
+    void Construct(U&& value) { new (m_data) T(std::forward<U>(value)); }
+
+    void MoveTo(T& value)
+    {
+        value = std::move(*Get());
+        Get()->~T();
+    }
+
+    alignas(T) unsigned char m_data[sizeof(T)];
+};
+
+// Ring buffer with multiple producers and consumers using the well-known
+// algorithm with per-slot sequence numbers by Dmitry Vyukov.
+template <typename T>
+class MPMCRing
+{
+public:
+    explicit MPMCRing(size_t capacity)
+        : m_mask(GetRingCapacity(capacity) - 1),
+          m_cells(new Cell[m_mask + 1])
+    {
+        for ( size_t n = 0; n <= m_mask; n++ )
+            m_cells[n].m_seq.store(n, std::memory_order_relaxed);
+
+        m_enqueuePos.store(0, std::memory_order_relaxed);
+        m_dequeuePos.store(0, std::memory_order_relaxed);
+    }
+
+    ~MPMCRing()
+    {
+        T value;
+        while ( TryPop(value) )
+            ;
+    }
+
+    size_t GetCapacity() const { return m_mask + 1; }
+
+    // Notice that the value is only moved from if true is returned.
+    template <typename U>
+    bool TryPush(U&& value)
+    {
+        Cell* cell;
+        size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+        for ( ;; )
+        {
+            cell = &m_cells[pos & m_mask];
+            const size_t seq = cell->m_seq.load(std::memory_order_acquire);
+            const wxIntPtr diff = static_cast<wxIntPtr>(seq - pos);
+            if ( diff == 0 )
+            {
+                if ( m_enqueuePos.compare_exchange_weak
+                                  (
+                                    pos, pos + 1,
+                                    std::memory_order_relaxed
+                                  ) )
+                    break;
+            }
+            else if ( diff < 0 )
+            {
+                // The slot still contains the value not consumed yet.
+                return false;
+            }
+            else
+            {
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->m_slot.Construct(std::forward<U>(value));
+        cell->m_seq.store(pos + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    bool TryPop(T& value)
+    {
+        Cell* cell;
+        size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+        for ( ;; )
+        {
+            cell = &m_cells[pos & m_mask];
+            const size_t seq = cell->m_seq.load(std::memory_order_acquire);
+            const wxIntPtr diff = static_cast<wxIntPtr>(seq - (pos + 1));
+            if ( diff == 0 )
+            {
+                if ( m_dequeuePos.compare_exchange_weak
+                                  (
+                                    pos, pos + 1,
+                                    std::memory_order_relaxed
+                                  ) )
+                    break;
+            }
+            else if ( diff < 0 )
+            {
+                // Nothing was written into this slot yet.
+                return false;
+            }
+            else
+            {
+                pos = m_dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->m_slot.MoveTo(value);
+        cell->m_seq.store(pos + m_mask + 1, std::memory_order_release);
+
+        return true;
+    }
+
+private:
+    struct Cell
+    {
+        std::atomic<size_t> m_seq;
+        RingSlot<T> m_slot;
+    };
+
+    const size_t m_mask;
+    const std::unique_ptr<Cell[]> m_cells;
+
+    char m_pad1[QUEUE_CACHE_LINE_SIZE];
+    std::atomic<size_t> m_enqueuePos;
+    char m_pad2[QUEUE_CACHE_LINE_SIZE];
+    std::atomic<size_t> m_dequeuePos;
+    char m_pad3[QUEUE_CACHE_LINE_SIZE];
+
+    wxDECLARE_NO_COPY_TEMPLATE_CLASS(MPMCRing, T);
+};
+
+// Ring buffer which can only be used by a single producer and a single
+// consumer thread: it doesn't need any atomic read-modify-write operations.
+template <typename T>
+class SPSCRing
+{
+public:
+    explicit SPSCRing(size_t capacity)
+        : m_mask(GetRingCapacity(capacity) - 1),
+          m_slots(new RingSlot<T>[m_mask + 1])
+    {
+        m_head.store(0, std::memory_order_relaxed);
+        m_tail.store(0, std::memory_order_relaxed);
+        m_headCache = 0;
+        m_tailCache = 0;
+    }
+
+    ~SPSCRing()
+    {
+        T value;
+        while ( TryPop(value) )
+            ;
+    }
+
+    size_t GetCapacity() const { return m_mask + 1; }
+
+    template <typename U>
+    bool TryPush(U&& value)
+    {
+        const size_t tail = m_tail.load(std::memory_order_relaxed);
+        if ( tail - m_headCache > m_mask )
+        {
+            // Only access the consumer cache line if the ring seems full.
+            m_headCache = m_head.load(std::memory_order_acquire);
+            if ( tail - m_headCache > m_mask )
+                return false;
+        }
+
+        m_slots[tail & m_mask].Construct(std::forward<U>(value));
+        m_tail.store(tail + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    bool TryPop(T& value)
+    {
+        const size_t head = m_head.load(std::memory_order_relaxed);
+        if ( head == m_tailCache )
+        {
+            m_tailCache = m_tail.load(std::memory_order_acquire);
+            if ( head == m_tailCache )
+                return false;
+        }
+
+        m_slots[head & m_mask].MoveTo(value);
+        m_head.store(head + 1, std::memory_order_release);
+
+        return true;
+    }
+
+private:
+    const size_t m_mask;
+    const std::unique_ptr<RingSlot<T>[]> m_slots;
+
+    // Data used by the producer.
+    char m_pad1[QUEUE_CACHE_LINE_SIZE];
+    std::atomic<size_t> m_tail;
+    size_t m_headCache;
+
+    // Data used by the consumer.
+    char m_pad2[QUEUE_CACHE_LINE_SIZE];
+    std::atomic<size_t> m_head;
+    size_t m_tailCache;
+    char m_pad3[QUEUE_CACHE_LINE_SIZE];
+
+    wxDECLARE_NO_COPY_TEMPLATE_CLASS(SPSCRing, T);
+};
+
+} // namespace wxPrivate
+
+// ---------------------------------------------------------------------------
+// Bounded message queue using a lock-free ring buffer.
+//
+// This class provides the same functionality as wxMessageQueue but doesn't
+// lock any mutex as long as the queue is neither empty nor full, making it
+// much cheaper to use for passing messages between threads at high rate.
+//
+// Contrary to wxMessageQueue, the queue has fixed capacity and Post() blocks
+// when the queue is full until a consumer makes space in it.
+//
+// Messages must be default-constructible and their move ctor and assignment
+// operator shouldn't throw.
+// ---------------------------------------------------------------------------
+template <typename T, wxBoundedQueueKind kind = wxQUEUE_MPMC>
+class wxBoundedMessageQueue
+{
+public:
+    // The type of the messages transported by this queue
+    typedef T Message;
+
+    // Create the queue able to contain at least the given number of messages:
+    // the capacity is rounded up to the next power of 2.
+    explicit wxBoundedMessageQueue(size_t capacity)
+        : m_ring(capacity),
+          m_conditionNotEmpty(m_mutex),
+          m_conditionNotFull(m_mutex)
+    {
+        m_waitingConsumers.store(0, std::memory_order_relaxed);
+        m_waitingProducers.store(0, std::memory_order_relaxed);
+    }
+
+    // Return false only if there was a fatal error in ctor
+    bool IsOk() const
+    {
+        return m_conditionNotEmpty.IsOk() && m_conditionNotFull.IsOk();
+    }
+
+    // Return the maximal number of messages in the queue.
+    size_t GetCapacity() const { return m_ring.GetCapacity(); }
+
+
+    // Add a message to the queue if it's not full and return true or return
+    // false immediately, without modifying the message, if it is.
+    bool TryPost(const Message& msg) { return DoTryPost(msg); }
+    bool TryPost(Message&& msg) { return DoTryPost(std::move(msg)); }
+
+    // Add a message to the queue, waiting until there is space for it.
+    wxMessageQueueError Post(const Message& msg) { return DoPost(msg, -1); }
+    wxMessageQueueError Post(Message&& msg) { return DoPost(std::move(msg), -1); }
+
+    // Same as Post() but waits no more than timeout milliseconds and returns
+    // wxMSGQUEUE_TIMEOUT if the queue remained full during all this time.
+    wxMessageQueueError PostTimeout(long timeout, const Message& msg)
+    {
+        return DoPost(msg, timeout);
+    }
+
+    wxMessageQueueError PostTimeout(long timeout, Message&& msg)
+    {
+        return DoPost(std::move(msg), timeout);
+    }
+
+
+    // Get a message from the queue if it's not empty and return true or
+    // return false immediately if it is.
+    bool TryReceive(Message& msg)
+    {
+        if ( !m_ring.TryPop(msg) )
+            return false;
+
+        NotifyProducers();
+        return true;
+    }
+
+    // Wait until a message becomes available.
+    wxMessageQueueError Receive(Message& msg)
+    {
+        return DoReceive(msg, -1);
+    }
+
+    // Wait no more than timeout milliseconds until a message becomes
+    // available and return wxMSGQUEUE_TIMEOUT if it doesn't.
+    wxMessageQueueError ReceiveTimeout(long timeout, Message& msg)
+    {
+        return DoReceive(msg, timeout);
+    }
+
+    // Append up to maxCount messages currently in the queue to the provided
+    // vector and return their number, which may be 0, without waiting.
+    size_t TryReceiveBatch(std::vector<Message>& msgs, size_t maxCount)
+    {
+        const size_t count = DoReceiveBatch(msgs, maxCount);
+        if ( count )
+            NotifyProducers(count);
+
+        return count;
+    }
+
+    // Wait until at least one message becomes available and then append up
+    // to maxCount messages to the provided vector.
+    wxMessageQueueError ReceiveBatch(std::vector<Message>& msgs, size_t maxCount)
+    {
+        wxCHECK( maxCount, wxMSGQUEUE_MISC_ERROR );
+
+        Message msg;
+        const wxMessageQueueError rc = DoReceive(msg, -1);
+        if ( rc != wxMSGQUEUE_NO_ERROR )
+            return rc;
+
+        msgs.push_back(std::move(msg));
+
+        // DoReceive() has already notified a producer about the first slot.
+        const size_t count = DoReceiveBatch(msgs, maxCount - 1);
+        if ( count )
+            NotifyProducers(count);
+
+        return wxMSGQUEUE_NO_ERROR;
+    }
+
+private:
+    typedef typename std::conditional<kind == wxQUEUE_SPSC,
+                                      wxPrivate::SPSCRing<T>,
+                                      wxPrivate::MPMCRing<T>>::type Ring;
+
+    template <typename U>
+    bool DoTryPost(U&& msg)
+    {
+        if ( !m_ring.TryPush(std::forward<U>(msg)) )
+            return false;
+
+        NotifyConsumers();
+        return true;
+    }
+
+    template <typename U>
+    wxMessageQueueError DoPost(U&& msg, long timeout)
+    {
+        if ( !m_ring.TryPush(std::forward<U>(msg)) )
+        {
+            const wxMessageQueueError rc = WaitUntil
+                (
+                    [&]() { return m_ring.TryPush(std::forward<U>(msg)); },
+                    m_waitingProducers,
+                    m_conditionNotFull,
+                    timeout
+                );
+            if ( rc != wxMSGQUEUE_NO_ERROR )
+                return rc;
+        }
+
+        NotifyConsumers();
+        return wxMSGQUEUE_NO_ERROR;
+    }
+
+    wxMessageQueueError DoReceive(Message& msg, long timeout)
+    {
+        if ( !m_ring.TryPop(msg) )
+        {
+            const wxMessageQueueError rc = WaitUntil
+                (
+                    [&]() { return m_ring.TryPop(msg); },
+                    m_waitingConsumers,
+                    m_conditionNotEmpty,
+                    timeout
+                );
+            if ( rc != wxMSGQUEUE_NO_ERROR )
+                return rc;
+        }
+
+        NotifyProducers();
+        return wxMSGQUEUE_NO_ERROR;
+    }
+
+    size_t DoReceiveBatch(std::vector<Message>& msgs, size_t maxCount)
+    {
+        size_t count = 0;
+        Message msg;
+        while ( count < maxCount && m_ring.TryPop(msg) )
+        {
+            msgs.push_back(std::move(msg));
+            count++;
+        }
+
+        return count;
+    }
+
+    // Slow path used when the queue is full or empty: wait on the condition
+    // until the given operation succeeds or the timeout (if not negative)
+    // expires.
+    //
+    // The waiting threads register themselves in the counter before checking
+    // the queue state for the last time, while the other side checks this
+    // counter after modifying the queue and only locks the mutex if it is
+    // non-zero, so that the notifications are never lost but are not needed
+    // at all in the common case.
+    template <typename F>
+    wxMessageQueueError WaitUntil(const F& tryOp,
+                                  std::atomic<int>& waiting,
+                                  wxCondition& condition,
+                                  long timeout)
+    {
+        wxCHECK( IsOk(), wxMSGQUEUE_MISC_ERROR );
+
+        // Give the other side a chance to run before blocking, this is much
+        // cheaper than going to sleep and being woken up again, unless we're
+        // not supposed to wait at all.
+        for ( int n = 0; timeout != 0 && n < 16; n++ )
+        {
+            wxThread::Yield();
+            if ( tryOp() )
+                return wxMSGQUEUE_NO_ERROR;
+        }
+
+        const wxMilliClock_t waitUntil = wxGetLocalTimeMillis() + timeout;
+
+        wxMutexLocker locker(m_mutex);
+
+        wxCHECK( locker.IsOk(), wxMSGQUEUE_MISC_ERROR );
+
+        waiting++;
+
+        wxMessageQueueError rc = wxMSGQUEUE_NO_ERROR;
+        for ( ;; )
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if ( tryOp() )
+                break;
+
+            wxCondError result;
+            if ( timeout < 0 )
+            {
+                result = condition.Wait();
+            }
+            else
+            {
+                const wxMilliClock_t now = wxGetLocalTimeMillis();
+                if ( now >= waitUntil )
+                {
+                    rc = wxMSGQUEUE_TIMEOUT;
+                    break;
+                }
+
+                result = condition.WaitTimeout((waitUntil - now).ToLong());
+            }
+
+            if ( result != wxCOND_NO_ERROR && result != wxCOND_TIMEOUT )
+            {
+                rc = wxMSGQUEUE_MISC_ERROR;
+                break;
+            }
+        }
+
+        waiting--;
+
+        return rc;
+    }
+
+    // Wake up the threads waiting on the given condition after count slots
+    // became available: a single one if there is just one of them, as the
+    // others wouldn't be able to do anything anyhow, but all of them if more
+    // slots were freed at once.
+    void Notify(const std::atomic<int>& waiting,
+                wxCondition& condition,
+                size_t count)
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if ( waiting.load(std::memory_order_relaxed) )
+        {
+            wxMutexLocker locker(m_mutex);
+            if ( count > 1 )
+                condition.Broadcast();
+            else
+                condition.Signal();
+        }
+    }
+
+    void NotifyConsumers()
+    {
+        Notify(m_waitingConsumers, m_conditionNotEmpty, 1);
+    }
+
+    void NotifyProducers(size_t count = 1)
+    {
+        Notify(m_waitingProducers, m_conditionNotFull, count);
+    }
+
+
+    Ring m_ring;
+
+    std::atomic<int> m_waitingConsumers;
+    std::atomic<int> m_waitingProducers;
+
+    wxMutex     m_mutex;
+    wxCondition m_conditionNotEmpty;
+    wxCondition m_conditionNotFull;
+
+    wxDECLARE_NO_COPY_TEMPLATE_CLASS_2(wxBoundedMessageQueue, T, kind);
+};
+
+// Convenient synonym for the queue used by a single producer and consumer.
+template <typename T>
+using wxSPSCMessageQueue = wxBoundedMessageQueue<T, wxQUEUE_SPSC>;
+
 #endif // wxUSE_THREADS
 
 #endif // _WX_MSGQUEUE_H_
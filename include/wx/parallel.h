@@ -0,0 +1,202 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/parallel.h
+// Purpose:     Parallel loops and algorithms using wxThreadPool
+// Author:      wxWidgets team
+// Created:     2026-10-19
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_PARALLEL_H_
+#define _WX_PARALLEL_H_
+
+#include "wx/defs.h"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+// Global concurrency limit
+// ----------------------------------------------------------------------------
+
+// Set the maximal number of threads, including the calling one, used by the
+// functions in this file. 0 means to use the number of CPUs in the system.
+WXDLLIMPEXP_BASE void wxSetParallelConcurrency(unsigned numThreads);
+
+// Return the maximal number of threads used, always 1 if wxUSE_THREADS==0.
+WXDLLIMPEXP_BASE unsigned wxGetParallelConcurrency();
+
+// ----------------------------------------------------------------------------
+// Implementation helpers
+// ----------------------------------------------------------------------------
+
+namespace wxPrivate
+{
+
+// Return the number of chunks to split the range of the given size into when
+// each chunk must contain at least the given number of elements.
+WXDLLIMPEXP_BASE size_t GetParallelChunkCount(size_t count, size_t grainSize);
+
+// Split [begin, end) into the given number of chunks of (almost) equal sizes
+// and call func(chunkIndex, chunkBegin, chunkEnd) for all of them, possibly
+// concurrently. Any exception thrown by func is rethrown from this function.
+WXDLLIMPEXP_BASE void
+ParallelForChunks(size_t begin,
+                  size_t end,
+                  size_t numChunks,
+                  const std::function<void (size_t, size_t, size_t)>& func);
+
+// Don't sort the ranges smaller than this in parallel.
+const size_t PARALLEL_SORT_MIN_CHUNK = 16384;
+
+// Sort the range by sorting its chunks in parallel using the given function
+// and merging them, also in parallel, using the provided comparator.
+template <typename RandomIt, typename SortChunk, typename Compare>
+void
+ParallelSort(RandomIt first,
+             RandomIt last,
+             const SortChunk& sortChunk,
+             const Compare& comp)
+{
+    const size_t count = static_cast<size_t>(last - first);
+
+    size_t numChunks = std::min<size_t>(count / PARALLEL_SORT_MIN_CHUNK,
+                                        wxGetParallelConcurrency());
+    if ( numChunks <= 1 )
+    {
+        sortChunk(first, last);
+        return;
+    }
+
+    // Use a power of 2 number of chunks to simplify merging them.
+    while ( numChunks & (numChunks - 1) )
+        numChunks &= numChunks - 1;
+
+    std::vector<RandomIt> bounds(numChunks + 1);
+    for ( size_t n = 0; n <= numChunks; n++ )
+        bounds[n] = first + (count / numChunks)*n
+                          + std::min(n, count % numChunks);
+
+    ParallelForChunks(0, numChunks, numChunks,
+        [&](size_t n, size_t, size_t)
+        {
+            sortChunk(bounds[n], bounds[n + 1]);
+        });
+
+    // Merge adjacent chunks, doing all independent merges at each level
+    // concurrently too.
+    for ( size_t width = 1; width < numChunks; width *= 2 )
+    {
+        const size_t numMerges = numChunks / (2*width);
+        ParallelForChunks(0, numMerges, numMerges,
+            [&](size_t n, size_t, size_t)
+            {
+                const size_t start = 2*width*n;
+                std::inplace_merge(bounds[start],
+                                   bounds[start + width],
+                                   bounds[start + 2*width],
+                                   comp);
+            });
+    }
+}
+
+} // namespace wxPrivate
+
+// ----------------------------------------------------------------------------
+// Parallel algorithms
+// ----------------------------------------------------------------------------
+
+// Call func(from, to) for consecutive subranges covering [begin, end), each
+// containing at least grainSize elements, possibly concurrently. If grainSize
+// is 0, the range is split into a few chunks per thread.
+inline void
+wxParallelForRange(size_t begin,
+                   size_t end,
+                   const std::function<void (size_t, size_t)>& func,
+                   size_t grainSize = 0)
+{
+    if ( end <= begin )
+        return;
+
+    wxPrivate::ParallelForChunks
+    (
+        begin, end,
+        wxPrivate::GetParallelChunkCount(end - begin, grainSize),
+        [&func](size_t, size_t from, size_t to) { func(from, to); }
+    );
+}
+
+// Call func(i) for all i in [begin, end), possibly concurrently.
+template <typename Func>
+inline void
+wxParallelFor(size_t begin, size_t end, const Func& func, size_t grainSize = 0)
+{
+    wxParallelForRange(begin, end,
+        [&func](size_t from, size_t to)
+        {
+            for ( size_t i = from; i < to; i++ )
+                func(i);
+        },
+        grainSize);
+}
+
+// Combine func(i) for all i in [begin, end) using the reduce function, which
+// must be associative, and identity as the initial value of each chunk. The
+// partial results are combined in order, so the result doesn't depend on the
+// threads scheduling.
+template <typename T, typename Func, typename Reduce>
+inline T
+wxParallelReduce(size_t begin,
+                 size_t end,
+                 const T& identity,
+                 const Func& func,
+                 const Reduce& reduce,
+                 size_t grainSize = 0)
+{
+    if ( end <= begin )
+        return identity;
+
+    const size_t
+        numChunks = wxPrivate::GetParallelChunkCount(end - begin, grainSize);
+
+    std::vector<T> partial(numChunks, identity);
+    wxPrivate::ParallelForChunks(begin, end, numChunks,
+        [&](size_t n, size_t from, size_t to)
+        {
+            T value = identity;
+            for ( size_t i = from; i < to; i++ )
+                value = reduce(value, func(i));
+
+            partial[n] = value;
+        });
+
+    T result = partial[0];
+    for ( size_t n = 1; n < numChunks; n++ )
+        result = reduce(result, partial[n]);
+
+    return result;
+}
+
+// Sort the range using multiple threads if it's big enough. Notice that,
+// just as std::sort(), this sort is not stable.
+template <typename RandomIt, typename Compare>
+inline void wxParallelSort(RandomIt first, RandomIt last, const Compare& comp)
+{
+    wxPrivate::ParallelSort(first, last,
+        [&comp](RandomIt chunkFirst, RandomIt chunkLast)
+        {
+            std::sort(chunkFirst, chunkLast, comp);
+        },
+        comp);
+}
+
+template <typename RandomIt>
+inline void wxParallelSort(RandomIt first, RandomIt last)
+{
+    typedef typename std::iterator_traits<RandomIt>::value_type ValueType;
+
+    wxParallelSort(first, last, std::less<ValueType>());
+}
+
+#endif // _WX_PARALLEL_H_
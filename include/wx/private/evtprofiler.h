@@ -0,0 +1,90 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/private/evtprofiler.h
+// Purpose:     Helpers used for instrumenting event dispatching
+// Author:      wxWidgets team
+// Created:     2026-10-19
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_PRIVATE_EVTPROFILER_H_
+#define _WX_PRIVATE_EVTPROFILER_H_
+
+#include "wx/evtprofiler.h"
+
+// ----------------------------------------------------------------------------
+// wxEventDispatchRecorder: records the duration of an event dispatch
+// ----------------------------------------------------------------------------
+
+// An object of this class measures the time of the event processing during
+// its lifetime if wxEventProfiler is active and does nothing at all otherwise.
+class wxEventDispatchRecorder
+{
+public:
+    enum Kind
+    {
+        // Don't record anything.
+        Kind_None,
+
+        // Record the processing of the event as a whole, this must be only
+        // done once per event, when it's sent to the first handler.
+        Kind_Event,
+
+        // Record the processing of the event by the given handler only, this
+        // is only recorded if Handled() is called.
+        Kind_Handler
+    };
+
+    wxEventDispatchRecorder(const wxEvent& event,
+                            const wxEvtHandler* handler,
+                            Kind kind)
+    {
+        if ( kind != Kind_None && wxEventProfiler::IsActive() )
+            Start(event, handler, kind);
+    }
+
+    ~wxEventDispatchRecorder()
+    {
+        if ( m_started )
+            Stop();
+    }
+
+    // Mark the event as having been handled, returns true for convenience.
+    bool Handled()
+    {
+        m_handled = true;
+        return true;
+    }
+
+private:
+    void Start(const wxEvent& event, const wxEvtHandler* handler, Kind kind);
+    void Stop();
+
+    // Note that we don't store the handler itself as it may be destroyed while
+    // processing the event.
+    bool m_started = false;
+    wxEventType m_eventType = wxEVT_NULL;
+    const wxClassInfo* m_handlerClass = nullptr;
+    Kind m_kind = Kind_None;
+    wxUint64 m_start = 0;
+    bool m_handled = false;
+    bool m_isMainDispatch = false;
+
+    wxDECLARE_NO_COPY_CLASS(wxEventDispatchRecorder);
+};
+
+// ----------------------------------------------------------------------------
+// wxEventLoopProfilerScope: tells wxEventProfiler when an event loop runs
+// ----------------------------------------------------------------------------
+
+// This is used to avoid detecting a stall when an event handler runs a nested
+// event loop, e.g. by showing a modal dialog.
+class wxEventLoopProfilerScope
+{
+public:
+    wxEventLoopProfilerScope() { wxEventProfiler::WXOnMainLoopEnter(); }
+    ~wxEventLoopProfilerScope() { wxEventProfiler::WXOnMainLoopExit(); }
+
+    wxDECLARE_NO_COPY_CLASS(wxEventLoopProfilerScope);
+};
+
+#endif // _WX_PRIVATE_EVTPROFILER_H_
@@ -20,7 +20,20 @@ enum wxFDIODispatcherEntryFlags
     wxFDIO_INPUT = 1,
     wxFDIO_OUTPUT = 2,
     wxFDIO_EXCEPTION = 4,
-    wxFDIO_ALL = wxFDIO_INPUT | wxFDIO_OUTPUT | wxFDIO_EXCEPTION
+    wxFDIO_ALL = wxFDIO_INPUT | wxFDIO_OUTPUT | wxFDIO_EXCEPTION,
+
+    // the flags below are only used by wxEpollDispatcher and are ignored by
+    // the other dispatchers
+
+    // use edge-triggered notifications: the handler is only notified when the
+    // descriptor state changes, so it must read (or write) everything it can
+    // every time it is called as it won't be called again otherwise
+    wxFDIO_EDGE_TRIGGERED = 8,
+
+    // only wake up one of the dispatchers waiting for events on this
+    // descriptor, this is useful for the listening sockets shared by several
+    // processes
+    wxFDIO_EXCLUSIVE = 16
 };
 
 // base class for wxSelectDispatcher and wxEpollDispatcher
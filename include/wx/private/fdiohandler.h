@@ -32,6 +32,11 @@ public:
     // wxSocketImplUnix currently
     virtual bool IsOk() const { return true; }
 
+    // return the extra flags, such as wxFDIO_EDGE_TRIGGERED or
+    // wxFDIO_EXCLUSIVE, to use when registering this handler for the events
+    // by wxFDIOManager
+    virtual int GetExtraFlags() const { return 0; }
+
 
     // get/set the mask of events for which we're currently registered for:
     // it's a combination of wxFDIO_{INPUT,OUTPUT,EXCEPTION}
@@ -19,6 +19,8 @@
 
 #include "wx/utils.h"       // for wxSignal
 
+class WXDLLIMPEXP_FWD_BASE wxProcessOutputEvent;
+
 // the wxProcess creation flags
 enum
 {
@@ -26,7 +28,28 @@ enum
     wxPROCESS_DEFAULT = 0,
 
     // redirect the IO of the child process
-    wxPROCESS_REDIRECT = 1
+    wxPROCESS_REDIRECT = 1,
+
+    // get the output of the child process as wxEVT_PROCESS_OUTPUT events,
+    // implies wxPROCESS_REDIRECT
+    wxPROCESS_STREAM_OUTPUT = 2
+};
+
+// ----------------------------------------------------------------------------
+// wxProcessOutputReader: implementation detail of wxProcess::StreamOutput()
+// ----------------------------------------------------------------------------
+
+// This object reads the output of the child process and passes it to
+// wxProcess::OnOutput(), it is created by wxExecute() if the output is
+// streamed and is only used by wxProcess itself.
+class wxProcessOutputReader
+{
+public:
+    // stop or resume reading the output
+    virtual void Pause() = 0;
+    virtual void Resume() = 0;
+
+    virtual ~wxProcessOutputReader() = default;
 };
 
 // ----------------------------------------------------------------------------
@@ -73,6 +96,28 @@ public:
     void Redirect() { m_redirect = true; }
     bool IsRedirected() const { return m_redirect; }
 
+    // call this before passing the object to wxExecute() to get the output
+    // of the child process in wxEVT_PROCESS_OUTPUT events as soon as it
+    // becomes available instead of reading it from the streams, the output is
+    // read in chunks of at most the given size
+    //
+    // this also redirects the child process IO, but GetInputStream() and
+    // GetErrorStream() are not available when the output is streamed
+    void StreamOutput(size_t chunkSize = 65536);
+    bool IsOutputStreamed() const { return m_outputChunkSize != 0; }
+    size_t GetOutputChunkSize() const { return m_outputChunkSize; }
+
+    // stop reading the output of the child process until ResumeOutput() is
+    // called: this will block the child once it writes more output than fits
+    // into the pipe buffer
+    void PauseOutput();
+    void ResumeOutput();
+    bool IsOutputPaused() const { return m_outputPaused; }
+
+    // called with each chunk of the streamed output, sends
+    // wxEVT_PROCESS_OUTPUT event by default
+    virtual void OnOutput(const void *data, size_t len, bool isError);
+
     // detach from the parent - should be called by the parent if it's deleted
     // before the process it started terminates
     void Detach();
@@ -124,6 +169,10 @@ public:
     // needs to be public since it needs to be used from wxExecute() global func
     void SetPid(long pid) { m_pid = pid; }
 
+    // the reader is owned by wxExecute() implementation, which must reset it
+    // before destroying it
+    void SetOutputReader(wxProcessOutputReader *reader);
+
 protected:
     void Init(wxEvtHandler *parent, int id, int flags);
 
@@ -143,6 +192,11 @@ protected:
 
     bool m_redirect;
 
+    // the size of the chunks in which the output is streamed or 0 if it isn't
+    size_t m_outputChunkSize;
+    bool m_outputPaused;
+    wxProcessOutputReader *m_outputReader;
+
     wxDECLARE_DYNAMIC_CLASS(wxProcess);
     wxDECLARE_NO_COPY_CLASS(wxProcess);
 };
@@ -154,6 +208,7 @@ protected:
 class WXDLLIMPEXP_FWD_BASE wxProcessEvent;
 
 wxDECLARE_EXPORTED_EVENT( WXDLLIMPEXP_BASE, wxEVT_END_PROCESS, wxProcessEvent );
+wxDECLARE_EXPORTED_EVENT( WXDLLIMPEXP_BASE, wxEVT_PROCESS_OUTPUT, wxProcessOutputEvent );
 
 class WXDLLIMPEXP_BASE wxProcessEvent : public wxEvent
 {
@@ -182,12 +237,72 @@ public:
     wxDECLARE_DYNAMIC_CLASS_NO_ASSIGN_DEF_COPY(wxProcessEvent);
 };
 
+// Event containing a chunk of the child process output, see
+// wxProcess::StreamOutput().
+class WXDLLIMPEXP_BASE wxProcessOutputEvent : public wxEvent
+{
+public:
+    wxProcessOutputEvent(int nId = 0,
+                         int pid = 0,
+                         const void *data = nullptr,
+                         size_t len = 0,
+                         bool isError = false)
+        : wxEvent(nId, wxEVT_PROCESS_OUTPUT),
+          m_pid(pid),
+          m_data(data),
+          m_len(len),
+          m_isError(isError)
+    {
+    }
+
+    // the copy keeps its own copy of the data, as the original pointer is
+    // only valid while the event is being processed
+    wxProcessOutputEvent(const wxProcessOutputEvent& event)
+        : wxEvent(event),
+          m_pid(event.m_pid),
+          m_len(event.m_len),
+          m_isError(event.m_isError)
+    {
+        m_buffer.AppendData(event.m_data, event.m_len);
+        m_data = m_buffer.GetData();
+    }
+
+    // PID of the process which produced the output
+    int GetPid() const { return m_pid; }
+
+    // the output data, only valid during the event handling
+    const void *GetData() const { return m_data; }
+    size_t GetDataLen() const { return m_len; }
+
+    // true if the data comes from the standard error and not output
+    bool IsError() const { return m_isError; }
+
+    wxNODISCARD virtual wxEvent *Clone() const override { return new wxProcessOutputEvent(*this); }
+
+private:
+    int m_pid;
+    const void *m_data;
+    size_t m_len;
+    bool m_isError;
+
+    // only used by the copies
+    wxMemoryBuffer m_buffer;
+
+    wxDECLARE_DYNAMIC_CLASS_NO_ASSIGN(wxProcessOutputEvent);
+};
+
 typedef void (wxEvtHandler::*wxProcessEventFunction)(wxProcessEvent&);
+typedef void (wxEvtHandler::*wxProcessOutputEventFunction)(wxProcessOutputEvent&);
 
 #define wxProcessEventHandler(func) \
     wxEVENT_HANDLER_CAST(wxProcessEventFunction, func)
 
+#define wxProcessOutputEventHandler(func) \
+    wxEVENT_HANDLER_CAST(wxProcessOutputEventFunction, func)
+
 #define EVT_END_PROCESS(id, func) \
    wx__DECLARE_EVT1(wxEVT_END_PROCESS, id, wxProcessEventHandler(func))
+#define EVT_PROCESS_OUTPUT(id, func) \
+   wx__DECLARE_EVT1(wxEVT_PROCESS_OUTPUT, id, wxProcessOutputEventHandler(func))
 
 #endif // _WX_PROCESSH__
@@ -104,6 +104,21 @@ public:
     wxCharBuffer
         cWC2MB(const wchar_t *in, size_t inLen, size_t *outLen) const;
 
+    // Functions converting the input directly into the provided buffer, which
+    // is reused if it's big enough or reallocated otherwise, without finding
+    // the size of the output first, as is necessary when using To/FromWChar()
+    // directly, unless the initial guess about the output size turns out to
+    // be wrong, which is rare.
+    //
+    // The buffer must not be shared with any other buffer object.
+    //
+    // The return value is the same as for To/FromWChar() and the length of
+    // the buffer is set to it on success.
+    size_t ToWCharInto(wxWCharBuffer& buf,
+                       const char *src, size_t srcLen = wxNO_LEN) const;
+    size_t FromWCharInto(wxCharBuffer& buf,
+                         const wchar_t *src, size_t srcLen = wxNO_LEN) const;
+
     // Obsolete convenience functions.
     wxWCharBuffer cMB2WX(const char *psz) const { return cMB2WC(psz); }
     wxCharBuffer cWX2MB(const wchar_t *psz) const { return cWC2MB(psz); }
@@ -498,6 +513,7 @@ public:
     virtual size_t FromWChar(char *dst, size_t dstLen,
                              const wchar_t *src, size_t srcLen = wxNO_LEN) const override;
     virtual size_t GetMBNulLen() const override;
+    virtual size_t GetMaxCharLen() const override;
 
     virtual bool IsUTF8() const override;
 
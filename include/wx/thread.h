@@ -21,6 +21,9 @@
 
 #if wxUSE_THREADS
 
+#include <atomic>
+#include <vector>
+
 // ----------------------------------------------------------------------------
 // constants
 // ----------------------------------------------------------------------------
@@ -115,6 +118,7 @@ class WXDLLIMPEXP_FWD_BASE wxThreadHelper;
 class WXDLLIMPEXP_FWD_BASE wxConditionInternal;
 class WXDLLIMPEXP_FWD_BASE wxMutexInternal;
 class WXDLLIMPEXP_FWD_BASE wxSemaphoreInternal;
+class WXDLLIMPEXP_FWD_BASE wxSharedMutexInternal;
 class WXDLLIMPEXP_FWD_BASE wxThreadInternal;
 
 // ----------------------------------------------------------------------------
@@ -310,6 +314,170 @@ private:
     wxDECLARE_NO_COPY_CLASS(wxCriticalSectionLocker);
 };
 
+// ----------------------------------------------------------------------------
+// wxSharedMutex: a mutex which can be locked either exclusively, by a single
+//                writer, or in shared mode, by any number of readers at once
+// ----------------------------------------------------------------------------
+
+// consider using wxReadLocker and wxWriteLocker instead of calling the lock
+// functions of this class directly
+class WXDLLIMPEXP_BASE wxSharedMutex
+{
+public:
+    wxSharedMutex();
+    ~wxSharedMutex();
+
+    // test if the mutex has been created successfully
+    bool IsOk() const;
+
+    // Lock the mutex exclusively, blocking until no other thread has it
+    // locked, either exclusively or in shared mode. The mutex is not
+    // recursive, i.e. it can't be locked again by the same thread.
+    wxMutexError Lock();
+
+    // Same as Lock() but return wxMUTEX_BUSY immediately if it can't be done.
+    wxMutexError TryLock();
+
+    // Unlock the mutex locked by Lock() or TryLock().
+    wxMutexError Unlock();
+
+    // Lock the mutex in shared mode, blocking only while it is locked
+    // exclusively by another thread.
+    wxMutexError LockShared();
+
+    // Same as LockShared() but return wxMUTEX_BUSY instead of blocking.
+    wxMutexError TryLockShared();
+
+    // Unlock the mutex locked by LockShared() or TryLockShared().
+    wxMutexError UnlockShared();
+
+private:
+    wxSharedMutexInternal *m_internal;
+
+    wxDECLARE_NO_COPY_CLASS(wxSharedMutex);
+};
+
+// lock the shared mutex in shared, or read, mode in the ctor and unlock it in
+// the dtor
+class WXDLLIMPEXP_BASE wxReadLocker
+{
+public:
+    wxReadLocker(wxSharedMutex& mutex)
+        : m_mutex(mutex)
+        { m_isOk = m_mutex.LockShared() == wxMUTEX_NO_ERROR; }
+
+    // returns true if mutex was successfully locked in ctor
+    bool IsOk() const
+        { return m_isOk; }
+
+    ~wxReadLocker()
+        { if ( IsOk() ) m_mutex.UnlockShared(); }
+
+private:
+    wxSharedMutex& m_mutex;
+    bool m_isOk;
+
+    wxDECLARE_NO_COPY_CLASS(wxReadLocker);
+};
+
+// lock the shared mutex exclusively, for writing, in the ctor and unlock it in
+// the dtor
+class WXDLLIMPEXP_BASE wxWriteLocker
+{
+public:
+    wxWriteLocker(wxSharedMutex& mutex)
+        : m_mutex(mutex)
+        { m_isOk = m_mutex.Lock() == wxMUTEX_NO_ERROR; }
+
+    // returns true if mutex was successfully locked in ctor
+    bool IsOk() const
+        { return m_isOk; }
+
+    ~wxWriteLocker()
+        { if ( IsOk() ) m_mutex.Unlock(); }
+
+private:
+    wxSharedMutex& m_mutex;
+    bool m_isOk;
+
+    wxDECLARE_NO_COPY_CLASS(wxWriteLocker);
+};
+
+// ----------------------------------------------------------------------------
+// wxSpinMutex: very lightweight mutex for protecting short critical sections
+// ----------------------------------------------------------------------------
+
+// This mutex is not recursive and doesn't do any error checking, but locking
+// and unlocking it when there is no contention is just a single atomic
+// operation without any function calls. When it is already locked, the thread
+// spins for a short time before blocking (using futex under Linux) or, on the
+// other platforms, yielding the CPU until the mutex becomes available.
+class WXDLLIMPEXP_BASE wxSpinMutex
+{
+public:
+    wxSpinMutex() : m_state(State_Unlocked) { }
+
+    void Lock()
+    {
+        int expected = State_Unlocked;
+        if ( !m_state.compare_exchange_strong(expected, State_Locked,
+                                              std::memory_order_acquire,
+                                              std::memory_order_relaxed) )
+            LockSlow();
+    }
+
+    // return true if the mutex was locked or false if it was already locked
+    bool TryLock()
+    {
+        int expected = State_Unlocked;
+        return m_state.compare_exchange_strong(expected, State_Locked,
+                                               std::memory_order_acquire,
+                                               std::memory_order_relaxed);
+    }
+
+    void Unlock()
+    {
+        if ( m_state.exchange(State_Unlocked,
+                              std::memory_order_release) == State_Contended )
+            WakeWaiter();
+    }
+
+private:
+    enum
+    {
+        State_Unlocked,
+        State_Locked,
+
+        // locked and there may be other threads waiting for it
+        State_Contended
+    };
+
+    // these functions are only called when the mutex is contended
+    void LockSlow();
+    void WaitWhileContended();
+    void WakeWaiter();
+
+    std::atomic<int> m_state;
+
+    wxDECLARE_NO_COPY_CLASS(wxSpinMutex);
+};
+
+class WXDLLIMPEXP_BASE wxSpinMutexLocker
+{
+public:
+    wxSpinMutexLocker(wxSpinMutex& mutex)
+        : m_mutex(mutex)
+        { m_mutex.Lock(); }
+
+    ~wxSpinMutexLocker()
+        { m_mutex.Unlock(); }
+
+private:
+    wxSpinMutex& m_mutex;
+
+    wxDECLARE_NO_COPY_CLASS(wxSpinMutexLocker);
+};
+
 // ----------------------------------------------------------------------------
 // wxCondition models a POSIX condition variable which allows one (or more)
 // thread(s) to wait until some condition is fulfilled
@@ -440,6 +608,35 @@ private:
    typedef unsigned long wxThreadIdType;
 #endif
 
+// scheduling policies which can be used with wxThread::SetSchedPolicy()
+enum wxThreadSchedPolicy
+{
+    wxTHREAD_SCHED_DEFAULT,     // normal time-sharing scheduling
+    wxTHREAD_SCHED_BATCH,       // CPU-bound, non-interactive thread
+    wxTHREAD_SCHED_IDLE,        // run only when the system is otherwise idle
+    wxTHREAD_SCHED_FIFO,        // real-time, first in first out
+    wxTHREAD_SCHED_RR           // real-time, round robin
+};
+
+// CPU usage statistics returned by wxThread::GetCPUStats()
+struct wxThreadCPUStats
+{
+    wxThreadCPUStats()
+        : userTime(0), systemTime(0),
+          voluntarySwitches(0), involuntarySwitches(0)
+    {
+    }
+
+    // CPU time spent in user and kernel mode, in microseconds
+    wxUint64 userTime;
+    wxUint64 systemTime;
+
+    // number of context switches because the thread had to wait for
+    // something or because it was preempted by the scheduler
+    wxUint64 voluntarySwitches;
+    wxUint64 involuntarySwitches;
+};
+
 class WXDLLIMPEXP_BASE wxThread
 {
 public:
@@ -556,6 +753,30 @@ public:
         // Get the current priority.
     unsigned int GetPriority() const;
 
+    // scheduling: all these functions can only be used after the thread was
+    // created, but they may be called before Run() to configure it before it
+    // starts executing
+        // Restrict the thread to run only on the given CPUs (0-based).
+    bool SetAffinity(const std::vector<int>& cpus);
+
+        // Get the CPUs this thread may run on.
+    bool GetAffinity(std::vector<int>& cpus) const;
+
+        // Set the scheduling policy and, for the real-time policies only,
+        // priority (0 means the minimal one).
+    bool SetSchedPolicy(wxThreadSchedPolicy policy, int priority = 0);
+
+        // Get the CPU usage statistics for this thread.
+    bool GetCPUStats(wxThreadCPUStats& stats) const;
+
+        // Versions of the functions above for the calling thread, which
+        // doesn't need to be a wxThread.
+    static bool SetAffinityForCurrent(const std::vector<int>& cpus);
+    static bool GetAffinityForCurrent(std::vector<int>& cpus);
+    static bool SetSchedPolicyForCurrent(wxThreadSchedPolicy policy,
+                                         int priority = 0);
+    static bool GetCPUStatsForCurrent(wxThreadCPUStats& stats);
+
     // thread status inquiries
         // Returns true if the thread is alive: i.e. running or suspended
     bool IsAlive() const;
@@ -0,0 +1,129 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/threadpool.h
+// Purpose:     wxThreadPool and wxTask classes for executing background tasks
+// Author:      wxWidgets team
+// Created:     2026-10-19
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_THREADPOOL_H_
+#define _WX_THREADPOOL_H_
+
+#include "wx/defs.h"
+
+#if wxUSE_THREADS
+
+#include <functional>
+#include <memory>
+
+class wxTaskImpl;
+class wxThreadPoolImpl;
+
+// ----------------------------------------------------------------------------
+// constants
+// ----------------------------------------------------------------------------
+
+// Tasks with higher priority are always executed before the lower priority
+// ones if they're both pending.
+enum wxTaskPriority
+{
+    wxTASK_PRIORITY_LOW,
+    wxTASK_PRIORITY_NORMAL,
+    wxTASK_PRIORITY_HIGH
+};
+
+enum wxTaskState
+{
+    wxTASK_PENDING,     // waiting to be executed
+    wxTASK_RUNNING,     // being executed right now
+    wxTASK_COMPLETED,   // finished executing
+    wxTASK_CANCELLED    // cancelled before it could be executed
+};
+
+// ----------------------------------------------------------------------------
+// wxTask: handle of a task submitted to wxThreadPool
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_BASE wxTask
+{
+public:
+    // Default ctor creates an invalid handle not associated with any task.
+    wxTask() = default;
+
+    bool IsOk() const { return m_impl != nullptr; }
+
+    wxTaskState GetState() const;
+
+    // Return true if the task is either completed or cancelled.
+    bool IsDone() const;
+
+    // Cancel the task if it hasn't started running yet and return true, or
+    // request the running task to stop and return false, see
+    // wxThreadPool::IsCancelRequested().
+    bool Cancel();
+
+    // Return true if Cancel() was called for this task.
+    bool IsCancelRequested() const;
+
+    // Block until the task is done. When called from a pool thread, other
+    // pending tasks are executed while waiting.
+    void Wait() const;
+
+    // Same as Wait() but give up after the given timeout and return false.
+    bool WaitTimeout(unsigned long milliseconds) const;
+
+    // Create a task executing the given function after this one completes in
+    // the same thread pool or, for ThenInMainThread(), in the main thread
+    // using wxApp::CallAfter(). If this task is cancelled, the continuation
+    // is cancelled too.
+    wxTask Then(const std::function<void()>& func,
+                wxTaskPriority priority = wxTASK_PRIORITY_NORMAL);
+    wxTask ThenInMainThread(const std::function<void()>& func);
+
+private:
+    explicit wxTask(const std::shared_ptr<wxTaskImpl>& impl) : m_impl(impl) { }
+
+    std::shared_ptr<wxTaskImpl> m_impl;
+
+    friend class wxThreadPool;
+};
+
+// ----------------------------------------------------------------------------
+// wxThreadPool: executes tasks using a fixed number of worker threads
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_BASE wxThreadPool
+{
+public:
+    // Create a pool with the given number of threads or, if it is 0, with as
+    // many threads as there are CPUs in the system.
+    explicit wxThreadPool(unsigned numThreads = 0);
+
+    // Cancels all the pending tasks and waits until the running ones finish.
+    ~wxThreadPool();
+
+    // Return the global pool, creating it on first use.
+    static wxThreadPool& Get();
+
+    unsigned GetThreadCount() const;
+
+    // Schedule the function for execution in one of the pool threads.
+    wxTask Submit(const std::function<void()>& func,
+                  wxTaskPriority priority = wxTASK_PRIORITY_NORMAL);
+
+    // Block until all the tasks submitted to this pool so far are done.
+    void WaitAll();
+
+    // Can be called from inside a task to check if it should stop because
+    // wxTask::Cancel() was called for it.
+    static bool IsCancelRequested();
+
+private:
+    std::shared_ptr<wxThreadPoolImpl> m_impl;
+
+    wxDECLARE_NO_COPY_CLASS(wxThreadPool);
+};
+
+#endif // wxUSE_THREADS
+
+#endif // _WX_THREADPOOL_H_
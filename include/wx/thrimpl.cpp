@@ -66,6 +66,122 @@ wxMutexError wxMutex::Unlock()
     return m_internal->Unlock();
 }
 
+// ----------------------------------------------------------------------------
+// wxSharedMutex
+// ----------------------------------------------------------------------------
+
+wxSharedMutex::wxSharedMutex()
+{
+    m_internal = new wxSharedMutexInternal();
+
+    if ( !m_internal->IsOk() )
+    {
+        delete m_internal;
+        m_internal = nullptr;
+    }
+}
+
+wxSharedMutex::~wxSharedMutex()
+{
+    delete m_internal;
+}
+
+bool wxSharedMutex::IsOk() const
+{
+    return m_internal != nullptr;
+}
+
+wxMutexError wxSharedMutex::Lock()
+{
+    wxCHECK_MSG( m_internal, wxMUTEX_INVALID,
+                 wxT("wxSharedMutex::Lock(): not initialized") );
+
+    return m_internal->Lock();
+}
+
+wxMutexError wxSharedMutex::TryLock()
+{
+    wxCHECK_MSG( m_internal, wxMUTEX_INVALID,
+                 wxT("wxSharedMutex::TryLock(): not initialized") );
+
+    return m_internal->TryLock();
+}
+
+wxMutexError wxSharedMutex::Unlock()
+{
+    wxCHECK_MSG( m_internal, wxMUTEX_INVALID,
+                 wxT("wxSharedMutex::Unlock(): not initialized") );
+
+    return m_internal->Unlock();
+}
+
+wxMutexError wxSharedMutex::LockShared()
+{
+    wxCHECK_MSG( m_internal, wxMUTEX_INVALID,
+                 wxT("wxSharedMutex::LockShared(): not initialized") );
+
+    return m_internal->LockShared();
+}
+
+wxMutexError wxSharedMutex::TryLockShared()
+{
+    wxCHECK_MSG( m_internal, wxMUTEX_INVALID,
+                 wxT("wxSharedMutex::TryLockShared(): not initialized") );
+
+    return m_internal->TryLockShared();
+}
+
+wxMutexError wxSharedMutex::UnlockShared()
+{
+    wxCHECK_MSG( m_internal, wxMUTEX_INVALID,
+                 wxT("wxSharedMutex::UnlockShared(): not initialized") );
+
+    return m_internal->UnlockShared();
+}
+
+// ----------------------------------------------------------------------------
+// wxSpinMutex
+// ----------------------------------------------------------------------------
+
+// Let the CPU know that we're busy waiting, which reduces power consumption
+// and frees resources for the other hyper-thread running on the same core.
+static inline void wxSpinPause()
+{
+#if defined(__WINDOWS__)
+    YieldProcessor();
+#elif defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+    __builtin_ia32_pause();
+#elif defined(__GNUC__) && defined(__aarch64__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+void wxSpinMutex::LockSlow()
+{
+    // The mutex is supposed to be held only for a short time, so start by
+    // spinning for a while, as this is much cheaper than blocking.
+    static const int SPIN_COUNT = 100;
+
+    for ( int n = 0; n < SPIN_COUNT; n++ )
+    {
+        wxSpinPause();
+
+        if ( m_state.load(std::memory_order_relaxed) == State_Unlocked &&
+                TryLock() )
+            return;
+    }
+
+    // Mark the mutex as contended, so that Unlock() wakes us up, and wait
+    // until we manage to lock it. Notice that we have to keep it in the
+    // contended state even if there are no other waiters any more as we
+    // can't know whether this is the case.
+    while ( m_state.exchange(State_Contended,
+                             std::memory_order_acquire) != State_Unlocked )
+    {
+        WaitWhileContended();
+    }
+}
+
 // --------------------------------------------------------------------------
 // wxConditionInternal
 // --------------------------------------------------------------------------
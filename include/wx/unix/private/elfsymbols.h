@@ -0,0 +1,130 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/unix/private/elfsymbols.h
+// Purpose:     In-process reader of ELF symbols and DWARF line information
+// Author:      wxWidgets team
+// Created:     2026-10-19
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_UNIX_PRIVATE_ELFSYMBOLS_H_
+#define _WX_UNIX_PRIVATE_ELFSYMBOLS_H_
+
+// This is only used by wxStackWalker and only under Linux, where we can rely
+// on having <link.h> and dladdr1() to find the module containing an address.
+#if wxUSE_STACKWALKER && defined(__LINUX__) && defined(__GLIBC__)
+
+#define wxHAS_ELF_SYMBOLS
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class wxDwarfReader;
+class wxElfFile;
+
+// Information about the location of an address found by wxElfModule.
+struct wxElfLocation
+{
+    // Demangled function name, may be empty if it couldn't be found.
+    wxString name;
+
+    // Source file name and line number, empty and 0 if there is no debug
+    // information for this address.
+    wxString filename;
+    unsigned long line = 0;
+};
+
+// Symbols and line information of an ELF executable or shared library.
+//
+// This class reads the symbol table and the DWARF .debug_line section of the
+// module, or of its separate debug file if the module itself is stripped, and
+// allows to quickly map addresses to function names and source locations.
+class WXDLLIMPEXP_BASE wxElfModule
+{
+public:
+    // Return the module with the given path, loading it if necessary.
+    //
+    // The modules are cached and never freed, so subsequent calls for the
+    // same path are cheap. This function is thread-safe.
+    static const wxElfModule& Get(const char* path);
+
+    // Load the information from the given file, use IsOk() to check if it
+    // was successful.
+    explicit wxElfModule(const char* path);
+    ~wxElfModule();
+
+    // Return true if any information could be loaded.
+    bool IsOk() const { return !m_symbols.empty() || !m_lines.empty(); }
+
+    // Return true if the module has line information which we couldn't read,
+    // e.g. because it is compressed, so that addr2line should be used to get
+    // it.
+    bool HasUnsupportedLines() const { return m_hasUnsupportedLines; }
+
+    // Fill in the location of the given address, which must be relative to
+    // the module load address, i.e. must be the address in the file.
+    //
+    // Returns false if neither the function nor the line were found.
+    bool Lookup(wxUIntPtr addr, wxElfLocation& loc) const;
+
+private:
+    struct Symbol
+    {
+        wxUIntPtr addr;
+        wxUIntPtr size;
+
+        // Points into the string table of one of m_files.
+        const char* name;
+    };
+
+    struct LineRow
+    {
+        wxUIntPtr addr;
+
+        // Index in m_fileNames.
+        wxUint32 file;
+        wxUint32 line;
+
+        // True for the row marking the first address after the end of the
+        // sequence of instructions.
+        bool endSequence;
+    };
+
+    // Load the symbols from the section of the given type (symbol table or
+    // dynamic symbols) of the given file, return true if any were found.
+    bool LoadSymbols(const wxElfFile& file, unsigned type);
+
+    // Load the line information from the given file, return true if there
+    // was any.
+    bool LoadLines(const wxElfFile& file);
+
+    // Parse a single unit of .debug_line section, return false if it is
+    // malformed or uses unsupported features.
+    bool ParseLineUnit(wxDwarfReader& unit, bool is64,
+                       const wxElfFile& file);
+
+    // Return the index of the given file name in m_fileNames, adding it if
+    // necessary.
+    wxUint32 AddFileName(const char* dir, const char* name);
+
+    // Files containing the symbol names.
+    std::vector<std::unique_ptr<wxElfFile>> m_files;
+
+    // Both of these vectors are sorted by address.
+    std::vector<Symbol> m_symbols;
+    std::vector<LineRow> m_lines;
+
+    std::vector<std::string> m_fileNames;
+
+    // Only used while loading to avoid duplicates in m_fileNames.
+    std::unordered_map<std::string, wxUint32> m_fileIndices;
+
+    bool m_hasUnsupportedLines = false;
+
+    wxDECLARE_NO_COPY_CLASS(wxElfModule);
+};
+
+#endif // wxUSE_STACKWALKER && __LINUX__ && __GLIBC__
+
+#endif // _WX_UNIX_PRIVATE_ELFSYMBOLS_H_
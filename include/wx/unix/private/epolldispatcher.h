@@ -15,9 +15,29 @@
 #ifdef wxUSE_EPOLL_DISPATCHER
 
 #include "wx/private/fdiodispatcher.h"
+#include "wx/recguard.h"
+
+#include <memory>
 
 struct epoll_event;
 
+// statistics collected by wxEpollDispatcher, see GetStats()
+struct wxEpollDispatcherStats
+{
+    // number of times epoll_wait() returned at least one event
+    wxUint64 wakeups = 0;
+
+    // total number of events returned by epoll_wait()
+    wxUint64 events = 0;
+
+    // maximal number of events returned by a single epoll_wait() call
+    unsigned maxEventsPerWakeup = 0;
+
+    // number of times epoll_wait() filled the entire buffer, if this is
+    // frequently the case, increasing the batch size would be useful
+    wxUint64 fullBatches = 0;
+};
+
 class WXDLLIMPEXP_BASE wxEpollDispatcher : public wxFDIODispatcher
 {
 public:
@@ -36,16 +56,39 @@ public:
     virtual bool HasPending() const override;
     virtual int Dispatch(int timeout = TIMEOUT_INFINITE) override;
 
+    // set the maximal number of events retrieved by a single Dispatch() call,
+    // the default value is 64 unless "unix.epoll.max_events" system option
+    // is set
+    void SetMaxEvents(size_t maxEvents);
+    size_t GetMaxEvents() const { return m_maxEvents; }
+
+    // get the statistics about the events dispatched so far or reset them
+    const wxEpollDispatcherStats& GetStats() const { return m_stats; }
+    void ResetStats() { m_stats = wxEpollDispatcherStats(); }
+
 private:
     // ctor is private, use Create()
     wxEpollDispatcher(int epollDescriptor);
 
+    // common part of RegisterFD() and ModifyFD()
+    bool DoCtl(int op, int fd, wxFDIOHandler* handler, int flags);
+
     // common part of HasPending() and Dispatch(): calls epoll_wait() with the
     // given timeout
     int DoPoll(epoll_event *events, int numEvents, int timeout) const;
 
 
     int m_epollDescriptor;
+
+    // the buffer used by Dispatch() to avoid allocating it every time, it is
+    // only used by the outermost call as Dispatch() may be reentered from the
+    // event handlers
+    std::unique_ptr<epoll_event[]> m_events;
+    size_t m_numEvents = 0;
+    size_t m_maxEvents;
+    wxRecursionGuardFlag m_dispatchLevel = 0;
+
+    wxEpollDispatcherStats m_stats;
 };
 
 #endif // wxUSE_EPOLL_DISPATCHER
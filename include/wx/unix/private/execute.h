@@ -18,9 +18,84 @@
     #include "wx/private/streamtempinput.h"
 #endif
 
+#if wxUSE_EVENTLOOP_SOURCE
+    #include "wx/evtloopsrc.h"
+#endif
+
+#include <memory>
 #include <unordered_map>
 
 class wxEventLoopBase;
+class wxExecuteData;
+
+#if wxUSE_EVENTLOOP_SOURCE
+
+// Reads the output of the child process as soon as it becomes available and
+// passes it to wxProcess::OnOutput(), used if wxProcess::StreamOutput() was
+// called.
+class wxExecuteOutputReader : public wxProcessOutputReader
+{
+public:
+    // Takes ownership of the descriptors, which must be non-blocking.
+    wxExecuteOutputReader(wxExecuteData& execData, int fdOut, int fdErr);
+    virtual ~wxExecuteOutputReader();
+
+    virtual void Pause() override;
+    virtual void Resume() override;
+
+    // Return true once the end of both output and error streams was reached.
+    bool IsEOF() const { return m_out.IsEOF() && m_err.IsEOF(); }
+
+private:
+    // Handler for one of the child output streams.
+    class Channel : public wxEventLoopSourceHandler
+    {
+    public:
+        Channel(wxExecuteOutputReader& reader, int fd, bool isError);
+        virtual ~Channel();
+
+        virtual void OnReadWaiting() override;
+        virtual void OnWriteWaiting() override { }
+        virtual void OnExceptionWaiting() override { }
+
+        // The descriptor is closed as soon as we get EOF on it.
+        bool IsEOF() const { return m_fd == -1; }
+
+        // Start or stop monitoring the descriptor.
+        void Start();
+        void Stop();
+
+    private:
+        wxExecuteOutputReader& m_reader;
+        int m_fd;
+        const bool m_isError;
+
+        // The source is only non-null while we're monitoring the descriptor.
+        wxEventLoopSource* m_source;
+
+        // The buffer for the data read from the descriptor.
+        std::unique_ptr<char[]> m_buffer;
+
+        // True while the data is being processed by wxProcess.
+        bool m_inOnOutput;
+
+        wxDECLARE_NO_COPY_CLASS(Channel);
+    };
+
+    // Called by Channel when it reaches EOF, may delete this object.
+    void OnChannelEOF();
+
+    wxExecuteData& m_execData;
+    const size_t m_chunkSize;
+    bool m_paused;
+
+    Channel m_out,
+            m_err;
+
+    wxDECLARE_NO_COPY_CLASS(wxExecuteOutputReader);
+};
+
+#endif // wxUSE_EVENTLOOP_SOURCE
 
 // Information associated with a running child process.
 class wxExecuteData
@@ -40,6 +115,8 @@ public:
         m_fdOut =
         m_fdErr = wxPipe::INVALID_FD;
 #endif // wxUSE_STREAMS
+
+        m_exited = false;
     }
 
     // This must be called in the parent process as soon as fork() returns to
@@ -51,6 +128,12 @@ public:
     // Called when the child process exits.
     void OnExit(int exitcode);
 
+#if wxUSE_EVENTLOOP_SOURCE
+    // Called by wxExecuteOutputReader when all the output was read, this
+    // may delete this object.
+    void OnOutputEOF();
+#endif // wxUSE_EVENTLOOP_SOURCE
+
     // Return true if we should (or already did) redirect the child IO.
     bool IsRedirected() const { return m_process && m_process->IsRedirected(); }
 
@@ -84,12 +167,25 @@ public:
         m_fdErr;
 #endif // wxUSE_STREAMS
 
+#if wxUSE_EVENTLOOP_SOURCE
+    // the object reading the child output if it's streamed, only used for
+    // asynchronous execution
+    std::unique_ptr<wxExecuteOutputReader> m_outputReader;
+#endif // wxUSE_EVENTLOOP_SOURCE
+
 
 private:
+    // Notify about the child termination, called from OnExit() or, if we're
+    // still reading the child output, later, once all of it was read.
+    void NotifyExit();
+
     // SIGCHLD signal handler that checks whether any of the currently running
     // children have exited.
     static void OnSomeChildExited(int sig);
 
+    // True once the child process has exited.
+    bool m_exited;
+
     // All currently running child processes indexed by their PID.
     //
     // Notice that the container doesn't own its elements.
@@ -22,6 +22,7 @@
     #include <sys/filio.h>
 #endif
 
+#include "wx/private/fdiodispatcher.h"
 #include "wx/private/fdiomanager.h"
 
 class wxSocketImplUnix : public wxSocketImpl,
@@ -71,6 +72,11 @@ public:
     virtual void OnExceptionWaiting() override;
     virtual bool IsOk() const override { return m_fd != INVALID_SOCKET; }
 
+    // a listening socket may be shared by several processes and waking up
+    // all of them for each incoming connection is useless
+    virtual int GetExtraFlags() const override
+        { return m_server ? wxFDIO_EXCLUSIVE : 0; }
+
 private:
     virtual wxSocketError GetLastError() const override;
 
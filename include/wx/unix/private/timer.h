@@ -14,7 +14,7 @@
 
 #include "wx/private/timer.h"
 
-#include <list>
+#include <vector>
 
 // the type used for milliseconds is large enough for microseconds too but
 // introduce a synonym for it to avoid confusion
@@ -47,6 +47,11 @@ public:
 
 private:
     bool m_isRunning;
+
+    // the index of this timer in wxTimerScheduler heap, only used by it
+    size_t m_heapIndex = static_cast<size_t>(-1);
+
+    friend class wxTimerScheduler;
 };
 
 // ----------------------------------------------------------------------------
@@ -55,10 +60,24 @@ private:
 
 struct wxTimerSchedule
 {
-    wxTimerSchedule(wxUnixTimerImpl *timer, wxUsecClock_t expiration)
+    wxTimerSchedule(wxUnixTimerImpl *timer,
+                    wxUsecClock_t expiration,
+                    wxUint64 seq)
         : m_timer(timer),
-          m_expiration(expiration)
+          m_expiration(expiration),
+          m_seq(seq)
+    {
+    }
+
+    // return true if this timer must be notified before the other one
+    bool IsBefore(const wxTimerSchedule& other) const
     {
+        if ( m_expiration != other.m_expiration )
+            return m_expiration < other.m_expiration;
+
+        // timers expiring at the same time are notified in the order in which
+        // they were added
+        return m_seq < other.m_seq;
     }
 
     // the timer itself (we don't own this pointer)
@@ -66,15 +85,21 @@ struct wxTimerSchedule
 
     // the time of its next expiration, in usec
     wxUsecClock_t m_expiration;
+
+    // sequential number of this schedule, used to order the timers with the
+    // same expiration time
+    wxUint64 m_seq;
 };
 
-// the linked list of all active timers, we keep it sorted by expiration time
-using wxTimerList = std::list<wxTimerSchedule>;
+// binary heap of all active timers, ordered by expiration time
+using wxTimerHeap = std::vector<wxTimerSchedule>;
 
 // ----------------------------------------------------------------------------
 // wxTimerScheduler: class responsible for updating all timers
 // ----------------------------------------------------------------------------
 
+class wxTimerFDHandler;
+
 class wxTimerScheduler
 {
 public:
@@ -117,20 +142,70 @@ public:
     // if any did
     bool NotifyExpired();
 
+    // return true if the expiration of the timers is signaled by a file
+    // descriptor monitored by wxFDIODispatcher, so that the event loop doesn't
+    // need to use GetNext() to limit the time it waits for the events
+    bool UsesTimerFD() const { return m_timerFD != -1; }
+
 private:
     // ctor and dtor are private, this is a singleton class only created by
     // Get() and destroyed by Shutdown()
-    wxTimerScheduler() = default;
-    ~wxTimerScheduler() = default;
+    wxTimerScheduler();
+    ~wxTimerScheduler();
 
-    // add the given timer schedule to the list in the right place
-    void DoAddTimer(const wxTimerSchedule& s);
+    // add the given timer to the heap
+    void DoAddTimer(wxUnixTimerImpl *timer, wxUsecClock_t expiration);
 
+    // remove the timer at the given position from the heap
+    void DoRemoveAt(size_t n);
 
-    // the list of all currently active timers sorted by expiration
-    wxTimerList m_timers;
+    // put the element at the given position at its place in the heap
+    void SiftUp(size_t n);
+    void SiftDown(size_t n);
+
+    // store the element at the given position in the heap
+    void SetAt(size_t n, const wxTimerSchedule& s)
+    {
+        m_timers[n] = s;
+        m_timers[n].m_timer->m_heapIndex = n;
+    }
+
+    // return the time when the event loop should wake up to notify the
+    // timers, must not be called if there are no timers
+    wxUsecClock_t GetWakeUpTime() const
+    {
+        return m_timers[0].m_expiration + m_slack;
+    }
+
+    // update the timer file descriptor to expire at the wake up time, does
+    // nothing if it's not used
+    void UpdateTimerFD();
+
+    // called by wxTimerFDHandler when the timer file descriptor expires
+    void OnTimerFDExpired();
+
+
+    // the heap of all currently active timers with the timer expiring first
+    // at its top
+    wxTimerHeap m_timers;
+
+    // the counter used for the timers sequential numbers
+    wxUint64 m_seq = 0;
+
+    // the maximal delay of the timers notifications allowed to let several
+    // timers expiring close to each other to be notified at once, 0 by
+    // default but can be changed using "unix.timer.slack" system option
+    wxUsecClock_t m_slack;
+
+    // the timer file descriptor (-1 if not used), its handler and the time
+    // it's set to expire at (0 if it's not)
+    int m_timerFD = -1;
+    wxTimerFDHandler *m_timerFDHandler = nullptr;
+    wxUsecClock_t m_timerFDExpiration;
 
     static wxTimerScheduler *ms_instance;
+
+    friend class wxTimerFDHandler;
 };
 
 #endif // wxUSE_TIMER
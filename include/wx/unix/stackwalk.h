@@ -85,6 +85,10 @@ public:
     void ProcessFrames(size_t skip);
     void FreeStack();
 
+    // process the frames at the given addresses, which must have been
+    // obtained using backtrace(), e.g. in a signal handler in another thread
+    void WalkAddresses(void* const* addresses, size_t count);
+
 private:
     int InitFrames(wxStackFrame *arr, size_t n, void **addresses, char **syminfo);
 
@@ -534,10 +534,14 @@ inline int wxStrcmp_String(const wxString& s1, const T& s2)
     { return s1.compare(s2); }
 WX_STRCMP_FUNC(wxStrcmp, wxCRT_StrcmpA, wxCRT_StrcmpW, wxStrcmp_String)
 
+// Same as wxCRT_StricmpW() but uses a fast path for the common ASCII prefix of
+// the strings, this is used by wxStricmp() for wide strings.
+WXDLLIMPEXP_BASE int wxStricmpW(const wchar_t *s1, const wchar_t *s2);
+
 template<typename T>
 inline int wxStricmp_String(const wxString& s1, const T& s2)
     { return s1.CmpNoCase(s2); }
-WX_STRCMP_FUNC(wxStricmp, wxCRT_StricmpA, wxCRT_StricmpW, wxStricmp_String)
+WX_STRCMP_FUNC(wxStricmp, wxCRT_StricmpA, wxStricmpW, wxStricmp_String)
 
 #if defined(wxCRT_StrcollA) && defined(wxCRT_StrcollW)
 
@@ -76,6 +76,17 @@ public:
     */
     wxAny(const wxAny& any);
 
+    /**
+        Constructs wxAny by moving the value from another wxAny.
+
+        The value is moved using wxAnyValueType::MoveBuffer(), which avoids
+        copying it for all types which are not stored directly in wxAny
+        buffer. After this call, @a any is null.
+
+        @since 3.3.4
+    */
+    wxAny(wxAny&& any);
+
     /**
         Constructs wxAny, converting value from wxVariant.
 
@@ -185,6 +196,7 @@ public:
     template<typename T>
     wxAny& operator=(const T &value);
     wxAny& operator=(const wxAny &any);
+    wxAny& operator=(wxAny&& any);
     wxAny& operator=(const wxVariant &variant);
     ///@}
 
@@ -422,6 +434,27 @@ public:
     virtual void CopyBuffer(const wxAnyValueBuffer& src,
                             wxAnyValueBuffer& dst) const = 0;
 
+    /**
+        Moves the value from one buffer to another one.
+
+        This is used by wxAny move constructor and assignment operator. The
+        default implementation calls CopyBuffer() and then DeleteValue() for
+        the source buffer, but wxAnyValueTypeImplBase overrides it to avoid
+        copying the value.
+
+        @param src
+            This is the source data buffer, which is in freed state after
+            this call.
+
+        @param dst
+            This is the destination data buffer that is in either
+            uninitialized or freed state.
+
+        @since 3.3.4
+    */
+    virtual void MoveBuffer(wxAnyValueBuffer& src,
+                            wxAnyValueBuffer& dst) const;
+
     /**
         This function is called every time the data in wxAny
         buffer needs to be freed.
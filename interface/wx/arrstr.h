@@ -308,6 +308,36 @@ public:
     */
     void Sort(CompareFunction compareFunction);
 
+    /**
+        Sorts the array using multiple threads.
+
+        This function does the same thing as Sort() but, for sufficiently
+        big arrays, sorts different parts of the array in separate threads of
+        the global wxThreadPool, using at most wxGetParallelConcurrency()
+        threads, and then merges the results. For the small arrays, or if
+        wxUSE_THREADS is 0, it is exactly the same as Sort().
+
+        Note that Sort() itself already uses a faster radix sort algorithm
+        for big arrays when sorting them in the alphabetical order, so this
+        function is only worth using for the arrays with many thousands of
+        elements.
+
+        @since 3.3.4
+    */
+    void SortParallel(bool reverseOrder = false);
+
+    /**
+        Sorts the array using multiple threads and the specified comparison
+        function.
+
+        This is the same as the overload above, but uses the provided
+        comparison function, which must be thread-safe, as it will be called
+        from multiple threads concurrently.
+
+        @since 3.3.4
+    */
+    void SortParallel(CompareFunction compareFunction);
+
     /**
         Compares 2 arrays respecting the case. Returns @true if the arrays have
         different number of elements or if the elements don't match pairwise.
@@ -382,6 +412,20 @@ public:
     */
     wxSortedArrayString(const wxArrayString& array);
 
+    /**
+        Constructs a sorted array with the same contents as the (possibly
+        unsorted) @a array argument using the specified @a compareFunction.
+
+        Just as the constructor above, this constructor sorts all the strings
+        at once, which is much faster than adding them to the array one by
+        one. The strings comparing equal remain in the same relative order as
+        in the original @a array.
+
+        @since 3.3.4
+    */
+    wxSortedArrayString(const wxArrayString& array,
+                        CompareFunction compareFunction);
+
     /**
         @copydoc wxArrayString::Add()
 
@@ -0,0 +1,121 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/base64stream.h
+// Purpose:     BASE64 encoding and decoding stream classes documentation
+// Author:      wxWidgets team
+// Created:     2026-10-19
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+    @class wxBase64DecoderInputStream
+
+    This filter stream decodes BASE64 data read from another stream.
+
+    Unlike wxBase64Decode(), this class doesn't require the entire encoded
+    data to be available in memory and decodes it in chunks as it is being
+    read, which makes it suitable for handling big amounts of data.
+
+    For example, to decode the contents of standard input to standard output,
+    the following code could be used:
+    @code
+    wxFFileInputStream fin(stdin);
+    wxBase64DecoderInputStream din(fin);
+    wxFFileOutputStream fout(stdout);
+    din.Read(fout);
+
+    if ( din.GetLastError() != wxSTREAM_EOF ) {
+        ... handle error ...
+    }
+    @endcode
+
+    If the input contains invalid characters, not permitted by the decoding
+    mode specified when creating the stream, or ends in the middle of a
+    4-character group, the stream error is set to ::wxSTREAM_READ_ERROR.
+
+    @library{wxbase}
+    @category{streams}
+
+    @see wxInputStream, wxBase64EncoderOutputStream
+
+    @since 3.3.4
+*/
+class wxBase64DecoderInputStream : public wxFilterInputStream
+{
+public:
+    /**
+        Create decoding stream associated with the given underlying stream.
+
+        This overload does not take ownership of the @a stream.
+
+        @param stream
+            The stream to read BASE64-encoded data from.
+        @param mode
+            Specifies how to handle whitespace and invalid characters in the
+            input, see wxBase64Decode() for the description of the possible
+            values. Notice that, by default, whitespace is skipped, as it is
+            commonly found in the data read from files.
+    */
+    wxBase64DecoderInputStream(wxInputStream& stream,
+                               wxBase64DecodeMode mode = wxBase64DecodeMode_SkipWS);
+
+    /**
+        Create decoding stream associated with the given underlying stream
+        and takes ownership of it.
+
+        As with the base wxFilterInputStream class, passing @a stream by
+        pointer indicates that this object takes ownership of it and will
+        delete it when it is itself destroyed.
+     */
+    wxBase64DecoderInputStream(wxInputStream* stream,
+                               wxBase64DecodeMode mode = wxBase64DecodeMode_SkipWS);
+};
+
+/**
+    @class wxBase64EncoderOutputStream
+
+    This filter stream encodes the data written to it as BASE64 and writes the
+    result to another stream.
+
+    The output is the same as produced by wxBase64Encode() for the
+    concatenation of all the data written to the stream, without any line
+    breaks. Notice that the last bytes of the data, which don't form a
+    complete 3-byte group, can only be encoded once it is known that no more
+    data follows, so the output is only complete after the stream is closed,
+    either explicitly by calling Close() or by destroying it.
+
+    @library{wxbase}
+    @category{streams}
+
+    @see wxOutputStream, wxBase64DecoderInputStream
+
+    @since 3.3.4
+*/
+class wxBase64EncoderOutputStream : public wxFilterOutputStream
+{
+public:
+    /**
+        Create encoding stream associated with the given underlying stream.
+
+        This overload does not take ownership of the @a stream.
+    */
+    wxBase64EncoderOutputStream(wxOutputStream& stream);
+
+    /**
+        Create encoding stream associated with the given underlying stream
+        and takes ownership of it.
+
+        As with the base wxFilterOutputStream class, passing @a stream by
+        pointer indicates that this object takes ownership of it and will
+        delete it when it is itself destroyed.
+     */
+    wxBase64EncoderOutputStream(wxOutputStream* stream);
+
+    /**
+        Write out all the data which can be encoded and close the stream.
+
+        This function encodes any bytes remaining from the previous writes,
+        appending the padding to them if necessary, and writes them to the
+        underlying stream.
+    */
+    bool Close() override;
+};
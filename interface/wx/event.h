@@ -465,6 +465,56 @@ public:
      */
     virtual void QueueEvent(wxEvent *event);
 
+    /**
+        Queue event for a later processing replacing the still pending event
+        queued with the same key.
+
+        This function is similar to QueueEvent() but if an event of the same
+        type was queued by this function with the same @a key and hasn't been
+        processed yet, this event replaces it, i.e. only the latest event is
+        processed, instead of both of them being processed one after another.
+        Events of different types or with different keys don't replace each
+        other.
+
+        This is useful for the events carrying the current state of something,
+        e.g. the progress of a computation, or just notifying the main thread
+        about a change, which can be sent by a worker thread much more often
+        than they can be processed by the main thread: using this function
+        ensures that the number of such pending events remains bounded and
+        that the most recent state is processed as soon as possible.
+
+        Example:
+        @code
+            void FunctionInAWorkerThread(wxEvtHandler* handler, int percent)
+            {
+                wxThreadEvent* evt = new wxThreadEvent(wxEVT_THREAD, ID_PROGRESS);
+                evt->SetInt(percent);
+
+                // Don't queue more than one progress event at any time.
+                handler->QueueCoalescedEvent(evt);
+            }
+        @endcode
+
+        Notice that the replaced event is destroyed by this function, so if
+        the events need to be processed in order with respect to the other
+        events queued for this handler, QueueEvent() must be used.
+
+        Just as QueueEvent(), this function can be called from any thread.
+
+        @param event
+            A heap-allocated event to be queued, this function takes ownership
+            of it. This parameter shouldn't be @NULL.
+        @param key
+            The key which can be used to distinguish between the events of
+            the same type which shouldn't replace each other, e.g. the window
+            ID or a pointer to the object the event is about.
+
+        @see wxQueueCoalescedEvent(), CallAfterCoalesced()
+
+        @since 3.3.4
+     */
+    void QueueCoalescedEvent(wxEvent *event, wxIntPtr key = 0);
+
     /**
         Post an event to be processed later.
 
@@ -526,7 +576,7 @@ public:
          @param method The method to call.
          @param x1 The (optional) first parameter to pass to the method.
             Currently, 0, 1 or 2 parameters can be passed. If you need to pass
-            more than 2 arguments, you can use the CallAfter<T>(const T& fn)
+            more than 2 arguments, you can use the CallAfter<T>(T&& fn)
             overload that can call any functor.
 
          @since 2.9.5
@@ -556,12 +606,61 @@ public:
          });
          @endcode
 
+         The functor is moved, instead of being copied, if it's a temporary,
+         which avoids copying any objects captured by the lambda by value
+         (this is only the case since wxWidgets 3.3.4, previously the
+         functor was always copied).
+
          @param functor The functor to call.
 
          @since 3.0
      */
     template<typename T>
-    void CallAfter(const T& functor);
+    void CallAfter(T&& functor);
+
+    /**
+         Asynchronously call the given method, replacing the pending call made
+         with the same key.
+
+         This function is similar to CallAfter() but if the method or functor
+         scheduled by a previous call to CallAfterCoalesced() with the same @a
+         key hasn't been called yet, it is not called at all and only the
+         method or functor specified by the latest call is called.
+
+         This is useful for refreshing something in response to notifications
+         which can arrive much faster than the refresh can be performed:
+         @code
+         void MyFrame::OnDataChanged()
+         {
+             // Only refresh once, even if this function is called many times
+             // before the next event loop iteration.
+             CallAfterCoalesced(ID_REFRESH, &MyFrame::RefreshData);
+         }
+         @endcode
+
+         @param key The key identifying the calls replacing each other.
+         @param method The method to call.
+         @param x1 The (optional) first parameter to pass to the method, up
+            to 2 parameters can be passed, as with CallAfter().
+
+         @see QueueCoalescedEvent()
+
+         @since 3.3.4
+     */
+    template<typename T, typename T1, ...>
+    void CallAfterCoalesced(wxIntPtr key,
+                            void (T::*method)(T1, ...), T1 x1, ...);
+
+    /**
+         Asynchronously call the given functor, replacing the pending call
+         made with the same key.
+
+         This is the same as the overload above, but for functors.
+
+         @since 3.3.4
+     */
+    template<typename T>
+    void CallAfterCoalesced(wxIntPtr key, T&& functor);
 
     /**
         Processes an event, searching event tables and calling zero or more suitable
@@ -3763,6 +3862,16 @@ public:
     */
     wxThreadEvent(wxEventType eventType = wxEVT_THREAD, int id = wxID_ANY);
 
+    /**
+        Move constructor.
+
+        Moves the string and the payload of the other event instead of copying
+        them, see the wxQueueEvent() overload taking an rvalue event.
+
+        @since 3.3.4
+    */
+    wxThreadEvent(wxThreadEvent&& event);
+
     /**
         Clones this event making sure that all internal members which use
         COW (only @c m_commandString for now; see @ref overview_refcount)
@@ -5471,6 +5580,55 @@ void wxPostEvent(wxEvtHandler* dest, const wxEvent& event);
  */
 void wxQueueEvent(wxEvtHandler* dest, wxEvent *event);
 
+/**
+    Queue an event for processing on the given object by moving it.
+
+    This overload creates a new heap-allocated event by moving the given
+    event into it and queues it. Unlike calling wxEvent::Clone(), this
+    doesn't copy the event string or payload, e.g. for wxThreadEvent, so
+    it's more efficient when the event object is not needed any more:
+    @code
+    wxThreadEvent event;
+    event.SetString(ComputeLongString());
+    event.SetPayload(GetSomeData());
+    wxQueueEvent(handler, std::move(event));
+    @endcode
+
+    Notice that the static type of @a event is used for creating the new
+    event, so it must be the same as its dynamic type.
+
+    This overload only participates in overload resolution if @a event is an
+    rvalue of a class deriving from wxEvent.
+
+    @header{wx/event.h}
+
+    @since 3.3.4
+ */
+template <typename T>
+void wxQueueEvent(wxEvtHandler* dest, T&& event);
+
+/**
+    Queue an event for processing on the given object, replacing the pending
+    event queued with the same key.
+
+    This is a wrapper around wxEvtHandler::QueueCoalescedEvent(), see its
+    documentation for more details.
+
+    @header{wx/event.h}
+
+    @param dest
+        The object to queue the event on, can't be @NULL.
+    @param event
+        The heap-allocated and non-null event to queue, the function takes
+        ownership of it.
+    @param key
+        The key distinguishing the events of the same type which shouldn't
+        replace each other.
+
+    @since 3.3.4
+ */
+void wxQueueCoalescedEvent(wxEvtHandler* dest, wxEvent *event, wxIntPtr key = 0);
+
 #endif // wxUSE_BASE
 
 #if wxUSE_GUI
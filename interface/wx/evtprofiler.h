@@ -0,0 +1,321 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/evtprofiler.h
+// Purpose:     wxEventProfiler class documentation
+// Author:      wxWidgets team
+// Created:     2026-10-19
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+    @class wxEventDispatchStats
+
+    Statistics about the time taken by event dispatching.
+
+    Objects of this class are returned by wxEventProfiler functions and
+    contain the number of the dispatches, their total and maximal durations
+    and a histogram of their durations.
+
+    All times are expressed in microseconds.
+
+    @library{wxbase}
+    @category{events}
+
+    @since 3.3.4
+*/
+class wxEventDispatchStats
+{
+public:
+    /**
+        The number of the histogram buckets.
+
+        The histogram uses logarithmic buckets: the first one contains the
+        dispatches taking less than 1us, the bucket @c N for @c N > 0 the
+        ones taking at least @c 2^(N-1) but less than @c 2^N us and the last
+        one all the dispatches taking longer than this.
+    */
+    enum { HISTOGRAM_SIZE = 32 };
+
+    /// Default constructor creates empty statistics.
+    wxEventDispatchStats();
+
+    /// Records another dispatch which took the given number of microseconds.
+    void Add(wxUint64 usec);
+
+    /// Adds all the dispatches recorded in another object to this one.
+    void Merge(const wxEventDispatchStats& other);
+
+    /// Returns the number of the dispatches.
+    unsigned long GetCount() const;
+
+    /// Returns the total time taken by all the dispatches.
+    wxUint64 GetTotalTime() const;
+
+    /// Returns the time taken by the longest dispatch.
+    wxUint64 GetMaxTime() const;
+
+    /// Returns the average dispatch time or 0 if there were no dispatches.
+    double GetAverageTime() const;
+
+    /**
+        Returns the number of the dispatches in the given histogram bucket.
+
+        @param n Bucket index between 0 and @c HISTOGRAM_SIZE - 1.
+    */
+    unsigned long GetHistogramCount(int n) const;
+
+    /**
+        Returns the upper bound, exclusive, of the times in the given bucket.
+
+        This is simply @c 2^n.
+    */
+    static wxUint64 GetHistogramLimit(int n);
+};
+
+/**
+    Information about a slow event dispatch.
+
+    @see wxEventProfiler::GetSlowDispatches()
+
+    @since 3.3.4
+*/
+struct wxEventSlowDispatch
+{
+    /// The type of the event.
+    wxEventType eventType;
+
+    /// The class name of the event handler which processed the event.
+    wxString handler;
+
+    /// The dispatch time in microseconds.
+    wxUint64 duration;
+};
+
+/**
+    Information about the main event loop stall.
+
+    @see wxEventProfiler::GetStalls()
+
+    @since 3.3.4
+*/
+struct wxEventLoopStall
+{
+    /// The type of the event which was being processed.
+    wxEventType eventType;
+
+    /// The class name of the event handler the event was sent to.
+    wxString handler;
+
+    /**
+        The duration of the stall in milliseconds.
+
+        If the stall is still ongoing, this is the time elapsed until its
+        detection only.
+    */
+    wxUint64 duration;
+
+    /**
+        The stack of the main thread at the moment of the stall detection.
+
+        The stack contains one frame per line and is currently only available
+        under Unix systems when wxUSE_STACKWALKER is on. It is empty if it
+        couldn't be retrieved.
+    */
+    wxString stack;
+};
+
+/**
+    @class wxEventProfiler
+
+    wxEventProfiler collects statistics about the event dispatching and
+    detects the events blocking the main event loop for too long.
+
+    This class only contains static functions and can't be instantiated.
+
+    Statistics collection is disabled by default and has to be explicitly
+    enabled by calling Enable(). When it is disabled, the profiler doesn't
+    add any noticeable overhead to the event processing. When it is enabled,
+    the following data is collected:
+        - The total processing time of each event, from the moment it is
+          sent to the first event handler until the end of its processing,
+          grouped by the event type.
+        - The time taken by each handler which processed the event, grouped
+          by the event handler class name. Notice that for the classes not
+          using wxDECLARE_DYNAMIC_CLASS() the name of their nearest base class
+          using it, e.g. @c wxEvtHandler, is used.
+        - The list of the most recent dispatches that took longer than the
+          slow dispatch threshold, see SetSlowDispatchThreshold().
+
+    Stall detection is independent of the statistics collection and works
+    by running a watchdog thread checking that the main thread doesn't spend
+    more than the given time processing any single event. Notice that
+    running a nested event loop, e.g. showing a modal dialog, from an event
+    handler doesn't count as a stall. Under Unix systems, the stack of the
+    main thread at the moment of stall detection is retrieved by sending it a
+    signal, which is @c SIGRTMIN+3 by default on the systems supporting
+    real-time signals, such as Linux, and can be changed using
+    SetStallStackSignal(). This signal shouldn't be used by the application
+    for anything else while stall detection is running. Notice that, as with
+    any signal, this may interrupt a blocking system call being executed by
+    the main thread, which then fails with @c EINTR error.
+
+    Statistics are accumulated separately by each thread dispatching events
+    and combined only when they are retrieved, so collecting them doesn't
+    require any global locking.
+
+    Example of using this class:
+    @code
+    bool MyApp::OnInit()
+    {
+        wxEventProfiler::Enable();
+        wxEventProfiler::StartStallDetection(200);
+
+        ...
+    }
+
+    int MyApp::OnExit()
+    {
+        wxEventProfiler::StopStallDetection();
+
+        wxFFile("events.json", "w").Write(wxEventProfiler::DumpAsJSON());
+
+        ...
+    }
+    @endcode
+
+    @library{wxbase}
+    @category{events}
+
+    @since 3.3.4
+*/
+class wxEventProfiler
+{
+public:
+    /**
+        Enables or disables collection of the statistics.
+    */
+    static void Enable(bool enable = true);
+
+    /**
+        Returns @true if the statistics are being collected.
+    */
+    static bool IsEnabled();
+
+    /**
+        Discards all the statistics, slow dispatches and stalls collected so
+        far.
+    */
+    static void Reset();
+
+    /**
+        Sets the threshold for the slow dispatches.
+
+        The dispatches of the events to a handler taking at least this number
+        of microseconds are remembered and can be retrieved using
+        GetSlowDispatches(). The default threshold is 10ms.
+    */
+    static void SetSlowDispatchThreshold(wxUint64 usec);
+
+    /**
+        Returns the threshold for the slow dispatches in microseconds.
+    */
+    static wxUint64 GetSlowDispatchThreshold();
+
+    /**
+        Returns the statistics for each event type.
+
+        The times are measured from the moment the event starts being
+        processed until the end of its processing, including all the handlers
+        and any nested events dispatching.
+    */
+    static std::map<wxEventType, wxEventDispatchStats> GetEventTypeStats();
+
+    /**
+        Returns the statistics for the events processed by each event handler
+        class, indexed by the class name.
+    */
+    static std::map<wxString, wxEventDispatchStats> GetHandlerStats();
+
+    /**
+        Returns the most recent slow dispatches.
+
+        At most 100 last slow dispatches are returned.
+    */
+    static std::vector<wxEventSlowDispatch> GetSlowDispatches();
+
+    /**
+        Starts the thread detecting the stalls of the main event loop.
+
+        This function must be called from the main thread. If stall detection
+        is already running, it is restarted with the new threshold.
+
+        @param thresholdMs The maximal time, in milliseconds, that processing
+            of a single event in the main thread can take without being
+            considered to be a stall. Must be strictly positive.
+        @return @true if stall detection was started or @false if it couldn't
+            be done, e.g. because threads are not supported.
+    */
+    static bool StartStallDetection(unsigned long thresholdMs);
+
+    /**
+        Stops detecting the stalls.
+
+        This function waits until the watchdog thread terminates.
+    */
+    static void StopStallDetection();
+
+    /**
+        Returns @true if stall detection is running.
+    */
+    static bool IsStallDetectionRunning();
+
+    /**
+        Returns all the stalls detected so far.
+    */
+    static std::vector<wxEventLoopStall> GetStalls();
+
+    /**
+        Sets the signal used to retrieve the stack of the main thread.
+
+        This function is only useful under Unix systems, where the watchdog
+        thread sends this signal to the main thread to make it store its
+        stack when a stall is detected. By default, @c SIGRTMIN+3 is used if
+        real-time signals are supported and the stack is not retrieved at all
+        otherwise.
+
+        It must be called before StartStallDetection() to have any effect.
+
+        @param sig The signal number to use, which must not be used by the
+            application for anything else, or 0 to disable retrieving the
+            stack.
+    */
+    static void SetStallStackSignal(int sig);
+
+    /**
+        Returns the signal used to retrieve the stack of the main thread.
+
+        Returns 0 if the stack is not retrieved, e.g. because this is not
+        supported on the current platform.
+
+        @see SetStallStackSignal()
+    */
+    static int GetStallStackSignal();
+
+    /**
+        Returns all the collected data as a JSON object.
+
+        The returned object has the following keys:
+            - @c eventTypes: object with the event types as keys and the
+              statistics objects as values.
+            - @c handlers: object with the handler class names as keys and the
+              statistics objects as values.
+            - @c slowDispatches: array of objects with @c eventType,
+              @c handler and @c duration_us keys.
+            - @c stalls: array of objects with @c eventType, @c handler,
+              @c duration_ms and @c stack keys.
+
+        Each statistics object has @c count, @c total_us, @c max_us, @c avg_us
+        and @c histogram keys, with the latter being an array of the counts
+        in each histogram bucket with the trailing zeroes omitted.
+    */
+    static wxString DumpAsJSON();
+};
@@ -79,6 +79,10 @@
     any kind of pointer.
     Similarly three equality predicates: @c wxIntegerEqual, @c wxStringEqual,
     @c wxPointerEqual are provided.
+    Additionally, @c wxStringHashNoCase and @c wxStringEqualNoCase can be used
+    together for the maps with wxString keys which should be compared without
+    taking the case into account (these classes are only available since
+    wxWidgets 3.3.4).
     Using this you could declare a hash map mapping int values to wxString like this:
 
     @code
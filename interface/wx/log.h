@@ -76,6 +76,113 @@ public:
     wxThreadIdType threadId;
 };
 
+/**
+    Log record containing the format string and the arguments of the message
+    instead of the message itself.
+
+    Objects of this class are created by the deferred logging functions, such
+    as wxLogTraceDeferred(), and are passed to wxLog::DoLogDeferredRecord().
+    The message is formatted only when Format() is called, which may happen
+    much later and in a different thread, or not at all if the log target
+    doesn't need the formatted message, e.g. because it saves the records in
+    binary form, as wxLogBinaryFile does.
+
+    Only the pointer to the format string is stored, so it must have static
+    storage duration and the deferred logging functions accept only string
+    literals as format strings. Passing a non-const character array, such as
+    a local buffer, to them results in a compilation error, but this can't be
+    detected for all the other arrays, so please don't use anything but a
+    literal. The format string uses the standard printf()-like format
+    specifiers, including positional ones, except that using @c '*' for the
+    width or precision is not supported. The length modifiers, such as
+    @c 'l', are ignored, as the actual types of the arguments are used
+    instead.
+
+    At most MAX_ARGS arguments can be stored in a record and they must be of
+    one of the following types: any integer or floating point number or
+    enum, any pointer, a narrow or wide C string, wxString or @c std::string.
+    The strings are copied when the record is created, while the other
+    pointers are stored as numbers and can only be used with @c "%p".
+
+    @since 3.3.4
+
+    @library{wxbase}
+    @category{logging}
+ */
+class wxLogDeferredRecord
+{
+public:
+    /// The maximal number of arguments which can be stored.
+    enum { MAX_ARGS = 8 };
+
+    /// The kinds of stored arguments.
+    enum ArgType
+    {
+        Arg_Int,        ///< Any signed integer type, including @c char.
+        Arg_UInt,       ///< Any unsigned integer type, including @c bool.
+        Arg_Double,     ///< Any floating point type.
+        Arg_Pointer,    ///< Any pointer other than to a string.
+        Arg_String      ///< Any string type.
+    };
+
+    /**
+        Creates a record without any arguments.
+
+        This is normally done by the deferred logging functions only.
+     */
+    wxLogDeferredRecord(wxLogLevel level,
+                        const char* format,
+                        const wxLogRecordInfo& info);
+
+    /**
+        Adds the next argument.
+
+        The arguments must be added in the order in which they are used in the
+        format string.
+     */
+    template <typename T>
+    void AddArg(T value);
+
+    /// Returns the number of the stored arguments.
+    size_t GetArgCount() const;
+
+    /// Returns the type of the argument with the given index.
+    ArgType GetArgType(size_t n) const;
+
+    /// Returns the argument of Arg_Int type.
+    wxLongLong_t GetIntArg(size_t n) const;
+
+    /// Returns the argument of Arg_UInt type.
+    wxULongLong_t GetUIntArg(size_t n) const;
+
+    /// Returns the argument of Arg_Double type.
+    double GetDoubleArg(size_t n) const;
+
+    /// Returns the argument of Arg_Pointer type.
+    wxUIntPtr GetPointerArg(size_t n) const;
+
+    /// Returns the argument of Arg_String type.
+    wxString GetStringArg(size_t n) const;
+
+    /**
+        Returns the message formatted using the format string and arguments.
+
+        If the type of an argument doesn't correspond to its format specifier,
+        it is converted to the expected type, e.g. a number is output as
+        string if @c "%s" is used for it.
+     */
+    wxString Format() const;
+
+    /// The log level of this record.
+    wxLogLevel level;
+
+    /// The format string, never null.
+    const char* format;
+
+    /// The information about the record.
+    wxLogRecordInfo info;
+};
+
 /**
     @class wxLogFormatter
 
@@ -370,9 +477,11 @@ public:
 
         When this method is called from the main thread context, it also
         flushes any previously buffered messages logged by the other threads.
-        When it is called from the other threads it simply calls Flush() on the
-        currently active log target, so it mostly makes sense to do this if a
-        thread has its own logger set with SetThreadActiveTarget().
+        These messages are shown in the order of their time stamps, even if
+        they were logged by different threads. When it is called from the
+        other threads it simply calls Flush() on the currently active log
+        target, so it mostly makes sense to do this if a thread has its own
+        logger set with SetThreadActiveTarget().
 
         Note that when using the default log target, this method is called
         automatically before showing any modal dialog, in order to prevent
@@ -462,6 +571,99 @@ public:
      */
     static void SetComponentLevel(const wxString& component, wxLogLevel level);
 
+    /**
+        Limits the rate of log messages from the given component.
+
+        This function allows to prevent a misbehaving component from flooding
+        the log with the messages: after the limit is set, at most @a burst
+        messages from each location, i.e. each wxLogXXX() statement, in this
+        component are logged at once and, after this, the messages are logged
+        at the average rate not exceeding @a messagesPerSecond, while all the
+        other ones are discarded. The messages without any location
+        information, e.g. logged using OnLog() directly, are limited for the
+        entire component.
+
+        The number of the discarded messages is logged periodically, see
+        SetSuppressedSummaryInterval().
+
+        For example, to log at most one message per second, after the first
+        10 ones, from each location in the network code, you could use
+        @code
+            wxLog::SetComponentRateLimit("wx/net", 1, 10);
+        @endcode
+
+        Unlike the other messages, fatal errors are never discarded.
+
+        This function is thread-safe and can be called at any time.
+
+        @param component
+            Component name, possibly using slashes to separate it into several
+            parts, as for SetComponentLevel(). The limit applies to the
+            subcomponents of this component too, unless they have their own
+            limits. If the component is empty, the limit applies to all the
+            components without their own limits.
+        @param messagesPerSecond
+            Maximal average number of messages per second, may be fractional.
+            If it is 0, the existing limit for this component is removed.
+        @param burst
+            Maximal number of messages that can be logged at once. If it is
+            0, @a messagesPerSecond rounded up is used.
+
+        @see SetComponentSampling()
+
+        @since 3.3.4
+     */
+    static void SetComponentRateLimit(const wxString& component,
+                                      double messagesPerSecond,
+                                      unsigned burst = 0);
+
+    /**
+        Logs only some randomly chosen messages from the given component.
+
+        Each message from this component is logged with the given
+        probability, i.e. only the approximately @a ratio fraction of them is
+        logged, while the other ones are discarded. As with
+        SetComponentRateLimit(), the number of the discarded messages is
+        logged periodically.
+
+        Sampling can be combined with the rate limiting: in this case only
+        the messages selected for logging count towards the rate limit.
+
+        This function is thread-safe and can be called at any time.
+
+        @param component
+            Component name, with the same meaning as for
+            SetComponentRateLimit().
+        @param ratio
+            Fraction of messages to log between 0, meaning that no messages
+            are logged at all, and 1, which means logging all of them and
+            removes any existing sampling for this component.
+
+        @since 3.3.4
+     */
+    static void SetComponentSampling(const wxString& component, double ratio);
+
+    /**
+        Sets the minimal interval between the messages about the discarded
+        messages.
+
+        When the messages from some location are discarded due to rate
+        limiting or sampling, a message with the number of the discarded
+        messages, e.g. "42 messages from the same location were suppressed.",
+        is logged before the next message from the same location which is
+        logged or, if there are none, when the log is flushed by
+        FlushActive(). This is done at most once during the given interval
+        for each location.
+
+        @param milliseconds
+            The interval in milliseconds, 10 seconds by default. If it is 0,
+            the number of the discarded messages is logged as soon as
+            possible.
+
+        @since 3.3.4
+     */
+    static void SetSuppressedSummaryInterval(int milliseconds);
+
     /**
         Specifies that log messages with level greater (numerically) than
         @a logLevel should be ignored and not sent to the active log target.
@@ -641,6 +843,17 @@ public:
      */
     void LogRecord(wxLogLevel level, const wxString& msg, const wxLogRecordInfo& info);
 
+    /**
+        Log the given deferred record.
+
+        This is similar to LogRecord() but should be used from
+        DoLogDeferredRecord() implementations passing the record to another
+        log target.
+
+        @since 3.3.4
+     */
+    void LogDeferredRecord(const wxLogDeferredRecord& rec);
+
 protected:
     /**
         @name Logging callbacks.
@@ -692,6 +905,24 @@ protected:
     */
     virtual void DoLogText(const wxString& msg);
 
+    /**
+        Called to log a record created by one of the deferred logging
+        functions, such as wxLogTraceDeferred().
+
+        The default implementation formats the message, using
+        wxLogDeferredRecord::Format(), and then handles it as any other
+        message, i.e. eventually passes it to DoLogRecord(). Override this
+        function to avoid formatting the message or to do it later, e.g. in
+        another thread.
+
+        Note that this function is not called if repetition counting is
+        enabled, see SetRepetitionCounting(), as the message needs to be
+        formatted to compare it with the previous one in this case.
+
+        @since 3.3.4
+     */
+    virtual void DoLogDeferredRecord(const wxLogDeferredRecord& rec);
+
     ///@}
 };
 
@@ -1101,6 +1332,10 @@ public:
     example, to show all the log messages in a frame but still continue to process
     them normally by showing the standard log dialog.
 
+    The messages are shown in the window in the same way as by wxLogTextCtrl,
+    i.e. they are appended to it in batches and not appended at all while the
+    user scrolls the window to look at the previous messages.
+
     @library{wxcore}
     @category{logging}
 
@@ -1157,6 +1392,22 @@ public:
         Shows or hides the frame.
     */
     void Show(bool show = true);
+
+    /**
+        Sets the maximal number of lines shown in the log window.
+
+        When the number of lines exceeds this limit, the oldest ones are
+        removed from the window.
+
+        @param maxLines
+            The maximal number of lines or 0, which is the default, to keep
+            all of them.
+
+        @see wxLogTextCtrl::SetMaxLines()
+
+        @since 3.3.4
+     */
+    void SetMaxLines(int maxLines);
 };
 
 
@@ -1360,6 +1611,16 @@ private:
     The text control must have been created with @c wxTE_MULTILINE style by the
     caller previously.
 
+    As appending the messages to the control one by one may be very slow if
+    many of them are logged, they are collected and appended all at once when
+    the log is flushed, which normally happens during the next idle time, or,
+    if the log is not flushed, at most every 100ms. Call Flush() to append
+    them immediately or use EnableBatching() to disable this behaviour.
+
+    Optionally, the messages may also be not appended while the control is
+    not scrolled to its end, i.e. while the user looks at the previous
+    messages, see EnablePauseOnScroll().
+
     @library{wxcore}
     @category{logging}
 
@@ -1373,6 +1634,67 @@ public:
         control. The @a textctrl parameter cannot be @NULL.
     */
     wxLogTextCtrl(wxTextCtrl* pTextCtrl);
+
+    /**
+        Sets the maximal number of lines kept in the control.
+
+        When the number of lines exceeds this limit, the oldest ones are
+        removed from the control.
+
+        Notice that each message is counted as a single line, unless it
+        contains new lines itself.
+
+        @param maxLines
+            The maximal number of lines or 0, which is the default, to keep
+            all of them.
+
+        @since 3.3.4
+     */
+    void SetMaxLines(int maxLines);
+
+    /**
+        Returns the value set by SetMaxLines().
+
+        @since 3.3.4
+     */
+    int GetMaxLines() const;
+
+    /**
+        Enables or disables appending the messages to the control in batches.
+
+        Batching is enabled by default. When it is disabled, each message is
+        appended to the control as soon as it is logged, which was the only
+        behaviour before wxWidgets 3.3.4.
+
+        @since 3.3.4
+     */
+    void EnableBatching(bool enable = true);
+
+    /**
+        Enables or disables pausing the output while the control is scrolled.
+
+        When this is enabled, the messages are not appended to the control
+        while it is not scrolled to its end, so that the user can look at the
+        previous messages without the control being scrolled to its end again
+        whenever a new message is logged. They are appended when the control
+        is scrolled back to its end. To avoid using too much memory, only the
+        last lines are kept if SetMaxLines() was called and, if it wasn't, the
+        messages are appended anyhow when more than 10000 lines accumulate.
+
+        This is disabled by default, as it relies on the control scrolling
+        information which is not available for all ports.
+
+        @since 3.3.4
+     */
+    void EnablePauseOnScroll(bool enable = true);
+
+    /**
+        Appends all the messages logged since the last flush to the control.
+
+        The messages are not appended if the output is paused, see
+        EnablePauseOnScroll().
+     */
+    virtual void Flush();
 };
 
 
@@ -1467,6 +1789,31 @@ void wxLogGeneric(wxLogLevel level, const char* formatString, ... );
 void wxVLogGeneric(wxLogLevel level, const char* formatString, va_list argPtr);
 ///@}
 
+/** @addtogroup group_funcmacro_log */
+///@{
+/**
+    Logs a message with the given wxLogLevel without formatting it
+    immediately.
+
+    This function is similar to wxLogGeneric() but, instead of formatting the
+    message when it is called, only stores the format string, which must be a
+    string literal, and its arguments in a wxLogDeferredRecord passed to the
+    active log target. The message is then formatted only when, and if, it is
+    output, which may be never, e.g. when using wxLogBinaryFile, or happen in
+    another thread, e.g. when using wxLogAsync. This makes it much cheaper to
+    call this function than wxLogGeneric(), which is important for
+    high-volume logging.
+
+    Please see wxLogDeferredRecord documentation for the restrictions on the
+    format string and the arguments which can be used with it.
+
+    @since 3.3.4
+
+    @header{wx/log.h}
+*/
+void wxLogGenericDeferred(wxLogLevel level, const char* formatString, ... );
+///@}
+
 /** @addtogroup group_funcmacro_log */
 ///@{
 /**
@@ -1594,6 +1941,30 @@ void wxLogTrace(const char* mask, const char* formatString, ... );
 void wxVLogTrace(const char* mask, const char* formatString, va_list argPtr);
 ///@}
 
+/** @addtogroup group_funcmacro_log */
+///@{
+/**
+    Log a trace message without formatting it immediately.
+
+    This function is similar to wxLogTrace() but doesn't format the message
+    when it is called, just as wxLogGenericDeferred(). It is disabled at
+    compile time under the same conditions as wxLogTrace().
+
+    Example of using it to write the trace messages to a binary file:
+    @code
+    wxLog::SetActiveTarget(new wxLogBinaryFile("trace.wxlog"));
+    wxLog::AddTraceMask("io");
+
+    wxLogTraceDeferred("io", "read %zu bytes from %s", count, path);
+    @endcode
+
+    @since 3.3.4
+
+    @header{wx/log.h}
+*/
+void wxLogTraceDeferred(const char* mask, const char* formatString, ... );
+///@}
+
 /** @addtogroup group_funcmacro_log */
 ///@{
 /**
@@ -0,0 +1,157 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        wx/logasync.h
+// Purpose:     interface of wxLogAsync
+// Author:      wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+    Determines what happens when a message is logged to wxLogAsync while its
+    queue is full.
+
+    @since 3.3.4
+*/
+enum wxLogAsyncOverflowPolicy
+{
+    /**
+        Wait until the writer thread makes space in the queue.
+
+        No messages are lost with this policy, but the logging thread may be
+        blocked if messages are logged faster than they can be written.
+     */
+    wxLOG_ASYNC_BLOCK,
+
+    /// Discard the message being logged.
+    wxLOG_ASYNC_DROP,
+
+    /**
+        Discard the oldest message in the queue to make space for the new one.
+
+        If another thread takes the freed space first, the new message is
+        discarded instead. Flush requests are never discarded.
+     */
+    wxLOG_ASYNC_DROP_OLDEST
+};
+
+/**
+    @class wxLogAsync
+
+    Log target passing all messages to another log target from a dedicated
+    background thread.
+
+    Logging a message to this target only adds it to a bounded lock-free
+    queue, while formatting it and writing it out, which may involve blocking
+    I/O, is done by the writer thread. This ensures that logging doesn't slow
+    down the thread doing it, which is especially important for the main
+    thread of GUI applications and for the performance-critical worker
+    threads.
+
+    The wrapped log target is owned by wxLogAsync and is only used from the
+    writer thread, so it must be usable from a thread other than the main
+    one. In particular, GUI log targets such as wxLogGui or wxLogWindow can't
+    be used with this class, but any log target writing to a file, such as
+    wxLogStderr or wxLogStream, can be.
+
+    Example of using it:
+    @code
+    // Log to the given file in the background.
+    wxLog::SetActiveTarget(new wxLogAsync(new wxLogStderr(fp)));
+    @endcode
+
+    Notice that messages logged from threads other than the main one are
+    normally buffered by wxLog until they are flushed from the main thread,
+    see wxLog::SetThreadActiveTarget(). To avoid this, wxLogAsync can be set
+    as the thread-specific target in the worker threads as well, as it can be
+    safely used from any number of threads concurrently.
+
+    When the queue is full, what happens depends on the policy specified in
+    the constructor or SetOverflowPolicy(): by default, the logging thread
+    waits until there is space in the queue, but it is also possible to drop
+    either the new or the oldest messages. In the latter case, the number of
+    dropped messages is counted and a warning indicating how many messages
+    were dropped is written to the wrapped log target before the next message.
+
+    The records created by the deferred logging functions, such as
+    wxLogTraceDeferred(), are formatted by the writer thread too, which makes
+    logging them even cheaper for the calling thread.
+
+    Messages are also written synchronously before terminating the program
+    after a fatal error, i.e. when wxLogFatalError() is called, as well as
+    after the library shutdown, i.e. if the log target is deleted after the
+    threads cleanup.
+
+    @since 3.3.4
+
+    @library{wxbase}
+    @category{logging}
+*/
+class wxLogAsync : public wxLog
+{
+public:
+    /**
+        Creates the asynchronous log target for the given log target.
+
+        @param logger
+            The log target to pass the messages to, must be non-null. This
+            object takes ownership of it and deletes it when it is destroyed.
+        @param capacity
+            The maximal number of messages which can be queued, rounded up to
+            the next power of 2.
+        @param policy
+            What to do when a message is logged while the queue is full.
+     */
+    explicit wxLogAsync(wxLog* logger,
+                        size_t capacity = 4096,
+                        wxLogAsyncOverflowPolicy policy = wxLOG_ASYNC_BLOCK);
+
+    /**
+        Destructor writes all the messages still in the queue, stops the
+        writer thread and deletes the wrapped log target.
+     */
+    virtual ~wxLogAsync();
+
+    /**
+        Returns the wrapped log target.
+     */
+    wxLog* GetLog() const;
+
+    /**
+        Changes the overflow policy used when the queue is full.
+
+        This can be done at any time.
+     */
+    void SetOverflowPolicy(wxLogAsyncOverflowPolicy policy);
+
+    /**
+        Returns the currently used overflow policy.
+     */
+    wxLogAsyncOverflowPolicy GetOverflowPolicy() const;
+
+    /**
+        Returns the total number of messages dropped because the queue was
+        full.
+
+        This is always 0 when using wxLOG_ASYNC_BLOCK overflow policy.
+     */
+    wxUint64 GetDroppedCount() const;
+
+    /**
+        Asks the writer thread to flush the wrapped log target.
+
+        This function doesn't wait for the messages to be written, which will
+        happen later, use FlushAndWait() if this is needed.
+     */
+    virtual void Flush();
+
+    /**
+        Waits until all the messages logged so far are written and the
+        wrapped log target is flushed.
+
+        @param timeout
+            The maximal time to wait, in milliseconds, or -1 to wait for as
+            long as necessary.
+        @return @true if all the messages were written or @false if the
+            timeout expired before this happened.
+     */
+    bool FlushAndWait(long timeout = -1);
+};
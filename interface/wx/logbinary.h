@@ -0,0 +1,155 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        wx/logbinary.h
+// Purpose:     interface of wxLogBinaryFile and wxLogBinaryReader
+// Author:      wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+    @class wxLogBinaryFile
+
+    Log target writing the log records to a file in compact binary format.
+
+    This log target is meant to be used for high-volume logging, typically
+    with the deferred logging functions such as wxLogTraceDeferred() or
+    wxLogGenericDeferred(): the records created by them are written to the
+    file without formatting the message, which is only done when the file is
+    decoded. Only the arguments of each record are written, while the format
+    strings, as well as the names of the source files, functions and log
+    components, are written only once, when they're used for the first time.
+
+    The messages logged by the other logging functions are written as is.
+
+    The file can be read using wxLogBinaryReader or decoded to text by the
+    @c logdecode utility included with wxWidgets.
+
+    This class can be used from several threads simultaneously, e.g. it may be
+    set as the thread-specific log target in several threads. It can also be
+    combined with wxLogAsync to write the file in a background thread.
+
+    @since 3.3.4
+
+    @library{wxbase}
+    @category{logging}
+*/
+class wxLogBinaryFile : public wxLog
+{
+public:
+    /**
+        Default constructor doesn't open any file.
+
+        Open() must be called to use this object.
+     */
+    wxLogBinaryFile();
+
+    /**
+        Constructor creating the file with the given name.
+
+        The file is overwritten if it already exists. Use IsOk() to check if
+        it was created successfully.
+     */
+    explicit wxLogBinaryFile(const wxString& filename);
+
+    /**
+        Destructor writes all the buffered data and closes the file.
+     */
+    virtual ~wxLogBinaryFile();
+
+    /**
+        Creates the file with the given name.
+
+        Closes the previously opened file, if any.
+
+        @return @true if the file was created successfully.
+     */
+    bool Open(const wxString& filename);
+
+    /**
+        Returns @true if the file is opened and no errors occurred while
+        writing to it.
+     */
+    bool IsOk() const;
+
+    /**
+        Writes all the buffered data and closes the file.
+
+        @return @true if all the data was written successfully.
+     */
+    bool Close();
+
+    /**
+        Writes all the buffered data to the file.
+
+        The records are buffered in memory and only written to the file when
+        the buffer becomes full or when this function is called.
+     */
+    virtual void Flush();
+};
+
+/**
+    @class wxLogBinaryReader
+
+    Reads the log records from a file created by wxLogBinaryFile.
+
+    Example of use:
+    @code
+    wxLogBinaryReader reader("trace.wxlog");
+    if ( !reader.IsOk() )
+        return false;
+
+    wxLogLevel level;
+    wxString msg;
+    wxLogRecordInfo info;
+    while ( reader.ReadRecord(level, msg, info) )
+    {
+        wxPrintf("%s:%d: %s\n", info.filename, info.line, msg);
+    }
+
+    if ( reader.HasError() )
+        wxLogError("Log file is corrupted.");
+    @endcode
+
+    @since 3.3.4
+
+    @library{wxbase}
+    @category{logging}
+*/
+class wxLogBinaryReader
+{
+public:
+    /**
+        Opens the file with the given name.
+
+        Use IsOk() to check if the file was opened successfully and is in the
+        supported format.
+     */
+    explicit wxLogBinaryReader(const wxString& filename);
+
+    /**
+        Returns @true if the file was opened successfully and no errors
+        occurred while reading it so far.
+     */
+    bool IsOk() const;
+
+    /**
+        Reads the next record and formats its message.
+
+        The message is formatted in the same way as it would have been done
+        when logging it, including the trace mask prefix and system error
+        suffix, if any.
+
+        Notice that the pointers in @a info remain valid for the lifetime of
+        this object only.
+
+        @return @true if a record was read or @false at the end of the file
+            or if an error occurred, use HasError() to distinguish between
+            these two cases.
+     */
+    bool ReadRecord(wxLogLevel& level, wxString& msg, wxLogRecordInfo& info);
+
+    /**
+        Returns @true if the file is not a valid binary log file or is
+        truncated.
+     */
+    bool HasError() const;
+};
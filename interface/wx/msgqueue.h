@@ -21,7 +21,8 @@ enum wxMessageQueueError
     /**
         Indicates that no messages were received before timeout expired.
 
-        This return value is only used by wxMessageQueue<>::ReceiveTimeout().
+        This return value is only used by wxMessageQueue<>::ReceiveTimeout()
+        and by wxBoundedMessageQueue<> functions taking a timeout.
      */
     wxMSGQUEUE_TIMEOUT,
 
@@ -119,3 +120,186 @@ public:
     wxMessageQueueError ReceiveTimeout(long timeout, T& msg);
 };
 
+/**
+    The kinds of wxBoundedMessageQueue.
+
+    @since 3.3.4
+ */
+enum wxBoundedQueueKind
+{
+    /// Any number of threads can post and receive messages.
+    wxQUEUE_MPMC,
+
+    /**
+        Only a single thread can post messages and only a single, possibly
+        different, thread can receive them.
+
+        This is more efficient than wxQUEUE_MPMC but using the queue from
+        more than one producer or consumer thread results in undefined
+        behaviour.
+     */
+    wxQUEUE_SPSC
+};
+
+/**
+    Bounded message queue implemented using a lock-free ring buffer.
+
+    This class provides the same functionality as wxMessageQueue but is much
+    more efficient when messages are exchanged between the threads at high
+    rate, as neither posting nor receiving a message locks any mutex unless
+    the queue is empty or full and the thread needs to wait.
+
+    Contrary to wxMessageQueue, this queue has a fixed capacity specified
+    when creating it. When the queue is full, Post() waits until a consumer
+    receives a message, which provides natural back-pressure preventing
+    producers from getting too far ahead of the consumers, while TryPost()
+    returns @false immediately, allowing the producer to decide what to do
+    with the message it couldn't post.
+
+    Example of using the queue for passing the decoded frames to the thread
+    rendering them:
+    @code
+    wxSPSCMessageQueue<Frame> queue(16);
+
+    // In the decoding thread:
+    while ( DecodeNextFrame(frame) )
+        queue.Post(std::move(frame));
+    queue.Post(Frame()); // Empty frame indicates the end of stream.
+
+    // In the rendering thread:
+    std::vector<Frame> frames;
+    for ( ;; )
+    {
+        frames.clear();
+        queue.ReceiveBatch(frames, 8);
+        for ( auto& frame : frames )
+        {
+            if ( frame.IsEmpty() )
+                return;
+
+            Render(frame);
+        }
+    }
+    @endcode
+
+    @tparam T
+        The type of the messages, which must be default-constructible and
+        movable and whose move constructor and move assignment operator
+        must not throw.
+    @tparam kind
+        Either ::wxQUEUE_MPMC (default) or ::wxQUEUE_SPSC, the latter can be
+        also used via wxSPSCMessageQueue<T> alias.
+
+    @since 3.3.4
+
+    @nolibrary
+    @category{threading}
+
+    @see wxMessageQueue
+*/
+template <typename T, wxBoundedQueueKind kind = wxQUEUE_MPMC>
+class wxBoundedMessageQueue<T, kind>
+{
+public:
+    /**
+        Create the queue able to contain at least the given number of
+        messages.
+
+        The capacity is rounded up to the next power of 2, see GetCapacity().
+     */
+    explicit wxBoundedMessageQueue(size_t capacity);
+
+    /**
+        Returns @true if the object had been initialized successfully, @false
+        if an error occurred.
+    */
+    bool IsOk() const;
+
+    /**
+        Returns the maximal number of messages in the queue.
+     */
+    size_t GetCapacity() const;
+
+    /**
+        Add a message to the queue if it is not full.
+
+        Returns @true if the message was added or @false, without waiting and
+        without modifying @a msg, if the queue is full.
+     */
+    bool TryPost(const T& msg);
+
+    /// @overload
+    bool TryPost(T&& msg);
+
+    /**
+        Add a message to the queue, waiting until there is space for it if
+        the queue is full.
+     */
+    wxMessageQueueError Post(const T& msg);
+
+    /// @overload
+    wxMessageQueueError Post(T&& msg);
+
+    /**
+        Add a message to the queue, waiting no more than @a timeout
+        milliseconds if the queue is full.
+
+        Returns @c wxMSGQUEUE_TIMEOUT if the queue remained full during all
+        this time.
+     */
+    wxMessageQueueError PostTimeout(long timeout, const T& msg);
+
+    /// @overload
+    wxMessageQueueError PostTimeout(long timeout, T&& msg);
+
+    /**
+        Get a message from the queue if it is not empty.
+
+        Returns @false without waiting if the queue is empty.
+     */
+    bool TryReceive(T& msg);
+
+    /**
+        Get a message from the queue, waiting for as long as necessary until
+        one becomes available.
+     */
+    wxMessageQueueError Receive(T& msg);
+
+    /**
+        Get a message from the queue, waiting no more than @a timeout
+        milliseconds until one becomes available.
+
+        Returns @c wxMSGQUEUE_TIMEOUT if no message became available.
+     */
+    wxMessageQueueError ReceiveTimeout(long timeout, T& msg);
+
+    /**
+        Get up to @a maxCount messages currently in the queue without
+        waiting.
+
+        The messages are appended to the provided vector.
+
+        Returns the number of the messages received, which may be 0.
+     */
+    size_t TryReceiveBatch(std::vector<T>& msgs, size_t maxCount);
+
+    /**
+        Get up to @a maxCount messages from the queue, waiting until at least
+        one of them becomes available.
+
+        The messages are appended to the provided vector. Receiving messages
+        in batches is more efficient than receiving them one by one.
+     */
+    wxMessageQueueError ReceiveBatch(std::vector<T>& msgs, size_t maxCount);
+};
+
+/**
+    Bounded message queue which can be used only by a single producer and a
+    single consumer thread.
+
+    This is just a synonym for wxBoundedMessageQueue<T, wxQUEUE_SPSC>.
+
+    @since 3.3.4
+ */
+template <typename T>
+using wxSPSCMessageQueue = wxBoundedMessageQueue<T, wxQUEUE_SPSC>;
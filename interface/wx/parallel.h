@@ -0,0 +1,150 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/parallel.h
+// Purpose:     Parallel algorithms documentation
+// Author:      wxWidgets team
+// Created:     2026-10-19
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+/** @addtogroup group_funcmacro_thread */
+///@{
+
+/**
+    Sets the maximal number of threads used by the parallel algorithms.
+
+    This limit applies to all functions declared in this header and includes
+    the calling thread, e.g. setting it to 1 makes all of them execute
+    serially in the calling thread. The other threads are taken from the
+    global wxThreadPool.
+
+    @param numThreads The maximal number of threads or 0 to use the default
+        limit, which is the number of CPUs in the system.
+
+    @header{wx/parallel.h}
+
+    @since 3.3.4
+*/
+void wxSetParallelConcurrency(unsigned numThreads);
+
+/**
+    Returns the maximal number of threads used by the parallel algorithms.
+
+    This is the value set by wxSetParallelConcurrency() or the number of CPUs
+    in the system by default. It is always 1 if @c wxUSE_THREADS is 0.
+
+    @header{wx/parallel.h}
+
+    @since 3.3.4
+*/
+unsigned wxGetParallelConcurrency();
+
+/**
+    Calls the given function for subranges covering the given range,
+    possibly concurrently.
+
+    The range is split into consecutive non-overlapping chunks and @a func is
+    called with the beginning and the end, exclusive, of each of them. By
+    default, i.e. if @a grainSize is 0, a few chunks are created for each of
+    the wxGetParallelConcurrency() threads, so that the threads which are done
+    with their chunks faster could take more of them. Specifying @a grainSize
+    ensures that the chunks contain at least this number of elements, which
+    is useful when processing each of them is very fast and the overhead of
+    the parallelization would be too high otherwise.
+
+    The calling thread participates in the execution and the function only
+    returns once all the chunks have been processed. If @a func throws an
+    exception, no more chunks are started and the exception is rethrown
+    from this function once all the already running chunks finish.
+
+    Example:
+    @code
+    wxParallelForRange(0, image.GetHeight(), [&](size_t from, size_t to)
+        {
+            for ( size_t y = from; y < to; y++ )
+                ProcessRow(image, y);
+        });
+    @endcode
+
+    @header{wx/parallel.h}
+
+    @since 3.3.4
+*/
+void wxParallelForRange(size_t begin,
+                        size_t end,
+                        const std::function<void (size_t, size_t)>& func,
+                        size_t grainSize = 0);
+
+/**
+    Calls the given function for all indices in the given range, possibly
+    concurrently.
+
+    This is a convenient wrapper for wxParallelForRange() calling @a func
+    for each index in [@a begin, @a end) range.
+
+    @header{wx/parallel.h}
+
+    @since 3.3.4
+*/
+template <typename Func>
+void wxParallelFor(size_t begin, size_t end, const Func& func, size_t grainSize = 0);
+
+/**
+    Combines the values returned by the given function for all indices in
+    the given range, possibly concurrently.
+
+    The range is split into chunks in the same way as by wxParallelForRange()
+    and the values of @a func for all indices in each chunk are combined
+    using @a reduce, starting with @a identity, then the values for all chunks
+    are combined in their order. Hence @a reduce must be associative, but
+    doesn't need to be commutative, and the result doesn't depend on the
+    order in which the chunks are processed, although it may depend on the
+    number of the chunks for the floating point values.
+
+    Example computing the sum of squares:
+    @code
+    double sum = wxParallelReduce(0, v.size(), 0.0,
+                                  [&v](size_t i) { return v[i]*v[i]; },
+                                  std::plus<double>());
+    @endcode
+
+    @header{wx/parallel.h}
+
+    @since 3.3.4
+*/
+template <typename T, typename Func, typename Reduce>
+T wxParallelReduce(size_t begin,
+                   size_t end,
+                   const T& identity,
+                   const Func& func,
+                   const Reduce& reduce,
+                   size_t grainSize = 0);
+
+/**
+    Sorts the range using multiple threads.
+
+    For sufficiently big ranges, having many thousands of elements, this
+    function sorts the parts of the range concurrently using std::sort() and
+    then merges them, also concurrently. Smaller ranges are just sorted
+    using std::sort() directly.
+
+    Just as std::sort(), this function doesn't preserve the order of the
+    equal elements. The comparator must be thread-safe.
+
+    @header{wx/parallel.h}
+
+    @since 3.3.4
+*/
+template <typename RandomIt, typename Compare>
+void wxParallelSort(RandomIt first, RandomIt last, const Compare& comp);
+
+/**
+    Sorts the range using multiple threads and @c operator<.
+
+    @header{wx/parallel.h}
+
+    @since 3.3.4
+*/
+template <typename RandomIt>
+void wxParallelSort(RandomIt first, RandomIt last);
+
+///@}
@@ -30,10 +30,18 @@
     and GetErrorStream() can then be used to retrieve the streams corresponding to the
     child process standard output, input and error output respectively.
 
+    Alternatively, the output of the child process can be delivered to the
+    program as it becomes available if StreamOutput() is called before passing
+    the object to ::wxExecute(), see its documentation for more details.
+
     @beginEventEmissionTable{wxProcessEvent}
     @event{EVT_END_PROCESS(id, func)}
         Process a @c wxEVT_END_PROCESS event, sent by wxProcess::OnTerminate upon
         the external process termination.
+    @event{EVT_PROCESS_OUTPUT(id, func)}
+        Process a @c wxEVT_PROCESS_OUTPUT event, sent by wxProcess::OnOutput
+        when a chunk of the child process output is read, see StreamOutput().
+        This event is generated by wxProcessOutputEvent.
     @endEventTable
 
     @library{wxbase}
@@ -68,10 +76,11 @@ public:
     /**
         Creates an object without any associated parent (and hence no id either)
         but allows specifying the @a flags which can have the value of
-        @c wxPROCESS_DEFAULT or @c wxPROCESS_REDIRECT.
+        @c wxPROCESS_DEFAULT, @c wxPROCESS_REDIRECT or @c wxPROCESS_STREAM_OUTPUT.
 
-        Specifying the former value has no particular effect while using the latter
-        one is equivalent to calling Redirect().
+        Specifying the first value has no particular effect while using the
+        second one is equivalent to calling Redirect() and the last one is
+        equivalent to calling StreamOutput() with the default chunk size.
     */
     wxProcess(int flags);
 
@@ -221,6 +230,31 @@ public:
     */
     virtual void OnTerminate(int pid, int status);
 
+    /**
+        It is called when a chunk of the output of the child process is read
+        if StreamOutput() was used.
+
+        The default implementation sends a wxProcessOutputEvent to this object
+        itself, which means that it is also propagated to the parent event
+        handler, if any. This function can be overridden to process the data
+        directly instead.
+
+        Notice that @a data is only valid during this function execution and
+        must be copied if it needs to be used later.
+
+        @param data
+            Pointer to the data read from the child process, never @NULL.
+        @param len
+            The length of the data in bytes, always strictly positive and not
+            greater than the chunk size passed to StreamOutput().
+        @param isError
+            @true if the data was read from the standard error of the child
+            process or @false if it comes from its standard output.
+
+        @since 3.3.4
+    */
+    virtual void OnOutput(const void* data, size_t len, bool isError);
+
     /**
         This static method replaces the standard @c popen() function: it launches
         the process specified by the @a cmd parameter and returns the wxProcess
@@ -257,6 +291,83 @@ public:
     */
     void Redirect();
 
+    /**
+        Turns on streaming of the child process output.
+
+        This function implies Redirect() but, instead of making the output and
+        the error output of the child process available via GetInputStream()
+        and GetErrorStream(), it makes ::wxExecute() read them from the event
+        loop as soon as they become available and pass them to OnOutput() in
+        chunks of at most @a chunkSize bytes. Only a single buffer of this size
+        is used for each of the two outputs, so the memory consumption doesn't
+        depend on the amount of output produced by the child process.
+
+        If the program can't process the data as fast as the child produces
+        it, PauseOutput() can be used to stop reading it temporarily. When the
+        output is paused, the pipes connected to the child become full and
+        the child process blocks when it tries to write more data, until
+        ResumeOutput() is called.
+
+        OnTerminate() is only called after all the output of the child process
+        has been passed to OnOutput(), so no more output notifications happen
+        after it.
+
+        Output streaming is currently only implemented under Unix and only for
+        the asynchronous execution, i.e. it is ignored when @c wxEXEC_SYNC is
+        used and the streams are used as with Redirect() in this case. Notice
+        that the standard input of the child process is still available via
+        GetOutputStream() when streaming its output.
+
+        This function must be called before passing this object to
+        ::wxExecute().
+
+        @since 3.3.4
+    */
+    void StreamOutput(size_t chunkSize = 65536);
+
+    /**
+        Returns @true if StreamOutput() had been called.
+
+        @since 3.3.4
+    */
+    bool IsOutputStreamed() const;
+
+    /**
+        Returns the chunk size passed to StreamOutput() or 0 if it hadn't been
+        called.
+
+        @since 3.3.4
+    */
+    size_t GetOutputChunkSize() const;
+
+    /**
+        Temporarily stops reading the output of the child process.
+
+        This function can be called at any time, including from OnOutput()
+        and even before the process is launched, and OnOutput() won't be
+        called any more until ResumeOutput() is called. Notice that it is
+        possible for OnOutput() to be called once more if this function is
+        called from inside it for one of the outputs and the other one already
+        has data waiting to be read.
+
+        @since 3.3.4
+    */
+    void PauseOutput();
+
+    /**
+        Resumes reading the output paused by PauseOutput().
+
+        @since 3.3.4
+    */
+    void ResumeOutput();
+
+    /**
+        Returns @true if the output is currently paused.
+
+        @since 3.3.4
+    */
+    bool IsOutputPaused() const;
+
     /**
         Sets the priority of the process, between 0 (lowest) and 100 (highest).
         It can only be set before the process is created.
@@ -316,3 +427,63 @@ public:
 
 wxEventType wxEVT_END_PROCESS;
 
+/**
+    @class wxProcessOutputEvent
+
+    Event containing a chunk of the child process output, sent by wxProcess
+    when its output is streamed, see wxProcess::StreamOutput().
+
+    Notice that the data is owned by wxProcess and remains valid only while
+    the event is being processed, unless the event object is copied, e.g.
+    when it's queued for later processing, in which case the copy has its own
+    copy of the data.
+
+    @beginEventTable{wxProcessOutputEvent}
+    @event{EVT_PROCESS_OUTPUT(id, func)}
+        Process a @c wxEVT_PROCESS_OUTPUT event. @a id is the identifier of the
+        process object (the id passed to the wxProcess constructor).
+    @endEventTable
+
+    @since 3.3.4
+
+    @library{wxbase}
+    @category{events}
+
+    @see wxProcess
+*/
+class wxProcessOutputEvent : public wxEvent
+{
+public:
+    /**
+        Constructor.
+
+        Doesn't copy the data, which must remain valid during the lifetime
+        of this object.
+    */
+    wxProcessOutputEvent(int id = 0, int pid = 0,
+                         const void* data = nullptr, size_t len = 0,
+                         bool isError = false);
+
+    /**
+        Returns the process id.
+    */
+    int GetPid() const;
+
+    /**
+        Returns the pointer to the data read from the child process.
+    */
+    const void* GetData() const;
+
+    /**
+        Returns the length of the data in bytes.
+    */
+    size_t GetDataLen() const;
+
+    /**
+        Returns @true if the data comes from the standard error of the child
+        process and @false if it comes from its standard output.
+    */
+    bool IsError() const;
+};
+
+wxEventType wxEVT_PROCESS_OUTPUT;
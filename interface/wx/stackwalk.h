@@ -43,6 +43,18 @@
     Of course, all this is only @true if you build using a recent enough version
     of GNU libc which provides the @c backtrace() function needed to walk the stack.
 
+    Under Linux, the symbol tables and the DWARF line information of the
+    program and the shared libraries it uses are read directly by wxWidgets,
+    which is much faster than running the external @c addr2line tool, used
+    under the other Unix systems, and works even if it is not installed. The
+    information about each module is loaded when it is needed for the first
+    time and cached, so walking the stack again is fast. Separate debug
+    information files, installed under @c /usr/lib/debug by many Linux
+    distributions, are used for the stripped modules. @c addr2line is still
+    used, if available, for the addresses which couldn't be resolved in this
+    way, e.g. because the module uses compressed debug information. Since
+    wxWidgets 3.3.4.
+
     See @ref overview_debugging for how to make it available.
 
     @library{wxbase}
@@ -267,6 +267,52 @@ public:
      */
     wxCharBuffer cWC2MB(const wxWCharBuffer& buf) const;
 
+    /**
+        Converts from multibyte encoding to wide characters, storing the
+        result in the provided buffer.
+
+        Unlike cMB2WC(), this function reuses the existing buffer if it is
+        big enough to contain the output and, in the common case, performs
+        the conversion in a single pass by estimating the maximal length of
+        the output instead of computing its exact value first. It is
+        therefore more efficient when converting many strings in a loop.
+
+        The parameters @a src and @a srcLen have the same meaning as for
+        ToWChar().
+
+        @param buf
+            The buffer to store the result in. It is reallocated if it is too
+            small and its length is set to the returned value on success. It
+            must not share its data with any other buffer object.
+        @param src
+            The input string.
+        @param srcLen
+            The length of the input string or @c wxNO_LEN if it is
+            @c NUL-terminated.
+        @return
+            The number of characters written to the buffer, including the
+            trailing @c NUL if it was part of the input, as for ToWChar(), or
+            @c wxCONV_FAILED on error.
+
+        @since 3.3.4
+     */
+    size_t ToWCharInto(wxWCharBuffer& buf,
+                       const char* src, size_t srcLen = wxNO_LEN) const;
+
+    /**
+        Converts from wide characters to multibyte encoding, storing the
+        result in the provided buffer.
+
+        This is the counterpart of ToWCharInto() using FromWChar() for the
+        conversion. The maximal length of the output is estimated using
+        GetMaxCharLen(), so custom conversion classes using more than one byte
+        per character should override it to benefit from this function.
+
+        @since 3.3.4
+     */
+    size_t FromWCharInto(wxCharBuffer& buf,
+                         const wchar_t* src, size_t srcLen = wxNO_LEN) const;
+
     ///@{
     /**
         Converts from Unicode to the current wxChar type.
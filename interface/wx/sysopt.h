@@ -117,6 +117,40 @@
     @endFlagTable
 
 
+    @section sysopt_unix Unix
+
+    @beginFlagTable
+    @flag{unix.timer.slack}
+        Maximal delay, in milliseconds, of wxTimer notifications in console
+        applications. If this option is set to a positive value, the
+        notification of a timer may be delayed by at most this amount of time
+        to allow notifying it together with the other timers expiring soon
+        after it, which reduces the number of wake ups of the program when it
+        uses many timers. Default: 0, i.e. the timers are notified as soon as
+        they expire. This option must be set before starting any timers to
+        have effect. This option has been added in wxWidgets 3.3.4.
+    @flag{unix.epoll.max_events}
+        Maximal number of events retrieved by a single @c epoll_wait() call
+        when using epoll() for monitoring the file descriptors in console
+        applications, e.g. for wxSocket or wxProcess events. Increasing it may
+        reduce the number of system calls in the programs handling many events
+        simultaneously. Default: 64. This option must be set before creating
+        any sockets or event loops to have effect. This option has been added
+        in wxWidgets 3.3.4.
+    @flag{unix.execute.use_fork}
+        If set to 1, wxExecute() always uses @c fork() to launch the child
+        process. By default, @c posix_spawn() is used instead when it is
+        available and supports all the options used, as it is much faster
+        for the programs using a lot of memory. This option has been added in
+        wxWidgets 3.3.4.
+    @flag{unix.stackwalk.use_addr2line}
+        If set to 1, wxStackWalker always uses the external @c addr2line tool
+        to find the function names and source locations under Linux instead
+        of reading the symbols and debug information of the modules directly.
+        This option has been added in wxWidgets 3.3.4.
+    @endFlagTable
+
+
     @section sysopt_mac Mac
 
     @beginFlagTable
@@ -686,6 +686,82 @@ enum wxThreadKind
     wxTHREAD_JOINABLE
 };
 
+/**
+    Scheduling policies which can be used with wxThread::SetSchedPolicy().
+
+    Not all policies are available under all platforms. Under Windows, which
+    doesn't have scheduling policies, they are mapped to the thread priorities
+    as closely as possible.
+
+    @since 3.3.4
+*/
+enum wxThreadSchedPolicy
+{
+    /// Normal time-sharing scheduling used by default.
+    wxTHREAD_SCHED_DEFAULT,
+
+    /**
+        Policy for CPU-bound non-interactive threads.
+
+        The thread is assumed to be throughput-bound, so it is preempted less
+        often but also gets a slight penalty when competing with interactive
+        threads.
+     */
+    wxTHREAD_SCHED_BATCH,
+
+    /// Run the thread only when the system has nothing else to do.
+    wxTHREAD_SCHED_IDLE,
+
+    /**
+        Real-time policy: the thread runs until it blocks or a thread with a
+        higher priority becomes runnable.
+
+        Using this policy usually requires special privileges.
+     */
+    wxTHREAD_SCHED_FIFO,
+
+    /**
+        Real-time policy similar to wxTHREAD_SCHED_FIFO but the threads with
+        the same priority are executed in turn.
+
+        Using this policy usually requires special privileges.
+     */
+    wxTHREAD_SCHED_RR
+};
+
+/**
+    CPU usage statistics of a thread.
+
+    This struct is filled by wxThread::GetCPUStats() and
+    wxThread::GetCPUStatsForCurrent().
+
+    @since 3.3.4
+*/
+struct wxThreadCPUStats
+{
+    /// CPU time spent executing in user mode, in microseconds.
+    wxUint64 userTime;
+
+    /// CPU time spent executing in kernel mode, in microseconds.
+    wxUint64 systemTime;
+
+    /**
+        Number of the context switches because the thread blocked waiting
+        for something.
+
+        This is always 0 under Windows.
+     */
+    wxUint64 voluntarySwitches;
+
+    /**
+        Number of the context switches because the thread was preempted by
+        the scheduler.
+
+        This is always 0 under Windows.
+     */
+    wxUint64 involuntarySwitches;
+};
+
 /**
   The possible thread errors.
 */
@@ -1147,6 +1223,124 @@ public:
     */
     unsigned int GetPriority() const;
 
+    /**
+        Restricts the thread to run only on the given CPUs.
+
+        The CPUs are identified by their 0-based indices, which must be less
+        than the value returned by GetCPUCount(). Pinning the thread to a
+        single CPU may be useful for latency-sensitive threads, as it
+        preserves the contents of the CPU caches used by them.
+
+        This function can only be called after creating the thread, but may
+        be called before Run(), e.g.
+        @code
+        thread->Create();
+        thread->SetAffinity({0});
+        thread->Run();
+        @endcode
+
+        Currently this function is implemented under Linux and Windows, where
+        only the first 64 CPUs can be used, and returns @false elsewhere.
+
+        @return @true if the affinity was successfully changed.
+
+        @see SetAffinityForCurrent(), GetAffinity()
+
+        @since 3.3.4
+    */
+    bool SetAffinity(const std::vector<int>& cpus);
+
+    /**
+        Gets the CPUs the thread may run on.
+
+        The thread must have been created. Returns @false if the affinity
+        couldn't be retrieved.
+
+        @see SetAffinity()
+
+        @since 3.3.4
+    */
+    bool GetAffinity(std::vector<int>& cpus) const;
+
+    /**
+        Sets the scheduling policy of the thread.
+
+        This can be used instead of SetPriority() to have more control over
+        how the thread is scheduled. The @a priority argument is only used
+        with the real-time policies wxTHREAD_SCHED_FIFO and wxTHREAD_SCHED_RR
+        and is clipped to the range supported by the system, which is 1..99
+        under Linux, with 0 corresponding to the lowest possible priority.
+
+        As with SetAffinity(), this function can only be called after
+        creating the thread but can be called before running it.
+
+        @return @true if the policy was successfully changed, @false if it is
+            not supported or if the process doesn't have the permission to
+            use it.
+
+        @see SetSchedPolicyForCurrent()
+
+        @since 3.3.4
+    */
+    bool SetSchedPolicy(wxThreadSchedPolicy policy, int priority = 0);
+
+    /**
+        Gets the CPU usage statistics of this thread.
+
+        Under Linux the statistics of threads other than the calling one are
+        read from the @c /proc file system and their CPU time has only clock
+        tick resolution.
+
+        Currently this function is implemented under Linux and Windows only.
+
+        @return @true if the statistics were retrieved successfully.
+
+        @see GetCPUStatsForCurrent()
+
+        @since 3.3.4
+    */
+    bool GetCPUStats(wxThreadCPUStats& stats) const;
+
+    /**
+        Restricts the calling thread to run only on the given CPUs.
+
+        This is the same as SetAffinity() but for the current thread, which
+        doesn't need to be a wxThread.
+
+        @since 3.3.4
+    */
+    static bool SetAffinityForCurrent(const std::vector<int>& cpus);
+
+    /**
+        Gets the CPUs the calling thread may run on.
+
+        @see GetAffinity()
+
+        @since 3.3.4
+    */
+    static bool GetAffinityForCurrent(std::vector<int>& cpus);
+
+    /**
+        Sets the scheduling policy of the calling thread.
+
+        This is the same as SetSchedPolicy() but for the current thread,
+        which doesn't need to be a wxThread.
+
+        @since 3.3.4
+    */
+    static bool SetSchedPolicyForCurrent(wxThreadSchedPolicy policy,
+                                         int priority = 0);
+
+    /**
+        Gets the CPU usage statistics of the calling thread.
+
+        This is the same as GetCPUStats() but for the current thread, which
+        doesn't need to be a wxThread.
+
+        @since 3.3.4
+    */
+    static bool GetCPUStatsForCurrent(wxThreadCPUStats& stats);
+
     /**
         Returns @true if the thread is alive (i.e.\ started and not terminating).
 
@@ -1717,6 +1911,272 @@ public:
 };
 
 
+/**
+    @class wxSharedMutex
+
+    A shared mutex, also known as reader-writer lock, can be locked either
+    exclusively by a single thread or in shared mode by any number of threads
+    at once.
+
+    This is useful for protecting data which is read much more often than it
+    is modified, e.g. a cache: the threads only reading the data can lock the
+    mutex in shared mode using LockShared(), or, preferably, wxReadLocker, and
+    do it concurrently, while the threads modifying it lock it exclusively
+    using Lock(), or wxWriteLocker, which waits until all the readers release
+    it and prevents any other thread from locking it until it is unlocked.
+
+    Example:
+    @code
+    class Cache
+    {
+    public:
+        bool Find(const wxString& key, wxString& value)
+        {
+            wxReadLocker lock(m_mutex);
+
+            const auto it = m_map.find(key);
+            if ( it == m_map.end() )
+                return false;
+
+            value = it->second;
+            return true;
+        }
+
+        void Add(const wxString& key, const wxString& value)
+        {
+            wxWriteLocker lock(m_mutex);
+
+            m_map[key] = value;
+        }
+
+    private:
+        std::unordered_map<wxString, wxString> m_map;
+        wxSharedMutex m_mutex;
+    };
+    @endcode
+
+    This mutex is not recursive, i.e. the thread which has locked it, in any
+    mode, must not try to lock it again. Under Unix it is implemented using
+    POSIX read-write locks, preferring the writers when possible, so that the
+    threads waiting to lock the mutex exclusively are not starved by the
+    readers, and under MSW using slim reader/writer locks.
+
+    @library{wxbase}
+    @category{threading}
+
+    @see wxMutex, wxSpinMutex
+
+    @since 3.3.4
+*/
+class wxSharedMutex
+{
+public:
+    /**
+        Default constructor.
+    */
+    wxSharedMutex();
+
+    /**
+        Destroys the mutex, which must not be locked.
+    */
+    ~wxSharedMutex();
+
+    /**
+        Returns @true if the mutex was created successfully.
+    */
+    bool IsOk() const;
+
+    /**
+        Locks the mutex exclusively.
+
+        Blocks until no other thread holds the mutex, neither exclusively nor
+        in shared mode.
+    */
+    wxMutexError Lock();
+
+    /**
+        Tries to lock the mutex exclusively without blocking.
+
+        @return wxMUTEX_BUSY if the mutex is locked by another thread.
+    */
+    wxMutexError TryLock();
+
+    /**
+        Unlocks the mutex locked using Lock() or TryLock().
+    */
+    wxMutexError Unlock();
+
+    /**
+        Locks the mutex in shared mode.
+
+        Blocks only while another thread holds the mutex exclusively, or
+        waits to lock it exclusively.
+    */
+    wxMutexError LockShared();
+
+    /**
+        Tries to lock the mutex in shared mode without blocking.
+
+        @return wxMUTEX_BUSY if the mutex is locked exclusively by another
+            thread.
+    */
+    wxMutexError TryLockShared();
+
+    /**
+        Unlocks the mutex locked using LockShared() or TryLockShared().
+    */
+    wxMutexError UnlockShared();
+};
+
+/**
+    @class wxReadLocker
+
+    Locks wxSharedMutex in shared mode in its constructor and unlocks it in
+    its destructor.
+
+    @library{wxbase}
+    @category{threading}
+
+    @see wxWriteLocker
+
+    @since 3.3.4
+*/
+class wxReadLocker
+{
+public:
+    /**
+        Locks the mutex in shared mode.
+
+        Call IsOk() to check if the mutex was successfully locked.
+    */
+    wxReadLocker(wxSharedMutex& mutex);
+
+    /**
+        Unlocks the mutex if it was successfully locked in the constructor.
+    */
+    ~wxReadLocker();
+
+    /**
+        Returns @true if the mutex was locked in the constructor.
+    */
+    bool IsOk() const;
+};
+
+/**
+    @class wxWriteLocker
+
+    Locks wxSharedMutex exclusively in its constructor and unlocks it in its
+    destructor.
+
+    @library{wxbase}
+    @category{threading}
+
+    @see wxReadLocker
+
+    @since 3.3.4
+*/
+class wxWriteLocker
+{
+public:
+    /**
+        Locks the mutex exclusively.
+
+        Call IsOk() to check if the mutex was successfully locked.
+    */
+    wxWriteLocker(wxSharedMutex& mutex);
+
+    /**
+        Unlocks the mutex if it was successfully locked in the constructor.
+    */
+    ~wxWriteLocker();
+
+    /**
+        Returns @true if the mutex was locked in the constructor.
+    */
+    bool IsOk() const;
+};
+
+
+/**
+    @class wxSpinMutex
+
+    A very lightweight mutex intended for protecting short critical sections.
+
+    Unlike wxMutex and wxCriticalSection, locking and unlocking this mutex
+    when it is not contended is done inline using a single atomic operation,
+    which makes it significantly cheaper. When the mutex is already locked,
+    the thread trying to lock it spins for a short time, as the mutex is
+    expected to be released soon, and then blocks until it is unlocked. Under
+    Linux, blocking uses futex system call, so that the waiting threads don't
+    consume CPU, while under the other platforms the waiting thread just
+    gives up its time slice repeatedly until it can lock the mutex, so this
+    mutex must not be used for protecting the code which can take long to
+    execute.
+
+    This mutex is not recursive and doesn't perform any error checking: it is
+    an error to lock it twice from the same thread or to unlock it from a
+    thread which didn't lock it.
+
+    @library{wxbase}
+    @category{threading}
+
+    @see wxSpinMutexLocker, wxCriticalSection
+
+    @since 3.3.4
+*/
+class wxSpinMutex
+{
+public:
+    /**
+        Default constructor creates an unlocked mutex.
+    */
+    wxSpinMutex();
+
+    /**
+        Locks the mutex, waiting until it is unlocked by another thread if
+        necessary.
+    */
+    void Lock();
+
+    /**
+        Tries to lock the mutex without waiting.
+
+        @return @true if the mutex was locked or @false if it was already
+            locked.
+    */
+    bool TryLock();
+
+    /**
+        Unlocks the mutex locked by Lock() or TryLock().
+    */
+    void Unlock();
+};
+
+/**
+    @class wxSpinMutexLocker
+
+    Locks wxSpinMutex in its constructor and unlocks it in its destructor.
+
+    @library{wxbase}
+    @category{threading}
+
+    @since 3.3.4
+*/
+class wxSpinMutexLocker
+{
+public:
+    /**
+        Locks the given mutex.
+    */
+    wxSpinMutexLocker(wxSpinMutex& mutex);
+
+    /**
+        Unlocks the mutex locked by the constructor.
+    */
+    ~wxSpinMutexLocker();
+};
+
+
 
 // ============================================================================
 // Global functions/macros
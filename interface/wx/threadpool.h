@@ -0,0 +1,263 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/threadpool.h
+// Purpose:     wxThreadPool and wxTask classes documentation
+// Author:      wxWidgets team
+// Created:     2026-10-19
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+    Priority of a task submitted to wxThreadPool.
+
+    Pending tasks with higher priority are always executed before the ones
+    with lower priority.
+
+    @since 3.3.4
+*/
+enum wxTaskPriority
+{
+    wxTASK_PRIORITY_LOW,
+    wxTASK_PRIORITY_NORMAL,
+    wxTASK_PRIORITY_HIGH
+};
+
+/**
+    State of a task returned by wxTask::GetState().
+
+    @since 3.3.4
+*/
+enum wxTaskState
+{
+    /// The task is waiting to be executed.
+    wxTASK_PENDING,
+
+    /// The task is being executed right now.
+    wxTASK_RUNNING,
+
+    /// The task has finished executing.
+    wxTASK_COMPLETED,
+
+    /// The task was cancelled before it could be executed.
+    wxTASK_CANCELLED
+};
+
+/**
+    @class wxTask
+
+    Handle of a task submitted to wxThreadPool.
+
+    Objects of this class are returned by wxThreadPool::Submit() and can be
+    used to wait for the task completion, cancel it or to schedule other tasks
+    to be executed once it completes. They are cheap to copy and all copies
+    refer to the same task. Destroying the handle doesn't affect the task.
+
+    All functions of this class may be called from any thread.
+
+    @library{wxbase}
+    @category{threading}
+
+    @since 3.3.4
+*/
+class wxTask
+{
+public:
+    /**
+        Default constructor creates an invalid handle.
+
+        IsOk() returns @false for such handles and no other functions may be
+        called on them.
+    */
+    wxTask();
+
+    /**
+        Returns @true if the handle refers to a task.
+    */
+    bool IsOk() const;
+
+    /**
+        Returns the current state of the task.
+    */
+    wxTaskState GetState() const;
+
+    /**
+        Returns @true if the task has either completed or was cancelled.
+    */
+    bool IsDone() const;
+
+    /**
+        Cancels the task.
+
+        If the task hasn't started executing yet, it is cancelled and will
+        never be executed and neither will any of its continuations.
+
+        If the task is already running, it can't be cancelled, but this
+        function still remembers that cancellation was requested and the
+        task function can check for it using wxThreadPool::IsCancelRequested()
+        and exit early.
+
+        @return @true if the task was cancelled or @false if it was already
+            running or done.
+    */
+    bool Cancel();
+
+    /**
+        Returns @true if Cancel() was called for this task.
+    */
+    bool IsCancelRequested() const;
+
+    /**
+        Blocks until the task is done.
+
+        When called from one of the threads of the pool executing the task,
+        this function executes other pending tasks while waiting, to avoid
+        blocking the pool.
+
+        Notice that waiting in the main thread for a task created by
+        ThenInMainThread() would never return.
+    */
+    void Wait() const;
+
+    /**
+        Blocks until the task is done or the timeout expires.
+
+        This is similar to Wait() but gives up waiting after the given number
+        of milliseconds.
+
+        @return @true if the task is done or @false if the timeout expired.
+    */
+    bool WaitTimeout(unsigned long milliseconds) const;
+
+    /**
+        Creates a task to be executed once this one completes.
+
+        The new task, called continuation, is executed in the same thread pool
+        as this one once it completes or immediately if it's already done.
+        If this task is cancelled, the continuation is cancelled as well.
+
+        @return Handle of the new task.
+    */
+    wxTask Then(const std::function<void()>& func,
+                wxTaskPriority priority = wxTASK_PRIORITY_NORMAL);
+
+    /**
+        Creates a task to be executed in the main thread once this one
+        completes.
+
+        This is similar to Then(), but the continuation is executed in the
+        main thread from the event loop using wxEvtHandler::CallAfter() on
+        the application object, so it can safely update the user interface.
+        If there is no application object, the continuation is executed in
+        the pool instead.
+
+        Example:
+        @code
+        wxThreadPool::Get().Submit([data]() { data->Compute(); })
+            .ThenInMainThread([this, data]() { m_label->SetLabel(data->GetResult()); });
+        @endcode
+
+        Note that the continuation executed in the main thread is not taken
+        into account by wxThreadPool::WaitAll().
+
+        @return Handle of the new task.
+    */
+    wxTask ThenInMainThread(const std::function<void()>& func);
+};
+
+/**
+    @class wxThreadPool
+
+    Thread pool executing tasks in a fixed number of worker threads.
+
+    Using a thread pool is more efficient than creating a new wxThread for
+    each background task as the threads are created only once. Moreover,
+    using the same global pool, returned by Get(), for all background work in
+    the application avoids creating more threads than the system can run
+    concurrently.
+
+    Each worker thread has its own queue of tasks. The tasks submitted from a
+    task already running in the pool are added to the queue of its thread,
+    and each thread executes the most recently added tasks from its queue
+    first. When a thread doesn't have anything to do, it takes the oldest task
+    submitted from outside of the pool or, failing this, "steals" the oldest
+    task from the queue of another thread. Tasks with higher priority are
+    always executed first.
+
+    The tasks are executed using wxApp::OnUnhandledException() to handle any
+    exceptions thrown from them.
+
+    Example:
+    @code
+    wxTask task = wxThreadPool::Get().Submit([]() { DoSomethingLong(); });
+    ...
+    task.Wait();
+    @endcode
+
+    @library{wxbase}
+    @category{threading}
+
+    @see wxTask, wxThread
+
+    @since 3.3.4
+*/
+class wxThreadPool
+{
+public:
+    /**
+        Creates a pool with the given number of threads.
+
+        @param numThreads The number of threads to use or 0, the default, to
+            use as many threads as there are CPUs in the system, as returned
+            by wxThread::GetCPUCount().
+    */
+    explicit wxThreadPool(unsigned numThreads = 0);
+
+    /**
+        Destroys the pool.
+
+        All the tasks which haven't started executing yet are cancelled and
+        the destructor waits until all the currently running ones finish.
+        Notice that no new tasks may be submitted to the pool while it is
+        being destroyed.
+    */
+    ~wxThreadPool();
+
+    /**
+        Returns the global thread pool.
+
+        The pool is created with the default number of threads on the first
+        call to this function and destroyed on library shutdown.
+    */
+    static wxThreadPool& Get();
+
+    /**
+        Returns the number of threads in the pool.
+    */
+    unsigned GetThreadCount() const;
+
+    /**
+        Schedules the given function for execution in one of the pool threads.
+
+        @param func The function to execute, it is destroyed once it finishes
+            executing or the task is cancelled.
+        @param priority Priority of the task.
+        @return Handle of the new task.
+    */
+    wxTask Submit(const std::function<void()>& func,
+                  wxTaskPriority priority = wxTASK_PRIORITY_NORMAL);
+
+    /**
+        Blocks until all the tasks submitted to this pool so far are done.
+
+        This function can't be called from the tasks executed by this pool.
+    */
+    void WaitAll();
+
+    /**
+        Returns @true if the cancellation of the current task was requested.
+
+        This function may be called from the task function to check if
+        wxTask::Cancel() was called for it. It returns @false if called from
+        outside of a task.
+    */
+    static bool IsCancelRequested();
+};
@@ -1249,6 +1249,16 @@ enum
     session). Under MSW, this flag can be used with console processes only and
     corresponds to the native @c CREATE_NEW_PROCESS_GROUP flag.
 
+    Under Unix the child process is launched using @c posix_spawn() when it is
+    available and supports all the options used, which is much faster than
+    using @c fork() for the programs using a lot of memory. In this case, if
+    the command can't be found or executed, an error is logged and the
+    function returns the error value described above immediately, while when
+    using @c fork() the child process exits with the code 255 in this case.
+    The use of @c fork() can be forced by setting "unix.execute.use_fork"
+    system option to 1, see wxSystemOptions (this and the use of
+    @c posix_spawn() are new since wxWidgets 3.3.4).
+
     The @c wxEXEC_NOEVENTS flag prevents processing of any events from taking
     place while the child process is running. It should be only used for very
     short-lived processes as otherwise the application windows risk becoming
@@ -486,10 +486,37 @@ int wxAppConsoleBase::FilterEvent(wxEvent& WXUNUSED(event))
     return Event_Skip;
 }
 
+void wxAppConsoleBase::TakeNewPendingEventHandlers()
+{
+    // avoid the more expensive exchange() in the common case of no new events
+    if ( !m_handlersWithNewPendingEvents.load() )
+        return;
+
+    wxEvtHandler* handler = m_handlersWithNewPendingEvents.exchange(nullptr);
+
+    // the stack contains the handlers in LIFO order, reverse it to process
+    // the handlers in the order in which the events were queued for them
+    wxEvtHandler* first = nullptr;
+    while ( handler )
+    {
+        wxEvtHandler* const next = handler->m_nextWithPendingEvents;
+        handler->m_nextWithPendingEvents = first;
+        first = handler;
+        handler = next;
+    }
+
+    // no need to check if the handlers are already present in the array, as
+    // their m_hasPendingEvents flag ensures that they're added only once
+    for ( handler = first; handler; handler = handler->m_nextWithPendingEvents )
+        m_handlersWithPendingEvents.Add(handler);
+}
+
 void wxAppConsoleBase::DelayPendingEventHandler(wxEvtHandler* toDelay)
 {
     wxENTER_CRIT_SECT(m_handlersWithPendingEventsLocker);
 
+    TakeNewPendingEventHandlers();
+
     // move the handler from the list of handlers with processable pending events
     // to the list of handlers with pending events which needs to be processed later
     m_handlersWithPendingEvents.Remove(toDelay);
@@ -502,8 +529,16 @@ void wxAppConsoleBase::DelayPendingEventHandler(wxEvtHandler* toDelay)
 
 void wxAppConsoleBase::RemovePendingEventHandler(wxEvtHandler* toRemove)
 {
+    // handlers without pending events are not in any list, this is the common
+    // case when this function is called from wxEvtHandler dtor
+    if ( !toRemove->m_hasPendingEvents.load() )
+        return;
+
     wxENTER_CRIT_SECT(m_handlersWithPendingEventsLocker);
 
+    // the handler could be still in the stack of the new handlers
+    TakeNewPendingEventHandlers();
+
     if (m_handlersWithPendingEvents.Index(toRemove) != wxNOT_FOUND)
     {
         m_handlersWithPendingEvents.Remove(toRemove);
@@ -524,21 +559,36 @@ void wxAppConsoleBase::RemovePendingEventHandler(wxEvtHandler* toRemove)
     }
     //else: it wasn't in this list at all, it's ok
 
+    // allow AppendPendingEventHandler() to add it again
+    toRemove->m_hasPendingEvents = false;
+
     wxLEAVE_CRIT_SECT(m_handlersWithPendingEventsLocker);
 }
 
 void wxAppConsoleBase::AppendPendingEventHandler(wxEvtHandler* toAppend)
 {
-    wxENTER_CRIT_SECT(m_handlersWithPendingEventsLocker);
-
-    if ( m_handlersWithPendingEvents.Index(toAppend) == wxNOT_FOUND )
-        m_handlersWithPendingEvents.Add(toAppend);
+    // only the first thread setting this flag adds the handler, so that it's
+    // never added twice without having to search for it
+    if ( toAppend->m_hasPendingEvents.exchange(true) )
+        return;
 
-    wxLEAVE_CRIT_SECT(m_handlersWithPendingEventsLocker);
+    // push the handler on the stack of the handlers with new events without
+    // locking, it will be moved to m_handlersWithPendingEvents by the main
+    // thread later
+    toAppend->m_nextWithPendingEvents = m_handlersWithNewPendingEvents.load(std::memory_order_relaxed);
+    while ( !m_handlersWithNewPendingEvents.compare_exchange_weak
+             (
+                toAppend->m_nextWithPendingEvents,
+                toAppend
+             ) )
+        ;
 }
 
 bool wxAppConsoleBase::HasPendingEvents() const
 {
+    if ( m_handlersWithNewPendingEvents.load() )
+        return true;
+
     wxENTER_CRIT_SECT(const_cast<wxAppConsoleBase*>(this)->m_handlersWithPendingEventsLocker);
 
     bool has = !m_handlersWithPendingEvents.IsEmpty();
@@ -569,8 +619,15 @@ void wxAppConsoleBase::ProcessPendingEvents()
 
         // iterate until the list becomes empty: the handlers remove themselves
         // from it when they don't have any more pending events
-        while (!m_handlersWithPendingEvents.IsEmpty())
+        for ( ;; )
         {
+            // take all the handlers with the events queued since the last
+            // iteration at once, without locking for each of them
+            TakeNewPendingEventHandlers();
+
+            if ( m_handlersWithPendingEvents.IsEmpty() )
+                break;
+
             // NOTE: we always call ProcessPendingEvents() on the first event handler
             //       with pending events because handlers auto-remove themselves
             //       from this list (see RemovePendingEventHandler) if they have no
@@ -609,12 +666,21 @@ void wxAppConsoleBase::DeletePendingEvents()
     wxCHECK_RET( m_handlersWithPendingDelayedEvents.IsEmpty(),
                  "this helper list should be empty" );
 
-    for (unsigned int i=0; i<m_handlersWithPendingEvents.GetCount(); i++)
-        m_handlersWithPendingEvents[i]->DeletePendingEvents();
+    TakeNewPendingEventHandlers();
 
-    m_handlersWithPendingEvents.Clear();
+    wxEvtHandlerArray handlers;
+    handlers.swap(m_handlersWithPendingEvents);
+
+    for (unsigned int i=0; i<handlers.GetCount(); i++)
+        handlers[i]->m_hasPendingEvents = false;
 
     wxLEAVE_CRIT_SECT(m_handlersWithPendingEventsLocker);
+
+    // don't call wxEvtHandler::DeletePendingEvents() while holding our lock,
+    // as it locks the handler and wxEvtHandler::ProcessPendingEvents() locks
+    // both of them in the opposite order
+    for (unsigned int i=0; i<handlers.GetCount(); i++)
+        handlers[i]->DeletePendingEvents();
 }
 
 // ----------------------------------------------------------------------------
@@ -16,14 +16,247 @@
 
 
 #include "wx/arrstr.h"
+#include "wx/parallel.h"
 #include "wx/scopedarray.h"
 #include "wx/wxcrt.h"
 
 #include "wx/beforestd.h"
 #include <algorithm>
 #include <functional>
+#include <string>
+#include <vector>
 #include "wx/afterstd.h"
 
+// ============================================================================
+// sorting helpers
+// ============================================================================
+
+namespace
+{
+
+// ----------------------------------------------------------------------------
+// MSD radix sort used for sorting in the default, i.e. ordinal, order
+// ----------------------------------------------------------------------------
+
+#if wxUSE_UNICODE_WCHAR
+
+// Don't use radix sort for arrays smaller than this, std::sort() is faster.
+const size_t RADIX_SORT_MIN_COUNT = 256;
+
+// Buckets smaller than this are sorted using std::sort() too.
+const size_t RADIX_SORT_MIN_BUCKET = 32;
+
+// Maximal recursion level, beyond which std::sort() is used for the remaining
+// characters: each level uses a few KiB of stack and some inputs, e.g. strings
+// of the form "a...ab" with increasing number of "a"s, would otherwise recurse
+// once per character.
+const unsigned RADIX_SORT_MAX_LEVEL = 64;
+
+struct RadixSortItem
+{
+    const wxStringCharType* str;
+    size_t len;
+    wxString* orig;
+
+    // Bucket index for the character at the current depth: 0 if the string
+    // ends before it or character value plus 1.
+    unsigned bucket;
+};
+
+typedef std::char_traits<wxStringCharType> RadixCharTraits;
+
+// Compare the items starting from the given position, knowing that all the
+// characters before it are equal. This must give the same result as
+// wxString::compare().
+class RadixSuffixLess
+{
+public:
+    explicit RadixSuffixLess(size_t depth) : m_depth(depth) { }
+
+    bool operator()(const RadixSortItem& item1, const RadixSortItem& item2) const
+    {
+        const size_t len = std::min(item1.len, item2.len);
+        if ( len > m_depth )
+        {
+            const int rc = RadixCharTraits::compare(item1.str + m_depth,
+                                                    item2.str + m_depth,
+                                                    len - m_depth);
+            if ( rc )
+                return rc < 0;
+        }
+
+        return item1.len < item2.len;
+    }
+
+private:
+    const size_t m_depth;
+};
+
+// Sort the items using the characters starting from the given depth, using
+// the buffer of the same size for temporary storage. The level is the number
+// of recursive calls made to get here.
+void DoRadixSort(RadixSortItem* items,
+                 RadixSortItem* buf,
+                 size_t count,
+                 size_t depth,
+                 unsigned level)
+{
+    for ( ;; )
+    {
+        if ( count < RADIX_SORT_MIN_BUCKET || level >= RADIX_SORT_MAX_LEVEL )
+        {
+            std::sort(items, items + count, RadixSuffixLess(depth));
+            return;
+        }
+
+        // We use a bucket per each possible character value, which works well
+        // for ASCII and Latin-1 strings, but fall back to comparison sort if
+        // we have any characters outside of this range.
+        size_t counts[257] = { 0 };
+        for ( size_t n = 0; n < count; n++ )
+        {
+            RadixSortItem& item = items[n];
+            if ( item.len > depth )
+            {
+                const wxStringCharType ch = item.str[depth];
+                if ( static_cast<unsigned long>(ch) > 0xff )
+                {
+                    std::sort(items, items + count, RadixSuffixLess(depth));
+                    return;
+                }
+
+                item.bucket = static_cast<unsigned>(ch) + 1;
+            }
+            else
+            {
+                item.bucket = 0;
+            }
+
+            counts[item.bucket]++;
+        }
+
+        // Avoid moving the items around if they're all in the same bucket,
+        // which is common for the strings with common prefix.
+        const unsigned firstBucket = items[0].bucket;
+        if ( counts[firstBucket] == count )
+        {
+            if ( firstBucket == 0 )
+            {
+                // All strings end here and so are equal.
+                return;
+            }
+
+            // Skip the entire common prefix at once instead of doing it one
+            // character at a time.
+            const RadixSortItem& first = items[0];
+            size_t prefixEnd = first.len;
+            for ( size_t n = 1; n < count && prefixEnd > depth + 1; n++ )
+            {
+                const RadixSortItem& item = items[n];
+                const size_t len = std::min(prefixEnd, item.len);
+                size_t pos = depth + 1;
+                while ( pos < len && item.str[pos] == first.str[pos] )
+                    pos++;
+
+                prefixEnd = pos;
+            }
+
+            depth = std::max(prefixEnd, depth + 1);
+            continue;
+        }
+
+        size_t starts[257];
+        size_t start = 0;
+        for ( size_t b = 0; b < WXSIZEOF(counts); b++ )
+        {
+            starts[b] = start;
+            start += counts[b];
+        }
+
+        for ( size_t n = 0; n < count; n++ )
+            buf[starts[items[n].bucket]++] = items[n];
+
+        std::copy(buf, buf + count, items);
+
+        // Recurse into the buckets, except for the first one, containing the
+        // strings ending at this position which are all equal.
+        start = counts[0];
+        for ( size_t b = 1; b < WXSIZEOF(counts); b++ )
+        {
+            if ( counts[b] > 1 )
+                DoRadixSort(items + start, buf + start, counts[b],
+                            depth + 1, level + 1);
+
+            start += counts[b];
+        }
+
+        return;
+    }
+}
+
+#endif // wxUSE_UNICODE_WCHAR
+
+// Sort the strings in the ordinal order, as std::sort() with the default
+// comparator would do, but possibly faster.
+void SortOrdinal(wxString* first, wxString* last)
+{
+#if wxUSE_UNICODE_WCHAR
+    const size_t count = last - first;
+    if ( count >= RADIX_SORT_MIN_COUNT )
+    {
+        std::vector<RadixSortItem> items(count);
+        for ( size_t n = 0; n < count; n++ )
+        {
+            wxString& s = first[n];
+
+            RadixSortItem& item = items[n];
+            item.str = s.wx_str();
+            item.len = s.length();
+            item.orig = &s;
+        }
+
+        std::vector<RadixSortItem> buf(count);
+        DoRadixSort(&items[0], &buf[0], count, 0, 0);
+
+        // Now reorder the strings themselves: moving them is cheap.
+        std::vector<wxString> sorted;
+        sorted.reserve(count);
+        for ( const auto& item : items )
+            sorted.push_back(std::move(*item.orig));
+
+        std::move(sorted.begin(), sorted.end(), first);
+        return;
+    }
+#endif // wxUSE_UNICODE_WCHAR
+
+    std::sort(first, last);
+}
+
+// Helper for sorting in the ordinal order using multiple threads.
+void SortOrdinalParallel(wxString* first, wxString* last, bool reverseOrder)
+{
+    wxPrivate::ParallelSort(first, last, SortOrdinal, std::less<wxString>());
+
+    if ( reverseOrder )
+        std::reverse(first, last);
+}
+
+// And the one for sorting using the given comparison function.
+void
+SortParallelWith(wxString* first,
+                 wxString* last,
+                 wxArrayString::CompareFunction function)
+{
+    const auto comp = [function](const wxString& s1, const wxString& s2)
+                      {
+                          return function(s1, s2) < 0;
+                      };
+
+    wxParallelSort(first, last, comp);
+}
+
+} // anonymous namespace
+
 // ============================================================================
 // ArrayString
 // ============================================================================
@@ -82,13 +315,53 @@ void wxArrayString::Sort(CompareFunction function)
 
 void wxArrayString::Sort(bool reverseOrder)
 {
-    if (reverseOrder)
+    if ( empty() )
+        return;
+
+    SortOrdinal(&*begin(), &*begin() + size());
+
+    if ( reverseOrder )
+        std::reverse(begin(), end());
+}
+
+void wxArrayString::SortParallel(bool reverseOrder)
+{
+    if ( empty() )
+        return;
+
+    SortOrdinalParallel(&*begin(), &*begin() + size(), reverseOrder);
+}
+
+void wxArrayString::SortParallel(CompareFunction function)
+{
+    if ( empty() )
+        return;
+
+    SortParallelWith(&*begin(), &*begin() + size(), function);
+}
+
+void wxSortedArrayString::AssignSorted(const wxArrayString& src)
+{
+    assign(src.begin(), src.end());
+
+    if ( empty() )
+        return;
+
+    SCMPFUNC function = GetCompareFunction();
+    if ( function == wxStringSortAscending )
     {
-        std::sort(begin(), end(), std::greater<wxString>());
+        SortOrdinal(&*begin(), &*begin() + size());
     }
     else
     {
-        std::sort(begin(), end());
+        // Use stable sort to keep the elements which compare equal in the
+        // same order as in the original array.
+        std::stable_sort(begin(), end(),
+                         [function](const wxString& s1, const wxString& s2)
+                         {
+                             return function(s1, s2) < 0;
+                         }
+                        );
     }
 }
 
@@ -495,10 +768,43 @@ void wxArrayString::Sort(CompareFunction2 compareFunction)
 
 void wxArrayString::Sort(bool reverseOrder)
 {
+    SortOrdinal(m_pItems, m_pItems + m_nCount);
+
     if ( reverseOrder )
-        std::sort(m_pItems, m_pItems + m_nCount, std::greater<wxString>());
-    else // normal sort
-        std::sort(m_pItems, m_pItems + m_nCount);
+        std::reverse(m_pItems, m_pItems + m_nCount);
+}
+
+void wxArrayString::SortParallel(bool reverseOrder)
+{
+    SortOrdinalParallel(m_pItems, m_pItems + m_nCount, reverseOrder);
+}
+
+void wxArrayString::SortParallel(CompareFunction compareFunction)
+{
+    wxCHECK_RET( !m_autoSort, wxT("can't use this method with sorted arrays") );
+
+    SortParallelWith(m_pItems, m_pItems + m_nCount, compareFunction);
+}
+
+void wxArrayString::AssignSorted(const wxArrayString& src)
+{
+    wxASSERT_MSG( m_autoSort, wxT("must be only used with sorted arrays") );
+
+    // Add all strings at once and sort them only once instead of inserting
+    // them one by one at the correct position.
+    m_autoSort = false;
+    Copy(src);
+    m_autoSort = true;
+
+    if ( m_compareFunction )
+    {
+        std::stable_sort(m_pItems, m_pItems + m_nCount,
+                         wxSortPredicateAdaptor(m_compareFunction));
+    }
+    else
+    {
+        SortOrdinal(m_pItems, m_pItems + m_nCount);
+    }
 }
 
 bool wxArrayString::operator==(const wxArrayString& a) const
@@ -13,6 +13,167 @@
 
 #include "wx/base64.h"
 
+#if wxUSE_STREAMS
+    #include "wx/base64stream.h"
+
+    #ifndef WX_PRECOMP
+        #include "wx/utils.h"
+    #endif
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+
+    #define wxHAS_SSE2_BASE64
+#endif
+
+// ----------------------------------------------------------------------------
+// SSE2 helpers
+// ----------------------------------------------------------------------------
+
+#ifdef wxHAS_SSE2_BASE64
+
+namespace
+{
+
+// Encode 12 bytes from src as 16 base64 characters in dst.
+inline void EncodeBlockSSE2(char *dst, const unsigned char *src)
+{
+    // Put each group of 3 bytes into its own 32 bit lane.
+    const __m128i in = _mm_setr_epi32
+                       (
+                        src[0] << 16 | src[1] << 8 | src[2],
+                        src[3] << 16 | src[4] << 8 | src[5],
+                        src[6] << 16 | src[7] << 8 | src[8],
+                        src[9] << 16 | src[10] << 8 | src[11]
+                       );
+
+    // Extract 4 6-bit indices from each lane and put them into its 4 bytes,
+    // with the first one in the lowest byte, as it must be output first.
+    const __m128i mask = _mm_set1_epi32(0x3f);
+    __m128i idx = _mm_srli_epi32(in, 18);
+    idx = _mm_or_si128(idx,
+            _mm_slli_epi32(_mm_and_si128(_mm_srli_epi32(in, 12), mask), 8));
+    idx = _mm_or_si128(idx,
+            _mm_slli_epi32(_mm_and_si128(_mm_srli_epi32(in, 6), mask), 16));
+    idx = _mm_or_si128(idx,
+            _mm_slli_epi32(_mm_and_si128(in, mask), 24));
+
+    // Map the indices to the characters: start with the offset for 'A'..'Z'
+    // range and adjust it for each of the subsequent ranges, relying on the
+    // byte additions wrapping around.
+    __m128i off = _mm_set1_epi8('A');
+    off = _mm_add_epi8(off, _mm_and_si128(_mm_cmpgt_epi8(idx, _mm_set1_epi8(25)),
+                                          _mm_set1_epi8('a' - 26 - 'A')));
+    off = _mm_add_epi8(off, _mm_and_si128(_mm_cmpgt_epi8(idx, _mm_set1_epi8(51)),
+                                          _mm_set1_epi8('0' - 52 - ('a' - 26))));
+    off = _mm_add_epi8(off, _mm_and_si128(_mm_cmpgt_epi8(idx, _mm_set1_epi8(61)),
+                                          _mm_set1_epi8('+' - 62 - ('0' - 52))));
+    off = _mm_add_epi8(off, _mm_and_si128(_mm_cmpgt_epi8(idx, _mm_set1_epi8(62)),
+                                          _mm_set1_epi8('/' - 63 - ('+' - 62))));
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_add_epi8(idx, off));
+}
+
+// Return the mask of the bytes in [first, last] range. Note that comparisons
+// are signed, so the bytes with the high bit set never match.
+inline __m128i GetRangeMask(__m128i v, char first, char last)
+{
+    return _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(first - 1)),
+                         _mm_cmpgt_epi8(_mm_set1_epi8(last + 1), v));
+}
+
+// Return the mask of the valid base64 characters in the given vector.
+inline __m128i GetBase64CharsMask(__m128i v)
+{
+    return _mm_or_si128(_mm_or_si128(GetRangeMask(v, 'A', 'Z'),
+                                     GetRangeMask(v, 'a', 'z')),
+                        _mm_or_si128(GetRangeMask(v, '0', '9'),
+                                     _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('+')),
+                                                  _mm_cmpeq_epi8(v, _mm_set1_epi8('/')))));
+}
+
+// Copy 16 characters from src to dst, which may be the same as or precede
+// it, if they're all valid base64 characters and return true, or just return
+// false otherwise.
+inline bool CopyBase64CharsSSE2(char *dst, const char *src)
+{
+    const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+    if ( _mm_movemask_epi8(GetBase64CharsMask(in)) != 0xffff )
+        return false;
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), in);
+
+    return true;
+}
+
+// Decode 16 base64 characters from src into 12 bytes in dst.
+//
+// Returns false, without modifying dst, if any of the characters is not a
+// valid base64 character, including whitespace and padding.
+inline bool DecodeBlockSSE2(unsigned char *dst, const char *src)
+{
+    const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+
+    const __m128i upper = GetRangeMask(in, 'A', 'Z');
+    const __m128i lower = GetRangeMask(in, 'a', 'z');
+    const __m128i digit = GetRangeMask(in, '0', '9');
+    const __m128i plus = _mm_cmpeq_epi8(in, _mm_set1_epi8('+'));
+    const __m128i slash = _mm_cmpeq_epi8(in, _mm_set1_epi8('/'));
+
+    const __m128i valid = _mm_or_si128(_mm_or_si128(upper, lower),
+                                       _mm_or_si128(_mm_or_si128(digit, plus),
+                                                    slash));
+    if ( _mm_movemask_epi8(valid) != 0xffff )
+        return false;
+
+    // Convert the characters to their 6 bit values.
+    __m128i off = _mm_and_si128(upper, _mm_set1_epi8(-'A'));
+    off = _mm_or_si128(off, _mm_and_si128(lower, _mm_set1_epi8(26 - 'a')));
+    off = _mm_or_si128(off, _mm_and_si128(digit, _mm_set1_epi8(52 - '0')));
+    off = _mm_or_si128(off, _mm_and_si128(plus, _mm_set1_epi8(62 - '+')));
+    off = _mm_or_si128(off, _mm_and_si128(slash, _mm_set1_epi8(63 - '/')));
+    const __m128i values = _mm_add_epi8(in, off);
+
+    // Combine the pairs of values in each 16 bit lane into 12 bit values...
+    const __m128i pairs = _mm_or_si128
+                          (
+                            _mm_slli_epi16(_mm_and_si128(values,
+                                                         _mm_set1_epi16(0xff)),
+                                           6),
+                            _mm_srli_epi16(values, 8)
+                          );
+
+    // ... and then the pairs of these values into 24 bit ones.
+    const __m128i triplets = _mm_or_si128
+                             (
+                                _mm_slli_epi32(_mm_and_si128(pairs,
+                                                             _mm_set1_epi32(0xffff)),
+                                               12),
+                                _mm_srli_epi32(pairs, 16)
+                             );
+
+    wxUint32 words[4];
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(words), triplets);
+    for ( int n = 0; n < 4; n++ )
+    {
+        *dst++ = static_cast<unsigned char>(words[n] >> 16);
+        *dst++ = static_cast<unsigned char>(words[n] >> 8);
+        *dst++ = static_cast<unsigned char>(words[n]);
+    }
+
+    return true;
+}
+
+} // anonymous namespace
+
+#endif // wxHAS_SSE2_BASE64
+
+// ----------------------------------------------------------------------------
+// encoding and decoding functions
+// ----------------------------------------------------------------------------
+
 size_t
 wxBase64Encode(char *dst, size_t dstLen, const void *src_, size_t srcLen)
 {
@@ -26,6 +187,21 @@ wxBase64Encode(char *dst, size_t dstLen, const void *src_, size_t srcLen)
 
     size_t encLen = 0;
 
+#ifdef wxHAS_SSE2_BASE64
+    // encode blocks of 12 bytes at once while we have enough space for them,
+    // the rest is done by the loop below which also checks for errors
+    if ( dst )
+    {
+        for ( ; srcLen >= 12 && encLen + 16 <= dstLen; srcLen -= 12, src += 12 )
+        {
+            EncodeBlockSSE2(dst, src);
+
+            dst += 16;
+            encLen += 16;
+        }
+    }
+#endif // wxHAS_SSE2_BASE64
+
     // encode blocks of 3 bytes into 4 base64 characters
     for ( ; srcLen >= 3; srcLen -= 3, src += 3 )
     {
@@ -118,6 +294,27 @@ wxBase64Decode(void *dst_, size_t dstLen,
     const char *p;
     for ( p = src; srcLen; p++, srcLen-- )
     {
+#ifdef wxHAS_SSE2_BASE64
+        // decode as many blocks of 16 characters as possible at once when
+        // we're at the quartet boundary, this stops at the first block with
+        // anything but the valid base64 characters, which is then handled by
+        // the code below
+        if ( !n && !end && dst )
+        {
+            while ( srcLen >= 16 && decLen + 12 <= dstLen &&
+                        DecodeBlockSSE2(dst, p) )
+            {
+                p += 16;
+                srcLen -= 16;
+                dst += 12;
+                decLen += 12;
+            }
+
+            if ( !srcLen )
+                break;
+        }
+#endif // wxHAS_SSE2_BASE64
+
         const unsigned char c = decode[static_cast<unsigned char>(*p)];
         switch ( c )
         {
@@ -234,4 +431,318 @@ wxMemoryBuffer wxBase64Decode(const char *src,
     return buf;
 }
 
+#if wxUSE_STREAMS
+
+// ============================================================================
+// wxBase64DecoderInputStream
+// ============================================================================
+
+namespace
+{
+
+// Size of the chunks read from the underlying stream.
+const size_t wxBASE64_READ_SIZE = 8192;
+
+inline bool IsBase64Char(unsigned char c)
+{
+    return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') ||
+            (c >= '0' && c <= '9') || c == '+' || c == '/';
+}
+
+// Check for the same characters that wxBase64Decode() considers to be spaces.
+inline bool IsBase64Space(unsigned char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' ||
+            c == '\0';
+}
+
+} // anonymous namespace
+
+void wxBase64DecoderInputStream::Init(wxBase64DecodeMode mode)
+{
+    m_mode = mode;
+    m_pos = 0;
+    m_decodedPos = 0;
+    m_quartetLen = 0;
+    m_padded = false;
+}
+
+size_t wxBase64DecoderInputStream::OnSysRead(void *buffer, size_t size)
+{
+    char *p = static_cast<char *>(buffer);
+    size_t total = 0;
+
+    while ( size )
+    {
+        const size_t avail = m_decoded.GetDataLen() - m_decodedPos;
+        if ( !avail )
+        {
+            if ( !ReadAndDecode() )
+                break;
+
+            continue;
+        }
+
+        const size_t count = wxMin(avail, size);
+        memcpy(p, static_cast<char *>(m_decoded.GetData()) + m_decodedPos,
+               count);
+
+        m_decodedPos += count;
+        p += count;
+        size -= count;
+        total += count;
+    }
+
+    m_pos += total;
+
+    return total;
+}
+
+bool wxBase64DecoderInputStream::ReadAndDecode()
+{
+    if ( !IsOk() )
+        return false;
+
+    // Reserve the space for the leftover characters from the last time in
+    // front of the freshly read ones.
+    char buf[4 + wxBASE64_READ_SIZE];
+    memcpy(buf, m_quartet, m_quartetLen);
+
+    for ( ;; )
+    {
+        m_parent_i_stream->Read(buf + m_quartetLen, wxBASE64_READ_SIZE);
+        const size_t lenRead = m_parent_i_stream->LastRead();
+        if ( !lenRead )
+        {
+            // An incomplete quartet at the end is an error in any mode, just
+            // as it is for wxBase64Decode().
+            if ( m_quartetLen || !m_parent_i_stream->Eof() )
+                m_lasterror = wxSTREAM_READ_ERROR;
+            else
+                m_lasterror = wxSTREAM_EOF;
+
+            return false;
+        }
+
+        // Drop all the characters which are skipped in the current mode,
+        // check for invalid ones and for anything following the padding.
+        char* const start = buf + m_quartetLen;
+        char* const end = start + lenRead;
+        const char* src = start;
+        char* dst = start;
+        while ( src != end )
+        {
+            // Copy the runs of valid characters, which are by far the most
+            // common, as quickly as possible.
+            if ( !m_padded )
+            {
+                for ( ;; )
+                {
+#ifdef wxHAS_SSE2_BASE64
+                    while ( end - src >= 16 && CopyBase64CharsSSE2(dst, src) )
+                    {
+                        dst += 16;
+                        src += 16;
+                    }
+#endif // wxHAS_SSE2_BASE64
+
+                    // Copy the rest of the block one by one, stopping at the
+                    // first character needing special handling.
+                    const char* const
+                        stop = src + wxMin(end - src, static_cast<ptrdiff_t>(16));
+                    while ( src != stop &&
+                                IsBase64Char(static_cast<unsigned char>(*src)) )
+                        *dst++ = *src++;
+
+                    if ( src != stop || src == end )
+                        break;
+                }
+
+                if ( src == end )
+                    break;
+            }
+
+            const unsigned char c = static_cast<unsigned char>(*src++);
+
+            bool valid;
+            if ( IsBase64Char(c) )
+                valid = false; // because we must be after padding here
+            else if ( c == '=' )
+                valid = !m_padded || (dst - buf) % 4 != 0;
+            else if ( m_mode == wxBase64DecodeMode_Relaxed ||
+                        (m_mode == wxBase64DecodeMode_SkipWS &&
+                            IsBase64Space(c)) )
+                continue;
+            else
+                valid = false;
+
+            if ( !valid )
+            {
+                m_lasterror = wxSTREAM_READ_ERROR;
+                return false;
+            }
+
+            m_padded = true;
+            *dst++ = c;
+        }
+
+        const size_t len = dst - buf;
+        const size_t lenQuartets = len - len % 4;
+        if ( !lenQuartets )
+        {
+            // Not enough data yet, just remember what we have and continue.
+            m_quartetLen = len;
+            continue;
+        }
+
+        m_decoded.SetDataLen(0);
+        m_decodedPos = 0;
+
+        size_t lenDecoded = wxBase64DecodedSize(lenQuartets);
+        lenDecoded = wxBase64Decode(m_decoded.GetWriteBuf(lenDecoded),
+                                    lenDecoded,
+                                    buf, lenQuartets,
+                                    wxBase64DecodeMode_Strict);
+        if ( lenDecoded == wxCONV_FAILED )
+        {
+            m_decoded.UngetWriteBuf(0);
+            m_lasterror = wxSTREAM_READ_ERROR;
+            return false;
+        }
+
+        m_decoded.UngetWriteBuf(lenDecoded);
+
+        m_quartetLen = len - lenQuartets;
+        memcpy(m_quartet, buf + lenQuartets, m_quartetLen);
+
+        // Padding at the end of the data results in a quartet decoding to
+        // nothing at all, but we must still return something if we can.
+        if ( lenDecoded )
+            return true;
+    }
+}
+
+// ============================================================================
+// wxBase64EncoderOutputStream
+// ============================================================================
+
+void wxBase64EncoderOutputStream::Init()
+{
+    m_pos = 0;
+    m_pendingLen = 0;
+    m_outLen = 0;
+}
+
+bool wxBase64EncoderOutputStream::FlushOutput()
+{
+    if ( !m_outLen )
+        return true;
+
+    m_parent_o_stream->Write(m_out, m_outLen);
+    if ( m_parent_o_stream->LastWrite() != m_outLen )
+    {
+        m_lasterror = wxSTREAM_WRITE_ERROR;
+        return false;
+    }
+
+    m_outLen = 0;
+
+    return true;
+}
+
+bool wxBase64EncoderOutputStream::Encode(const unsigned char *data, size_t size)
+{
+    while ( size )
+    {
+        // Encode as many complete triplets as fit into the output buffer.
+        size_t len = wxMin(size, (BUF_SIZE - m_outLen) / 4 * 3);
+        if ( !len )
+        {
+            if ( !FlushOutput() )
+                return false;
+
+            continue;
+        }
+
+        m_outLen += wxBase64Encode(m_out + m_outLen, BUF_SIZE - m_outLen,
+                                   data, len);
+
+        data += len;
+        size -= len;
+    }
+
+    return true;
+}
+
+size_t wxBase64EncoderOutputStream::OnSysWrite(const void *buffer, size_t size)
+{
+    if ( !IsOk() || !size )
+        return 0;
+
+    const unsigned char *data = static_cast<const unsigned char *>(buffer);
+    const size_t sizeOrig = size;
+
+    // Complete the triplet started by the previous call, if any.
+    if ( m_pendingLen )
+    {
+        while ( m_pendingLen < 3 && size )
+        {
+            m_pending[m_pendingLen++] = *data++;
+            size--;
+        }
+
+        if ( m_pendingLen < 3 )
+        {
+            m_pos += sizeOrig;
+            return sizeOrig;
+        }
+
+        if ( !Encode(m_pending, 3) )
+            return 0;
+
+        m_pendingLen = 0;
+    }
+
+    const size_t lenTriplets = size - size % 3;
+    if ( !Encode(data, lenTriplets) )
+        return 0;
+
+    m_pendingLen = size - lenTriplets;
+    memcpy(m_pending, data + lenTriplets, m_pendingLen);
+
+    m_pos += sizeOrig;
+
+    return sizeOrig;
+}
+
+void wxBase64EncoderOutputStream::Sync()
+{
+    // Note that we can't output the pending bytes here, as this would
+    // require padding them, so the last incomplete triplet is only written
+    // when the stream is closed.
+    if ( IsOk() && FlushOutput() )
+        m_parent_o_stream->Sync();
+}
+
+bool wxBase64EncoderOutputStream::Close()
+{
+    if ( IsOk() )
+    {
+        if ( m_pendingLen )
+        {
+            if ( !Encode(m_pending, m_pendingLen) )
+                return false;
+
+            m_pendingLen = 0;
+        }
+
+        if ( !FlushOutput() )
+            return false;
+    }
+
+    return wxFilterOutputStream::Close() && IsOk();
+}
+
+#endif // wxUSE_STREAMS
+
 #endif // wxUSE_BASE64
@@ -68,6 +68,12 @@ static const wxUint16* GetEncTable(wxFontEncoding enc)
     return nullptr;
 }
 
+// This is used by wxMBConv_sbcs in strconv.cpp.
+const wxUint16* wxGetEncodingUnicodeTable(wxFontEncoding enc)
+{
+    return GetEncTable(enc);
+}
+
 typedef struct {
     wxUint16 u;
     wxUint8  c;
@@ -46,7 +46,13 @@
 #include "wx/private/safecall.h"
 
 #if wxUSE_BASE
+    #include "wx/private/evtprofiler.h"
+
+    #include <cstddef>
+    #include <map>
     #include <memory>
+    #include <utility>
+    #include <vector>
 #endif // wxUSE_BASE
 
 #if wxUSE_GUI
@@ -382,6 +388,7 @@ wxEvent::wxEvent(int theId, wxEventType commandType)
     m_propagatedFrom = nullptr;
     m_wasProcessed = false;
     m_willBeProcessedAgain = false;
+    m_nextPending = nullptr;
 }
 
 wxEvent::wxEvent(const wxEvent& src)
@@ -398,6 +405,7 @@ wxEvent::wxEvent(const wxEvent& src)
     , m_isCommandEvent(src.m_isCommandEvent)
     , m_wasProcessed(false)
     , m_willBeProcessedAgain(false)
+    , m_nextPending(nullptr)
 {
 }
 
@@ -425,6 +433,352 @@ wxEvent& wxEvent::operator=(const wxEvent& src)
     return *this;
 }
 
+// ----------------------------------------------------------------------------
+// wxEventPool
+// ----------------------------------------------------------------------------
+
+// Don't reuse the memory when using address sanitizer, as this would prevent
+// it from detecting use-after-free errors for the events.
+#if defined(__SANITIZE_ADDRESS__)
+    #define wxNO_EVENT_POOL
+#elif defined(__has_feature)
+    #if __has_feature(address_sanitizer)
+        #define wxNO_EVENT_POOL
+    #endif
+#endif
+
+// See UntranslatedStringHolder in translation.cpp for the explanation of the
+// MinGW thread_local bug: we can't rely on the thread cache dtor being called
+// correctly when using it, so always use the global depot with it.
+#if !wxUSE_THREADS || \
+    (defined(__MINGW32__) && \
+        (!defined(__MINGW64_VERSION_MAJOR) || __MINGW64_VERSION_MAJOR < 15))
+    #define wxNO_EVENT_POOL_THREAD_CACHE
+#endif
+
+namespace
+{
+
+// Every block starts with a header containing the index of its size class, or
+// wxEVENT_POOL_NO_CLASS if it's too big to be pooled, which is big enough to
+// preserve the alignment of the memory returned by the global operator new.
+union wxEventPoolHeader
+{
+    size_t sizeClass;
+    std::max_align_t align;
+};
+
+const size_t wxEVENT_POOL_NO_CLASS = static_cast<size_t>(-1);
+
+// Block sizes are multiples of this granularity, up to the maximal size,
+// events bigger than it are just allocated on the heap.
+const size_t wxEVENT_POOL_GRANULARITY = 16;
+const size_t wxEVENT_POOL_MAX_SIZE = 512;
+const size_t wxEVENT_POOL_NUM_CLASSES =
+    wxEVENT_POOL_MAX_SIZE / wxEVENT_POOL_GRANULARITY;
+
+// Number of the blocks moved between the thread caches and the depot at once.
+const size_t wxEVENT_POOL_BATCH_SIZE = 32;
+
+// Maximal number of the free blocks of each size in a thread cache.
+const size_t wxEVENT_POOL_MAX_CACHED = 2*wxEVENT_POOL_BATCH_SIZE;
+
+// Maximal number of the batches of each size kept in the depot.
+const size_t wxEVENT_POOL_MAX_BATCHES = 32;
+
+size_t wxEventPoolGetBlockSize(size_t sizeClass)
+{
+    return (sizeClass + 1)*wxEVENT_POOL_GRANULARITY;
+}
+
+// Free blocks are linked together using their memory after the header.
+struct wxEventPoolFreeBlock
+{
+    wxEventPoolFreeBlock* next;
+};
+
+wxEventPoolFreeBlock* wxEventPoolGetFreeBlock(wxEventPoolHeader* header)
+{
+    return reinterpret_cast<wxEventPoolFreeBlock*>(header + 1);
+}
+
+wxEventPoolHeader* wxEventPoolGetHeader(void* p)
+{
+    return static_cast<wxEventPoolHeader*>(p) - 1;
+}
+
+// List of free blocks of the same size.
+struct wxEventPoolList
+{
+    void Push(wxEventPoolFreeBlock* block)
+    {
+        block->next = head;
+        head = block;
+        count++;
+    }
+
+    wxEventPoolFreeBlock* Pop()
+    {
+        wxEventPoolFreeBlock* const block = head;
+        head = block->next;
+        count--;
+        return block;
+    }
+
+    // Take the given number of blocks from this list.
+    wxEventPoolList Split(size_t n)
+    {
+        wxEventPoolList list;
+        while ( list.count < n )
+            list.Push(Pop());
+        return list;
+    }
+
+    void FreeAll()
+    {
+        while ( head )
+            ::operator delete(wxEventPoolGetHeader(Pop()));
+    }
+
+    wxEventPoolFreeBlock* head = nullptr;
+    size_t count = 0;
+};
+
+// The global depot containing the batches of free blocks which can be used
+// by any thread.
+class wxEventPoolDepot
+{
+public:
+    wxEventPoolDepot() = default;
+
+    ~wxEventPoolDepot()
+    {
+        ms_destroyed = true;
+
+        for ( auto& batches : m_batches )
+        {
+            for ( auto& batch : batches )
+                batch.FreeAll();
+        }
+    }
+
+    static bool IsDestroyed() { return ms_destroyed; }
+
+    // Store the given list in the depot, or free it if the depot is full.
+    void PutList(size_t sizeClass, wxEventPoolList& list)
+    {
+        if ( !list.head )
+            return;
+
+        {
+            wxCRIT_SECT_LOCKER(lock, m_cs);
+
+            std::vector<wxEventPoolList>& batches = m_batches[sizeClass];
+            if ( batches.size() < wxEVENT_POOL_MAX_BATCHES )
+            {
+                batches.push_back(list);
+                list = wxEventPoolList();
+                return;
+            }
+        }
+
+        list.FreeAll();
+    }
+
+    // Get a batch of blocks or an empty list if there are none.
+    wxEventPoolList GetList(size_t sizeClass)
+    {
+        wxCRIT_SECT_LOCKER(lock, m_cs);
+
+        std::vector<wxEventPoolList>& batches = m_batches[sizeClass];
+        if ( batches.empty() )
+            return wxEventPoolList();
+
+        const wxEventPoolList list = batches.back();
+        batches.pop_back();
+        return list;
+    }
+
+private:
+    std::vector<wxEventPoolList> m_batches[wxEVENT_POOL_NUM_CLASSES];
+
+    wxCRIT_SECT_DECLARE_MEMBER(m_cs);
+
+    static bool ms_destroyed;
+
+    wxDECLARE_NO_COPY_CLASS(wxEventPoolDepot);
+};
+
+bool wxEventPoolDepot::ms_destroyed = false;
+
+wxEventPoolDepot& wxEventPoolGetDepot()
+{
+    static wxEventPoolDepot s_depot;
+    return s_depot;
+}
+
+#ifndef wxNO_EVENT_POOL_THREAD_CACHE
+
+// Cache of the free blocks used by a single thread without any locking.
+class wxEventPoolThreadCache
+{
+public:
+    wxEventPoolThreadCache() = default;
+
+    ~wxEventPoolThreadCache()
+    {
+        ms_destroyed = true;
+
+        const bool depotAlive = !wxEventPoolDepot::IsDestroyed();
+        for ( size_t n = 0; n < wxEVENT_POOL_NUM_CLASSES; n++ )
+        {
+            if ( depotAlive )
+                wxEventPoolGetDepot().PutList(n, m_lists[n]);
+            else
+                m_lists[n].FreeAll();
+        }
+    }
+
+    static bool IsDestroyed() { return ms_destroyed; }
+
+    wxEventPoolFreeBlock* Get(size_t sizeClass)
+    {
+        wxEventPoolList& list = m_lists[sizeClass];
+        if ( !list.head )
+        {
+            list = wxEventPoolGetDepot().GetList(sizeClass);
+            if ( !list.head )
+                return nullptr;
+        }
+
+        return list.Pop();
+    }
+
+    void Put(size_t sizeClass, wxEventPoolFreeBlock* block)
+    {
+        wxEventPoolList& list = m_lists[sizeClass];
+        list.Push(block);
+
+        // This happens when the events are created in one thread but
+        // destroyed in another one, e.g. when they're queued by the worker
+        // threads: pass the excess blocks to the creating threads.
+        if ( list.count > wxEVENT_POOL_MAX_CACHED )
+        {
+            wxEventPoolList batch = list.Split(wxEVENT_POOL_BATCH_SIZE);
+            wxEventPoolGetDepot().PutList(sizeClass, batch);
+        }
+    }
+
+private:
+    wxEventPoolList m_lists[wxEVENT_POOL_NUM_CLASSES];
+
+    static thread_local bool ms_destroyed;
+
+    wxDECLARE_NO_COPY_CLASS(wxEventPoolThreadCache);
+};
+
+thread_local bool wxEventPoolThreadCache::ms_destroyed = false;
+
+// Return the cache for the current thread or null if it was already destroyed.
+wxEventPoolThreadCache* wxEventPoolGetThreadCache()
+{
+    if ( wxEventPoolThreadCache::IsDestroyed() )
+        return nullptr;
+
+    thread_local wxEventPoolThreadCache s_cache;
+    return &s_cache;
+}
+
+#endif // !wxNO_EVENT_POOL_THREAD_CACHE
+
+// Get a free block of the given size class, return null if there are none.
+wxEventPoolFreeBlock* wxEventPoolGetBlock(size_t sizeClass)
+{
+    if ( wxEventPoolDepot::IsDestroyed() )
+        return nullptr;
+
+#ifndef wxNO_EVENT_POOL_THREAD_CACHE
+    if ( wxEventPoolThreadCache* const cache = wxEventPoolGetThreadCache() )
+        return cache->Get(sizeClass);
+#endif // !wxNO_EVENT_POOL_THREAD_CACHE
+
+    wxEventPoolList list = wxEventPoolGetDepot().GetList(sizeClass);
+    if ( !list.head )
+        return nullptr;
+
+    wxEventPoolFreeBlock* const block = list.Pop();
+    wxEventPoolGetDepot().PutList(sizeClass, list);
+    return block;
+}
+
+// Put a block back into the pool, return false if it should be just freed.
+bool wxEventPoolPutBlock(size_t sizeClass, wxEventPoolFreeBlock* block)
+{
+    if ( wxEventPoolDepot::IsDestroyed() )
+        return false;
+
+#ifndef wxNO_EVENT_POOL_THREAD_CACHE
+    if ( wxEventPoolThreadCache* const cache = wxEventPoolGetThreadCache() )
+    {
+        cache->Put(sizeClass, block);
+        return true;
+    }
+#endif // !wxNO_EVENT_POOL_THREAD_CACHE
+
+    wxEventPoolList list;
+    list.Push(block);
+    wxEventPoolGetDepot().PutList(sizeClass, list);
+    return true;
+}
+
+} // anonymous namespace
+
+/* static */
+void* wxEventPool::Allocate(size_t size)
+{
+    size_t sizeClass = wxEVENT_POOL_NO_CLASS;
+
+#ifndef wxNO_EVENT_POOL
+    if ( size && size <= wxEVENT_POOL_MAX_SIZE )
+    {
+        sizeClass = (size - 1) / wxEVENT_POOL_GRANULARITY;
+
+        if ( wxEventPoolFreeBlock* const block = wxEventPoolGetBlock(sizeClass) )
+            return block;
+
+        size = wxEventPoolGetBlockSize(sizeClass);
+    }
+#endif // !wxNO_EVENT_POOL
+
+    wxEventPoolHeader* const
+        header = static_cast<wxEventPoolHeader*>(
+                    ::operator new(sizeof(wxEventPoolHeader) + size));
+    header->sizeClass = sizeClass;
+
+    return wxEventPoolGetFreeBlock(header);
+}
+
+/* static */
+void wxEventPool::Free(void* p)
+{
+    if ( !p )
+        return;
+
+    // Notice that the header is preserved while the block is in the pool, so
+    // that it doesn't need to be set again when it's reused.
+    wxEventPoolHeader* const header = wxEventPoolGetHeader(p);
+
+    const size_t sizeClass = header->sizeClass;
+    if ( sizeClass != wxEVENT_POOL_NO_CLASS )
+    {
+        if ( wxEventPoolPutBlock(sizeClass,
+                                 static_cast<wxEventPoolFreeBlock*>(p)) )
+            return;
+    }
+
+    ::operator delete(header);
+}
+
 #endif // wxUSE_BASE
 
 #if wxUSE_GUI
@@ -1190,17 +1544,136 @@ void wxEventHashTable::GrowEventTypeTable()
     delete[] oldEventTypeTable;
 }
 
+// ----------------------------------------------------------------------------
+// coalesced events support
+// ----------------------------------------------------------------------------
+
+// The key identifying the coalesced events replacing each other.
+typedef std::pair<wxEventType, wxIntPtr> wxCoalescedEventKey;
+
+// The latest events queued by wxEvtHandler::QueueCoalescedEvent() which
+// haven't been processed yet.
+class wxCoalescedEvents
+{
+public:
+    wxCoalescedEvents() = default;
+
+    ~wxCoalescedEvents()
+    {
+        DeleteAll();
+    }
+
+    // Store the event for the given key and return true if there was no event
+    // for it yet, i.e. if a placeholder for it must be queued.
+    bool Store(const wxCoalescedEventKey& key, wxEvent* event)
+    {
+        wxCRIT_SECT_LOCKER(lock, m_cs);
+
+        wxEvent*& slot = m_events[key];
+        if ( !slot )
+        {
+            slot = event;
+            return true;
+        }
+
+        delete slot;
+        slot = event;
+
+        return false;
+    }
+
+    // Take the event for the given key, if any, the caller is responsible for
+    // deleting it.
+    wxEvent* Take(const wxCoalescedEventKey& key)
+    {
+        wxCRIT_SECT_LOCKER(lock, m_cs);
+
+        const auto it = m_events.find(key);
+        if ( it == m_events.end() )
+            return nullptr;
+
+        wxEvent* const event = it->second;
+        m_events.erase(it);
+
+        return event;
+    }
+
+    void DeleteAll()
+    {
+        wxCRIT_SECT_LOCKER(lock, m_cs);
+
+        for ( const auto& kv : m_events )
+            delete kv.second;
+
+        m_events.clear();
+    }
+
+private:
+    std::map<wxCoalescedEventKey, wxEvent*> m_events;
+
+#if wxUSE_THREADS
+    wxCriticalSection m_cs;
+#endif // wxUSE_THREADS
+
+    wxDECLARE_NO_COPY_CLASS(wxCoalescedEvents);
+};
+
+namespace
+{
+
+// The special event type used for the placeholders only.
+const wxEventType wxEVT_COALESCED_EVENT_PLACEHOLDER = wxNewEventType();
+
+// The placeholder queued instead of the coalesced events: the actual event to
+// process is only retrieved from wxCoalescedEvents when it is dequeued.
+class wxCoalescedEventPlaceholder : public wxEvent
+{
+public:
+    wxCoalescedEventPlaceholder(const wxCoalescedEventKey& key,
+                                wxEventCategory category)
+        : wxEvent(0, wxEVT_COALESCED_EVENT_PLACEHOLDER),
+          m_key(key),
+          m_category(category)
+    {
+    }
+
+    virtual wxEvent *Clone() const override
+    {
+        return new wxCoalescedEventPlaceholder(*this);
+    }
+
+    // Use the category of the real event to allow wxEventLoop::YieldFor()
+    // to decide whether this event can be processed.
+    virtual wxEventCategory GetEventCategory() const override
+    {
+        return m_category;
+    }
+
+    const wxCoalescedEventKey& GetKey() const { return m_key; }
+
+private:
+    const wxCoalescedEventKey m_key;
+    const wxEventCategory m_category;
+};
+
+} // anonymous namespace
+
 // ----------------------------------------------------------------------------
 // wxEvtHandler
 // ----------------------------------------------------------------------------
 
 wxEvtHandler::wxEvtHandler()
+    : m_pendingEventsIncoming(nullptr),
+      m_hasPendingEvents(false),
+      m_coalescedEvents(nullptr)
 {
     m_nextHandler = nullptr;
     m_previousHandler = nullptr;
     m_enabled = true;
     m_dynamicEvents = nullptr;
-    m_pendingEvents = nullptr;
+    m_pendingEventsHead =
+    m_pendingEventsTail = nullptr;
+    m_nextWithPendingEvents = nullptr;
 
     // no client data (yet)
     m_clientData = nullptr;
@@ -1243,6 +1716,8 @@ wxEvtHandler::~wxEvtHandler()
 
     DeletePendingEvents();
 
+    delete m_coalescedEvents.load();
+
     // we only delete object data, not untyped
     if ( m_clientDataType == wxClientData_Object )
         delete m_clientObject;
@@ -1338,37 +1813,114 @@ void wxEvtHandler::QueueEvent(wxEvent *event)
         return;
     }
 
-    // 1) Add this event to our list of pending events
-    wxENTER_CRIT_SECT( m_pendingEventsLock );
+    // 1) Push this event on the stack of the newly queued events: this is done
+    //    without taking any locks, so that the threads queuing many events
+    //    don't contend with each other nor with the main thread processing
+    //    them. The events are put in the right order by the consumer.
+    event->m_nextPending = m_pendingEventsIncoming.load(std::memory_order_relaxed);
+    while ( !m_pendingEventsIncoming.compare_exchange_weak(event->m_nextPending,
+                                                           event) )
+        ;
+
+    // 2) Add this event handler to list of event handlers that have pending
+    //    events, unless it's already there: notice that this must be done
+    //    after adding the event as ProcessPendingEvents() relies on finding
+    //    it if it removes the handler from this list concurrently with us,
+    //    see the comment there.
+    wxTheApp->AppendPendingEventHandler(this);
 
-    if ( !m_pendingEvents )
-        m_pendingEvents = new wxList;
+    // 3) Inform the system that new pending events are somewhere,
+    //    and that these should be processed in idle time.
+    wxWakeUpIdle();
+}
 
-    m_pendingEvents->Append(event);
+void wxEvtHandler::QueueCoalescedEvent(wxEvent *event, wxIntPtr key)
+{
+    wxCHECK_RET( event, "null event can't be posted" );
 
-    // 2) Add this event handler to list of event handlers that
-    //    have pending events.
+    wxCoalescedEvents* events = m_coalescedEvents.load();
+    if ( !events )
+    {
+        // Allocate the events on first use, taking care to use the object
+        // allocated by another thread doing the same thing concurrently.
+        wxCoalescedEvents* const newEvents = new wxCoalescedEvents;
+        if ( m_coalescedEvents.compare_exchange_strong(events, newEvents) )
+            events = newEvents;
+        else
+            delete newEvents;
+    }
 
-    wxTheApp->AppendPendingEventHandler(this);
+    const wxCoalescedEventKey eventKey(event->GetEventType(), key);
+    const wxEventCategory category = event->GetEventCategory();
 
-    // only release m_pendingEventsLock now because otherwise there is a race
-    // condition as described in the ticket #9093: we could process the event
-    // just added to m_pendingEvents in our ProcessPendingEvents() below before
-    // we had time to append this pointer to wxHandlersWithPendingEvents list; thus
-    // breaking the invariant that a handler should be in the list iff it has
-    // any pending events to process
-    wxLEAVE_CRIT_SECT( m_pendingEventsLock );
+    // If an event with the same key is already pending, it was just replaced
+    // with this one and there is nothing else to do, otherwise queue the
+    // placeholder which will be replaced with the latest event when it's
+    // processed.
+    if ( events->Store(eventKey, event) )
+        QueueEvent(new wxCoalescedEventPlaceholder(eventKey, category));
+}
 
-    // 3) Inform the system that new pending events are somewhere,
-    //    and that these should be processed in idle time.
-    wxWakeUpIdle();
+wxEvent* wxEvtHandler::GetEventToProcess(wxEvent* pending)
+{
+    if ( pending->GetEventType() != wxEVT_COALESCED_EVENT_PLACEHOLDER )
+        return pending;
+
+    std::unique_ptr<wxCoalescedEventPlaceholder>
+        placeholder(static_cast<wxCoalescedEventPlaceholder*>(pending));
+
+    // This can return null if DeletePendingEvents() was called after storing
+    // the event but before queuing the placeholder for it.
+    wxCoalescedEvents* const events = m_coalescedEvents.load();
+    return events ? events->Take(placeholder->GetKey()) : nullptr;
+}
+
+void wxEvtHandler::TakeIncomingPendingEvents()
+{
+    wxEvent* event = m_pendingEventsIncoming.exchange(nullptr);
+    if ( !event )
+        return;
+
+    // The incoming events are in LIFO order, reverse them to get them in the
+    // order in which they were queued.
+    wxEvent* const last = event;
+    wxEvent* first = nullptr;
+    while ( event )
+    {
+        wxEvent* const next = event->m_nextPending;
+        event->m_nextPending = first;
+        first = event;
+        event = next;
+    }
+
+    if ( m_pendingEventsTail )
+        m_pendingEventsTail->m_nextPending = first;
+    else
+        m_pendingEventsHead = first;
+
+    m_pendingEventsTail = last;
 }
 
 void wxEvtHandler::DeletePendingEvents()
 {
-    if (m_pendingEvents)
-        m_pendingEvents->DeleteContents(true);
-    wxDELETE(m_pendingEvents);
+    wxENTER_CRIT_SECT( m_pendingEventsLock );
+
+    TakeIncomingPendingEvents();
+
+    for ( wxEvent* event = m_pendingEventsHead; event; )
+    {
+        wxEvent* const next = event->m_nextPending;
+        delete event;
+        event = next;
+    }
+
+    m_pendingEventsHead =
+    m_pendingEventsTail = nullptr;
+
+    if ( wxCoalescedEvents* const events = m_coalescedEvents.load() )
+        events->DeleteAll();
+
+    wxLEAVE_CRIT_SECT( m_pendingEventsLock );
 }
 
 void wxEvtHandler::ProcessPendingEvents()
@@ -1387,25 +1939,40 @@ void wxEvtHandler::ProcessPendingEvents()
 
     wxENTER_CRIT_SECT( m_pendingEventsLock );
 
-    // this method is only called by wxApp if this handler does have
-    // pending events
-    wxCHECK_RET( m_pendingEvents && !m_pendingEvents->IsEmpty(),
-                 "should have pending events if called" );
+    // only take the new events when we don't have any already available, to
+    // avoid doing it for every event when there are many of them
+    if ( !m_pendingEventsHead )
+        TakeIncomingPendingEvents();
+
+    wxEvent* pEvent = m_pendingEventsHead;
+    wxEvent* pPrev = nullptr;
+
+    if ( !pEvent )
+    {
+        // this is not supposed to happen normally as this method is only
+        // called by wxApp if this handler does have pending events, but could
+        // if DeletePendingEvents() was called, so just stop being in the list
+        // of the handlers with pending events then
+        wxTheApp->RemovePendingEventHandler(this);
+
+        wxLEAVE_CRIT_SECT( m_pendingEventsLock );
 
-    wxList::compatibility_iterator node = m_pendingEvents->GetFirst();
-    wxEvent* pEvent = static_cast<wxEvent *>(node->GetData());
+        return;
+    }
 
     // find the first event which can be processed now:
     wxEventLoopBase* evtLoop = wxEventLoopBase::GetActive();
     if (evtLoop && evtLoop->IsYielding())
     {
-        while (node && pEvent && !evtLoop->IsEventAllowedInsideYield(pEvent->GetEventCategory()))
+        TakeIncomingPendingEvents();
+
+        while (pEvent && !evtLoop->IsEventAllowedInsideYield(pEvent->GetEventCategory()))
         {
-            node = node->GetNext();
-            pEvent = node ? static_cast<wxEvent *>(node->GetData()) : nullptr;
+            pPrev = pEvent;
+            pEvent = pEvent->m_nextPending;
         }
 
-        if (!node)
+        if (!pEvent)
         {
             // all our events are NOT processable now... signal this:
             wxTheApp->DelayPendingEventHandler(this);
@@ -1419,22 +1986,41 @@ void wxEvtHandler::ProcessPendingEvents()
         }
     }
 
-    std::unique_ptr<wxEvent> event(pEvent);
-
     // it's important we remove event from list before processing it, else a
     // nested event loop, for example from a modal dialog, might process the
     // same event again.
-    m_pendingEvents->Erase(node);
+    if ( pPrev )
+        pPrev->m_nextPending = pEvent->m_nextPending;
+    else
+        m_pendingEventsHead = pEvent->m_nextPending;
+
+    if ( m_pendingEventsTail == pEvent )
+        m_pendingEventsTail = pPrev;
+
+    pEvent->m_nextPending = nullptr;
+
+    std::unique_ptr<wxEvent> event(GetEventToProcess(pEvent));
 
-    if ( m_pendingEvents->IsEmpty() )
+    if ( !m_pendingEventsHead && !m_pendingEventsIncoming.load() )
     {
         // if there are no more pending events left, we don't need to
         // stay in this list
         wxTheApp->RemovePendingEventHandler(this);
+
+        // but if an event was queued by another thread after we checked for
+        // it above, it could have seen that we were still in the list and not
+        // added us to it, so check for it again now, after having left the
+        // list: if there is no event now, the thread queuing one later will
+        // add us to the list itself
+        if ( m_pendingEventsIncoming.load() )
+            wxTheApp->AppendPendingEventHandler(this);
     }
 
     wxLEAVE_CRIT_SECT( m_pendingEventsLock );
 
+    if ( !event )
+        return;
+
     // We must not let exceptions escape from here, there is no outer exception
     // handler to catch them and so letting them do it would just terminate the
     // program.
@@ -1540,7 +2126,14 @@ bool wxEvtHandler::ProcessEvent(wxEvent& event)
     // Note that we should only do it if we're the first event handler called
     // to avoid calling FilterEvent() multiple times as the event goes through
     // the event handler chain and possibly upwards the window hierarchy.
-    if ( !event.WasProcessed() )
+    const bool isFirst = !event.WasProcessed();
+
+    // This is also the right place to measure the total event processing time.
+    wxEventDispatchRecorder
+        recorder(event, this, isFirst ? wxEventDispatchRecorder::Kind_Event
+                                      : wxEventDispatchRecorder::Kind_None);
+
+    if ( isFirst )
     {
         for ( wxEventFilter* f = ms_filterList; f; f = f->m_next )
         {
@@ -1653,13 +2246,18 @@ bool wxEvtHandler::TryHereOnly(wxEvent& event)
     if ( !GetEvtHandlerEnabled() )
         return false;
 
+    // Only the time taken by the handlers actually processing the event is
+    // recorded as it's attributed to this handler.
+    wxEventDispatchRecorder
+        recorder(event, this, wxEventDispatchRecorder::Kind_Handler);
+
     // Handle per-instance dynamic event tables first
     if ( m_dynamicEvents && SearchDynamicEventTable(event) )
-        return true;
+        return recorder.Handled();
 
     // Then static per-class event tables
     if ( GetEventHashTable().HandleEvent(event, this) )
-        return true;
+        return recorder.Handled();
 
     // There is an implicit entry for async method calls processing in every
     // event handler:
@@ -1667,7 +2265,7 @@ bool wxEvtHandler::TryHereOnly(wxEvent& event)
             event.GetEventObject() == this )
     {
         static_cast<wxAsyncMethodCallEvent&>(event).Execute();
-        return true;
+        return recorder.Handled();
     }
 
     // We don't have a handler for this event.
@@ -1791,10 +2389,7 @@ void wxEvtHandler::DoBind(int id,
     if (!m_dynamicEvents)
         m_dynamicEvents = new DynamicEvents;
 
-    // We prefer to push back the entry here and then iterate over the vector
-    // in reverse direction in GetNextDynamicEntry() as it's more efficient
-    // than inserting the element at the front.
-    m_dynamicEvents->m_entries.push_back(entry);
+    m_dynamicEvents->Add(entry);
 
     // Make sure we get to know when a sink is destroyed
     wxEvtHandler *eventSink = func->GetEvtHandler();
@@ -1848,7 +2443,7 @@ wxEvtHandler::DoUnbind(int id,
             // Notice that we rely on "cookie" being just the index into the
             // vector, which is not guaranteed by our API, but here we can use
             // this implementation detail.
-            m_dynamicEvents->m_entries[cookie] = nullptr;
+            m_dynamicEvents->Unbind(cookie);
 
             delete entry;
             return true;
@@ -1885,6 +2480,67 @@ wxEvtHandler::GetNextDynamicEntry(size_t& cookie) const
     return nullptr;
 }
 
+// Searching the index is slower than just iterating over a few entries, so
+// only use it if there are at least this many of them.
+static const size_t wxDYNAMIC_EVENTS_INDEX_THRESHOLD = 16;
+
+void wxEvtHandler::DynamicEvents::Add(wxDynamicEventTableEntry* entry)
+{
+    // We prefer to push back the entry here and then iterate over the vector
+    // in reverse direction in GetNextDynamicEntry() as it's more efficient
+    // than inserting the element at the front.
+    m_entries.push_back(entry);
+
+    if ( m_indexed )
+        m_index[entry->m_eventType].push_back(m_entries.size() - 1);
+}
+
+void wxEvtHandler::DynamicEvents::Unbind(size_t n)
+{
+    // Notice that we don't need to update the index here, it is rebuilt after
+    // pruning the null entries anyhow.
+    m_entries[n] = nullptr;
+    m_numUnbound++;
+}
+
+bool wxEvtHandler::DynamicEvents::UpdateIndex()
+{
+    if ( m_indexed )
+        return true;
+
+    if ( m_entries.size() < wxDYNAMIC_EVENTS_INDEX_THRESHOLD )
+        return false;
+
+    for ( size_t n = 0; n != m_entries.size(); n++ )
+    {
+        if ( m_entries[n] )
+            m_index[m_entries[n]->m_eventType].push_back(n);
+    }
+
+    m_indexed = true;
+
+    return true;
+}
+
+void wxEvtHandler::DynamicEvents::Prune()
+{
+    size_t nNew = 0;
+    for ( size_t n = 0; n != m_entries.size(); n++ )
+    {
+        if ( m_entries[n] )
+            m_entries[nNew++] = m_entries[n];
+    }
+
+    wxASSERT( nNew != m_entries.size() );
+    m_entries.resize(nNew);
+    m_numUnbound = 0;
+
+    // The positions of the entries have changed, so the index will need to be
+    // rebuilt when it's needed the next time.
+    m_index.clear();
+    m_indexed = false;
+}
+
 bool wxEvtHandler::SearchDynamicEventTable( wxEvent& event )
 {
     wxCHECK_MSG( m_dynamicEvents, false,
@@ -1905,28 +2561,51 @@ bool wxEvtHandler::SearchDynamicEventTable( wxEvent& event )
     DynamicEvents& dynamicEvents = *m_dynamicEvents;
 
     wxRecursionGuard guard(dynamicEvents.m_flag);
-    bool needToPruneDeleted = false;
+
+    const wxEventType eventType = event.GetEventType();
+
+    // If there are many entries, only iterate over the ones for this event
+    // type, otherwise just iterate over all of them.
+    //
+    // Notice that we can't keep any pointers into the vectors while calling
+    // the handlers, as they can bind more entries, but we can keep the pointer
+    // to the vector in the index, as the elements of unordered_map are never
+    // moved and entries are never removed from the index while we're iterating
+    // over it, as this is only done when pruning, which never happens in the
+    // nested calls.
+    const wxVector<size_t>* positions = nullptr;
+    size_t count;
+    if ( dynamicEvents.UpdateIndex() )
+    {
+        const auto it = dynamicEvents.m_index.find(eventType);
+        if ( it != dynamicEvents.m_index.end() )
+        {
+            positions = &it->second;
+            count = positions->size();
+        }
+        else
+        {
+            count = 0;
+        }
+    }
+    else
+    {
+        count = dynamicEvents.m_entries.size();
+    }
 
     // We can't use Get{First,Next}DynamicEntry() here as they hide the deleted
     // but not yet pruned entries from the caller, but here we do want to know
     // about them, so iterate directly. Remember to do it in the reverse order
     // to honour the order of handlers connection.
-    for ( size_t n = dynamicEvents.m_entries.size(); n; n-- )
+    for ( size_t n = count; n; n-- )
     {
-        wxDynamicEventTableEntry* const entry = dynamicEvents.m_entries[n - 1];
+        wxDynamicEventTableEntry* const entry =
+            dynamicEvents.m_entries[positions ? (*positions)[n - 1] : n - 1];
 
-        if ( !entry )
-        {
-            // This entry must have been unbound at some time in the past, so
-            // skip it now and really remove it from the vector below, once we
-            // finish iterating.
-            // N.B.:  If we are in a nested call, then we can't be done
-            // iterating during this call
-            needToPruneDeleted = !guard.IsInside();
-            continue;
-        }
-
-        if ( event.GetEventType() == entry->m_eventType )
+        // The entries which were unbound at some time in the past are skipped
+        // now and really removed from the vector below, once we finish
+        // iterating.
+        if ( entry && eventType == entry->m_eventType )
         {
             wxEvtHandler *handler = entry->m_fn->GetEvtHandler();
             if ( !handler )
@@ -1951,18 +2630,10 @@ bool wxEvtHandler::SearchDynamicEventTable( wxEvent& event )
         }
     }
 
-    if ( needToPruneDeleted )
-    {
-        size_t nNew = 0;
-        for ( size_t n = 0; n != dynamicEvents.m_entries.size(); n++ )
-        {
-            if ( dynamicEvents.m_entries[n] )
-                dynamicEvents.m_entries[nNew++] = dynamicEvents.m_entries[n];
-        }
-
-        wxASSERT( nNew != dynamicEvents.m_entries.size() );
-        dynamicEvents.m_entries.resize(nNew);
-    }
+    // If we are in a nested call, then we can't be done iterating during this
+    // call, so only prune the entries in the outermost one.
+    if ( dynamicEvents.m_numUnbound && !guard.IsInside() )
+        dynamicEvents.Prune();
 
     return false;
 }
@@ -2042,7 +2713,7 @@ void wxEvtHandler::OnSinkDestroyed( wxEvtHandler *sink )
 
             // Just as in DoUnbind(), we use our knowledge of
             // GetNextDynamicEntry() implementation here.
-            m_dynamicEvents->m_entries[cookie] = nullptr;
+            m_dynamicEvents->Unbind(cookie);
         }
     }
 }
@@ -21,6 +21,7 @@
 #include "wx/scopeguard.h"
 #include "wx/apptrait.h"
 #include "wx/private/eventloopsourcesmanager.h"
+#include "wx/private/evtprofiler.h"
 #include "wx/private/safecall.h"
 
 // Counts currently existing event loops.
@@ -84,6 +85,9 @@ int wxEventLoopBase::Run()
     m_isInsideRun = true;
     wxON_BLOCK_EXIT_SET(m_isInsideRun, false);
 
+    // Let the profiler know that the events are dispatched by this loop now.
+    wxEventLoopProfilerScope profilerScope;
+
     // Finally really run the loop.
     return DoRun();
 }
@@ -0,0 +1,1096 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        src/common/evtprofiler.cpp
+// Purpose:     wxEventProfiler implementation
+// Author:      wxWidgets team
+// Created:     2026-10-19
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+// For compilers that support precompilation, includes "wx.h".
+#include "wx/wxprec.h"
+
+#ifndef WX_PRECOMP
+    #include "wx/app.h"
+    #include "wx/utils.h"
+#endif // WX_PRECOMP
+
+#include "wx/evtprofiler.h"
+#include "wx/private/evtprofiler.h"
+
+#include "wx/thread.h"
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <unordered_map>
+
+// We can only retrieve the stack of the main thread from the watchdog thread
+// by sending a signal to it, which is only done under Unix.
+#if wxUSE_THREADS && wxUSE_STACKWALKER && defined(__UNIX__)
+    #include "wx/stackwalk.h"
+
+    #include <errno.h>
+    #include <execinfo.h>
+    #include <pthread.h>
+    #include <signal.h>
+    #include <string.h>
+
+    #define wxHAS_STALL_STACK
+#endif
+
+// ----------------------------------------------------------------------------
+// constants
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+// The maximal number of the slow dispatches remembered.
+const size_t MAX_SLOW_DISPATCHES = 100;
+
+// Default value of the slow dispatch threshold, in microseconds.
+const wxUint64 DEFAULT_SLOW_DISPATCH_THRESHOLD = 10000;
+
+} // anonymous namespace
+
+// ============================================================================
+// wxEventDispatchStats implementation
+// ============================================================================
+
+void wxEventDispatchStats::Merge(const wxEventDispatchStats& other)
+{
+    m_count += other.m_count;
+    m_total += other.m_total;
+    if ( other.m_max > m_max )
+        m_max = other.m_max;
+
+    for ( int n = 0; n < HISTOGRAM_SIZE; n++ )
+        m_histogram[n] += other.m_histogram[n];
+}
+
+void wxEventDispatchStats::Add(wxUint64 usec)
+{
+    m_count++;
+    m_total += usec;
+    if ( usec > m_max )
+        m_max = usec;
+
+    int n = 0;
+    while ( n < HISTOGRAM_SIZE - 1 && usec >= GetHistogramLimit(n) )
+        n++;
+
+    m_histogram[n]++;
+}
+
+unsigned long wxEventDispatchStats::GetHistogramCount(int n) const
+{
+    wxCHECK_MSG( n >= 0 && n < HISTOGRAM_SIZE, 0, "invalid bucket index" );
+
+    return m_histogram[n];
+}
+
+/* static */
+wxUint64 wxEventDispatchStats::GetHistogramLimit(int n)
+{
+    return static_cast<wxUint64>(1) << n;
+}
+
+// ============================================================================
+// wxEventProfiler implementation
+// ============================================================================
+
+std::atomic<int> wxEventProfiler::ms_flags{0};
+
+namespace
+{
+
+// Return the current time in microseconds, never returns 0.
+wxUint64 GetMicroseconds()
+{
+    using namespace std::chrono;
+
+    const wxUint64 now = duration_cast<microseconds>(
+                            steady_clock::now().time_since_epoch()).count();
+    return now ? now : 1;
+}
+
+wxString GetHandlerName(const wxClassInfo* info)
+{
+    return info ? wxString(info->GetClassName()) : wxString();
+}
+
+// The statistics for each event type and handler class.
+struct wxProfilerStats
+{
+    void Clear()
+    {
+        eventTypeStats.clear();
+        handlerStats.clear();
+    }
+
+    void Merge(const wxProfilerStats& other)
+    {
+        for ( const auto& kv : other.eventTypeStats )
+            eventTypeStats[kv.first].Merge(kv.second);
+        for ( const auto& kv : other.handlerStats )
+            handlerStats[kv.first].Merge(kv.second);
+    }
+
+    std::unordered_map<wxEventType, wxEventDispatchStats> eventTypeStats;
+
+    // The handlers are identified by their class info and not the names to
+    // avoid constructing the names when recording the statistics.
+    std::unordered_map<const wxClassInfo*, wxEventDispatchStats> handlerStats;
+};
+
+// The statistics collected by a single thread: they are kept separately for
+// each thread to avoid locking a global lock for every event dispatch.
+struct wxThreadProfilerStats : wxProfilerStats
+{
+#if wxUSE_THREADS
+    // Protects the statistics, it's only contended when they're retrieved
+    // or reset from another thread.
+    wxSpinMutex lock;
+#endif // wxUSE_THREADS
+};
+
+#if wxUSE_THREADS
+    #define wxPROFILER_STATS_LOCK(stats) wxSpinMutexLocker lockStats((stats).lock)
+#else
+    #define wxPROFILER_STATS_LOCK(stats)
+#endif
+
+// See UntranslatedStringHolder in translation.cpp for the explanation of the
+// MinGW thread_local bug: the memory of wxThreadProfilerStatsRef is freed
+// before its dtor is called, so it can't use its member and must find the
+// statistics of the exiting thread in a global map instead.
+#if defined(__MINGW32__) && \
+    (!defined(__MINGW64_VERSION_MAJOR) || __MINGW64_VERSION_MAJOR < 15)
+    #define wxPROFILER_STATS_BY_THREAD_ID
+#endif
+
+// All the data collected by the profiler.
+struct wxEventProfilerData
+{
+#if wxUSE_THREADS
+    // Protects all the fields of this struct.
+    wxCriticalSection cs;
+#endif // wxUSE_THREADS
+
+    // The statistics of all the existing threads which dispatched any events
+    // and the combined statistics of the threads which don't exist any more.
+    std::vector<wxThreadProfilerStats*> threadStats;
+    wxProfilerStats finishedStats;
+
+#if defined(wxPROFILER_STATS_BY_THREAD_ID) && wxUSE_THREADS
+    // The same statistics as in threadStats indexed by the thread ID.
+    std::unordered_map<wxThreadIdType, wxThreadProfilerStats*> statsByThread;
+#endif
+
+    std::deque<wxEventSlowDispatch> slowDispatches;
+
+    std::vector<wxEventLoopStall> stalls;
+};
+
+wxEventProfilerData& GetData()
+{
+    static wxEventProfilerData s_data;
+    return s_data;
+}
+
+// This one is accessed without locking, as it's needed for every dispatch.
+std::atomic<wxUint64> gs_slowDispatchThreshold{DEFAULT_SLOW_DISPATCH_THRESHOLD};
+
+#if wxUSE_THREADS
+    #define wxPROFILER_DATA_LOCK() wxCriticalSectionLocker lock(GetData().cs)
+#else
+    #define wxPROFILER_DATA_LOCK()
+#endif
+
+// Owns the statistics of the current thread, which are created on demand.
+class wxThreadProfilerStatsRef
+{
+public:
+    wxThreadProfilerStatsRef() = default;
+
+    ~wxThreadProfilerStatsRef()
+    {
+        wxEventProfilerData& data = GetData();
+
+        wxPROFILER_DATA_LOCK();
+
+        wxThreadProfilerStats* const stats = TakeExitingThreadStats();
+        if ( !stats )
+            return;
+
+        data.finishedStats.Merge(*stats);
+        data.threadStats.erase(std::remove(data.threadStats.begin(),
+                                           data.threadStats.end(),
+                                           stats),
+                               data.threadStats.end());
+
+        delete stats;
+    }
+
+    wxThreadProfilerStats& Get()
+    {
+        if ( !m_stats )
+        {
+            m_stats = new wxThreadProfilerStats;
+
+            wxPROFILER_DATA_LOCK();
+
+            GetData().threadStats.push_back(m_stats);
+
+#if defined(wxPROFILER_STATS_BY_THREAD_ID) && wxUSE_THREADS
+            GetData().statsByThread[wxThread::GetCurrentId()] = m_stats;
+#endif
+        }
+
+        return *m_stats;
+    }
+
+private:
+    // Return the statistics of the exiting thread, if any, and forget about
+    // them. Must be called with the data lock held.
+    wxThreadProfilerStats* TakeExitingThreadStats() const
+    {
+#ifndef wxPROFILER_STATS_BY_THREAD_ID
+        return m_stats;
+#elif wxUSE_THREADS
+        // We can't access m_stats here, see above.
+        wxEventProfilerData& data = GetData();
+
+        const auto it = data.statsByThread.find(wxThread::GetCurrentId());
+        if ( it == data.statsByThread.end() )
+            return nullptr;
+
+        wxThreadProfilerStats* const stats = it->second;
+        data.statsByThread.erase(it);
+        return stats;
+#else // wxPROFILER_STATS_BY_THREAD_ID && !wxUSE_THREADS
+        // We can't access m_stats here, but there is only the main thread and
+        // it is exiting anyhow, so just leave its statistics alone.
+        return nullptr;
+#endif
+    }
+
+    wxThreadProfilerStats* m_stats = nullptr;
+
+    wxDECLARE_NO_COPY_CLASS(wxThreadProfilerStatsRef);
+};
+
+thread_local wxThreadProfilerStatsRef gs_threadStats;
+
+// Return the statistics of all threads combined, must be called with the data
+// lock held.
+wxProfilerStats GetAllStats()
+{
+    const wxEventProfilerData& data = GetData();
+
+    wxProfilerStats all;
+    all.Merge(data.finishedStats);
+
+    for ( auto stats : data.threadStats )
+    {
+        wxPROFILER_STATS_LOCK(*stats);
+
+        all.Merge(*stats);
+    }
+
+    return all;
+}
+
+// Return the handler statistics indexed by the class names: notice that
+// different class infos may have the same name (e.g. null and a class with
+// an empty name), so they need to be combined.
+std::map<wxString, wxEventDispatchStats>
+GetHandlerStatsByName(const wxProfilerStats& all)
+{
+    std::map<wxString, wxEventDispatchStats> handlerStats;
+    for ( const auto& kv : all.handlerStats )
+        handlerStats[GetHandlerName(kv.first)].Merge(kv.second);
+
+    return handlerStats;
+}
+
+// ----------------------------------------------------------------------------
+// Main thread state used for stall detection
+// ----------------------------------------------------------------------------
+
+// The main thread state is a stack of the currently running event loops and
+// event dispatches: only the outermost dispatch in each loop can stall it, as
+// the dispatches nested inside it are part of it and an event loop running
+// inside a dispatch (e.g. a modal dialog) doesn't block anything.
+//
+// This stack is only accessed from the main thread, while the atomic
+// variables below are read from the watchdog thread too.
+enum MainStackEntry
+{
+    MainStack_Loop,
+    MainStack_Dispatch
+};
+
+std::vector<MainStackEntry> gs_mainStack;
+
+bool IsMainThreadBusy()
+{
+    return !gs_mainStack.empty() && gs_mainStack.back() == MainStack_Dispatch;
+}
+
+// The time when the main thread started being busy, in microseconds, or 0 if
+// it's idle.
+std::atomic<wxUint64> gs_busySince{0};
+
+// Information about the event being currently dispatched in the main thread.
+std::atomic<wxEventType> gs_busyEventType{wxEVT_NULL};
+std::atomic<const wxClassInfo*> gs_busyHandler{nullptr};
+
+// The value of gs_busySince for which the last stall was detected and the
+// index of this stall in wxEventProfilerData::stalls (protected by its cs).
+std::atomic<wxUint64> gs_stallBusySince{0};
+size_t gs_stallIndex = 0;
+
+// Called when the main thread stops being busy, after gs_busySince is reset.
+void OnMainThreadIdle(wxUint64 busySince, wxUint64 now)
+{
+    if ( gs_stallBusySince.load() != busySince )
+        return;
+
+    wxPROFILER_DATA_LOCK();
+
+    // Update the stall duration which is now known.
+    wxEventProfilerData& data = GetData();
+    if ( gs_stallIndex < data.stalls.size() )
+        data.stalls[gs_stallIndex].duration = (now - busySince) / 1000;
+}
+
+// ----------------------------------------------------------------------------
+// Retrieving the stack of the main thread
+// ----------------------------------------------------------------------------
+
+#ifdef wxHAS_STALL_STACK
+
+// The maximal number of the stack frames retrieved.
+const int MAX_STALL_FRAMES = 64;
+
+// The number of frames corresponding to the signal handler itself.
+const int SIGNAL_HANDLER_FRAMES = 2;
+
+pthread_t gs_mainThread;
+
+// The signal currently used for retrieving the stack and the handler which
+// was installed for it before us, only used if this signal is non-zero.
+int gs_stallSignal = 0;
+struct sigaction gs_oldStallAction;
+
+// The stack retrieval is synchronized using this variable, which contains
+// the generation of the request in its upper bits and the state of the
+// request, see below, in its lower bits.
+//
+// This ensures that the signal handler only writes to gs_stallFrames if the
+// watchdog thread is waiting for it, and not if it has already given up
+// waiting and could be retrieving the stack again, for a new stall.
+std::atomic<unsigned> gs_stallRequest{0};
+
+enum
+{
+    // The watchdog thread is not waiting for the signal handler.
+    StallRequest_None,
+
+    // The watchdog thread has sent the signal and waits for the handler.
+    StallRequest_Sent,
+
+    // The signal handler is storing the stack.
+    StallRequest_Writing,
+
+    // The stack has been stored by the signal handler.
+    StallRequest_Done,
+
+    StallRequest_Mask = 3,
+    StallRequest_GenerationShift = 2
+};
+
+// The buffer filled by the signal handler and the number of frames in it.
+void* gs_stallFrames[MAX_STALL_FRAMES];
+int gs_stallFramesCount = 0;
+
+void wxStallStackSignalHandler(int WXUNUSED(sig))
+{
+    const int saveErrno = errno;
+
+    unsigned request = gs_stallRequest.load();
+    if ( (request & StallRequest_Mask) == StallRequest_Sent )
+    {
+        const unsigned generation = request & ~StallRequest_Mask;
+        if ( gs_stallRequest.compare_exchange_strong
+             (
+                request,
+                generation | StallRequest_Writing
+             ) )
+        {
+            gs_stallFramesCount = backtrace(gs_stallFrames, MAX_STALL_FRAMES);
+
+            gs_stallRequest = generation | StallRequest_Done;
+        }
+    }
+
+    errno = saveErrno;
+}
+
+// Return the signal used by default, if any.
+int GetDefaultStallSignal()
+{
+#ifdef SIGRTMIN
+    // Use a real-time signal as they're not used for anything by default and
+    // don't use the first few of them as they're most likely to be used by
+    // other libraries.
+    if ( SIGRTMIN + 3 <= SIGRTMAX )
+        return SIGRTMIN + 3;
+#endif // SIGRTMIN
+
+    // There is no signal which is safe to use for this.
+    return 0;
+}
+
+// The signal set by SetStallStackSignal() or -1 to use the default one.
+std::atomic<int> gs_stallSignalToUse{-1};
+
+bool InstallStallStackHandler()
+{
+    const int sig = gs_stallSignalToUse.load();
+    gs_stallSignal = sig == -1 ? GetDefaultStallSignal() : sig;
+    if ( !gs_stallSignal )
+        return true;
+
+    // Call backtrace() once from here as the first call to it may allocate
+    // memory when loading libgcc, which must not happen in a signal handler.
+    void* dummy[1];
+    backtrace(dummy, WXSIZEOF(dummy));
+
+    gs_mainThread = pthread_self();
+
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = wxStallStackSignalHandler;
+    sigemptyset(&sa.sa_mask);
+    sa.sa_flags = SA_RESTART;
+
+    if ( sigaction(gs_stallSignal, &sa, &gs_oldStallAction) != 0 )
+    {
+        gs_stallSignal = 0;
+        return false;
+    }
+
+    return true;
+}
+
+void UninstallStallStackHandler()
+{
+    if ( !gs_stallSignal )
+        return;
+
+    sigaction(gs_stallSignal, &gs_oldStallAction, nullptr);
+    gs_stallSignal = 0;
+}
+
+class wxStallStackWalker : public wxStackWalker
+{
+public:
+    const wxString& GetStack() const { return m_stack; }
+
+protected:
+    virtual void OnStackFrame(const wxStackFrame& frame) override
+    {
+        const wxString name = frame.GetName();
+        if ( !name.empty() )
+            m_stack << name;
+        else
+            m_stack << wxString::Format("%p", frame.GetAddress());
+
+        if ( frame.HasSourceLocation() )
+        {
+            m_stack << wxString::Format(" (%s:%zu)",
+                                        frame.GetFileName(),
+                                        frame.GetLine());
+        }
+
+        m_stack << '\n';
+    }
+
+private:
+    wxString m_stack;
+};
+
+// Get the stack of the main thread, this is called from the watchdog thread.
+wxString GetMainThreadStack()
+{
+    if ( !gs_stallSignal )
+        return wxString();
+
+    // Start a new request: notice that only this thread modifies the
+    // generation, so we don't need to worry about concurrent requests.
+    const unsigned generation = (gs_stallRequest.load() & ~StallRequest_Mask)
+                                    + (1u << StallRequest_GenerationShift);
+
+    gs_stallRequest = generation | StallRequest_Sent;
+    if ( pthread_kill(gs_mainThread, gs_stallSignal) != 0 )
+    {
+        gs_stallRequest = generation | StallRequest_None;
+        return wxString();
+    }
+
+    // Don't wait for too long as the main thread could be blocked in a system
+    // call with the signal masked.
+    for ( int n = 0; n < 200; n++ )
+    {
+        if ( gs_stallRequest.load() == (generation | StallRequest_Done) )
+            break;
+
+        wxMilliSleep(1);
+    }
+
+    // If the signal handler hasn't started running yet, cancel the request,
+    // so that it doesn't write to the buffer when it finally does run.
+    unsigned request = generation | StallRequest_Sent;
+    if ( gs_stallRequest.compare_exchange_strong(request,
+                                                 generation | StallRequest_None) )
+        return wxString();
+
+    // Otherwise wait until it finishes, which shouldn't take long.
+    while ( gs_stallRequest.load() != (generation | StallRequest_Done) )
+        wxMilliSleep(1);
+
+    const int count = gs_stallFramesCount;
+    if ( count <= SIGNAL_HANDLER_FRAMES )
+        return wxString();
+
+    wxStallStackWalker walker;
+    walker.WalkAddresses(gs_stallFrames + SIGNAL_HANDLER_FRAMES,
+                         count - SIGNAL_HANDLER_FRAMES);
+    return walker.GetStack();
+}
+
+#endif // wxHAS_STALL_STACK
+
+// ----------------------------------------------------------------------------
+// Watchdog thread
+// ----------------------------------------------------------------------------
+
+#if wxUSE_THREADS
+
+class wxEventLoopWatchdog : public wxThread
+{
+public:
+    explicit wxEventLoopWatchdog(unsigned long thresholdMs)
+        : wxThread(wxTHREAD_JOINABLE),
+          m_thresholdMs(thresholdMs)
+    {
+    }
+
+    // Ask the thread to stop, it still needs to be waited for.
+    void Stop() { m_stop.Post(); }
+
+protected:
+    virtual ExitCode Entry() override
+    {
+        // Check 4 times per threshold interval, so that we don't detect the
+        // stall much later than it happens.
+        const unsigned long interval = wxMax(m_thresholdMs / 4, 1ul);
+
+        wxUint64 lastReported = 0;
+        while ( m_stop.WaitTimeout(interval) == wxSEMA_TIMEOUT )
+        {
+            const wxUint64 busySince = gs_busySince.load();
+            if ( !busySince || busySince == lastReported )
+                continue;
+
+            const wxUint64 now = GetMicroseconds();
+            if ( now - busySince < m_thresholdMs * 1000 )
+                continue;
+
+            wxEventLoopStall stall;
+            stall.eventType = gs_busyEventType.load();
+            stall.handler = GetHandlerName(gs_busyHandler.load());
+
+            // Check that we didn't read the data of another dispatch.
+            if ( gs_busySince.load() != busySince )
+                continue;
+
+            lastReported = busySince;
+
+            stall.duration = (now - busySince) / 1000;
+
+            // Remember the stall before retrieving the stack, which can take
+            // some time, to allow the main thread to update its duration if
+            // it ends in the meanwhile.
+            size_t index;
+            {
+                wxPROFILER_DATA_LOCK();
+
+                wxEventProfilerData& data = GetData();
+                data.stalls.push_back(stall);
+                index = data.stalls.size() - 1;
+                gs_stallIndex = index;
+                gs_stallBusySince = busySince;
+            }
+
+#ifdef wxHAS_STALL_STACK
+            const wxString stack = GetMainThreadStack();
+
+            wxPROFILER_DATA_LOCK();
+
+            wxEventProfilerData& data = GetData();
+            if ( index < data.stalls.size() )
+                data.stalls[index].stack = stack;
+#endif // wxHAS_STALL_STACK
+        }
+
+        return nullptr;
+    }
+
+private:
+    const unsigned long m_thresholdMs;
+
+    wxSemaphore m_stop;
+};
+
+std::unique_ptr<wxEventLoopWatchdog> gs_watchdog;
+
+#endif // wxUSE_THREADS
+
+// ----------------------------------------------------------------------------
+// JSON output helpers
+// ----------------------------------------------------------------------------
+
+wxString JSONQuote(const wxString& s)
+{
+    wxString quoted;
+    quoted.reserve(s.length() + 2);
+
+    quoted += '"';
+    for ( wxString::const_iterator it = s.begin(); it != s.end(); ++it )
+    {
+        const wxUniChar ch = *it;
+        switch ( ch.GetValue() )
+        {
+            case '"':
+                quoted += "\\\"";
+                break;
+
+            case '\\':
+                quoted += "\\\\";
+                break;
+
+            case '\n':
+                quoted += "\\n";
+                break;
+
+            case '\r':
+                quoted += "\\r";
+                break;
+
+            case '\t':
+                quoted += "\\t";
+                break;
+
+            default:
+                if ( ch.GetValue() < 0x20 )
+                    quoted += wxString::Format("\\u%04x", ch.GetValue());
+                else
+                    quoted += ch;
+        }
+    }
+    quoted += '"';
+
+    return quoted;
+}
+
+wxString StatsAsJSON(const wxEventDispatchStats& stats)
+{
+    wxString json = wxString::Format
+                    (
+                        "{\"count\": %lu, \"total_us\": %llu, "
+                        "\"max_us\": %llu, \"avg_us\": %.1f, \"histogram\": [",
+                        stats.GetCount(),
+                        static_cast<unsigned long long>(stats.GetTotalTime()),
+                        static_cast<unsigned long long>(stats.GetMaxTime()),
+                        stats.GetAverageTime()
+                    );
+
+    // Don't output the trailing empty buckets.
+    int last = wxEventDispatchStats::HISTOGRAM_SIZE - 1;
+    while ( last >= 0 && !stats.GetHistogramCount(last) )
+        last--;
+
+    for ( int n = 0; n <= last; n++ )
+    {
+        if ( n )
+            json += ", ";
+        json << stats.GetHistogramCount(n);
+    }
+
+    json += "]}";
+
+    return json;
+}
+
+} // anonymous namespace
+
+/* static */
+void wxEventProfiler::Enable(bool enable)
+{
+    if ( enable )
+        ms_flags |= Flag_Stats;
+    else
+        ms_flags &= ~Flag_Stats;
+}
+
+/* static */
+void wxEventProfiler::Reset()
+{
+    wxPROFILER_DATA_LOCK();
+
+    wxEventProfilerData& data = GetData();
+    for ( auto stats : data.threadStats )
+    {
+        wxPROFILER_STATS_LOCK(*stats);
+
+        stats->Clear();
+    }
+
+    data.finishedStats.Clear();
+    data.slowDispatches.clear();
+    data.stalls.clear();
+
+    // Don't update the duration of a stall we had forgotten about.
+    gs_stallBusySince = 0;
+}
+
+/* static */
+void wxEventProfiler::SetSlowDispatchThreshold(wxUint64 usec)
+{
+    gs_slowDispatchThreshold = usec;
+}
+
+/* static */
+wxUint64 wxEventProfiler::GetSlowDispatchThreshold()
+{
+    return gs_slowDispatchThreshold;
+}
+
+/* static */
+std::map<wxEventType, wxEventDispatchStats> wxEventProfiler::GetEventTypeStats()
+{
+    wxProfilerStats all;
+    {
+        wxPROFILER_DATA_LOCK();
+
+        all = GetAllStats();
+    }
+
+    return std::map<wxEventType, wxEventDispatchStats>(all.eventTypeStats.begin(),
+                                                       all.eventTypeStats.end());
+}
+
+/* static */
+std::map<wxString, wxEventDispatchStats> wxEventProfiler::GetHandlerStats()
+{
+    wxProfilerStats all;
+    {
+        wxPROFILER_DATA_LOCK();
+
+        all = GetAllStats();
+    }
+
+    return GetHandlerStatsByName(all);
+}
+
+/* static */
+std::vector<wxEventSlowDispatch> wxEventProfiler::GetSlowDispatches()
+{
+    wxPROFILER_DATA_LOCK();
+
+    const wxEventProfilerData& data = GetData();
+    return std::vector<wxEventSlowDispatch>(data.slowDispatches.begin(),
+                                            data.slowDispatches.end());
+}
+
+/* static */
+bool wxEventProfiler::StartStallDetection(unsigned long thresholdMs)
+{
+#if wxUSE_THREADS
+    wxCHECK_MSG( wxIsMainThread(), false,
+                 "must be called from the main thread" );
+    wxCHECK_MSG( thresholdMs, false, "invalid stall threshold" );
+
+    if ( gs_watchdog )
+        StopStallDetection();
+
+#ifdef wxHAS_STALL_STACK
+    if ( !InstallStallStackHandler() )
+        return false;
+#endif // wxHAS_STALL_STACK
+
+    std::unique_ptr<wxEventLoopWatchdog> watchdog(
+        new wxEventLoopWatchdog(thresholdMs));
+    if ( watchdog->Run() != wxTHREAD_NO_ERROR )
+    {
+#ifdef wxHAS_STALL_STACK
+        UninstallStallStackHandler();
+#endif // wxHAS_STALL_STACK
+
+        return false;
+    }
+
+    gs_watchdog = std::move(watchdog);
+
+    ms_flags |= Flag_Stalls;
+
+    return true;
+#else // !wxUSE_THREADS
+    wxUnusedVar(thresholdMs);
+
+    return false;
+#endif // wxUSE_THREADS/!wxUSE_THREADS
+}
+
+/* static */
+void wxEventProfiler::StopStallDetection()
+{
+#if wxUSE_THREADS
+    if ( !gs_watchdog )
+        return;
+
+    ms_flags &= ~Flag_Stalls;
+
+    gs_watchdog->Stop();
+    gs_watchdog->Wait();
+    gs_watchdog.reset();
+
+#ifdef wxHAS_STALL_STACK
+    UninstallStallStackHandler();
+#endif // wxHAS_STALL_STACK
+
+    gs_busySince = 0;
+#endif // wxUSE_THREADS
+}
+
+/* static */
+void wxEventProfiler::SetStallStackSignal(int sig)
+{
+#ifdef wxHAS_STALL_STACK
+    wxCHECK_RET( sig >= 0, "invalid signal number" );
+
+    gs_stallSignalToUse = sig;
+#else // !wxHAS_STALL_STACK
+    wxUnusedVar(sig);
+#endif // wxHAS_STALL_STACK/!wxHAS_STALL_STACK
+}
+
+/* static */
+int wxEventProfiler::GetStallStackSignal()
+{
+#ifdef wxHAS_STALL_STACK
+    const int sig = gs_stallSignalToUse.load();
+    return sig == -1 ? GetDefaultStallSignal() : sig;
+#else // !wxHAS_STALL_STACK
+    return 0;
+#endif // wxHAS_STALL_STACK/!wxHAS_STALL_STACK
+}
+
+/* static */
+std::vector<wxEventLoopStall> wxEventProfiler::GetStalls()
+{
+    wxPROFILER_DATA_LOCK();
+
+    return GetData().stalls;
+}
+
+/* static */
+wxString wxEventProfiler::DumpAsJSON()
+{
+    wxPROFILER_DATA_LOCK();
+
+    const wxEventProfilerData& data = GetData();
+
+    const wxProfilerStats all = GetAllStats();
+
+    // Output the event types in order, for consistency with the handlers.
+    const std::map<wxEventType, wxEventDispatchStats>
+        eventTypeStats(all.eventTypeStats.begin(), all.eventTypeStats.end());
+
+    wxString json = "{\n  \"eventTypes\": {";
+    bool first = true;
+    for ( const auto& kv : eventTypeStats )
+    {
+        json << (first ? "\n    " : ",\n    ")
+             << '"' << kv.first << "\": " << StatsAsJSON(kv.second);
+        first = false;
+    }
+
+    json += "\n  },\n  \"handlers\": {";
+    first = true;
+    for ( const auto& kv : GetHandlerStatsByName(all) )
+    {
+        json << (first ? "\n    " : ",\n    ")
+             << JSONQuote(kv.first) << ": " << StatsAsJSON(kv.second);
+        first = false;
+    }
+
+    json += "\n  },\n  \"slowDispatches\": [";
+    first = true;
+    for ( const auto& slow : data.slowDispatches )
+    {
+        json << (first ? "\n    " : ",\n    ")
+             << wxString::Format
+                (
+                    "{\"eventType\": %d, \"handler\": %s, \"duration_us\": %llu}",
+                    slow.eventType,
+                    JSONQuote(slow.handler),
+                    static_cast<unsigned long long>(slow.duration)
+                );
+        first = false;
+    }
+
+    json += "\n  ],\n  \"stalls\": [";
+    first = true;
+    for ( const auto& stall : data.stalls )
+    {
+        json << (first ? "\n    " : ",\n    ")
+             << wxString::Format
+                (
+                    "{\"eventType\": %d, \"handler\": %s, \"duration_ms\": %llu, "
+                    "\"stack\": %s}",
+                    stall.eventType,
+                    JSONQuote(stall.handler),
+                    static_cast<unsigned long long>(stall.duration),
+                    JSONQuote(stall.stack)
+                );
+        first = false;
+    }
+
+    json += "\n  ]\n}\n";
+
+    return json;
+}
+
+/* static */
+void wxEventProfiler::WXOnMainLoopEnter()
+{
+    if ( !wxIsMainThread() )
+        return;
+
+    gs_mainStack.push_back(MainStack_Loop);
+    gs_busySince = 0;
+}
+
+/* static */
+void wxEventProfiler::WXOnMainLoopExit()
+{
+    if ( !wxIsMainThread() || gs_mainStack.empty() )
+        return;
+
+    gs_mainStack.pop_back();
+
+    // If we were running inside an event handler, it continues executing now.
+    if ( IsMainThreadBusy() && IsStallDetectionRunning() )
+        gs_busySince = GetMicroseconds();
+}
+
+// ============================================================================
+// wxEventDispatchRecorder implementation
+// ============================================================================
+
+void
+wxEventDispatchRecorder::Start(const wxEvent& event,
+                               const wxEvtHandler* handler,
+                               Kind kind)
+{
+    if ( kind == Kind_Event )
+    {
+        if ( wxEventProfiler::IsStallDetectionRunning() && wxIsMainThread() )
+        {
+            m_isMainDispatch = true;
+
+            if ( !IsMainThreadBusy() )
+            {
+                gs_busyEventType = event.GetEventType();
+                gs_busyHandler = handler->GetClassInfo();
+                gs_busySince = GetMicroseconds();
+            }
+
+            gs_mainStack.push_back(MainStack_Dispatch);
+        }
+        else if ( !wxEventProfiler::IsEnabled() )
+        {
+            return;
+        }
+    }
+    else // Kind_Handler
+    {
+        if ( !wxEventProfiler::IsEnabled() )
+            return;
+    }
+
+    m_started = true;
+    m_eventType = event.GetEventType();
+    m_handlerClass = handler->GetClassInfo();
+    m_kind = kind;
+    m_start = GetMicroseconds();
+}
+
+void wxEventDispatchRecorder::Stop()
+{
+    const wxUint64 now = GetMicroseconds();
+    const wxUint64 duration = now - m_start;
+
+    if ( m_isMainDispatch )
+    {
+        if ( !gs_mainStack.empty() )
+            gs_mainStack.pop_back();
+
+        if ( !IsMainThreadBusy() )
+        {
+            const wxUint64 busySince = gs_busySince.exchange(0);
+            if ( busySince )
+                OnMainThreadIdle(busySince, now);
+        }
+    }
+
+    if ( !wxEventProfiler::IsEnabled() )
+        return;
+
+    wxThreadProfilerStats& stats = gs_threadStats.Get();
+
+    if ( m_kind == Kind_Event )
+    {
+        wxPROFILER_STATS_LOCK(stats);
+
+        stats.eventTypeStats[m_eventType].Add(duration);
+    }
+    else if ( m_handled )
+    {
+        {
+            wxPROFILER_STATS_LOCK(stats);
+
+            stats.handlerStats[m_handlerClass].Add(duration);
+        }
+
+        if ( duration >= gs_slowDispatchThreshold.load(std::memory_order_relaxed) )
+        {
+            wxEventSlowDispatch slow;
+            slow.eventType = m_eventType;
+            slow.handler = GetHandlerName(m_handlerClass);
+            slow.duration = duration;
+
+            wxPROFILER_DATA_LOCK();
+
+            wxEventProfilerData& data = GetData();
+            data.slowDispatches.push_back(slow);
+            if ( data.slowDispatches.size() > MAX_SLOW_DISPATCHES )
+                data.slowDispatches.pop_front();
+        }
+    }
+}
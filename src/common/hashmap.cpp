@@ -13,25 +13,38 @@
 
 #include "wx/hashmap.h"
 
+#ifndef WX_PRECOMP
+    #include "wx/wxcrt.h"
+#endif
+
 /* FYI: This is the "One-at-a-Time" algorithm by Bob Jenkins */
 /* from requirements by Colin Plumb. */
 /* (http://burtleburtle.net/bob/hash/doobs.html) */
 /* adapted from Perl sources ( hv.h ) */
+static inline void DoStringHashAdd(unsigned long& hash, unsigned long c)
+{
+    hash += c;
+    hash += (hash << 10);
+    hash ^= (hash >> 6);
+}
+
+static inline unsigned long DoStringHashFinish(unsigned long hash)
+{
+    hash += (hash << 3);
+    hash ^= (hash >> 11);
+
+    return hash + (hash << 15);
+}
+
 template<typename T>
 static unsigned long DoStringHash(T *k)
 {
     unsigned long hash = 0;
 
     while( *k )
-    {
-        hash += *k++;
-        hash += (hash << 10);
-        hash ^= (hash >> 6);
-    }
-    hash += (hash << 3);
-    hash ^= (hash >> 11);
+        DoStringHashAdd(hash, *k++);
 
-    return hash + (hash << 15);
+    return DoStringHashFinish(hash);
 }
 
 unsigned long wxStringHash::stringHash( const char* k )
@@ -40,6 +53,35 @@ unsigned long wxStringHash::stringHash( const char* k )
 unsigned long wxStringHash::stringHash( const wchar_t* k )
   { return DoStringHash(k); }
 
+unsigned long wxStringHashNoCase::operator()( const wxString& x ) const noexcept
+{
+    // This must be consistent with wxString::CmpNoCase(), so only fold ASCII
+    // letters directly if the current locale maps them in the usual way, which
+    // is not the case for the Turkish one, for example.
+    const bool asciiFold = wxTolower(wxT('I')) == wxT('i') &&
+                           wxToupper(wxT('i')) == wxT('I');
+
+    unsigned long hash = 0;
+
+    for ( wxString::const_iterator it = x.begin(); it != x.end(); ++it )
+    {
+        wxUniChar::value_type c = (*it).GetValue();
+        if ( asciiFold && c < 0x80 )
+        {
+            if ( c >= 'A' && c <= 'Z' )
+                c |= 0x20;
+        }
+        else
+        {
+            c = wxTolower(c).GetValue();
+        }
+
+        DoStringHashAdd(hash, c);
+    }
+
+    return DoStringHashFinish(hash);
+}
+
 
 #ifdef wxNEEDS_WX_HASH_MAP
 
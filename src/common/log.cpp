@@ -34,6 +34,7 @@
 #include "wx/apptrait.h"
 #include "wx/datetime.h"
 #include "wx/file.h"
+#include "wx/logasync.h"
 #include "wx/msgout.h"
 #include "wx/textfile.h"
 #include "wx/thread.h"
@@ -45,6 +46,15 @@
 // other standard headers
 #include <errno.h>
 
+#include <atomic>
+#include <chrono>
+#include <cmath>
+
+#if wxUSE_THREADS
+    #include <map>
+    #include <memory>
+#endif // wxUSE_THREADS
+
 #include <string.h>
 
 #include <stdlib.h>
@@ -82,16 +92,240 @@ const char *wxLOG_COMPONENT = "";
 namespace
 {
 
-// contains messages logged by the other threads and waiting to be shown until
+// a message logged by a thread other than main and waiting to be shown until
 // Flush() is called in the main one
-typedef wxVector<wxLogRecord> wxLogRecords;
-wxLogRecords gs_bufferedLogRecords;
+struct wxBufferedLogRecord
+{
+    wxBufferedLogRecord(wxLogLevel level,
+                        const wxString& msg,
+                        const wxLogRecordInfo& info)
+        : record(level, msg, info),
+          order(std::chrono::steady_clock::now().time_since_epoch().count())
+    {
+    }
 
-#define WX_DEFINE_LOG_CS(name) WX_DEFINE_GLOBAL_VAR(wxCriticalSection, name##CS)
+    // for the deferred records, only "deferred" is used and "record" remains
+    // empty, so that the message is formatted in the main thread
+    explicit wxBufferedLogRecord(const wxLogDeferredRecord& rec)
+        : record(rec.level, wxString(), wxLogRecordInfo()),
+          deferred(new wxLogDeferredRecord(rec)),
+          order(std::chrono::steady_clock::now().time_since_epoch().count())
+    {
+    }
+
+    const wxLogRecordInfo& GetInfo() const
+    {
+        return deferred ? deferred->info : record.info;
+    }
+
+    wxLogRecord record;
+    std::unique_ptr<wxLogDeferredRecord> deferred;
+
+    // monotonic time stamp with the best available resolution, used for
+    // ordering the records logged by different threads during the same
+    // millisecond
+    std::chrono::steady_clock::rep order;
+
+    bool IsBefore(const wxBufferedLogRecord& other) const
+    {
+        const wxLongLong_t ts = GetInfo().timestampMS,
+                           tsOther = other.GetInfo().timestampMS;
+        if ( ts != tsOther )
+            return ts < tsOther;
+
+        return order < other.order;
+    }
+
+    // next record in the list
+    wxBufferedLogRecord* next = nullptr;
+};
+
+// Per-thread buffer for the messages logged by this thread.
+//
+// This is a lock-free singly linked list of records: new records are pushed
+// to its head by the thread owning it while the main thread takes all of them
+// at once in FlushThreadMessages(), so there is no contention between the
+// different logging threads.
+//
+// The buffer is referenced both by its thread and by the global list of all
+// buffers and is only deleted when both of them release it, so the messages
+// logged by a thread are not lost if it terminates before they are flushed.
+class wxThreadLogBuffer
+{
+public:
+    wxThreadLogBuffer() = default;
+
+    ~wxThreadLogBuffer()
+    {
+        DeleteRecords(TakeAll());
+    }
+
+    // add a new record, called by the owning thread only, returns true if the
+    // buffer was empty before
+    bool Push(wxBufferedLogRecord* rec)
+    {
+        wxBufferedLogRecord* head = m_head.load(std::memory_order_relaxed);
+        do
+        {
+            rec->next = head;
+        } while ( !m_head.compare_exchange_weak(head, rec,
+                                                std::memory_order_release,
+                                                std::memory_order_relaxed) );
+
+        return !head;
+    }
+
+    // take all the records from the buffer, they're returned in the order in
+    // which they were logged
+    wxBufferedLogRecord* TakeAll()
+    {
+        wxBufferedLogRecord* head = m_head.exchange(nullptr,
+                                                    std::memory_order_acquire);
+
+        // the list is in LIFO order, reverse it
+        wxBufferedLogRecord* prev = nullptr;
+        while ( head )
+        {
+            wxBufferedLogRecord* const next = head->next;
+            head->next = prev;
+            prev = head;
+            head = next;
+        }
+
+        return prev;
+    }
+
+    // true if the owning thread has already terminated
+    bool IsOrphaned() const
+    {
+        return m_refCount.load(std::memory_order_acquire) == 1;
+    }
+
+    void Release()
+    {
+        if ( m_refCount.fetch_sub(1, std::memory_order_acq_rel) == 1 )
+            delete this;
+    }
+
+    static void DeleteRecords(wxBufferedLogRecord* rec)
+    {
+        while ( rec )
+        {
+            wxBufferedLogRecord* const next = rec->next;
+            delete rec;
+            rec = next;
+        }
+    }
+
+private:
+    std::atomic<wxBufferedLogRecord*> m_head{nullptr};
+
+    // one reference is held by the owning thread and another one by
+    // wxThreadLogBuffers
+    std::atomic<int> m_refCount{2};
+
+    wxDECLARE_NO_COPY_CLASS(wxThreadLogBuffer);
+};
+
+// See UntranslatedStringHolder in translation.cpp for the explanation of the
+// MinGW thread_local bug: the memory of wxThreadLogBufferRef is freed before
+// its dtor is called, so it can't use its member and must find the buffer of
+// the exiting thread in a global map instead.
+#if defined(__MINGW32__) && \
+    (!defined(__MINGW64_VERSION_MAJOR) || __MINGW64_VERSION_MAJOR < 15)
+    #define wxLOG_BUFFERS_BY_THREAD_ID
+#endif
+
+// all the existing per-thread buffers
+struct wxThreadLogBuffers
+{
+    ~wxThreadLogBuffers()
+    {
+        for ( auto buffer : buffers )
+            buffer->Release();
+    }
+
+    // this critical section protects the vector below, it's only used when
+    // the threads are created or flushed, and not when logging
+    wxCriticalSection cs;
+    wxVector<wxThreadLogBuffer*> buffers;
+
+#ifdef wxLOG_BUFFERS_BY_THREAD_ID
+    // buffers of the currently running threads, also protected by cs
+    std::map<wxThreadIdType, wxThreadLogBuffer*> byThread;
+#endif // wxLOG_BUFFERS_BY_THREAD_ID
+};
+
+WX_DEFINE_GLOBAL_VAR(wxThreadLogBuffers, ThreadLogBuffers);
+
+// owns the reference to the buffer of the current thread, if it was created
+class wxThreadLogBufferRef
+{
+public:
+    wxThreadLogBufferRef() = default;
+
+    ~wxThreadLogBufferRef()
+    {
+#ifdef wxLOG_BUFFERS_BY_THREAD_ID
+        // we can't access m_buffer here, see above
+        wxThreadLogBuffer* buffer = nullptr;
+        {
+            wxThreadLogBuffers& all = GetThreadLogBuffers();
+            wxCriticalSectionLocker lock(all.cs);
+
+            const auto it = all.byThread.find(wxThread::GetCurrentId());
+            if ( it != all.byThread.end() )
+            {
+                buffer = it->second;
+                all.byThread.erase(it);
+            }
+        }
+
+        if ( buffer )
+            buffer->Release();
+#else // !wxLOG_BUFFERS_BY_THREAD_ID
+        if ( m_buffer )
+            m_buffer->Release();
+#endif // wxLOG_BUFFERS_BY_THREAD_ID
+    }
+
+    wxThreadLogBuffer& Get()
+    {
+        if ( !m_buffer )
+        {
+            m_buffer = new wxThreadLogBuffer;
+
+            wxThreadLogBuffers& all = GetThreadLogBuffers();
+            wxCriticalSectionLocker lock(all.cs);
+            all.buffers.push_back(m_buffer);
+
+#ifdef wxLOG_BUFFERS_BY_THREAD_ID
+            all.byThread[wxThread::GetCurrentId()] = m_buffer;
+#endif // wxLOG_BUFFERS_BY_THREAD_ID
+        }
+
+        return *m_buffer;
+    }
+
+private:
+    wxThreadLogBuffer* m_buffer = nullptr;
+
+    wxDECLARE_NO_COPY_CLASS(wxThreadLogBufferRef);
+};
+
+thread_local wxThreadLogBufferRef wxPerThreadLogBuffer;
 
-// this critical section is used for buffering the messages from threads other
-// than main, i.e. it protects all accesses to gs_bufferedLogRecords above
-WX_DEFINE_LOG_CS(BackgroundLog);
+// buffer the message logged by the current thread until it can be shown from
+// the main thread
+void BufferThreadRecord(wxBufferedLogRecord* rec)
+{
+    // ensure that our Flush() will be called soon, if it wasn't already done
+    // for the previous messages still in the buffer
+    if ( wxPerThreadLogBuffer.Get().Push(rec) )
+        wxWakeUpIdle();
+}
+
+#define WX_DEFINE_LOG_CS(name) WX_DEFINE_GLOBAL_VAR(wxCriticalSection, name##CS)
 
 // this one is used for protecting TraceMasks() from concurrent access
 WX_DEFINE_LOG_CS(TraceMask);
@@ -162,6 +396,365 @@ inline ComponentLevelsMap& GetComponentLevels()
     return s_componentLevels;
 }
 
+
+// rate limiting and sampling parameters of a component
+struct wxLogRateLimit
+{
+    bool IsUnlimited() const { return rate == 0.0 && sampling >= 1.0; }
+
+    // maximal average number of messages per second or 0 if unlimited
+    double rate = 0.0;
+
+    // maximal number of messages which can be logged in a burst
+    double burst = 0.0;
+
+    // fraction of the messages to log
+    double sampling = 1.0;
+};
+
+// location of a log statement, the pointers are never dereferenced when
+// comparing the locations, so they're identified by the pointers themselves
+// (and not by the strings they point to), which is fine because they're
+// normally static strings
+struct wxLogCallSite
+{
+    bool operator==(const wxLogCallSite& other) const
+    {
+        return filename == other.filename &&
+                line == other.line &&
+                    component == other.component;
+    }
+
+    const char* filename;
+    int line;
+    const char* component;
+};
+
+struct wxLogCallSiteHash
+{
+    size_t operator()(const wxLogCallSite& site) const
+    {
+        const std::hash<const void*> hashPtr;
+        return hashPtr(site.filename) ^
+                (hashPtr(site.component) << 1) ^
+                    (static_cast<size_t>(site.line) * 0x9e3779b9u);
+    }
+};
+
+using wxLogClock = std::chrono::steady_clock;
+
+// return the current time in nanoseconds, as used in wxLogCallSiteState
+inline wxInt64 wxLogGetNanoseconds()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>
+           (
+            wxLogClock::now().time_since_epoch()
+           ).count();
+}
+
+// the value of wxLogCallSiteState::samplingThreshold meaning no sampling
+const wxUint64 wxLOG_NO_SAMPLING = wxULL(1) << 32;
+
+// state of the rate limiting for a single log statement location
+//
+// Objects of this class are never destroyed once created and all their
+// fields are atomic, so that they can be used by several threads at once
+// without locking. The rate limiting uses the "generic cell rate algorithm"
+// which only needs to update a single value for each logged message.
+struct wxLogCallSiteState
+{
+    // the generation of the parameters used by this location, they're only
+    // updated, while holding wxLogRateLimiter::cs lock, if it changes
+    std::atomic<unsigned> generation{0};
+
+    // the interval between messages corresponding to the rate limit and the
+    // tolerance corresponding to the burst size, both in nanoseconds, the
+    // interval is 0 if there is no rate limit
+    std::atomic<wxInt64> interval{0};
+    std::atomic<wxInt64> tolerance{0};
+
+    // the message is logged if a random 32 bit value is less than this or
+    // always if this is wxLOG_NO_SAMPLING
+    std::atomic<wxUint64> samplingThreshold{wxLOG_NO_SAMPLING};
+
+    // the "theoretical arrival time" of the next message
+    std::atomic<wxInt64> nextTime{0};
+
+    // the number of messages suppressed since the last summary and the time
+    // when it was logged (or this object was created)
+    std::atomic<unsigned> suppressed{0};
+    std::atomic<wxInt64> lastSummary{0};
+
+    // level and function of the last suppressed message, used for summary
+    std::atomic<wxLogLevel> level{0};
+    std::atomic<const char*> func{nullptr};
+};
+
+struct wxLogRateLimiter
+{
+    // get the parameters for the given component, checking its parents and
+    // using the default parameters if necessary
+    wxLogRateLimit GetLimit(const char* component) const;
+
+    // update the state after changing the parameters of the given component
+    void OnLimitChanged(const wxString& component);
+
+    // find or create the state for the given location
+    wxLogCallSiteState& GetState(const wxLogRecordInfo& info);
+
+    // update the parameters used by the given location if they changed
+    void UpdateState(wxLogCallSiteState& state,
+                     const wxLogRecordInfo& info,
+                     wxInt64 now);
+
+    // return true if the message can be logged, also return the number of
+    // the previously suppressed messages to report in this case
+    bool Allow(wxLogLevel level, const wxLogRecordInfo& info, unsigned& summary);
+
+
+    // true if any limits are set, only used, together with numPending, to
+    // avoid doing anything at all when there are none
+    std::atomic<bool> active{false};
+
+    // the number of locations with suppressed messages not reported yet
+    std::atomic<unsigned> numPending{0};
+
+    // incremented whenever any parameters change
+    std::atomic<unsigned> generation{1};
+
+    // minimal interval between the summaries for the same location in
+    // nanoseconds
+    std::atomic<wxInt64> summaryInterval{wxLL(10000000000)};
+
+    // protects all the fields below, it's only locked when the parameters
+    // change or a location is used by a thread for the first time
+    wxCRIT_SECT_DECLARE_MEMBER(cs);
+
+    // the parameters set for the components
+    std::unordered_map<wxString, wxLogRateLimit> limits;
+
+    // all the locations messages were logged from since the limits were set,
+    // the elements are never removed from it, so pointers to them remain
+    // valid and can be cached by the threads
+    std::unordered_map<wxLogCallSite,
+                       wxLogCallSiteState,
+                       wxLogCallSiteHash> sites;
+};
+
+WX_DEFINE_GLOBAL_VAR(wxLogRateLimiter, LogRateLimiter);
+
+// small direct-mapped cache of the locations used by the current thread, it
+// allows to find the state without locking wxLogRateLimiter::cs
+struct wxLogCallSiteCacheEntry
+{
+    wxLogCallSite site;
+    wxLogCallSiteState* state;
+};
+
+const size_t wxLOG_SITE_CACHE_SIZE = 64;
+
+thread_local wxLogCallSiteCacheEntry gs_logSiteCache[wxLOG_SITE_CACHE_SIZE];
+
+// state of the per-thread xorshift random number generator used for sampling
+thread_local wxUint64 gs_logRandomState = 0;
+
+// return a random 32 bit number
+inline wxUint32 wxLogGetRandom()
+{
+    wxUint64 x = gs_logRandomState;
+    if ( !x )
+    {
+        // seed the generator differently for each thread
+        x = wxPtrToUInt(&gs_logRandomState) ^
+                static_cast<wxUint64>(wxLogGetNanoseconds()) ^
+                    wxULL(0x9e3779b97f4a7c15);
+        if ( !x )
+            x = 1;
+    }
+
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    gs_logRandomState = x;
+
+    return static_cast<wxUint32>(x >> 32);
+}
+
+wxLogRateLimit wxLogRateLimiter::GetLimit(const char* componentOrig) const
+{
+    wxString component = wxASCII_STR(componentOrig);
+    for ( ;; )
+    {
+        const auto it = limits.find(component);
+        if ( it != limits.end() )
+            return it->second;
+
+        if ( component.empty() )
+            return wxLogRateLimit();
+
+        component = component.BeforeLast('/');
+    }
+}
+
+void wxLogRateLimiter::OnLimitChanged(const wxString& component)
+{
+    const auto it = limits.find(component);
+    if ( it != limits.end() && it->second.IsUnlimited() )
+        limits.erase(it);
+
+    generation++;
+
+    active = !limits.empty();
+}
+
+wxLogCallSiteState& wxLogRateLimiter::GetState(const wxLogRecordInfo& info)
+{
+    const wxLogCallSite site = { info.filename, info.line, info.component };
+
+    wxLogCallSiteCacheEntry&
+        entry = gs_logSiteCache[wxLogCallSiteHash()(site) % wxLOG_SITE_CACHE_SIZE];
+    if ( entry.state && entry.site == site )
+        return *entry.state;
+
+    wxCRIT_SECT_LOCKER(lock, cs);
+
+    const auto it = sites.find(site);
+    if ( it != sites.end() )
+    {
+        entry.state = &it->second;
+    }
+    else
+    {
+        // note that we can't use emplace() here as the state is not movable
+        wxLogCallSiteState& state = sites[site];
+        state.lastSummary = wxLogGetNanoseconds();
+        entry.state = &state;
+    }
+
+    entry.site = site;
+
+    return *entry.state;
+}
+
+void
+wxLogRateLimiter::UpdateState(wxLogCallSiteState& state,
+                              const wxLogRecordInfo& info,
+                              wxInt64 now)
+{
+    wxCRIT_SECT_LOCKER(lock, cs);
+
+    // another thread could have already done it
+    const unsigned gen = generation;
+    if ( state.generation == gen )
+        return;
+
+    const wxLogRateLimit limit = GetLimit(info.component);
+
+    if ( limit.rate > 0.0 )
+    {
+        const wxInt64 interval = static_cast<wxInt64>(1e9 / limit.rate);
+        state.interval = interval;
+        state.tolerance = static_cast<wxInt64>((limit.burst - 1.0)*interval);
+    }
+    else
+    {
+        state.interval = 0;
+        state.tolerance = 0;
+    }
+
+    state.samplingThreshold = limit.sampling >= 1.0
+                                ? wxLOG_NO_SAMPLING
+                                : static_cast<wxUint64>(limit.sampling *
+                                                        wxLOG_NO_SAMPLING);
+
+    // allow the full burst with the new parameters
+    state.nextTime = now;
+
+    state.generation.store(gen, std::memory_order_release);
+}
+
+bool
+wxLogRateLimiter::Allow(wxLogLevel level,
+                        const wxLogRecordInfo& info,
+                        unsigned& summary)
+{
+    const wxInt64 now = wxLogGetNanoseconds();
+
+    wxLogCallSiteState& state = GetState(info);
+    if ( state.generation.load(std::memory_order_acquire) != generation )
+        UpdateState(state, info, now);
+
+    // check the sampling first to avoid consuming the rate limit by the
+    // messages which are not going to be logged anyhow
+    const wxUint64 threshold = state.samplingThreshold;
+    bool allow = threshold == wxLOG_NO_SAMPLING || wxLogGetRandom() < threshold;
+
+    const wxInt64 interval = state.interval;
+    if ( allow && interval )
+    {
+        // the message is allowed if it doesn't arrive earlier than expected
+        // by more than the tolerance, and then the next expected time is
+        // advanced by the interval
+        const wxInt64 tolerance = state.tolerance;
+        wxInt64 next = state.nextTime;
+        for ( ;; )
+        {
+            if ( next - tolerance > now )
+            {
+                allow = false;
+                break;
+            }
+
+            if ( state.nextTime.compare_exchange_weak(next,
+                                                      wxMax(next, now) + interval) )
+                break;
+        }
+    }
+
+    if ( !allow )
+    {
+        state.level.store(level, std::memory_order_relaxed);
+        state.func.store(info.func, std::memory_order_relaxed);
+
+        if ( !state.suppressed++ )
+            numPending++;
+
+        return false;
+    }
+
+    summary = 0;
+    if ( state.suppressed.load(std::memory_order_relaxed) &&
+            now - state.lastSummary >= summaryInterval )
+    {
+        summary = state.suppressed.exchange(0);
+        if ( summary )
+        {
+            state.lastSummary = now;
+            numPending--;
+        }
+    }
+
+    return true;
+}
+
+// check if the message passes the rate limits, if any
+inline bool
+wxLogCheckRateLimit(wxLogLevel level,
+                    const wxLogRecordInfo& info,
+                    unsigned& summary)
+{
+    // we still need to check the state if there are any suppressed messages
+    // even if there are no limits any more to report them
+    wxLogRateLimiter& limiter = GetLogRateLimiter();
+    if ( !limiter.active && !limiter.numPending )
+    {
+        summary = 0;
+        return true;
+    }
+
+    return limiter.Allow(level, info, summary);
+}
+
 } // anonymous namespace
 
 // ============================================================================
@@ -265,6 +858,267 @@ wxLogFormatter::FormatTimeMS(wxLongLong_t msec) const
 }
 
 
+// ----------------------------------------------------------------------------
+// wxLogDeferredRecord implementation
+// ----------------------------------------------------------------------------
+
+void wxLogDeferredRecord::AddArg(const char *s)
+{
+    AddArg(wxString(s));
+}
+
+void wxLogDeferredRecord::AddArg(const wchar_t *s)
+{
+    AddArg(wxString(s));
+}
+
+void wxLogDeferredRecord::AddArg(const std::string& s)
+{
+    AddArg(wxString(s));
+}
+
+void wxLogDeferredRecord::AddArg(const wxString& s)
+{
+    Arg& arg = DoAddArg(Arg_String);
+    arg.str.start = static_cast<wxUint32>(m_strings.length());
+    arg.str.len = static_cast<wxUint32>(s.length());
+
+    m_strings += s;
+}
+
+namespace
+{
+
+// Format a single argument using the given printf() conversion specification
+// without the length modifier and conversion character, which is given
+// separately: the type of the stored argument is used instead of the length
+// modifier and the argument is converted to the type required by the
+// conversion, if it doesn't match.
+wxString
+FormatDeferredArg(const wxLogDeferredRecord& rec,
+                  size_t n,
+                  const wxString& spec,
+                  char conv)
+{
+    const wxLogDeferredRecord::ArgType type = rec.GetArgType(n);
+
+    switch ( conv )
+    {
+        case 'd':
+        case 'i':
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+        case 'c':
+        case 'C':
+            {
+                wxLongLong_t value;
+                switch ( type )
+                {
+                    case wxLogDeferredRecord::Arg_Int:
+                        value = rec.GetIntArg(n);
+                        break;
+
+                    case wxLogDeferredRecord::Arg_UInt:
+                        value = static_cast<wxLongLong_t>(rec.GetUIntArg(n));
+                        break;
+
+                    case wxLogDeferredRecord::Arg_Double:
+                        value = static_cast<wxLongLong_t>(rec.GetDoubleArg(n));
+                        break;
+
+                    case wxLogDeferredRecord::Arg_Pointer:
+                        value = static_cast<wxLongLong_t>(rec.GetPointerArg(n));
+                        break;
+
+                    case wxLogDeferredRecord::Arg_String:
+                    default:
+                        return rec.GetStringArg(n);
+                }
+
+                if ( conv == 'c' || conv == 'C' )
+                    return wxString(wxUniChar(static_cast<wxUint32>(value)));
+
+                if ( conv == 'd' || conv == 'i' )
+                    return wxString::Format(spec + "lld", value);
+
+                return wxString::Format(spec + "ll" + conv,
+                                        static_cast<wxULongLong_t>(value));
+            }
+
+        case 'e':
+        case 'E':
+        case 'f':
+        case 'F':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+            {
+                double value;
+                switch ( type )
+                {
+                    case wxLogDeferredRecord::Arg_Int:
+                        value = static_cast<double>(rec.GetIntArg(n));
+                        break;
+
+                    case wxLogDeferredRecord::Arg_UInt:
+                        value = static_cast<double>(rec.GetUIntArg(n));
+                        break;
+
+                    case wxLogDeferredRecord::Arg_Double:
+                        value = rec.GetDoubleArg(n);
+                        break;
+
+                    case wxLogDeferredRecord::Arg_Pointer:
+                        value = static_cast<double>(rec.GetPointerArg(n));
+                        break;
+
+                    case wxLogDeferredRecord::Arg_String:
+                    default:
+                        return rec.GetStringArg(n);
+                }
+
+                return wxString::Format(spec + conv, value);
+            }
+
+        case 'p':
+            if ( type == wxLogDeferredRecord::Arg_String )
+                return rec.GetStringArg(n);
+
+            return wxString::Format(spec + "p",
+                                    wxUIntToPtr(type == wxLogDeferredRecord::Arg_Pointer
+                                                    ? rec.GetPointerArg(n)
+                                                    : rec.GetUIntArg(n)));
+
+        case 's':
+        case 'S':
+            {
+                wxString str;
+                switch ( type )
+                {
+                    case wxLogDeferredRecord::Arg_Int:
+                        str = wxString::Format("%lld", rec.GetIntArg(n));
+                        break;
+
+                    case wxLogDeferredRecord::Arg_UInt:
+                        str = wxString::Format("%llu", rec.GetUIntArg(n));
+                        break;
+
+                    case wxLogDeferredRecord::Arg_Double:
+                        str = wxString::Format("%g", rec.GetDoubleArg(n));
+                        break;
+
+                    case wxLogDeferredRecord::Arg_Pointer:
+                        str = wxString::Format("%p",
+                                               wxUIntToPtr(rec.GetPointerArg(n)));
+                        break;
+
+                    case wxLogDeferredRecord::Arg_String:
+                        str = rec.GetStringArg(n);
+                        break;
+                }
+
+                // avoid calling Format() if there is nothing to do
+                if ( spec.length() == 1 )
+                    return str;
+
+                return wxString::Format(spec + "s", str);
+            }
+    }
+
+    wxFAIL_MSG( "unreachable" );
+
+    return wxString();
+}
+
+} // anonymous namespace
+
+wxString wxLogDeferredRecord::Format() const
+{
+    wxString s;
+
+    size_t nextArg = 0;
+    for ( const char* p = format; *p; )
+    {
+        // copy the literal text
+        const char* const start = p;
+        while ( *p && *p != '%' )
+            p++;
+
+        if ( p != start )
+            s += wxString(start, p - start);
+
+        if ( !*p )
+            break;
+
+        const char* const specStart = p++;
+        if ( *p == '%' )
+        {
+            s += '%';
+            p++;
+            continue;
+        }
+
+        // check for a positional argument
+        size_t argIndex = nextArg;
+        size_t pos = 0;
+        const char* q = p;
+        while ( *q >= '0' && *q <= '9' )
+            pos = 10*pos + (*q++ - '0');
+        if ( *q == '$' && pos > 0 )
+        {
+            argIndex = pos - 1;
+            p = q + 1;
+        }
+
+        // collect flags, width and precision to pass them to Format() as is
+        wxString spec('%');
+        while ( *p && strchr("-+ #0'", *p) )
+            spec += *p++;
+        while ( *p >= '0' && *p <= '9' )
+            spec += *p++;
+        if ( *p == '.' )
+        {
+            spec += *p++;
+            while ( *p >= '0' && *p <= '9' )
+                spec += *p++;
+        }
+
+        // skip the length modifiers, we use the real types of the arguments
+        // instead, including the MSVC-specific I, I32 and I64
+        while ( *p && strchr("hlLqjztI", *p) )
+        {
+            if ( *p++ == 'I' )
+            {
+                while ( *p >= '0' && *p <= '9' )
+                    p++;
+            }
+        }
+
+        const char conv = *p;
+        if ( !conv || !strchr("diuoxXcCeEfFgGaAsSp", conv) || argIndex >= m_numArgs )
+        {
+            // unsupported or invalid format specification or missing
+            // argument: output it as is
+            if ( conv )
+                p++;
+
+            s += wxString(specStart, p - specStart);
+            continue;
+        }
+
+        p++;
+
+        s += FormatDeferredArg(*this, argIndex, spec, conv);
+
+        nextArg = argIndex + 1;
+    }
+
+    return s;
+}
+
 // ----------------------------------------------------------------------------
 // wxLog class implementation
 // ----------------------------------------------------------------------------
@@ -358,11 +1212,33 @@ wxLog::OnLog(wxLogLevel level,
     // and always terminate the program
     if ( level == wxLOG_FatalError )
     {
+#if wxUSE_THREADS
+        // ensure that the messages logged before, as well as this one, are
+        // not lost if asynchronous logging is used
+        wxLogAsync::OnFatalError(msg, info);
+#endif // wxUSE_THREADS
+
         wxSafeShowMessage(wxS("Fatal Error"), msg);
 
         wxAbort();
     }
 
+    unsigned suppressed;
+    if ( !wxLogCheckRateLimit(level, info, suppressed) )
+        return;
+
+    if ( suppressed )
+        LogSuppressed(level, suppressed, info);
+
+    DoOnLog(level, msg, info);
+}
+
+/* static */
+void
+wxLog::DoOnLog(wxLogLevel level,
+               const wxString& msg,
+               const wxLogRecordInfo& info)
+{
     wxLog *logger;
 
 #if wxUSE_THREADS
@@ -373,14 +1249,7 @@ wxLog::OnLog(wxLogLevel level,
         {
             if ( ms_pLogger )
             {
-                // buffer the messages until they can be shown from the main
-                // thread
-                wxCriticalSectionLocker lock(GetBackgroundLogCS());
-
-                gs_bufferedLogRecords.push_back(wxLogRecord(level, msg, info));
-
-                // ensure that our Flush() will be called soon
-                wxWakeUpIdle();
+                BufferThreadRecord(new wxBufferedLogRecord(level, msg, info));
             }
             //else: we don't have any logger at all, there is no need to log
             //      anything
@@ -401,6 +1270,143 @@ wxLog::OnLog(wxLogLevel level,
     logger->CallDoLogNow(level, msg, info);
 }
 
+/* static */
+void wxLog::OnLogDeferred(const wxLogDeferredRecord& rec)
+{
+    // fatal errors are always handled in the same way
+    if ( rec.level == wxLOG_FatalError )
+    {
+        OnLog(rec.level, rec.Format(), rec.info);
+        return;
+    }
+
+    unsigned suppressed;
+    if ( !wxLogCheckRateLimit(rec.level, rec.info, suppressed) )
+        return;
+
+    if ( suppressed )
+        LogSuppressed(rec.level, suppressed, rec.info);
+
+    wxLog *logger;
+
+#if wxUSE_THREADS
+    if ( !wxThread::IsMain() )
+    {
+        logger = wxPerThreadLogger;
+        if ( !logger )
+        {
+            // as in OnLog(), buffer the record, but without formatting it
+            if ( ms_pLogger )
+                BufferThreadRecord(new wxBufferedLogRecord(rec));
+
+            return;
+        }
+    }
+    else
+#endif // wxUSE_THREADS
+    {
+        logger = GetMainThreadActiveTarget();
+        if ( !logger )
+            return;
+    }
+
+    logger->CallDoLogDeferredNow(rec);
+}
+
+/* static */
+void
+wxLog::LogSuppressed(wxLogLevel level,
+                     unsigned count,
+                     const wxLogRecordInfo& info)
+{
+    wxString msg;
+#if wxUSE_INTL
+    msg.Printf(wxPLURAL("%u message from the same location was suppressed.",
+                        "%u messages from the same location were suppressed.",
+                        count),
+               count);
+#else
+    msg.Printf(wxS("%u message(s) from the same location were suppressed."),
+               count);
+#endif
+
+    DoOnLog(level, msg, info);
+}
+
+/* static */
+void wxLog::LogPendingSuppressed()
+{
+    wxLogRateLimiter& limiter = GetLogRateLimiter();
+    if ( !limiter.numPending )
+        return;
+
+    struct Summary
+    {
+        wxLogLevel level;
+        unsigned count;
+        wxLogCallSite site;
+        const char* func;
+    };
+
+    wxVector<Summary> summaries;
+
+    {
+        const wxInt64 now = wxLogGetNanoseconds();
+
+        wxCRIT_SECT_LOCKER(lock, limiter.cs);
+
+        for ( auto& kv : limiter.sites )
+        {
+            wxLogCallSiteState& state = kv.second;
+            if ( !state.suppressed ||
+                    now - state.lastSummary < limiter.summaryInterval )
+                continue;
+
+            const unsigned count = state.suppressed.exchange(0);
+            if ( !count )
+                continue;
+
+            const Summary summary =
+                { state.level, count, kv.first, state.func };
+            summaries.push_back(summary);
+
+            state.lastSummary = now;
+            limiter.numPending--;
+        }
+    }
+
+    for ( const auto& summary : summaries )
+    {
+        wxLogRecordInfo info(summary.site.filename,
+                             summary.site.line,
+                             summary.func,
+                             summary.site.component);
+        info.timestampMS = wxGetUTCTimeMillis().GetValue();
+#if WXWIN_COMPATIBILITY_3_0
+        info.timestamp = info.timestampMS / 1000;
+#endif // WXWIN_COMPATIBILITY_3_0
+
+        LogSuppressed(summary.level, summary.count, info);
+    }
+}
+
+void wxLog::CallDoLogDeferredNow(const wxLogDeferredRecord& rec)
+{
+    // we need the formatted message to compare it with the previous one
+    if ( GetRepetitionCounting() )
+    {
+        CallDoLogNow(rec.level, rec.Format(), rec.info);
+        return;
+    }
+
+    DoLogDeferredRecord(rec);
+}
+
+void wxLog::DoLogDeferredRecord(const wxLogDeferredRecord& rec)
+{
+    CallDoLogNow(rec.level, rec.Format(), rec.info);
+}
+
 void
 wxLog::CallDoLogNow(wxLogLevel level,
                     const wxString& msg,
@@ -613,6 +1619,53 @@ wxLogLevel wxLog::GetComponentLevel(const wxString& componentOrig)
     return GetLogLevel();
 }
 
+// ----------------------------------------------------------------------------
+// wxLog rate limiting
+// ----------------------------------------------------------------------------
+
+/* static */
+void
+wxLog::SetComponentRateLimit(const wxString& component,
+                             double messagesPerSecond,
+                             unsigned burst)
+{
+    wxLogRateLimiter& limiter = GetLogRateLimiter();
+
+    wxCRIT_SECT_LOCKER(lock, limiter.cs);
+
+    wxLogRateLimit& limit = limiter.limits[component];
+    if ( messagesPerSecond > 0.0 )
+    {
+        limit.rate = messagesPerSecond;
+        limit.burst = burst ? burst : std::ceil(messagesPerSecond);
+    }
+    else
+    {
+        limit.rate =
+        limit.burst = 0.0;
+    }
+
+    limiter.OnLimitChanged(component);
+}
+
+/* static */
+void wxLog::SetComponentSampling(const wxString& component, double ratio)
+{
+    wxLogRateLimiter& limiter = GetLogRateLimiter();
+
+    wxCRIT_SECT_LOCKER(lock, limiter.cs);
+
+    limiter.limits[component].sampling = wxClip(ratio, 0.0, 1.0);
+
+    limiter.OnLimitChanged(component);
+}
+
+/* static */
+void wxLog::SetSuppressedSummaryInterval(int milliseconds)
+{
+    GetLogRateLimiter().summaryInterval = wxLL(1000000)*milliseconds;
+}
+
 // ----------------------------------------------------------------------------
 // wxLog trace masks
 // ----------------------------------------------------------------------------
@@ -736,21 +1789,65 @@ void wxLog::TimeStampMS(wxString*, wxLongLong_t)
 
 void wxLog::FlushThreadMessages()
 {
-    // check if we have queued messages from other threads
-    wxLogRecords bufferedLogRecords;
+    // check if we have queued messages from other threads: take all of them
+    // from each of the per-thread buffers, which are already sorted
+    wxVector<wxBufferedLogRecord*> lists;
 
     {
-        wxCriticalSectionLocker lock(GetBackgroundLogCS());
-        bufferedLogRecords.swap(gs_bufferedLogRecords);
+        wxThreadLogBuffers& all = GetThreadLogBuffers();
+        wxCriticalSectionLocker lock(all.cs);
+
+        for ( size_t n = 0; n < all.buffers.size(); )
+        {
+            wxThreadLogBuffer* const buffer = all.buffers[n];
+
+            // check this before taking the records: if the thread has already
+            // terminated, it can't log anything more, so we can get rid of
+            // its buffer after doing it
+            const bool orphaned = buffer->IsOrphaned();
+
+            wxBufferedLogRecord* const rec = buffer->TakeAll();
+            if ( rec )
+                lists.push_back(rec);
+
+            if ( orphaned )
+            {
+                all.buffers.erase(all.buffers.begin() + n);
+                buffer->Release();
+            }
+            else
+            {
+                n++;
+            }
+        }
 
         // release the lock now to not keep it while we are logging the
-        // messages below, allowing background threads to run
+        // messages below, allowing new threads to start
     }
 
-    if ( !bufferedLogRecords.empty() )
+    // merge the messages from all threads in the order of their time stamps
+    while ( !lists.empty() )
     {
-        for ( const auto& record : bufferedLogRecords )
+        size_t first = 0;
+        for ( size_t n = 1; n < lists.size(); n++ )
         {
+            if ( lists[n]->IsBefore(*lists[first]) )
+                first = n;
+        }
+
+        std::unique_ptr<wxBufferedLogRecord> rec(lists[first]);
+        if ( rec->next )
+            lists[first] = rec->next;
+        else
+            lists.erase(lists.begin() + first);
+
+        if ( rec->deferred )
+        {
+            CallDoLogDeferredNow(*rec->deferred);
+        }
+        else
+        {
+            const wxLogRecord& record = rec->record;
             CallDoLogNow(record.level, record.msg, record.info);
         }
     }
@@ -799,6 +1896,11 @@ void wxLog::FlushActive()
             log->FlushThreadMessages();
 #endif // wxUSE_THREADS
 
+        // also report the messages suppressed by the rate limits if no more
+        // messages are logged from the same location to do it
+        if ( wxIsMainThread() )
+            LogPendingSuppressed();
+
         log->Flush();
     }
 }
@@ -0,0 +1,691 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        src/common/logasync.cpp
+// Purpose:     wxLogAsync implementation
+// Author:      wxWidgets team
+// Created:     2026-10-19
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+// ============================================================================
+// declarations
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// headers
+// ----------------------------------------------------------------------------
+
+// For compilers that support precompilation, includes "wx.h".
+#include "wx/wxprec.h"
+
+#if wxUSE_LOG && wxUSE_THREADS
+
+#ifndef WX_PRECOMP
+    #include "wx/intl.h"
+    #include "wx/log.h"
+    #include "wx/module.h"
+    #include "wx/thread.h"
+    #include "wx/time.h"
+#endif // WX_PRECOMP
+
+#include "wx/logasync.h"
+#include "wx/msgqueue.h"
+
+#include "wx/private/safecall.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace
+{
+
+// The maximal number of records processed by the writer thread at once.
+const size_t WRITER_BATCH_SIZE = 256;
+
+// How long to wait for the messages to be written before aborting the
+// program after a fatal error.
+const long FATAL_ERROR_FLUSH_TIMEOUT = 2000;
+
+// Record in the queue: either a message or a command for the writer thread.
+struct AsyncLogRecord
+{
+    enum Kind
+    {
+        Kind_Message,
+        Kind_Flush,
+        Kind_Stop
+    };
+
+    AsyncLogRecord() = default;
+
+    AsyncLogRecord(wxLogLevel level_,
+                   const wxString& msg_,
+                   const wxLogRecordInfo& info_)
+        : level(level_),
+          msg(msg_),
+          info(info_)
+    {
+    }
+
+    explicit AsyncLogRecord(const wxLogDeferredRecord& rec)
+        : level(rec.level),
+          deferred(new wxLogDeferredRecord(rec))
+    {
+    }
+
+    explicit AsyncLogRecord(Kind kind_, wxUint64 flushId_ = 0)
+        : kind(kind_),
+          flushId(flushId_)
+    {
+    }
+
+    Kind kind = Kind_Message;
+
+    // only used for Kind_Message
+    wxLogLevel level = 0;
+    wxString msg;
+    wxLogRecordInfo info;
+
+    // if non-null, used instead of msg and info: the message is formatted in
+    // the writer thread
+    std::unique_ptr<wxLogDeferredRecord> deferred;
+
+    // only used for Kind_Flush: non-zero if somebody waits for this flush
+    wxUint64 flushId = 0;
+};
+
+// All the existing wxLogAsync objects, used for flushing them on fatal errors
+// and stopping them on shutdown.
+std::vector<wxLogAsync*> gs_allAsyncLogs;
+
+wxCriticalSection& GetAllAsyncLogsCS()
+{
+    static wxCriticalSection s_cs;
+    return s_cs;
+}
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------------
+// wxLogAsyncWriter: the queue and the thread writing messages from it
+// ----------------------------------------------------------------------------
+
+class wxLogAsyncWriter : public wxThread
+{
+public:
+    wxLogAsyncWriter(wxLog *logger,
+                     size_t capacity,
+                     wxLogAsyncOverflowPolicy policy)
+        : wxThread(wxTHREAD_JOINABLE),
+          m_logger(logger),
+          m_queue(capacity),
+          m_policy(policy),
+          m_condFlushed(m_mutexFlushed)
+    {
+        m_running = Run() == wxTHREAD_NO_ERROR;
+    }
+
+    virtual ~wxLogAsyncWriter()
+    {
+        Stop();
+
+        delete m_logger;
+    }
+
+    wxLog *GetLog() const { return m_logger; }
+
+    void SetOverflowPolicy(wxLogAsyncOverflowPolicy policy) { m_policy = policy; }
+    wxLogAsyncOverflowPolicy GetOverflowPolicy() const { return m_policy; }
+
+    wxUint64 GetDroppedCount() const { return m_dropped; }
+
+    // Queue the message or write it immediately if the writer thread is not
+    // running.
+    void Log(wxLogLevel level, const wxString& msg, const wxLogRecordInfo& info);
+    void Log(const wxLogDeferredRecord& rec);
+
+    // Ask the writer thread to flush the wrapped logger if anything was
+    // logged since the last time this was done.
+    void Flush();
+
+    // Wait until everything logged so far is written.
+    bool FlushAndWait(long timeout);
+
+    // Write all the remaining messages and stop the writer thread.
+    void Stop();
+
+protected:
+    virtual ExitCode Entry() override;
+
+private:
+    // Queue the record or write it immediately if the writer thread is not
+    // running, this is used by both Log() overloads.
+    void DoLog(AsyncLogRecord&& rec);
+
+    // Return true if the writer thread is running and so records can be
+    // posted to the queue, in which case EndPost() must be called after
+    // doing it. Stop() waits until all posts started before it are done.
+    bool BeginPost();
+    void EndPost() { m_posting--; }
+
+    // Post the message to the queue, taking the overflow policy into account.
+    void Post(AsyncLogRecord&& rec);
+
+    // Write the message to the wrapped logger.
+    void Write(const AsyncLogRecord& rec);
+
+    // Log a warning about the dropped messages if there were any.
+    void ReportDropped();
+
+    // Process a single record in the writer thread, return false if the
+    // thread should stop after processing the current batch.
+    bool Process(const AsyncLogRecord& rec);
+
+    // Process the commands removed from the queue by Post(), return false
+    // if the thread should stop.
+    bool ProcessDisplaced();
+
+
+    wxLog *const m_logger;
+
+    wxBoundedMessageQueue<AsyncLogRecord> m_queue;
+
+    std::atomic<wxLogAsyncOverflowPolicy> m_policy;
+
+    // true while the writer thread is running
+    std::atomic<bool> m_running{false};
+
+    // number of threads currently posting records to the queue
+    std::atomic<unsigned> m_posting{0};
+
+    // true if a message was logged since the last flush
+    std::atomic<bool> m_dirty{false};
+
+    // number of messages dropped so far and number of them already reported
+    std::atomic<wxUint64> m_dropped{0};
+    wxUint64 m_droppedReported = 0;
+
+    // used when writing messages synchronously, i.e. without the thread
+    wxCriticalSection m_csSync;
+
+    // commands removed from the queue to make space for the new messages
+    // when using wxLOG_ASYNC_DROP_OLDEST policy, they're processed by the
+    // writer thread after the current batch of records
+    std::vector<AsyncLogRecord> m_displaced;
+    wxCriticalSection m_csDisplaced;
+
+    // last flush identifier allocated by FlushAndWait() and the last one
+    // processed by the writer thread, protected by m_mutexFlushed
+    wxUint64 m_flushRequested = 0;
+    wxUint64 m_flushDone = 0;
+    wxMutex m_mutexFlushed;
+    wxCondition m_condFlushed;
+
+    wxDECLARE_NO_COPY_CLASS(wxLogAsyncWriter);
+};
+
+void
+wxLogAsyncWriter::Log(wxLogLevel level,
+                      const wxString& msg,
+                      const wxLogRecordInfo& info)
+{
+    DoLog(AsyncLogRecord(level, msg, info));
+}
+
+void wxLogAsyncWriter::Log(const wxLogDeferredRecord& rec)
+{
+    DoLog(AsyncLogRecord(rec));
+}
+
+bool wxLogAsyncWriter::BeginPost()
+{
+    // Notice that the order of these operations is important: Stop() first
+    // resets m_running and then checks m_posting, so either it will wait for
+    // us or we will see that the thread is not running any more.
+    m_posting++;
+    if ( m_running )
+        return true;
+
+    m_posting--;
+    return false;
+}
+
+void wxLogAsyncWriter::DoLog(AsyncLogRecord&& rec)
+{
+    if ( !BeginPost() )
+    {
+        // The messages logged by the wrapped logger from the writer thread
+        // while it's being stopped can't be queued any more, but we must not
+        // lock m_csSync from it, as Stop() holds it while waiting for the
+        // thread to terminate.
+        if ( wxThread::This() == this )
+        {
+            Write(rec);
+            return;
+        }
+
+        wxCriticalSectionLocker lock(m_csSync);
+
+        Write(rec);
+        return;
+    }
+
+    m_dirty = true;
+
+    Post(std::move(rec));
+
+    EndPost();
+}
+
+void wxLogAsyncWriter::Post(AsyncLogRecord&& rec)
+{
+    if ( m_queue.TryPost(std::move(rec)) )
+        return;
+
+    switch ( m_policy.load() )
+    {
+        case wxLOG_ASYNC_BLOCK:
+            // Waiting for the writer thread from the writer thread itself
+            // would deadlock, so just write the message directly if the
+            // wrapped logger logs something.
+            if ( wxThread::This() == this )
+                Write(rec);
+            else
+                m_queue.Post(std::move(rec));
+            break;
+
+        case wxLOG_ASYNC_DROP:
+            m_dropped++;
+            break;
+
+        case wxLOG_ASYNC_DROP_OLDEST:
+            {
+                AsyncLogRecord old;
+                if ( m_queue.TryReceive(old) )
+                {
+                    if ( old.kind == AsyncLogRecord::Kind_Message )
+                    {
+                        m_dropped++;
+                    }
+                    else
+                    {
+                        // Commands can't be dropped, but they can't be put
+                        // back at the end of the queue neither, as they would
+                        // be processed after the newer messages then, so let
+                        // the writer thread process them separately. Notice
+                        // that this must be done before posting the new
+                        // message to ensure that the writer thread wakes up
+                        // after the command is added.
+                        wxCriticalSectionLocker lock(m_csDisplaced);
+                        m_displaced.push_back(std::move(old));
+                    }
+                }
+
+                // If another thread took the space we've just freed, drop
+                // this message instead of waiting.
+                if ( !m_queue.TryPost(std::move(rec)) )
+                    m_dropped++;
+            }
+            break;
+    }
+}
+
+void wxLogAsyncWriter::Write(const AsyncLogRecord& rec)
+{
+    ReportDropped();
+
+    wxSafeCall([&]()
+        {
+            if ( rec.deferred )
+                m_logger->LogDeferredRecord(*rec.deferred);
+            else
+                m_logger->LogRecord(rec.level, rec.msg, rec.info);
+        });
+}
+
+void wxLogAsyncWriter::ReportDropped()
+{
+    const wxUint64 dropped = m_dropped;
+    if ( dropped == m_droppedReported )
+        return;
+
+    wxLogRecordInfo info(__FILE__, __LINE__, __func__, "wx/log");
+    info.timestampMS = wxGetUTCTimeMillis().GetValue();
+
+    const wxString msg = wxString::Format
+                         (
+                            _("%llu log messages were dropped because the log queue was full."),
+                            static_cast<unsigned long long>(dropped - m_droppedReported)
+                         );
+
+    m_droppedReported = dropped;
+
+    wxSafeCall([&]() { m_logger->LogRecord(wxLOG_Warning, msg, info); });
+}
+
+void wxLogAsyncWriter::Flush()
+{
+    if ( !BeginPost() )
+    {
+        // As in DoLog(), don't lock m_csSync from the writer thread itself.
+        if ( wxThread::This() == this )
+        {
+            m_logger->Flush();
+            return;
+        }
+
+        wxCriticalSectionLocker lock(m_csSync);
+
+        m_logger->Flush();
+        return;
+    }
+
+    // Don't fill the queue with useless flush requests if nothing was logged.
+    // And don't wait if the queue is full, the request is not important
+    // enough to block the caller and the wrapped logger will be flushed when
+    // the queue is emptied anyhow.
+    if ( m_dirty.exchange(false) )
+        m_queue.TryPost(AsyncLogRecord(AsyncLogRecord::Kind_Flush));
+
+    EndPost();
+}
+
+bool wxLogAsyncWriter::FlushAndWait(long timeout)
+{
+    // As in DoLog(), don't lock m_csSync from the writer thread itself.
+    if ( wxThread::This() == this )
+    {
+        m_logger->Flush();
+        return true;
+    }
+
+    if ( !BeginPost() )
+    {
+        wxCriticalSectionLocker lock(m_csSync);
+
+        m_logger->Flush();
+        return true;
+    }
+
+    wxUint64 flushId;
+    {
+        wxMutexLocker lock(m_mutexFlushed);
+        flushId = ++m_flushRequested;
+    }
+
+    AsyncLogRecord rec(AsyncLogRecord::Kind_Flush, flushId);
+
+    bool posted = true;
+    if ( timeout < 0 )
+        m_queue.Post(std::move(rec));
+    else
+        posted = m_queue.PostTimeout(timeout, std::move(rec)) == wxMSGQUEUE_NO_ERROR;
+
+    EndPost();
+
+    if ( !posted )
+        return false;
+
+    const wxMilliClock_t waitUntil = wxGetLocalTimeMillis() + timeout;
+
+    wxMutexLocker lock(m_mutexFlushed);
+    while ( m_flushDone < flushId )
+    {
+        if ( timeout < 0 )
+        {
+            m_condFlushed.Wait();
+            continue;
+        }
+
+        const wxMilliClock_t now = wxGetLocalTimeMillis();
+        if ( now >= waitUntil )
+            return false;
+
+        m_condFlushed.WaitTimeout((waitUntil - now).ToLong());
+    }
+
+    return true;
+}
+
+void wxLogAsyncWriter::Stop()
+{
+    if ( !m_running )
+        return;
+
+    // Block the other threads trying to log synchronously until we're done.
+    wxCriticalSectionLocker lock(m_csSync);
+
+    // Don't let any other threads post to the queue any more and wait until
+    // those which have already started doing it finish: they can't block
+    // for long, as the writer thread is still running.
+    m_running = false;
+    while ( m_posting )
+        wxThread::Yield();
+
+    // Notice that this must be posted even if the queue is full, whatever the
+    // overflow policy is.
+    m_queue.Post(AsyncLogRecord(AsyncLogRecord::Kind_Stop));
+
+    Wait();
+
+    // Write any messages which could have been posted by the wrapped logger
+    // from the writer thread itself while processing the last batch.
+    AsyncLogRecord rec;
+    while ( m_queue.TryReceive(rec) )
+    {
+        if ( rec.kind == AsyncLogRecord::Kind_Message )
+            Write(rec);
+    }
+
+    ReportDropped();
+
+    m_logger->Flush();
+}
+
+bool wxLogAsyncWriter::Process(const AsyncLogRecord& rec)
+{
+    switch ( rec.kind )
+    {
+        case AsyncLogRecord::Kind_Message:
+            Write(rec);
+            break;
+
+        case AsyncLogRecord::Kind_Flush:
+            ReportDropped();
+
+            wxSafeCall([this]() { m_logger->Flush(); });
+
+            if ( rec.flushId )
+            {
+                wxMutexLocker lock(m_mutexFlushed);
+                m_flushDone = std::max(m_flushDone, rec.flushId);
+                m_condFlushed.Broadcast();
+            }
+            break;
+
+        case AsyncLogRecord::Kind_Stop:
+            return false;
+    }
+
+    return true;
+}
+
+bool wxLogAsyncWriter::ProcessDisplaced()
+{
+    std::vector<AsyncLogRecord> displaced;
+    {
+        wxCriticalSectionLocker lock(m_csDisplaced);
+        if ( m_displaced.empty() )
+            return true;
+
+        displaced.swap(m_displaced);
+    }
+
+    bool cont = true;
+    for ( const auto& rec : displaced )
+    {
+        if ( !Process(rec) )
+            cont = false;
+    }
+
+    return cont;
+}
+
+wxThread::ExitCode wxLogAsyncWriter::Entry()
+{
+    SetName("wxLogAsync");
+
+    std::vector<AsyncLogRecord> batch;
+    batch.reserve(WRITER_BATCH_SIZE);
+
+    for ( ;; )
+    {
+        batch.clear();
+        if ( m_queue.ReceiveBatch(batch, WRITER_BATCH_SIZE) != wxMSGQUEUE_NO_ERROR )
+            break;
+
+        bool stop = false;
+        for ( const auto& rec : batch )
+        {
+            if ( !Process(rec) )
+                stop = true;
+        }
+
+        // The displaced commands could have been queued before some of the
+        // records in this batch, so process them after them: this is fine as
+        // flushing later than requested is harmless.
+        if ( !ProcessDisplaced() )
+            stop = true;
+
+        if ( stop )
+            break;
+    }
+
+    return nullptr;
+}
+
+// ============================================================================
+// wxLogAsync implementation
+// ============================================================================
+
+wxLogAsync::wxLogAsync(wxLog *logger,
+                       size_t capacity,
+                       wxLogAsyncOverflowPolicy policy)
+{
+    wxASSERT_MSG( logger, wxS("wrapped log target must be non-null") );
+
+    m_writer = new wxLogAsyncWriter(logger, capacity, policy);
+
+    wxCriticalSectionLocker lock(GetAllAsyncLogsCS());
+    gs_allAsyncLogs.push_back(this);
+}
+
+wxLogAsync::~wxLogAsync()
+{
+    {
+        wxCriticalSectionLocker lock(GetAllAsyncLogsCS());
+        gs_allAsyncLogs.erase(std::remove(gs_allAsyncLogs.begin(),
+                                          gs_allAsyncLogs.end(),
+                                          this),
+                              gs_allAsyncLogs.end());
+    }
+
+    delete m_writer;
+}
+
+wxLog *wxLogAsync::GetLog() const
+{
+    return m_writer->GetLog();
+}
+
+void wxLogAsync::SetOverflowPolicy(wxLogAsyncOverflowPolicy policy)
+{
+    m_writer->SetOverflowPolicy(policy);
+}
+
+wxLogAsyncOverflowPolicy wxLogAsync::GetOverflowPolicy() const
+{
+    return m_writer->GetOverflowPolicy();
+}
+
+wxUint64 wxLogAsync::GetDroppedCount() const
+{
+    return m_writer->GetDroppedCount();
+}
+
+void wxLogAsync::Flush()
+{
+    wxLog::Flush();
+
+    m_writer->Flush();
+}
+
+bool wxLogAsync::FlushAndWait(long timeout)
+{
+    return m_writer->FlushAndWait(timeout);
+}
+
+void
+wxLogAsync::DoLogRecord(wxLogLevel level,
+                        const wxString& msg,
+                        const wxLogRecordInfo& info)
+{
+    m_writer->Log(level, msg, info);
+}
+
+void wxLogAsync::DoLogDeferredRecord(const wxLogDeferredRecord& rec)
+{
+    m_writer->Log(rec);
+}
+
+/* static */
+void wxLogAsync::OnFatalError(const wxString& msg, const wxLogRecordInfo& info)
+{
+    wxCriticalSectionLocker lock(GetAllAsyncLogsCS());
+
+    for ( auto log : gs_allAsyncLogs )
+    {
+        log->m_writer->Log(wxLOG_FatalError, msg, info);
+        log->m_writer->FlushAndWait(FATAL_ERROR_FLUSH_TIMEOUT);
+    }
+}
+
+/* static */
+void wxLogAsync::StopAllWriters()
+{
+    wxCriticalSectionLocker lock(GetAllAsyncLogsCS());
+
+    for ( auto log : gs_allAsyncLogs )
+        log->m_writer->Stop();
+}
+
+// ----------------------------------------------------------------------------
+// wxLogAsyncModule: stops the writer threads before wxThread cleanup
+// ----------------------------------------------------------------------------
+
+class wxLogAsyncModule : public wxModule
+{
+public:
+    wxLogAsyncModule()
+    {
+        // The writer threads must be stopped before the threads module
+        // cleanup, which would otherwise try to delete them.
+        AddDependency("wxThreadModule");
+    }
+
+    virtual bool OnInit() override { return true; }
+    virtual void OnExit() override
+    {
+        // The log targets themselves are typically deleted later, they will
+        // continue to work but will write messages synchronously from now on.
+        wxLogAsync::StopAllWriters();
+    }
+
+private:
+    wxDECLARE_DYNAMIC_CLASS(wxLogAsyncModule);
+};
+
+wxIMPLEMENT_DYNAMIC_CLASS(wxLogAsyncModule, wxModule);
+
+#endif // wxUSE_LOG && wxUSE_THREADS
@@ -0,0 +1,687 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        src/common/logbinary.cpp
+// Purpose:     wxLogBinaryFile and wxLogBinaryReader implementation
+// Author:      wxWidgets team
+// Created:     2026-10-19
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+// ============================================================================
+// declarations
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// headers
+// ----------------------------------------------------------------------------
+
+// For compilers that support precompilation, includes "wx.h".
+#include "wx/wxprec.h"
+
+#if wxUSE_LOG && wxUSE_FFILE
+
+#ifndef WX_PRECOMP
+    #include "wx/intl.h"
+    #include "wx/log.h"
+#endif // WX_PRECOMP
+
+#include "wx/logbinary.h"
+
+#include <string.h>
+
+/*
+    The file format is:
+
+        - The header consisting of the magic signature "wxLOGBIN" followed by
+          the format version (currently 1) as a variable length integer.
+        - The sequence of entries, each starting with a byte indicating its
+          type: either a string definition or a log record.
+
+    All integers are stored as variable length (LEB128) unsigned integers,
+    signed integers are zigzag-encoded first and doubles are stored as 8
+    bytes in little endian order. All strings are stored in UTF-8 preceded by
+    their length in bytes.
+
+    String definition consists of the string identifier, which is always the
+    next unused one, starting from 1, and the string itself. It is used for
+    the static strings: format strings and file, function and component names.
+
+    Log record consists of:
+
+        - Log level.
+        - Time stamp in milliseconds since Epoch as the signed delta from the
+          time stamp of the previous record.
+        - Thread identifier.
+        - Identifier of the format string or 0 for the records logged in the
+          already formatted form, which are stored as records with a single
+          string argument.
+        - Identifiers of the file name, line number, identifiers of the
+          function and component name (0 if not available).
+        - Flags indicating which of the optional fields follow: the system
+          error code and its description and the trace mask.
+        - Number of arguments followed by their type (a byte) and value.
+ */
+
+namespace
+{
+
+const char LOG_FILE_MAGIC[] = "wxLOGBIN";
+const size_t LOG_FILE_MAGIC_LEN = sizeof(LOG_FILE_MAGIC) - 1;
+
+const unsigned LOG_FILE_VERSION = 1;
+
+// entry types
+enum
+{
+    Entry_String = 1,
+    Entry_Record = 2
+};
+
+// bits of the flags field
+enum
+{
+    Flag_SysError = 1,
+    Flag_TraceMask = 2
+};
+
+// the buffer is written to the file when it becomes larger than this
+const size_t MAX_BUFFER_SIZE = 64*1024;
+
+// ----------------------------------------------------------------------------
+// encoding helpers
+// ----------------------------------------------------------------------------
+
+void AppendVarUInt(std::string& buf, wxULongLong_t value)
+{
+    while ( value >= 0x80 )
+    {
+        buf += static_cast<char>((value & 0x7f) | 0x80);
+        value >>= 7;
+    }
+
+    buf += static_cast<char>(value);
+}
+
+wxULongLong_t ZigZagEncode(wxLongLong_t value)
+{
+    return (static_cast<wxULongLong_t>(value) << 1) ^
+                static_cast<wxULongLong_t>(value >> 63);
+}
+
+wxLongLong_t ZigZagDecode(wxULongLong_t value)
+{
+    return static_cast<wxLongLong_t>(value >> 1) ^
+                -static_cast<wxLongLong_t>(value & 1);
+}
+
+void AppendVarInt(std::string& buf, wxLongLong_t value)
+{
+    AppendVarUInt(buf, ZigZagEncode(value));
+}
+
+void AppendBytes(std::string& buf, const char *s, size_t len)
+{
+    AppendVarUInt(buf, len);
+    buf.append(s, len);
+}
+
+void AppendString(std::string& buf, const wxString& s)
+{
+    const wxScopedCharBuffer utf8 = s.utf8_str();
+    AppendBytes(buf, utf8.data(), utf8.length());
+}
+
+void AppendDouble(std::string& buf, double d)
+{
+    wxUint64 bits;
+    memcpy(&bits, &d, sizeof(bits));
+
+    for ( int n = 0; n < 8; n++ )
+    {
+        buf += static_cast<char>(bits & 0xff);
+        bits >>= 8;
+    }
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// wxLogBinaryFile implementation
+// ============================================================================
+
+wxLogBinaryFile::~wxLogBinaryFile()
+{
+    Close();
+}
+
+bool wxLogBinaryFile::Open(const wxString& filename)
+{
+    Close();
+
+    wxCRIT_SECT_LOCKER(lock, m_cs);
+
+    m_error = false;
+    m_stringIds.clear();
+    m_lastTimestamp = 0;
+
+    // don't log any errors here: this could result in infinite recursion if
+    // this object is the active log target
+    {
+        wxLogNull noLog;
+        if ( !m_file.Open(filename, "wb") )
+            return false;
+    }
+
+    m_buffer.assign(LOG_FILE_MAGIC, LOG_FILE_MAGIC_LEN);
+    AppendVarUInt(m_buffer, LOG_FILE_VERSION);
+
+    DoFlush();
+
+    return !m_error;
+}
+
+bool wxLogBinaryFile::Close()
+{
+    wxCRIT_SECT_LOCKER(lock, m_cs);
+
+    if ( !m_file.IsOpened() )
+        return false;
+
+    DoFlush();
+
+    wxLogNull noLog;
+    if ( !m_file.Close() )
+        m_error = true;
+
+    return !m_error;
+}
+
+void wxLogBinaryFile::Flush()
+{
+    wxLog::Flush();
+
+    wxCRIT_SECT_LOCKER(lock, m_cs);
+
+    DoFlush();
+
+    if ( m_file.IsOpened() )
+    {
+        wxLogNull noLog;
+        m_file.Flush();
+    }
+}
+
+void wxLogBinaryFile::DoFlush()
+{
+    if ( m_buffer.empty() )
+        return;
+
+    if ( m_file.IsOpened() && !m_error )
+    {
+        wxLogNull noLog;
+        if ( m_file.Write(m_buffer.data(), m_buffer.size()) != m_buffer.size() )
+            m_error = true;
+    }
+
+    m_buffer.clear();
+}
+
+wxUint32 wxLogBinaryFile::GetStringId(const char *s)
+{
+    if ( !s )
+        return 0;
+
+    const auto it = m_stringIds.find(s);
+    if ( it != m_stringIds.end() )
+        return it->second;
+
+    const wxUint32 id = static_cast<wxUint32>(m_stringIds.size() + 1);
+    m_stringIds[s] = id;
+
+    m_buffer += static_cast<char>(Entry_String);
+    AppendVarUInt(m_buffer, id);
+    AppendBytes(m_buffer, s, strlen(s));
+
+    return id;
+}
+
+void
+wxLogBinaryFile::WriteRecord(wxLogLevel level,
+                             const char *format,
+                             const wxLogRecordInfo& info,
+                             const wxLogDeferredRecord *rec,
+                             const wxString& msg)
+{
+    wxCRIT_SECT_LOCKER(lock, m_cs);
+
+    if ( !m_file.IsOpened() || m_error )
+        return;
+
+    // string definitions must precede the record using them
+    const wxUint32 formatId = GetStringId(format),
+                   fileId = GetStringId(info.filename),
+                   funcId = GetStringId(info.func),
+                   componentId = GetStringId(info.component);
+
+    m_buffer += static_cast<char>(Entry_Record);
+    AppendVarUInt(m_buffer, level);
+    AppendVarInt(m_buffer, info.timestampMS - m_lastTimestamp);
+    m_lastTimestamp = info.timestampMS;
+
+#if wxUSE_THREADS
+    AppendVarUInt(m_buffer, static_cast<wxULongLong_t>(info.threadId));
+#else
+    AppendVarUInt(m_buffer, 0);
+#endif
+
+    AppendVarUInt(m_buffer, formatId);
+    AppendVarUInt(m_buffer, fileId);
+    AppendVarUInt(m_buffer, info.line > 0 ? info.line : 0);
+    AppendVarUInt(m_buffer, funcId);
+    AppendVarUInt(m_buffer, componentId);
+
+    if ( !rec )
+    {
+        // the message is already complete, there are no optional fields
+        AppendVarUInt(m_buffer, 0);
+
+        AppendVarUInt(m_buffer, 1);
+        m_buffer += static_cast<char>(wxLogDeferredRecord::Arg_String);
+        AppendString(m_buffer, msg);
+    }
+    else
+    {
+        wxUIntPtr err = 0;
+        wxString mask;
+
+        unsigned flags = 0;
+        if ( info.GetNumValue(wxLOG_KEY_SYS_ERROR_CODE, &err) )
+            flags |= Flag_SysError;
+#if wxUSE_LOG_TRACE
+        if ( info.GetStrValue(wxLOG_KEY_TRACE_MASK, &mask) )
+            flags |= Flag_TraceMask;
+#endif // wxUSE_LOG_TRACE
+
+        AppendVarUInt(m_buffer, flags);
+
+        if ( flags & Flag_SysError )
+        {
+            // store the error description too as it may be impossible to
+            // get it when decoding the file, e.g. on another machine
+            AppendVarUInt(m_buffer, err);
+            AppendString(m_buffer, wxSysErrorMsgStr(static_cast<long>(err)));
+        }
+
+        if ( flags & Flag_TraceMask )
+            AppendString(m_buffer, mask);
+
+        const size_t count = rec->GetArgCount();
+        AppendVarUInt(m_buffer, count);
+        for ( size_t n = 0; n < count; n++ )
+        {
+            const wxLogDeferredRecord::ArgType type = rec->GetArgType(n);
+            m_buffer += static_cast<char>(type);
+
+            switch ( type )
+            {
+                case wxLogDeferredRecord::Arg_Int:
+                    AppendVarInt(m_buffer, rec->GetIntArg(n));
+                    break;
+
+                case wxLogDeferredRecord::Arg_UInt:
+                    AppendVarUInt(m_buffer, rec->GetUIntArg(n));
+                    break;
+
+                case wxLogDeferredRecord::Arg_Double:
+                    AppendDouble(m_buffer, rec->GetDoubleArg(n));
+                    break;
+
+                case wxLogDeferredRecord::Arg_Pointer:
+                    AppendVarUInt(m_buffer, rec->GetPointerArg(n));
+                    break;
+
+                case wxLogDeferredRecord::Arg_String:
+                    AppendString(m_buffer, rec->GetStringArg(n));
+                    break;
+            }
+        }
+    }
+
+    if ( m_buffer.size() >= MAX_BUFFER_SIZE )
+        DoFlush();
+}
+
+void
+wxLogBinaryFile::DoLogRecord(wxLogLevel level,
+                             const wxString& msg,
+                             const wxLogRecordInfo& info)
+{
+    WriteRecord(level, nullptr, info, nullptr, msg);
+}
+
+void wxLogBinaryFile::DoLogDeferredRecord(const wxLogDeferredRecord& rec)
+{
+    WriteRecord(rec.level, rec.format, rec.info, &rec);
+}
+
+// ============================================================================
+// wxLogBinaryReader implementation
+// ============================================================================
+
+wxLogBinaryReader::wxLogBinaryReader(const wxString& filename)
+{
+    if ( !m_file.Open(filename, "rb") )
+        return;
+
+    char magic[LOG_FILE_MAGIC_LEN];
+    wxULongLong_t version;
+    if ( m_file.Read(magic, sizeof(magic)) != sizeof(magic) ||
+            memcmp(magic, LOG_FILE_MAGIC, sizeof(magic)) != 0 ||
+                !ReadVarUInt(version) ||
+                    version != LOG_FILE_VERSION )
+    {
+        wxLogError(_("File \"%s\" is not a binary log file."), filename);
+        m_error = true;
+    }
+}
+
+bool wxLogBinaryReader::ReadByte(unsigned char& b)
+{
+    const int c = getc(m_file.fp());
+    if ( c == EOF )
+    {
+        m_error = true;
+        return false;
+    }
+
+    b = static_cast<unsigned char>(c);
+    return true;
+}
+
+bool wxLogBinaryReader::ReadVarUInt(wxULongLong_t& value)
+{
+    value = 0;
+    for ( unsigned shift = 0; shift < 64; shift += 7 )
+    {
+        unsigned char b;
+        if ( !ReadByte(b) )
+            return false;
+
+        value |= static_cast<wxULongLong_t>(b & 0x7f) << shift;
+        if ( !(b & 0x80) )
+            return true;
+    }
+
+    m_error = true;
+    return false;
+}
+
+bool wxLogBinaryReader::CheckRemaining(wxULongLong_t len)
+{
+    const wxFileOffset pos = m_file.Tell();
+    if ( pos == wxInvalidOffset )
+    {
+        m_error = true;
+        return false;
+    }
+
+    // the file could have grown since we checked its length the last time
+    if ( m_length < pos || len > static_cast<wxULongLong_t>(m_length - pos) )
+    {
+        m_length = m_file.Length();
+
+        if ( m_length < pos ||
+                len > static_cast<wxULongLong_t>(m_length - pos) )
+        {
+            m_error = true;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool wxLogBinaryReader::ReadString(wxString& s)
+{
+    wxULongLong_t len;
+    if ( !ReadVarUInt(len) || !CheckRemaining(len) )
+        return false;
+
+    wxCharBuffer buf(static_cast<size_t>(len));
+    if ( m_file.Read(buf.data(), len) != len )
+    {
+        m_error = true;
+        return false;
+    }
+
+    s = wxString::FromUTF8(buf.data(), len);
+    return true;
+}
+
+bool wxLogBinaryReader::ReadStringDef()
+{
+    wxULongLong_t id, len;
+    if ( !ReadVarUInt(id) || !ReadVarUInt(len) )
+        return false;
+
+    // the identifiers are always allocated sequentially
+    if ( id != m_strings.size() + 1 )
+    {
+        m_error = true;
+        return false;
+    }
+
+    if ( !CheckRemaining(len) )
+        return false;
+
+    std::string s(static_cast<size_t>(len), '\0');
+    if ( len && m_file.Read(&s[0], len) != len )
+    {
+        m_error = true;
+        return false;
+    }
+
+    m_strings.push_back(s);
+    return true;
+}
+
+bool wxLogBinaryReader::GetString(wxULongLong_t id, const char*& s)
+{
+    if ( !id )
+    {
+        s = nullptr;
+        return true;
+    }
+
+    if ( id > m_strings.size() )
+    {
+        m_error = true;
+        return false;
+    }
+
+    s = m_strings[id - 1].c_str();
+    return true;
+}
+
+bool
+wxLogBinaryReader::ReadRecord(wxLogLevel& level,
+                              wxString& msg,
+                              wxLogRecordInfo& info)
+{
+    if ( !IsOk() )
+        return false;
+
+    for ( ;; )
+    {
+        const int type = getc(m_file.fp());
+        if ( type == EOF )
+            return false;
+
+        if ( type == Entry_String )
+        {
+            if ( !ReadStringDef() )
+                return false;
+
+            continue;
+        }
+
+        if ( type != Entry_Record )
+        {
+            m_error = true;
+            return false;
+        }
+
+        break;
+    }
+
+    wxULongLong_t levelValue, delta, threadId,
+                  formatId, fileId, line, funcId, componentId,
+                  flags, count;
+    if ( !ReadVarUInt(levelValue) ||
+            !ReadVarUInt(delta) ||
+                !ReadVarUInt(threadId) ||
+                    !ReadVarUInt(formatId) ||
+                        !ReadVarUInt(fileId) ||
+                            !ReadVarUInt(line) ||
+                                !ReadVarUInt(funcId) ||
+                                    !ReadVarUInt(componentId) ||
+                                        !ReadVarUInt(flags) )
+        return false;
+
+    const char *format, *filename, *func, *component;
+    if ( !GetString(formatId, format) ||
+            !GetString(fileId, filename) ||
+                !GetString(funcId, func) ||
+                    !GetString(componentId, component) )
+        return false;
+
+    info = wxLogRecordInfo(filename, static_cast<int>(line), func, component);
+
+    m_lastTimestamp += ZigZagDecode(delta);
+    info.timestampMS = m_lastTimestamp;
+#if WXWIN_COMPATIBILITY_3_0
+    info.timestamp = info.timestampMS / 1000;
+#endif // WXWIN_COMPATIBILITY_3_0
+
+#if wxUSE_THREADS
+    info.threadId = static_cast<wxThreadIdType>(threadId);
+#endif // wxUSE_THREADS
+
+    level = static_cast<wxLogLevel>(levelValue);
+
+    // the message prefix and suffix are constructed in the same way as
+    // wxLog::CallDoLogNow() does it
+    wxString prefix, suffix;
+    if ( flags & Flag_SysError )
+    {
+        wxULongLong_t err;
+        wxString errMsg;
+        if ( !ReadVarUInt(err) || !ReadString(errMsg) )
+            return false;
+
+        info.StoreValue(wxLOG_KEY_SYS_ERROR_CODE, static_cast<wxUIntPtr>(err));
+
+        suffix.Printf(_(" (error %ld: %s)"), static_cast<long>(err), errMsg);
+    }
+
+    if ( flags & Flag_TraceMask )
+    {
+        wxString mask;
+        if ( !ReadString(mask) )
+            return false;
+
+#if wxUSE_LOG_TRACE
+        info.StoreValue(wxLOG_KEY_TRACE_MASK, mask);
+#endif // wxUSE_LOG_TRACE
+
+        prefix = "(" + mask + ") ";
+    }
+
+    if ( !ReadVarUInt(count) )
+        return false;
+
+    if ( count > wxLogDeferredRecord::MAX_ARGS )
+    {
+        m_error = true;
+        return false;
+    }
+
+    // format pointer is not used if it's null, but it must still be valid
+    wxLogDeferredRecord rec(level, format ? format : "%s", info);
+    for ( size_t n = 0; n < count; n++ )
+    {
+        unsigned char argType;
+        if ( !ReadByte(argType) )
+            return false;
+
+        switch ( argType )
+        {
+            case wxLogDeferredRecord::Arg_Int:
+            case wxLogDeferredRecord::Arg_UInt:
+            case wxLogDeferredRecord::Arg_Pointer:
+                {
+                    wxULongLong_t value;
+                    if ( !ReadVarUInt(value) )
+                        return false;
+
+                    if ( argType == wxLogDeferredRecord::Arg_Int )
+                        rec.AddArg(ZigZagDecode(value));
+                    else if ( argType == wxLogDeferredRecord::Arg_UInt )
+                        rec.AddArg(value);
+                    else
+                        rec.AddArg(wxUIntToPtr(static_cast<wxUIntPtr>(value)));
+                }
+                break;
+
+            case wxLogDeferredRecord::Arg_Double:
+                {
+                    wxUint64 bits = 0;
+                    for ( int i = 0; i < 8; i++ )
+                    {
+                        unsigned char b;
+                        if ( !ReadByte(b) )
+                            return false;
+
+                        bits |= static_cast<wxUint64>(b) << (8*i);
+                    }
+
+                    double d;
+                    memcpy(&d, &bits, sizeof(d));
+                    rec.AddArg(d);
+                }
+                break;
+
+            case wxLogDeferredRecord::Arg_String:
+                {
+                    wxString s;
+                    if ( !ReadString(s) )
+                        return false;
+
+                    rec.AddArg(s);
+                }
+                break;
+
+            default:
+                m_error = true;
+                return false;
+        }
+    }
+
+    if ( format )
+    {
+        msg = prefix + rec.Format() + suffix;
+    }
+    else // already formatted message
+    {
+        if ( count != 1 || rec.GetArgType(0) != wxLogDeferredRecord::Arg_String )
+        {
+            m_error = true;
+            return false;
+        }
+
+        msg = rec.GetStringArg(0);
+    }
+
+    return true;
+}
+
+#endif // wxUSE_LOG && wxUSE_FFILE
@@ -0,0 +1,179 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        src/common/parallel.cpp
+// Purpose:     Implementation of the parallel algorithms helpers
+// Author:      wxWidgets team
+// Created:     2026-10-19
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+// For compilers that support precompilation, includes "wx.h".
+#include "wx/wxprec.h"
+
+#ifndef WX_PRECOMP
+    #include "wx/utils.h"
+#endif // WX_PRECOMP
+
+#include "wx/parallel.h"
+
+#if wxUSE_THREADS
+    #include "wx/thread.h"
+    #include "wx/threadpool.h"
+
+    #include <atomic>
+    #include <exception>
+#endif // wxUSE_THREADS
+
+namespace
+{
+
+// The number of chunks per thread to use by default, having more than one
+// allows to balance the load when some chunks take longer than the others.
+const size_t CHUNKS_PER_THREAD = 4;
+
+#if wxUSE_THREADS
+
+// The concurrency limit set by the user or 0 if none.
+std::atomic<unsigned> gs_concurrency{0};
+
+#endif // wxUSE_THREADS
+
+} // anonymous namespace
+
+// ============================================================================
+// implementation
+// ============================================================================
+
+void wxSetParallelConcurrency(unsigned numThreads)
+{
+#if wxUSE_THREADS
+    gs_concurrency = numThreads;
+#else // !wxUSE_THREADS
+    wxUnusedVar(numThreads);
+#endif // wxUSE_THREADS/!wxUSE_THREADS
+}
+
+unsigned wxGetParallelConcurrency()
+{
+#if wxUSE_THREADS
+    const unsigned numThreads = gs_concurrency;
+    if ( numThreads )
+        return numThreads;
+
+    const int numCPUs = wxThread::GetCPUCount();
+    if ( numCPUs > 0 )
+        return static_cast<unsigned>(numCPUs);
+#endif // wxUSE_THREADS
+
+    return 1;
+}
+
+namespace wxPrivate
+{
+
+size_t GetParallelChunkCount(size_t count, size_t grainSize)
+{
+    const unsigned numThreads = wxGetParallelConcurrency();
+    if ( numThreads <= 1 || count <= 1 )
+        return 1;
+
+    size_t numChunks = numThreads*CHUNKS_PER_THREAD;
+    if ( grainSize > 1 )
+        numChunks = std::min(numChunks, count / grainSize);
+
+    return wxClip(numChunks, static_cast<size_t>(1), count);
+}
+
+void
+ParallelForChunks(size_t begin,
+                  size_t end,
+                  size_t numChunks,
+                  const std::function<void (size_t, size_t, size_t)>& func)
+{
+    if ( end <= begin )
+        return;
+
+    const size_t count = end - begin;
+    numChunks = wxClip(numChunks, static_cast<size_t>(1), count);
+
+    // Compute the bounds in a way avoiding overflow for huge ranges.
+    const size_t chunkSize = count / numChunks;
+    const size_t remainder = count % numChunks;
+    const auto getChunkBegin = [=](size_t n)
+    {
+        return begin + chunkSize*n + std::min(n, remainder);
+    };
+
+#if wxUSE_THREADS
+    const size_t
+        numThreads = std::min<size_t>(wxGetParallelConcurrency(), numChunks);
+    if ( numThreads > 1 )
+    {
+        // Chunks are distributed dynamically: each thread takes the next
+        // chunk when it is done with the previous one.
+        std::atomic<size_t> nextChunk{0};
+        std::atomic<bool> failed{false};
+
+#if wxUSE_EXCEPTIONS
+        std::exception_ptr exception;
+        wxCriticalSection csException;
+#endif // wxUSE_EXCEPTIONS
+
+        const auto processChunks = [&]()
+        {
+            for ( ;; )
+            {
+                const size_t n = nextChunk++;
+                if ( n >= numChunks || failed )
+                    break;
+
+#if wxUSE_EXCEPTIONS
+                try
+#endif // wxUSE_EXCEPTIONS
+                {
+                    func(n, getChunkBegin(n), getChunkBegin(n + 1));
+                }
+#if wxUSE_EXCEPTIONS
+                catch ( ... )
+                {
+                    wxCriticalSectionLocker lock(csException);
+                    if ( !exception )
+                        exception = std::current_exception();
+
+                    failed = true;
+                }
+#endif // wxUSE_EXCEPTIONS
+            }
+        };
+
+        wxThreadPool& pool = wxThreadPool::Get();
+
+        std::vector<wxTask> tasks;
+        tasks.reserve(numThreads - 1);
+        for ( size_t n = 1; n < numThreads; n++ )
+            tasks.push_back(pool.Submit(processChunks));
+
+        // The current thread participates in the work too.
+        processChunks();
+
+        // If a task didn't start yet, it has nothing to do any more as all
+        // chunks have been already processed, so just cancel it.
+        for ( auto& task : tasks )
+        {
+            if ( !task.Cancel() )
+                task.Wait();
+        }
+
+#if wxUSE_EXCEPTIONS
+        if ( exception )
+            std::rethrow_exception(exception);
+#endif // wxUSE_EXCEPTIONS
+
+        return;
+    }
+#endif // wxUSE_THREADS
+
+    for ( size_t n = 0; n < numChunks; n++ )
+        func(n, getChunkBegin(n), getChunkBegin(n + 1));
+}
+
+} // namespace wxPrivate
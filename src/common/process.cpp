@@ -27,9 +27,11 @@
 // ----------------------------------------------------------------------------
 
 wxDEFINE_EVENT( wxEVT_END_PROCESS, wxProcessEvent );
+wxDEFINE_EVENT( wxEVT_PROCESS_OUTPUT, wxProcessOutputEvent );
 
 wxIMPLEMENT_DYNAMIC_CLASS(wxProcess, wxEvtHandler);
 wxIMPLEMENT_DYNAMIC_CLASS(wxProcessEvent, wxEvent);
+wxIMPLEMENT_DYNAMIC_CLASS(wxProcessOutputEvent, wxEvent);
 
 // ============================================================================
 // wxProcess implementation
@@ -47,7 +49,11 @@ void wxProcess::Init(wxEvtHandler *parent, int id, int flags)
     m_id         = id;
     m_pid        = 0;
     m_priority   = wxPRIORITY_DEFAULT;
-    m_redirect   = (flags & wxPROCESS_REDIRECT) != 0;
+    m_redirect   = (flags & (wxPROCESS_REDIRECT | wxPROCESS_STREAM_OUTPUT)) != 0;
+
+    m_outputChunkSize = flags & wxPROCESS_STREAM_OUTPUT ? 65536 : 0;
+    m_outputPaused = false;
+    m_outputReader = nullptr;
 
 #if wxUSE_STREAMS
     m_inputStream  = nullptr;
@@ -140,6 +146,56 @@ bool wxProcess::IsErrorAvailable() const
 
 #endif // wxUSE_STREAMS
 
+// ----------------------------------------------------------------------------
+// process output streaming
+// ----------------------------------------------------------------------------
+
+void wxProcess::StreamOutput(size_t chunkSize)
+{
+    wxCHECK_RET( chunkSize, wxS("chunk size must be positive") );
+
+    m_redirect = true;
+    m_outputChunkSize = chunkSize;
+}
+
+void wxProcess::PauseOutput()
+{
+    if ( m_outputPaused )
+        return;
+
+    m_outputPaused = true;
+
+    if ( m_outputReader )
+        m_outputReader->Pause();
+}
+
+void wxProcess::ResumeOutput()
+{
+    if ( !m_outputPaused )
+        return;
+
+    m_outputPaused = false;
+
+    if ( m_outputReader )
+        m_outputReader->Resume();
+}
+
+void wxProcess::SetOutputReader(wxProcessOutputReader *reader)
+{
+    m_outputReader = reader;
+
+    // apply the state possibly set before launching the process
+    if ( m_outputReader && m_outputPaused )
+        m_outputReader->Pause();
+}
+
+void wxProcess::OnOutput(const void *data, size_t len, bool isError)
+{
+    wxProcessOutputEvent event(m_id, m_pid, data, len, isError);
+
+    ProcessEvent(event);
+}
+
 // ----------------------------------------------------------------------------
 // process killing
 // ----------------------------------------------------------------------------
@@ -47,7 +47,12 @@
 #include "wx/osx/core/private/strconv_cf.h"
 #endif //def __DARWIN__
 
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 #define TRACE_STRCONV wxT("strconv")
 
@@ -385,33 +390,125 @@ size_t wxMBConv::WC2MB(char *outBuff, const wchar_t *inBuff, size_t outLen) cons
     return rc;
 }
 
+namespace
+{
+
+// Helper of wxMBConv::ToWCharInto() and FromWCharInto(): ensure that the
+// buffer has at least the given length, reusing it if it's already the case.
+// Notice that the buffer is allocated even if the length is 0, as the caller
+// needs to have a valid pointer to store at least the trailing NUL into.
+template <typename T>
+bool EnsureBufferLength(wxCharTypeBuffer<T>& buf, size_t len)
+{
+    if ( !buf.data() || buf.length() < len )
+    {
+        // Don't use extend() as we don't need to preserve the old contents.
+        buf = wxCharTypeBuffer<T>(len);
+        if ( !buf.data() )
+            return false;
+    }
+
+    return true;
+}
+
+// Don't try to guess the output size if it means allocating more than this
+// number of extra characters, but just compute it exactly.
+const size_t MAX_GUESSED_EXTRA_LEN = 65536;
+
+} // anonymous namespace
+
+size_t
+wxMBConv::ToWCharInto(wxWCharBuffer& buf, const char *src, size_t srcLen) const
+{
+    // All encodings use at least one byte per wide character, so the output
+    // can't be longer than the input. For NUL-terminated input, this is only
+    // a guess if NUL takes more than one byte, but it's still a good one and
+    // we don't call GetMBNulLen() here as, for wxConvAuto, it can't be used
+    // before the first conversion.
+    const size_t lenMax = srcLen == wxNO_LEN ? strlen(src) + 1 : srcLen;
+
+    size_t len = wxCONV_FAILED;
+    if ( lenMax != 0 && EnsureBufferLength(buf, lenMax) )
+        len = ToWChar(buf.data(), lenMax, src, srcLen);
+
+    if ( len == wxCONV_FAILED )
+    {
+        // Either the input is invalid or we couldn't guess the output size,
+        // we can only know which one by computing it.
+        len = ToWChar(nullptr, 0, src, srcLen);
+        if ( len == wxCONV_FAILED || !EnsureBufferLength(buf, len) )
+            return wxCONV_FAILED;
+
+        len = ToWChar(buf.data(), len, src, srcLen);
+        if ( len == wxCONV_FAILED )
+            return wxCONV_FAILED;
+    }
+
+    buf.shrink(len);
+
+    return len;
+}
+
+size_t
+wxMBConv::FromWCharInto(wxCharBuffer& buf, const wchar_t *src, size_t srcLen) const
+{
+    const size_t
+        srcCount = srcLen == wxNO_LEN ? wxWcslen(src) + 1 : srcLen;
+
+    // Assume that all characters take the maximal possible space, unless this
+    // results in allocating too much memory, in which case optimistically
+    // assume that the output is not longer than the input, as is often the
+    // case for UTF-8, for example.
+    size_t lenMax = srcCount*GetMaxCharLen();
+    if ( lenMax - srcCount > MAX_GUESSED_EXTRA_LEN )
+        lenMax = srcCount;
+
+    size_t len = wxCONV_FAILED;
+    if ( lenMax != 0 && EnsureBufferLength(buf, lenMax) )
+        len = FromWChar(buf.data(), lenMax, src, srcLen);
+
+    if ( len == wxCONV_FAILED )
+    {
+        len = FromWChar(nullptr, 0, src, srcLen);
+        if ( len == wxCONV_FAILED || !EnsureBufferLength(buf, len) )
+            return wxCONV_FAILED;
+
+        // Notice that the return value may be different from the one above as
+        // it could have overestimated the space needed, while what we get here
+        // is the exact length.
+        len = FromWChar(buf.data(), len, src, srcLen);
+        if ( len == wxCONV_FAILED )
+            return wxCONV_FAILED;
+    }
+
+    buf.shrink(len);
+
+    return len;
+}
+
 wxWCharBuffer
 wxMBConv::cMB2WC(const char *inBuff, size_t inLen, size_t *outLen) const
 {
-    const size_t dstLen = ToWChar(nullptr, 0, inBuff, inLen);
+    // notice that the buffer is always NUL-terminated, even if the input
+    // isn't (as otherwise the caller has no way to know its length)
+    wxWCharBuffer wbuf;
+    const size_t dstLen = ToWCharInto(wbuf, inBuff, inLen);
     if ( dstLen != wxCONV_FAILED )
     {
-        // notice that we allocate space for dstLen+1 wide characters here
-        // because we want the buffer to always be NUL-terminated, even if the
-        // input isn't (as otherwise the caller has no way to know its length)
-        wxWCharBuffer wbuf(dstLen);
-        if ( ToWChar(wbuf.data(), dstLen, inBuff, inLen) != wxCONV_FAILED )
+        if ( outLen )
         {
-            if ( outLen )
-            {
-                *outLen = dstLen;
-
-                // we also need to handle NUL-terminated input strings
-                // specially: for them the output is the length of the string
-                // excluding the trailing NUL, however if we're asked to
-                // convert a specific number of characters we return the length
-                // of the resulting output even if it's NUL-terminated
-                if ( inLen == wxNO_LEN )
-                    (*outLen)--;
-            }
+            *outLen = dstLen;
 
-            return wbuf;
+            // we also need to handle NUL-terminated input strings
+            // specially: for them the output is the length of the string
+            // excluding the trailing NUL, however if we're asked to
+            // convert a specific number of characters we return the length
+            // of the resulting output even if it's NUL-terminated
+            if ( inLen == wxNO_LEN )
+                (*outLen)--;
         }
+
+        return wbuf;
     }
 
     if ( outLen )
@@ -423,36 +520,35 @@ wxMBConv::cMB2WC(const char *inBuff, size_t inLen, size_t *outLen) const
 wxCharBuffer
 wxMBConv::cWC2MB(const wchar_t *inBuff, size_t inLen, size_t *outLen) const
 {
-    size_t dstLen = FromWChar(nullptr, 0, inBuff, inLen);
+    wxCharBuffer buf;
+    const size_t dstLen = FromWCharInto(buf, inBuff, inLen);
     if ( dstLen != wxCONV_FAILED )
     {
+        // as above, ensure that the buffer is always NUL-terminated, even if
+        // the input is not, which requires more than one NUL byte for some
+        // encodings
         const size_t nulLen = GetMBNulLen();
+        if ( nulLen > 1 && nulLen != wxCONV_FAILED )
+        {
+            if ( !buf.extend(dstLen + nulLen - 1) )
+                return wxCharBuffer();
 
-        // as above, ensure that the buffer is always NUL-terminated, even if
-        // the input is not
-        wxCharBuffer buf(dstLen + nulLen - 1);
-        memset(buf.data() + dstLen, 0, nulLen);
-
-        // Notice that return value of the call to FromWChar() here may be
-        // different from the one above as it could have overestimated the
-        // space needed, while what we get here is the exact length.
-        dstLen = FromWChar(buf.data(), dstLen, inBuff, inLen);
-        if ( dstLen != wxCONV_FAILED )
+            memset(buf.data() + dstLen, 0, nulLen);
+        }
+
+        if ( outLen )
         {
-            if ( outLen )
-            {
-                *outLen = dstLen;
+            *outLen = dstLen;
 
-                if ( inLen == wxNO_LEN )
-                {
-                    // in this case both input and output are NUL-terminated
-                    // and we're not supposed to count NUL
-                    *outLen -= nulLen;
-                }
+            if ( inLen == wxNO_LEN )
+            {
+                // in this case both input and output are NUL-terminated
+                // and we're not supposed to count NUL
+                *outLen -= nulLen;
             }
-
-            return buf;
         }
+
+        return buf;
     }
 
     if ( outLen )
@@ -469,21 +565,17 @@ wxWCharBuffer wxMBConv::DoConvertMB2WC(const char* buf, size_t srcLen) const
     // come from wxScopedCharBuffer.
     if ( srcLen && buf )
     {
-        const size_t dstLen = ToWChar(nullptr, 0, buf, srcLen);
+        wxWCharBuffer wbuf;
+        const size_t dstLen = ToWCharInto(wbuf, buf, srcLen);
         if ( dstLen != wxCONV_FAILED )
         {
-            wxWCharBuffer wbuf(dstLen);
-            wbuf.data()[dstLen] = L'\0';
-            if ( ToWChar(wbuf.data(), dstLen, buf, srcLen) != wxCONV_FAILED )
-            {
-                // If the input string was NUL-terminated, we shouldn't include
-                // the length of the trailing NUL into the length of the return
-                // value.
-                if ( srcLen == wxNO_LEN )
-                    wbuf.shrink(dstLen - 1);
+            // If the input string was NUL-terminated, we shouldn't include
+            // the length of the trailing NUL into the length of the return
+            // value.
+            if ( srcLen == wxNO_LEN )
+                wbuf.shrink(dstLen - 1);
 
-                return wbuf;
-            }
+            return wbuf;
         }
     }
 
@@ -494,20 +586,16 @@ wxCharBuffer wxMBConv::DoConvertWC2MB(const wchar_t* wbuf, size_t srcLen) const
 {
     if ( srcLen && wbuf )
     {
-        const size_t dstLen = FromWChar(nullptr, 0, wbuf, srcLen);
+        wxCharBuffer buf;
+        const size_t dstLen = FromWCharInto(buf, wbuf, srcLen);
         if ( dstLen != wxCONV_FAILED )
         {
-            wxCharBuffer buf(dstLen);
-            buf.data()[dstLen] = '\0';
-            if ( FromWChar(buf.data(), dstLen, wbuf, srcLen) != wxCONV_FAILED )
-            {
-                // As above, in DoConvertMB2WC(), except that the length of the
-                // trailing NUL is variable in this case.
-                if ( srcLen == wxNO_LEN )
-                    buf.shrink(dstLen - GetMBNulLen());
+            // As above, in DoConvertMB2WC(), except that the length of the
+            // trailing NUL is variable in this case.
+            if ( srcLen == wxNO_LEN )
+                buf.shrink(dstLen - GetMBNulLen());
 
-                return buf;
-            }
+            return buf;
         }
     }
 
@@ -2175,6 +2263,227 @@ wxMBConvUTF32swap::FromWChar(char *dst, size_t dstLen,
     #error "Unknown sizeof(wchar_t): please report this to wx-dev@lists.wxwindows.org"
 #endif
 
+// ----------------------------------------------------------------------------
+// iconv descriptors cache
+// ----------------------------------------------------------------------------
+
+// iconv_open() is relatively expensive, as it needs to find and load the
+// conversion modules, so we reuse the descriptors instead of closing them.
+//
+// Each iconv_t can only be used by a single thread at any given moment, so
+// the descriptors currently in use are kept in a per-thread cache, avoiding
+// any locking when converting, and the unused ones are returned to the global
+// pool from which they can be reused when another wxMBConv_iconv object for
+// the same charset is created or by another thread.
+
+namespace
+{
+
+// Maximal number of descriptors kept in the per-thread cache.
+const size_t wxICONV_THREAD_CACHE_SIZE = 8;
+
+// Maximal number of unused descriptors for the same conversion kept in the
+// global pool.
+const size_t wxICONV_POOL_SIZE = 4;
+
+class wxIconvPool
+{
+public:
+    // Return a descriptor for converting from "from" charset to "to" one,
+    // either an unused one from the pool or a newly opened one. Returns
+    // ICONV_T_INVALID if this conversion is not supported.
+    static iconv_t Acquire(const char *to, const char *from)
+    {
+        {
+#if wxUSE_THREADS
+            wxCriticalSectionLocker lock(GetCritSect());
+#endif // wxUSE_THREADS
+
+            Handles& handles = GetPool().m_handles;
+            const Handles::iterator it = handles.find(Key(to, from));
+            if ( it != handles.end() )
+            {
+                const iconv_t cd = it->second;
+                handles.erase(it);
+                return cd;
+            }
+        }
+
+        return iconv_open(to, from);
+    }
+
+    // Put the descriptor previously returned by Acquire() back into the pool,
+    // it may be closed if there are already enough of them in it.
+    static void Release(const char *to, const char *from, iconv_t cd)
+    {
+        if ( cd == ICONV_T_INVALID )
+            return;
+
+        // Return the descriptor to its initial state.
+        iconv(cd, nullptr, nullptr, nullptr, nullptr);
+
+        {
+#if wxUSE_THREADS
+            wxCriticalSectionLocker lock(GetCritSect());
+#endif // wxUSE_THREADS
+
+            Handles& handles = GetPool().m_handles;
+            const Key key(to, from);
+            if ( handles.count(key) < wxICONV_POOL_SIZE )
+            {
+                handles.insert(Handles::value_type(key, cd));
+                return;
+            }
+        }
+
+        iconv_close(cd);
+    }
+
+private:
+    using Key = std::pair<std::string, std::string>;
+    using Handles = std::multimap<Key, iconv_t>;
+
+    wxIconvPool() = default;
+
+    ~wxIconvPool()
+    {
+        for ( const auto& kv : m_handles )
+            iconv_close(kv.second);
+    }
+
+    static wxIconvPool& GetPool()
+    {
+        static wxIconvPool s_pool;
+        return s_pool;
+    }
+
+#if wxUSE_THREADS
+    static wxCriticalSection& GetCritSect()
+    {
+        static wxCriticalSection s_critSect;
+        return s_critSect;
+    }
+#endif // wxUSE_THREADS
+
+    Handles m_handles;
+
+    wxDECLARE_NO_COPY_CLASS(wxIconvPool);
+};
+
+// See UntranslatedStringHolder in translation.cpp for the explanation of the
+// MinGW thread_local bug: we can't rely on the thread cache dtor being called
+// correctly when using it, so don't use the thread cache at all and just use
+// the pool, at the price of locking it for every conversion.
+#if defined(__MINGW32__) && \
+    (!defined(__MINGW64_VERSION_MAJOR) || __MINGW64_VERSION_MAJOR < 15)
+    #define wxNO_ICONV_THREAD_CACHE
+#endif
+
+#ifndef wxNO_ICONV_THREAD_CACHE
+
+class wxIconvThreadCache
+{
+public:
+    wxIconvThreadCache() = default;
+
+    ~wxIconvThreadCache()
+    {
+        for ( const auto& entry : m_entries )
+            wxIconvPool::Release(entry.to.c_str(), entry.from.c_str(), entry.cd);
+    }
+
+    // Return the descriptor for the given conversion, which can be used by
+    // the current thread until the next call to this function.
+    iconv_t Get(const char *to, const char *from)
+    {
+        // Check the most recently used entries first, which are at the end.
+        for ( size_t n = m_entries.size(); n > 0; n-- )
+        {
+            Entry& entry = m_entries[n - 1];
+            if ( entry.to == to && entry.from == from )
+            {
+                if ( n != m_entries.size() )
+                    std::swap(entry, m_entries.back());
+
+                return m_entries.back().cd;
+            }
+        }
+
+        const iconv_t cd = wxIconvPool::Acquire(to, from);
+        if ( cd == ICONV_T_INVALID )
+            return cd;
+
+        if ( m_entries.size() == wxICONV_THREAD_CACHE_SIZE )
+        {
+            const Entry& entry = m_entries.front();
+            wxIconvPool::Release(entry.to.c_str(), entry.from.c_str(), entry.cd);
+            m_entries.erase(m_entries.begin());
+        }
+
+        m_entries.push_back(Entry{to, from, cd});
+
+        return cd;
+    }
+
+private:
+    struct Entry
+    {
+        std::string to,
+                    from;
+        iconv_t cd;
+    };
+
+    std::vector<Entry> m_entries;
+
+    wxDECLARE_NO_COPY_CLASS(wxIconvThreadCache);
+};
+
+#endif // !wxNO_ICONV_THREAD_CACHE
+
+// Provides access to the iconv descriptor for the given conversion during
+// its lifetime.
+class wxIconvHandle
+{
+public:
+    wxIconvHandle(const char *to, const char *from)
+#ifdef wxNO_ICONV_THREAD_CACHE
+        : m_to(to),
+          m_from(from),
+          m_cd(wxIconvPool::Acquire(to, from))
+    {
+    }
+
+    ~wxIconvHandle()
+    {
+        wxIconvPool::Release(m_to, m_from, m_cd);
+    }
+#else // !wxNO_ICONV_THREAD_CACHE
+    {
+        thread_local wxIconvThreadCache s_cache;
+
+        m_cd = s_cache.Get(to, from);
+
+        // Don't let any state from the previous conversion affect this one.
+        if ( m_cd != ICONV_T_INVALID )
+            iconv(m_cd, nullptr, nullptr, nullptr, nullptr);
+    }
+#endif // wxNO_ICONV_THREAD_CACHE/!wxNO_ICONV_THREAD_CACHE
+
+    iconv_t Get() const { return m_cd; }
+
+private:
+#ifdef wxNO_ICONV_THREAD_CACHE
+    const char* const m_to;
+    const char* const m_from;
+#endif // wxNO_ICONV_THREAD_CACHE
+
+    iconv_t m_cd;
+
+    wxDECLARE_NO_COPY_CLASS(wxIconvHandle);
+};
+
+} // anonymous namespace
+
 // ----------------------------------------------------------------------------
 // wxMBConv_iconv: encapsulates an iconv character set
 // ----------------------------------------------------------------------------
@@ -2192,30 +2501,30 @@ public:
                              const wchar_t *src, size_t srcLen = wxNO_LEN) const override;
     virtual size_t GetMBNulLen() const override;
 
+    // we can't know this for an arbitrary encoding, but 4 bytes are enough
+    // for UTF-8 and all the commonly used legacy multibyte encodings
+    virtual size_t GetMaxCharLen() const override { return 4; }
+
     virtual bool IsUTF8() const override;
 
     virtual wxMBConv *Clone() const override
     {
         wxMBConv_iconv *p = new wxMBConv_iconv(m_name);
-        p->m_minMBCharWidth = m_minMBCharWidth;
+        p->m_minMBCharWidth = m_minMBCharWidth.load(std::memory_order_relaxed);
         return p;
     }
 
-    bool IsOk() const
-        { return (m2w != ICONV_T_INVALID) && (w2m != ICONV_T_INVALID); }
-
-protected:
-    // the iconv handlers used to translate from multibyte
-    // to wide char and in the other direction
-    iconv_t m2w,
-            w2m;
-
-#if wxUSE_THREADS
-    // guards access to m2w and w2m objects
-    wxMutex m_iconvMutex;
-#endif
+    bool IsOk() const { return m_ok; }
 
 private:
+    // NB: iconv() is MT-safe, but each thread must use its own iconv_t handle.
+    //     Unfortunately there are a couple of global wxCSConv objects such as
+    //     wxConvLocal that are used all over wx code, so we can't store the
+    //     handles in this object itself and use the per-thread ones instead.
+    //     Otherwise only a few wx classes would be safe to use from non-main
+    //     threads as MB<->WC conversion would fail "randomly".
+    const char *GetWCName() const { return m_wcName.data(); }
+
     // the name (for iconv_open()) of a wide char charset -- if none is
     // available on this machine, it will remain empty
     static wxString ms_wcCharsetName;
@@ -2228,9 +2537,16 @@ private:
     // name of the encoding handled by this conversion
     const char *m_name;
 
+    // ASCII version of ms_wcCharsetName
+    wxCharBuffer m_wcName;
+
     // cached result of GetMBNulLen(); set to 0 meaning "unknown"
-    // initially
-    size_t m_minMBCharWidth;
+    // initially, atomic as it's lazily computed and the same object may be
+    // used from several threads
+    mutable std::atomic<size_t> m_minMBCharWidth;
+
+    // true if conversions in both directions are supported
+    bool m_ok;
 };
 
 // make the constructor available for unit testing
@@ -2253,6 +2569,11 @@ wxMBConv_iconv::wxMBConv_iconv(const char *name)
               : m_name(wxStrdup(name))
 {
     m_minMBCharWidth = 0;
+    m_ok = false;
+
+    // the handle for converting from this charset to wchar_t, if we had to
+    // open it for checking the wchar_t charset
+    iconv_t m2w = ICONV_T_INVALID;
 
     // check for charset that represents wchar_t:
     if ( ms_wcCharsetName.empty() )
@@ -2323,6 +2644,9 @@ wxMBConv_iconv::wxMBConv_iconv(const char *name)
                         wxLogLastError(wxT("iconv"));
                         wxLogError(_("Conversion to charset '%s' doesn't work."),
                                    nameCS.c_str());
+
+                        iconv_close(m2w);
+                        m2w = ICONV_T_INVALID;
                     }
                     else // ok, can convert to this encoding, remember it
                     {
@@ -2344,35 +2668,34 @@ wxMBConv_iconv::wxMBConv_iconv(const char *name)
                    ms_wcNeedsSwap ? wxT(" (needs swap)")
                                   : wxT(""));
     }
-    else // we already have ms_wcCharsetName
-    {
-        m2w = iconv_open(ms_wcCharsetName.ToAscii(), name);
-    }
 
     if ( ms_wcCharsetName.empty() )
+        return;
+
+    m_wcName = ms_wcCharsetName.ToAscii();
+
+    if ( m2w == ICONV_T_INVALID )
+        m2w = wxIconvPool::Acquire(GetWCName(), name);
+
+    const iconv_t w2m = wxIconvPool::Acquire(name, GetWCName());
+    if ( w2m == ICONV_T_INVALID && m2w != ICONV_T_INVALID )
     {
-        w2m = ICONV_T_INVALID;
-    }
-    else
-    {
-        w2m = iconv_open(name, ms_wcCharsetName.ToAscii());
-        if ( w2m == ICONV_T_INVALID )
-        {
-            wxLogTrace(TRACE_STRCONV,
-                       wxT("\"%s\" -> \"%s\" works but not the converse!?"),
-                       ms_wcCharsetName.c_str(), name);
-        }
+        wxLogTrace(TRACE_STRCONV,
+                   wxT("\"%s\" -> \"%s\" works but not the converse!?"),
+                   ms_wcCharsetName.c_str(), name);
     }
+
+    m_ok = m2w != ICONV_T_INVALID && w2m != ICONV_T_INVALID;
+
+    // we don't need the handles right now, but keep them in the pool to
+    // avoid opening them again when converting
+    wxIconvPool::Release(GetWCName(), name, m2w);
+    wxIconvPool::Release(name, GetWCName(), w2m);
 }
 
 wxMBConv_iconv::~wxMBConv_iconv()
 {
     free(const_cast<char *>(m_name));
-
-    if ( m2w != ICONV_T_INVALID )
-        iconv_close(m2w);
-    if ( w2m != ICONV_T_INVALID )
-        iconv_close(w2m);
 }
 
 size_t
@@ -2416,15 +2739,9 @@ wxMBConv_iconv::ToWChar(wchar_t *dst, size_t dstLen,
     // counts buffer sizes it in bytes
     dstLen *= SIZEOF_WCHAR_T;
 
-#if wxUSE_THREADS
-    // NB: iconv() is MT-safe, but each thread must use its own iconv_t handle.
-    //     Unfortunately there are a couple of global wxCSConv objects such as
-    //     wxConvLocal that are used all over wx code, so we have to make sure
-    //     the handle is used by at most one thread at the time. Otherwise
-    //     only a few wx classes would be safe to use from non-main threads
-    //     as MB<->WC conversion would fail "randomly".
-    wxMutexLocker lock(wxConstCast(this, wxMBConv_iconv)->m_iconvMutex);
-#endif // wxUSE_THREADS
+    const wxIconvHandle m2w(GetWCName(), m_name);
+    if ( m2w.Get() == ICONV_T_INVALID )
+        return wxCONV_FAILED;
 
     size_t res, cres;
     const char *pszPtr = src;
@@ -2435,7 +2752,7 @@ wxMBConv_iconv::ToWChar(wchar_t *dst, size_t dstLen,
 
         // have destination buffer, convert there
         size_t dstLenOrig = dstLen;
-        cres = iconv(m2w,
+        cres = iconv(m2w.Get(),
                      ICONV_CHAR_CAST(&pszPtr), &srcLen,
                      &bufPtr, &dstLen);
 
@@ -2461,7 +2778,7 @@ wxMBConv_iconv::ToWChar(wchar_t *dst, size_t dstLen,
             char* bufPtr = (char*)tbuf;
             dstLen = sizeof(tbuf);
 
-            cres = iconv(m2w,
+            cres = iconv(m2w.Get(),
                          ICONV_CHAR_CAST(&pszPtr), &srcLen,
                          &bufPtr, &dstLen );
 
@@ -2483,10 +2800,9 @@ wxMBConv_iconv::ToWChar(wchar_t *dst, size_t dstLen,
 size_t wxMBConv_iconv::FromWChar(char *dst, size_t dstLen,
                                  const wchar_t *src, size_t srcLen) const
 {
-#if wxUSE_THREADS
-    // NB: explained in MB2WC
-    wxMutexLocker lock(wxConstCast(this, wxMBConv_iconv)->m_iconvMutex);
-#endif
+    const wxIconvHandle w2m(m_name, GetWCName());
+    if ( w2m.Get() == ICONV_T_INVALID )
+        return wxCONV_FAILED;
 
     if ( srcLen == wxNO_LEN )
         srcLen = wxWcslen(src) + 1;
@@ -2513,7 +2829,7 @@ size_t wxMBConv_iconv::FromWChar(char *dst, size_t dstLen,
     if ( dst )
     {
         // have destination buffer, convert there
-        cres = iconv(w2m, ICONV_CHAR_CAST(&inbuf), &inbuflen, &dst, &outbuflen);
+        cres = iconv(w2m.Get(), ICONV_CHAR_CAST(&inbuf), &inbuflen, &dst, &outbuflen);
 
         res = dstLen - outbuflen;
     }
@@ -2527,7 +2843,7 @@ size_t wxMBConv_iconv::FromWChar(char *dst, size_t dstLen,
             dst = tbuf;
             outbuflen = WXSIZEOF(tbuf);
 
-            cres = iconv(w2m, ICONV_CHAR_CAST(&inbuf), &inbuflen, &dst, &outbuflen);
+            cres = iconv(w2m.Get(), ICONV_CHAR_CAST(&inbuf), &inbuflen, &dst, &outbuflen);
 
             res += WXSIZEOF(tbuf) - outbuflen;
         }
@@ -2550,14 +2866,10 @@ size_t wxMBConv_iconv::FromWChar(char *dst, size_t dstLen,
 
 size_t wxMBConv_iconv::GetMBNulLen() const
 {
-    if ( m_minMBCharWidth == 0 )
+    size_t width = m_minMBCharWidth.load(std::memory_order_relaxed);
+    if ( width == 0 )
     {
-        wxMBConv_iconv * const self = wxConstCast(this, wxMBConv_iconv);
-
-#if wxUSE_THREADS
-        // NB: explained in MB2WC
-        wxMutexLocker lock(self->m_iconvMutex);
-#endif
+        const wxIconvHandle w2m(m_name, GetWCName());
 
         const wchar_t *wnul = L"";
         char buf[8]; // should be enough for NUL in any encoding
@@ -2565,17 +2877,23 @@ size_t wxMBConv_iconv::GetMBNulLen() const
                outLen = WXSIZEOF(buf);
         const char* inBuff = reinterpret_cast<const char*>(wnul);
         char *outBuff = buf;
-        if ( iconv(w2m, ICONV_CHAR_CAST(&inBuff), &inLen, &outBuff, &outLen) == (size_t)-1 )
+        if ( w2m.Get() == ICONV_T_INVALID ||
+                iconv(w2m.Get(), ICONV_CHAR_CAST(&inBuff), &inLen,
+                      &outBuff, &outLen) == (size_t)-1 )
         {
-            self->m_minMBCharWidth = (size_t)-1;
+            width = (size_t)-1;
         }
         else // ok
         {
-            self->m_minMBCharWidth = outBuff - buf;
+            width = outBuff - buf;
         }
+
+        // Several threads may compute it concurrently, but they all get the
+        // same value, so it doesn't matter which one stores it.
+        m_minMBCharWidth.store(width, std::memory_order_relaxed);
     }
 
-    return m_minMBCharWidth;
+    return width;
 }
 
 bool wxMBConv_iconv::IsUTF8() const
@@ -2802,6 +3120,160 @@ private:
 #endif // wxHAVE_WIN32_MB2WC
 
 
+// ============================================================================
+// Table-driven conversion for the single byte encodings
+// ============================================================================
+
+// from encconv.cpp
+extern const wxUint16* wxGetEncodingUnicodeTable(wxFontEncoding enc);
+
+// This class uses the same tables as wxEncodingConverter, which map the upper
+// half of the single byte character set to Unicode, but, unlike it, is not
+// used as a last resort but in preference to the system conversion functions
+// for the encodings it supports, as it's much faster than them, especially
+// for short strings.
+class wxMBConv_sbcs : public wxMBConv
+{
+public:
+    // Return the conversion object for the given encoding or null if it's not
+    // a single byte encoding or if there is no table for it.
+    static wxMBConv_sbcs* Create(wxFontEncoding enc)
+    {
+        // Don't handle Mac encodings, wxEncodingConverter tables for them
+        // are generated dynamically and wxMBConv_cf handles them anyhow.
+        if ( enc >= wxFONTENCODING_MACMIN && enc <= wxFONTENCODING_MACMAX )
+            return nullptr;
+
+        const wxUint16* const table = wxGetEncodingUnicodeTable(enc);
+        if ( !table )
+            return nullptr;
+
+        return new wxMBConv_sbcs(enc, table);
+    }
+
+    virtual size_t ToWChar(wchar_t *dst, size_t dstLen,
+                           const char *src, size_t srcLen = wxNO_LEN) const override
+    {
+        if ( srcLen == wxNO_LEN )
+            srcLen = strlen(src) + 1;
+
+        if ( dst && dstLen < srcLen )
+            return wxCONV_FAILED;
+
+        for ( size_t n = 0; n < srcLen; n++ )
+        {
+            const unsigned char c = static_cast<unsigned char>(src[n]);
+
+            wchar_t wc;
+            if ( c < 0x80 )
+            {
+                wc = c;
+            }
+            else
+            {
+                wc = m_table[c - 0x80];
+                if ( !wc )
+                    return wxCONV_FAILED;
+            }
+
+            if ( dst )
+                dst[n] = wc;
+        }
+
+        return srcLen;
+    }
+
+    virtual size_t FromWChar(char *dst, size_t dstLen,
+                             const wchar_t *src, size_t srcLen = wxNO_LEN) const override
+    {
+        if ( srcLen == wxNO_LEN )
+            srcLen = wxWcslen(src) + 1;
+
+        if ( dst && dstLen < srcLen )
+            return wxCONV_FAILED;
+
+        for ( size_t n = 0; n < srcLen; n++ )
+        {
+            const wchar_t wc = src[n];
+
+            char c;
+            if ( static_cast<wxUint32>(wc) < 0x80 )
+            {
+                c = static_cast<char>(wc);
+            }
+            else
+            {
+                if ( static_cast<wxUint32>(wc) > 0xffff )
+                    return wxCONV_FAILED;
+
+                const ReverseItem* const end = m_reverse + m_reverseCount;
+                const ReverseItem* const
+                    it = std::lower_bound(m_reverse, end, static_cast<wxUint16>(wc));
+                if ( it == end || it->u != wc )
+                    return wxCONV_FAILED;
+
+                c = static_cast<char>(it->c);
+            }
+
+            if ( dst )
+                dst[n] = c;
+        }
+
+        return srcLen;
+    }
+
+    virtual wxMBConv *Clone() const override
+    {
+        return new wxMBConv_sbcs(m_enc, m_table);
+    }
+
+private:
+    wxMBConv_sbcs(wxFontEncoding enc, const wxUint16* table)
+        : m_enc(enc),
+          m_table(table)
+    {
+        m_reverseCount = 0;
+        for ( unsigned n = 0; n < 0x80; n++ )
+        {
+            if ( table[n] )
+            {
+                ReverseItem& item = m_reverse[m_reverseCount++];
+                item.u = table[n];
+                item.c = static_cast<wxUint8>(0x80 + n);
+            }
+        }
+
+        std::sort(m_reverse, m_reverse + m_reverseCount);
+    }
+
+    // Element of the table used for the conversions from Unicode, sorted by
+    // the Unicode code point.
+    struct ReverseItem
+    {
+        wxUint16 u;
+        wxUint8 c;
+
+        bool operator<(const ReverseItem& other) const { return u < other.u; }
+        bool operator<(wxUint16 other) const { return u < other; }
+    };
+
+    const wxFontEncoding m_enc;
+
+    // Table mapping the characters in 0x80..0xff range to Unicode.
+    const wxUint16* const m_table;
+
+    ReverseItem m_reverse[0x80];
+    size_t m_reverseCount;
+
+    wxDECLARE_NO_COPY_CLASS(wxMBConv_sbcs);
+};
+
+// make the constructor available for unit testing
+WXDLLIMPEXP_BASE wxMBConv* new_wxMBConv_sbcs( wxFontEncoding enc )
+{
+    return wxMBConv_sbcs::Create( enc );
+}
+
 // ============================================================================
 // wxEncodingConverter based conversion classes
 // ============================================================================
@@ -3077,13 +3549,26 @@ wxMBConv *wxCSConv::DoCreate() const
     }
 
     // we trust OS to do conversion better than we can so try external
-    // conversion methods first
+    // conversion methods first, except for the single byte encodings for
+    // which a simple table lookup is both correct and much faster than
+    // iconv(), especially for the short strings
     //
     // the full order is:
+    //      0. table-driven conversion for the single byte encodings
     //      1. OS conversion (iconv() under Unix or Win32 API)
     //      2. hard coded conversions for UTF
     //      3. wxEncodingConverter as fall back
 
+    // step (0)
+#ifndef wxHAVE_WIN32_MB2WC
+    if ( m_encoding != wxFONTENCODING_SYSTEM )
+    {
+        wxMBConv_sbcs *conv = wxMBConv_sbcs::Create(m_encoding);
+        if ( conv )
+            return conv;
+    }
+#endif // !wxHAVE_WIN32_MB2WC
+
     // step (1)
 #ifdef HAVE_ICONV
 #if !wxUSE_FONTMAP
@@ -3324,6 +3809,15 @@ size_t wxCSConv::GetMBNulLen() const
     return 1;
 }
 
+size_t wxCSConv::GetMaxCharLen() const
+{
+    if ( m_convReal )
+        return m_convReal->GetMaxCharLen();
+
+    // otherwise, we are ISO-8859-1
+    return 1;
+}
+
 bool wxCSConv::IsUTF8() const
 {
     if ( m_convReal )
@@ -28,6 +28,7 @@
 
 #include <string.h>
 #include <stdlib.h>
+#include <algorithm>
 
 #include "wx/uilocale.h"
 #include "wx/vector.h"
@@ -461,10 +462,8 @@ const wchar_t *wxString::AsWChar(const wxMBConv& conv) const
     const char * const strMB = m_impl.c_str();
     const size_t lenMB = m_impl.length();
 
-    // find out the size of the buffer needed
-    const size_t lenWC = conv.ToWChar(nullptr, 0, strMB, lenMB);
-    if ( lenWC == wxCONV_FAILED )
-        return nullptr;
+    ConvertedBuffer<wchar_t>& buf =
+        const_cast<wxString *>(this)->m_convertedToWChar;
 
     // keep the same buffer if the string size didn't change: this is not only
     // an optimization but also ensure that code which modifies string
@@ -472,23 +471,33 @@ const wchar_t *wxString::AsWChar(const wxMBConv& conv) const
     // the pointer returned by a previous wc_str() call even after changing the
     // string
 
-    // TODO-UTF8: we could check for ">" instead of "!=" here as this would
-    //            allow to save on buffer reallocations but at the cost of
-    //            consuming (even) more memory, we should benchmark this to
-    //            determine if it's worth doing
-    if ( !m_convertedToWChar.m_str || lenWC != m_convertedToWChar.m_len )
+    // the output can't be longer than the input, so try converting directly
+    // into the buffer of the same size and only find out the exact size of the
+    // buffer needed if this fails, which only happens for invalid input
+    size_t lenWC = wxCONV_FAILED;
+    if ( lenMB && ((buf.m_str && buf.m_len >= lenMB) || buf.Extend(lenMB)) )
+        lenWC = conv.ToWChar(buf.m_str, lenMB, strMB, lenMB);
+
+    if ( lenWC == wxCONV_FAILED )
     {
-        if ( !const_cast<wxString *>(this)->m_convertedToWChar.Extend(lenWC) )
+        lenWC = conv.ToWChar(nullptr, 0, strMB, lenMB);
+        if ( lenWC == wxCONV_FAILED )
+            return nullptr;
+
+        if ( !buf.m_str || lenWC > buf.m_len )
+        {
+            if ( !buf.Extend(lenWC) )
+                return nullptr;
+        }
+
+        if ( conv.ToWChar(buf.m_str, lenWC, strMB, lenMB) == wxCONV_FAILED )
             return nullptr;
     }
 
-    // finally do convert
-    m_convertedToWChar.m_str[lenWC] = L'\0';
-    if ( conv.ToWChar(m_convertedToWChar.m_str, lenWC,
-                      strMB, lenMB) == wxCONV_FAILED )
-        return nullptr;
+    buf.m_len = lenWC;
+    buf.m_str[lenWC] = L'\0';
 
-    return m_convertedToWChar.m_str;
+    return buf.m_str;
 }
 
 #endif // !wxUSE_UNICODE_WCHAR
@@ -511,22 +520,37 @@ const char *wxString::AsChar(const wxMBConv& conv) const
     const size_t lenWC = m_impl.length();
 #endif // wxUSE_UNICODE_UTF8/wxUSE_UNICODE_WCHAR
 
-    const size_t lenMB = conv.FromWChar(nullptr, 0, strWC, lenWC);
-    if ( lenMB == wxCONV_FAILED )
-        return nullptr;
+    ConvertedBuffer<char>& buf =
+        const_cast<wxString *>(this)->m_convertedToChar;
+
+    // as in AsWChar(), try converting directly into the buffer of the size
+    // sufficient for all single byte encodings and ASCII strings in UTF-8 and
+    // only find out the exact size of the buffer needed if this fails
+    size_t lenMB = wxCONV_FAILED;
+    if ( lenWC && ((buf.m_str && buf.m_len >= lenWC) || buf.Extend(lenWC)) )
+        lenMB = conv.FromWChar(buf.m_str, lenWC, strWC, lenWC);
 
-    if ( !m_convertedToChar.m_str || lenMB != m_convertedToChar.m_len )
+    if ( lenMB == wxCONV_FAILED )
     {
-        if ( !const_cast<wxString *>(this)->m_convertedToChar.Extend(lenMB) )
+        lenMB = conv.FromWChar(nullptr, 0, strWC, lenWC);
+        if ( lenMB == wxCONV_FAILED )
+            return nullptr;
+
+        if ( !buf.m_str || lenMB > buf.m_len )
+        {
+            if ( !buf.Extend(lenMB) )
+                return nullptr;
+        }
+
+        lenMB = conv.FromWChar(buf.m_str, lenMB, strWC, lenWC);
+        if ( lenMB == wxCONV_FAILED )
             return nullptr;
     }
 
-    m_convertedToChar.m_str[lenMB] = '\0';
-    if ( conv.FromWChar(m_convertedToChar.m_str, lenMB,
-                        strWC, lenWC) == wxCONV_FAILED )
-        return nullptr;
+    buf.m_len = lenMB;
+    buf.m_str[lenMB] = '\0';
 
-    return m_convertedToChar.m_str;
+    return buf.m_str;
 }
 
 // ---------------------------------------------------------------------------
@@ -867,6 +891,200 @@ size_t wxString::find_last_not_of(const char* sz, size_t nStart,
 // other common string functions
 // ===========================================================================
 
+// ---------------------------------------------------------------------------
+// ASCII fast paths for case-insensitive operations
+// ---------------------------------------------------------------------------
+
+#if wxUSE_UNICODE_WCHAR
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+
+    #define wxHAS_SSE2_CASE_OPS
+#endif
+
+namespace
+{
+
+// Don't bother with the fast paths for the strings shorter than this, the
+// overhead of checking whether they can be used is not worth it for them.
+const size_t ASCII_FAST_PATH_MIN_LEN = 8;
+
+// The fast paths below assume that ASCII letters are mapped to each other by
+// towlower() and towupper(), which is the case in all locales except Turkish
+// and Azeri ones, where 'I' and 'i' are mapped to dotless and dotted 'I'.
+//
+// Note that we can't cache the result of this function as the locale may be
+// changed at any moment.
+inline bool IsStandardAsciiCaseMapping()
+{
+    return wxTolower(wxT('I')) == wxT('i') && wxToupper(wxT('i')) == wxT('I');
+}
+
+inline wchar_t AsciiToLower(wchar_t c)
+{
+    return c >= wxT('A') && c <= wxT('Z') ? c | 0x20 : c;
+}
+
+// Convert a single character to the given case, using the fast path for the
+// ASCII characters. IsStandardAsciiCaseMapping() must be true when using it.
+inline wchar_t ConvertCharCase(wchar_t c, bool lower)
+{
+    if ( c < 0x80 )
+    {
+        if ( lower )
+            return AsciiToLower(c);
+
+        return c >= wxT('a') && c <= wxT('z') ? c & ~0x20 : c;
+    }
+
+    return static_cast<wchar_t>(lower ? wxTolower(c) : wxToupper(c));
+}
+
+#ifdef wxHAS_SSE2_CASE_OPS
+
+// Number of characters processed by a single SSE2 operation.
+const size_t CHARS_PER_VECTOR = sizeof(__m128i) / sizeof(wchar_t);
+
+// Helpers abstracting the differences between 16 and 32 bit wchar_t.
+template <size_t N> struct SSE2CharOps;
+
+template <>
+struct SSE2CharOps<2>
+{
+    static __m128i Set(int c) { return _mm_set1_epi16(static_cast<short>(c)); }
+    static __m128i CmpGt(__m128i a, __m128i b) { return _mm_cmpgt_epi16(a, b); }
+};
+
+template <>
+struct SSE2CharOps<4>
+{
+    static __m128i Set(int c) { return _mm_set1_epi32(c); }
+    static __m128i CmpGt(__m128i a, __m128i b) { return _mm_cmpgt_epi32(a, b); }
+};
+
+typedef SSE2CharOps<sizeof(wchar_t)> CharOps;
+
+inline __m128i LoadChars(const wchar_t* p)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+}
+
+inline bool AreAllAscii(__m128i v)
+{
+    const __m128i nonAscii = _mm_and_si128(v, CharOps::Set(~0x7f));
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(nonAscii, _mm_setzero_si128()))
+            == 0xffff;
+}
+
+// Flip the case of all characters in [first, last] range. This is only
+// correct if the vector contains ASCII characters only, as the comparisons
+// used here are signed.
+inline __m128i FlipAsciiCase(__m128i v, wchar_t first, wchar_t last)
+{
+    const __m128i inRange = _mm_and_si128
+                            (
+                                CharOps::CmpGt(v, CharOps::Set(first - 1)),
+                                CharOps::CmpGt(CharOps::Set(last + 1), v)
+                            );
+
+    return _mm_xor_si128(v, _mm_and_si128(inRange, CharOps::Set(0x20)));
+}
+
+#endif // wxHAS_SSE2_CASE_OPS
+
+// Convert the given buffer to lower or upper case in place.
+void ConvertBufferCase(wchar_t* p, size_t len, bool lower)
+{
+    size_t n = 0;
+
+#ifdef wxHAS_SSE2_CASE_OPS
+    const wchar_t first = lower ? wxT('A') : wxT('a');
+    const wchar_t last = lower ? wxT('Z') : wxT('z');
+
+    for ( ; n + CHARS_PER_VECTOR <= len; n += CHARS_PER_VECTOR )
+    {
+        const __m128i v = LoadChars(p + n);
+        if ( AreAllAscii(v) )
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(p + n),
+                             FlipAsciiCase(v, first, last));
+        }
+        else
+        {
+            for ( size_t i = n; i < n + CHARS_PER_VECTOR; i++ )
+                p[i] = ConvertCharCase(p[i], lower);
+        }
+    }
+#endif // wxHAS_SSE2_CASE_OPS
+
+    for ( ; n < len; n++ )
+        p[n] = ConvertCharCase(p[n], lower);
+}
+
+// Return the length of the longest common prefix of the two buffers which
+// consists of ASCII characters only that are equal when ignoring case.
+size_t GetAsciiNoCaseCommonPrefix(const wchar_t* p1, const wchar_t* p2, size_t len)
+{
+    size_t n = 0;
+
+#ifdef wxHAS_SSE2_CASE_OPS
+    for ( ; n + CHARS_PER_VECTOR <= len; n += CHARS_PER_VECTOR )
+    {
+        const __m128i v1 = LoadChars(p1 + n);
+        const __m128i v2 = LoadChars(p2 + n);
+        if ( !AreAllAscii(_mm_or_si128(v1, v2)) )
+            break;
+
+        const __m128i eq = _mm_cmpeq_epi8(FlipAsciiCase(v1, wxT('A'), wxT('Z')),
+                                          FlipAsciiCase(v2, wxT('A'), wxT('Z')));
+        if ( _mm_movemask_epi8(eq) != 0xffff )
+            break;
+    }
+#endif // wxHAS_SSE2_CASE_OPS
+
+    // Find the exact position of the first mismatch or non-ASCII character.
+    for ( ; n < len; n++ )
+    {
+        const wchar_t c1 = p1[n];
+        const wchar_t c2 = p2[n];
+        if ( (c1 | c2) >= 0x80 || AsciiToLower(c1) != AsciiToLower(c2) )
+            break;
+    }
+
+    return n;
+}
+
+} // anonymous namespace
+
+#endif // wxUSE_UNICODE_WCHAR
+
+int wxStricmpW(const wchar_t *s1, const wchar_t *s2)
+{
+    if ( s1 == s2 )
+        return 0;
+
+#if wxUSE_UNICODE_WCHAR
+    // We need to know the length of the strings to avoid reading beyond their
+    // end in GetAsciiNoCaseCommonPrefix(), but finding it is much cheaper
+    // than comparing them character by character without case.
+    const size_t len1 = wxStrlen(s1);
+    if ( len1 >= ASCII_FAST_PATH_MIN_LEN )
+    {
+        const size_t lenMin = wxStrnlen(s2, len1);
+        if ( lenMin >= ASCII_FAST_PATH_MIN_LEN && IsStandardAsciiCaseMapping() )
+        {
+            const size_t lenPrefix = GetAsciiNoCaseCommonPrefix(s1, s2, lenMin);
+            s1 += lenPrefix;
+            s2 += lenPrefix;
+        }
+    }
+#endif // wxUSE_UNICODE_WCHAR
+
+    return wxCRT_StricmpW(s1, s2);
+}
+
 int wxString::CmpNoCase(const wxString& s) const
 {
 #if !wxUSE_UNICODE_UTF8
@@ -884,6 +1102,21 @@ int wxString::CmpNoCase(const wxString& s) const
     pchar_type thisCur = thisBegin;
     pchar_type thatCur = thatBegin;
 
+#if wxUSE_UNICODE_WCHAR
+    // Skip the common ASCII prefix quickly, this covers the entire string in
+    // the common case of comparing equal ASCII strings and still helps a lot
+    // for the long strings differing only near their end.
+    const size_t lenMin = std::min(m_impl.length(), s.m_impl.length());
+    if ( lenMin >= ASCII_FAST_PATH_MIN_LEN && IsStandardAsciiCaseMapping() )
+    {
+        const size_t lenPrefix = GetAsciiNoCaseCommonPrefix(thisBegin,
+                                                            thatBegin,
+                                                            lenMin);
+        thisCur += lenPrefix;
+        thatCur += lenPrefix;
+    }
+#endif // wxUSE_UNICODE_WCHAR
+
     int rc;
     for ( ;; )
     {
@@ -1333,6 +1566,14 @@ wxString wxString::Strip(stripType w) const
 
 wxString& wxString::MakeUpper()
 {
+#if wxUSE_UNICODE_WCHAR
+  if ( m_impl.length() >= ASCII_FAST_PATH_MIN_LEN && IsStandardAsciiCaseMapping() )
+  {
+    ConvertBufferCase(&m_impl[0], m_impl.length(), false /* upper */);
+    return *this;
+  }
+#endif // wxUSE_UNICODE_WCHAR
+
   for ( auto&& c : *this )
     c = (wxChar)wxToupper(c);
 
@@ -1341,6 +1582,14 @@ wxString& wxString::MakeUpper()
 
 wxString& wxString::MakeLower()
 {
+#if wxUSE_UNICODE_WCHAR
+  if ( m_impl.length() >= ASCII_FAST_PATH_MIN_LEN && IsStandardAsciiCaseMapping() )
+  {
+    ConvertBufferCase(&m_impl[0], m_impl.length(), true /* lower */);
+    return *this;
+  }
+#endif // wxUSE_UNICODE_WCHAR
+
   for ( auto&& c : *this )
     c = (wxChar)wxTolower(c);
 
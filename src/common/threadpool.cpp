@@ -0,0 +1,889 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        src/common/threadpool.cpp
+// Purpose:     wxThreadPool implementation
+// Author:      wxWidgets team
+// Created:     2026-10-19
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+// For compilers that support precompilation, includes "wx.h".
+#include "wx/wxprec.h"
+
+#if wxUSE_THREADS
+
+#ifndef WX_PRECOMP
+    #include "wx/app.h"
+    #include "wx/log.h"
+    #include "wx/module.h"
+    #include "wx/utils.h"
+#endif // WX_PRECOMP
+
+#include "wx/threadpool.h"
+#include "wx/thread.h"
+
+#include "wx/private/safecall.h"
+
+#include <atomic>
+#include <deque>
+#include <vector>
+
+namespace
+{
+
+// The number of different task priorities.
+const int TASK_PRIORITY_COUNT = wxTASK_PRIORITY_HIGH + 1;
+
+// How long a pool thread waiting for a task blocks when there are no other
+// tasks it could execute in the meanwhile, in milliseconds: this must be
+// short as it doesn't get notified about the new tasks.
+const unsigned long WORKER_WAIT_INTERVAL = 5;
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------------
+// wxTaskImpl: the shared state of a task
+// ----------------------------------------------------------------------------
+
+typedef std::shared_ptr<wxTaskImpl> wxTaskPtr;
+
+class wxTaskImpl
+{
+public:
+    wxTaskImpl(const std::shared_ptr<wxThreadPoolImpl>& pool,
+               const std::function<void()>& func,
+               wxTaskPriority priority,
+               bool runInMainThread)
+        : m_pool(pool),
+          m_func(func),
+          m_priority(priority),
+          m_runInMainThread(runInMainThread)
+    {
+    }
+
+    wxTaskState GetState() const
+    {
+        return static_cast<wxTaskState>(m_state.load());
+    }
+
+    bool IsDone() const
+    {
+        const wxTaskState state = GetState();
+        return state == wxTASK_COMPLETED || state == wxTASK_CANCELLED;
+    }
+
+    // Change the state from pending to the given one, returns false if the
+    // task is not pending any more.
+    bool LeavePendingState(wxTaskState state)
+    {
+        int expected = wxTASK_PENDING;
+        return m_state.compare_exchange_strong(expected, state);
+    }
+
+    const std::shared_ptr<wxThreadPoolImpl> m_pool;
+
+    // The function is reset once it is executed to free any resources used
+    // by it as soon as possible.
+    std::function<void()> m_func;
+
+    const wxTaskPriority m_priority;
+    const bool m_runInMainThread;
+
+    std::atomic<int> m_state{wxTASK_PENDING};
+    std::atomic<bool> m_cancelRequested{false};
+
+    // The tasks to launch when this one is done, protected by m_csConts.
+    wxCRIT_SECT_DECLARE_MEMBER(m_csConts);
+    std::vector<wxTaskPtr> m_continuations;
+
+    wxDECLARE_NO_COPY_CLASS(wxTaskImpl);
+};
+
+namespace
+{
+
+// The task being currently executed by this thread, if any.
+thread_local wxTaskImpl* gs_currentTask = nullptr;
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------------
+// wxTaskQueue: double-ended queue of the tasks of each priority
+// ----------------------------------------------------------------------------
+
+// Each worker thread has its own queue to which it adds the tasks submitted
+// from it and from which it takes the most recently added tasks first, while
+// the other, idle, threads steal the oldest tasks from the other end. The
+// pool also has a shared queue for the tasks submitted from outside of it.
+class wxTaskQueue
+{
+public:
+    wxTaskQueue() = default;
+
+    bool IsEmpty(int priority) const
+    {
+        return m_sizes[priority].load(std::memory_order_relaxed) == 0;
+    }
+
+    void Push(const wxTaskPtr& task)
+    {
+        const int priority = task->m_priority;
+
+        wxCRIT_SECT_LOCKER(lock, m_cs);
+
+        m_tasks[priority].push_back(task);
+        m_sizes[priority].store(m_tasks[priority].size(),
+                                std::memory_order_relaxed);
+    }
+
+    wxTaskPtr PopBack(int priority)
+    {
+        return Pop(priority, true);
+    }
+
+    wxTaskPtr PopFront(int priority)
+    {
+        return Pop(priority, false);
+    }
+
+private:
+    wxTaskPtr Pop(int priority, bool back)
+    {
+        if ( IsEmpty(priority) )
+            return wxTaskPtr();
+
+        wxCRIT_SECT_LOCKER(lock, m_cs);
+
+        std::deque<wxTaskPtr>& tasks = m_tasks[priority];
+        if ( tasks.empty() )
+            return wxTaskPtr();
+
+        wxTaskPtr task;
+        if ( back )
+        {
+            task = std::move(tasks.back());
+            tasks.pop_back();
+        }
+        else
+        {
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+
+        m_sizes[priority].store(tasks.size(), std::memory_order_relaxed);
+
+        return task;
+    }
+
+    wxCRIT_SECT_DECLARE_MEMBER(m_cs);
+    std::deque<wxTaskPtr> m_tasks[TASK_PRIORITY_COUNT];
+
+    // Sizes of the queues, allowing to check if they're empty without locking.
+    std::atomic<size_t> m_sizes[TASK_PRIORITY_COUNT] = { };
+
+    wxDECLARE_NO_COPY_CLASS(wxTaskQueue);
+};
+
+// ----------------------------------------------------------------------------
+// wxThreadPoolWorker: one of the pool threads
+// ----------------------------------------------------------------------------
+
+class wxThreadPoolWorker : public wxThread
+{
+public:
+    wxThreadPoolWorker(wxThreadPoolImpl* pool, unsigned index)
+        : wxThread(wxTHREAD_JOINABLE),
+          m_pool(pool),
+          m_index(index)
+    {
+    }
+
+    bool Start()
+    {
+        m_started = Run() == wxTHREAD_NO_ERROR;
+        return m_started;
+    }
+
+    bool IsStarted() const { return m_started; }
+
+    wxThreadPoolImpl* GetPool() const { return m_pool; }
+    unsigned GetIndex() const { return m_index; }
+    wxTaskQueue& GetQueue() { return m_queue; }
+
+protected:
+    virtual void* Entry() override;
+
+private:
+    wxThreadPoolImpl* const m_pool;
+    const unsigned m_index;
+    bool m_started = false;
+    wxTaskQueue m_queue;
+
+    wxDECLARE_NO_COPY_CLASS(wxThreadPoolWorker);
+};
+
+namespace
+{
+
+// The worker object for the current thread if it is a pool thread.
+thread_local wxThreadPoolWorker* gs_currentWorker = nullptr;
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------------
+// wxThreadPoolImpl
+// ----------------------------------------------------------------------------
+
+class wxThreadPoolImpl : public std::enable_shared_from_this<wxThreadPoolImpl>
+{
+public:
+    wxThreadPoolImpl()
+        : m_sleepCond(m_sleepMutex),
+          m_waitCond(m_waitMutex)
+    {
+    }
+
+    ~wxThreadPoolImpl()
+    {
+        wxASSERT_MSG( m_workers.empty(), "must be shut down before destroying" );
+    }
+
+    void Start(unsigned numThreads);
+    void Shutdown();
+
+    unsigned GetThreadCount() const { return m_numStarted; }
+
+    wxTaskPtr CreateTask(const std::function<void()>& func,
+                         wxTaskPriority priority,
+                         bool runInMainThread = false);
+
+    // Schedule the task for execution, in the pool or in the main thread.
+    void Launch(const wxTaskPtr& task);
+
+    // Cancel the task if it's still pending.
+    static bool CancelTask(const wxTaskPtr& task);
+
+    // Execute the task in the current thread if it's still pending.
+    static void RunTask(const wxTaskPtr& task);
+
+    // Execute one of the pending tasks, if there are any, in the given worker
+    // thread and return true or return false if there are no tasks.
+    bool RunOneTask(wxThreadPoolWorker* worker);
+
+    // Block until the predicate returns true, it's called with m_waitMutex
+    // locked. Returns false if the timeout, if specified, expired.
+    template <typename Predicate>
+    bool WaitUntil(const Predicate& predicate, long timeout = -1);
+
+    void WaitAll()
+    {
+        const wxThreadPoolWorker* const worker = gs_currentWorker;
+        wxCHECK_RET( !worker || worker->GetPool() != this,
+                     "can't wait for all tasks from a task of the same pool" );
+
+        WaitUntil([this]() { return m_outstanding.load() == 0; });
+    }
+
+    void WorkerMain(wxThreadPoolWorker* worker);
+
+private:
+    void Enqueue(const wxTaskPtr& task);
+
+    // Cancel all the tasks in the shared and workers queues.
+    void CancelQueued();
+
+    wxTaskPtr Steal(int priority, wxThreadPoolWorker* thief);
+
+    // Called exactly once for each task when it completes or is cancelled.
+    static void OnTaskDone(const wxTaskPtr& task, wxTaskState state);
+
+    // Wake up the threads blocked in WaitUntil(), if any.
+    void NotifyWaiters();
+
+
+    // All the workers are created before starting any of them and this
+    // vector is not modified until shutdown, so it can be used without
+    // locking, but some of the threads might have failed to start.
+    std::vector<wxThreadPoolWorker*> m_workers;
+    unsigned m_numStarted = 0;
+
+    // Queue for the tasks submitted from the threads not belonging to pool.
+    wxTaskQueue m_sharedQueue;
+
+    // The number of the queued tasks of each priority and in total.
+    std::atomic<int> m_queued[TASK_PRIORITY_COUNT] = { };
+    std::atomic<int> m_queuedTotal{0};
+
+    // The number of tasks executed by the pool threads which are not done
+    // yet, used by WaitAll().
+    std::atomic<int> m_outstanding{0};
+
+    std::atomic<bool> m_stopping{false};
+
+    // Used by the idle worker threads to wait for the new tasks.
+    wxMutex m_sleepMutex;
+    wxCondition m_sleepCond;
+    std::atomic<int> m_sleepers{0};
+
+    // Used by the threads waiting for some tasks completion.
+    wxMutex m_waitMutex;
+    wxCondition m_waitCond;
+    std::atomic<int> m_waiters{0};
+
+    wxDECLARE_NO_COPY_CLASS(wxThreadPoolImpl);
+};
+
+void* wxThreadPoolWorker::Entry()
+{
+    gs_currentWorker = this;
+
+    m_pool->WorkerMain(this);
+
+    gs_currentWorker = nullptr;
+
+    return nullptr;
+}
+
+void wxThreadPoolImpl::Start(unsigned numThreads)
+{
+    m_workers.reserve(numThreads);
+    for ( unsigned n = 0; n < numThreads; n++ )
+        m_workers.push_back(new wxThreadPoolWorker(this, n));
+
+    for ( auto worker : m_workers )
+    {
+        if ( worker->Start() )
+            m_numStarted++;
+        else
+            wxLogDebug("Failed to start thread pool worker thread.");
+    }
+}
+
+void wxThreadPoolImpl::CancelQueued()
+{
+    // Notice that cancelling the tasks also cancels all their continuations.
+    for ( int priority = 0; priority < TASK_PRIORITY_COUNT; priority++ )
+    {
+        for ( ;; )
+        {
+            wxTaskPtr task = m_sharedQueue.PopFront(priority);
+            for ( size_t n = 0; !task && n < m_workers.size(); n++ )
+                task = m_workers[n]->GetQueue().PopFront(priority);
+
+            if ( !task )
+                break;
+
+            m_queued[priority]--;
+            m_queuedTotal--;
+
+            CancelTask(task);
+        }
+    }
+}
+
+void wxThreadPoolImpl::Shutdown()
+{
+    m_stopping = true;
+
+    // Cancel all the tasks which haven't started yet.
+    CancelQueued();
+
+    {
+        wxMutexLocker lock(m_sleepMutex);
+        m_sleepCond.Broadcast();
+    }
+
+    for ( auto worker : m_workers )
+    {
+        if ( worker->IsStarted() )
+            worker->Wait();
+    }
+
+    // The tasks which were running could have launched more tasks, possibly
+    // queuing them in their worker queue, which we need to cancel too before
+    // destroying the workers.
+    CancelQueued();
+
+    for ( auto worker : m_workers )
+        delete worker;
+
+    m_workers.clear();
+    m_numStarted = 0;
+}
+
+wxTaskPtr
+wxThreadPoolImpl::CreateTask(const std::function<void()>& func,
+                             wxTaskPriority priority,
+                             bool runInMainThread)
+{
+    wxCHECK_MSG( priority >= wxTASK_PRIORITY_LOW &&
+                    priority <= wxTASK_PRIORITY_HIGH,
+                 wxTaskPtr(), "invalid task priority" );
+
+    if ( !runInMainThread )
+        m_outstanding++;
+
+    return std::make_shared<wxTaskImpl>(shared_from_this(), func, priority,
+                                        runInMainThread);
+}
+
+void wxThreadPoolImpl::Launch(const wxTaskPtr& task)
+{
+    if ( task->m_runInMainThread )
+    {
+        // Without the application object there is no main event loop, so
+        // just execute the task in the pool thread then.
+        if ( wxTheApp )
+        {
+            wxTheApp->CallAfter([task]() { RunTask(task); });
+            return;
+        }
+    }
+
+    Enqueue(task);
+}
+
+void wxThreadPoolImpl::Enqueue(const wxTaskPtr& task)
+{
+    if ( m_stopping )
+    {
+        CancelTask(task);
+        return;
+    }
+
+    // If we couldn't create any threads, the best we can do is to execute
+    // the task synchronously.
+    if ( !m_numStarted )
+    {
+        RunTask(task);
+        return;
+    }
+
+    // Use the queue of the current thread if it belongs to this pool to keep
+    // the related tasks together and to avoid contention on the shared queue.
+    wxThreadPoolWorker* const worker = gs_currentWorker;
+    if ( worker && worker->GetPool() == this )
+        worker->GetQueue().Push(task);
+    else
+        m_sharedQueue.Push(task);
+
+    m_queued[task->m_priority]++;
+    m_queuedTotal++;
+
+    // Notice that the worker threads increment m_sleepers before checking
+    // m_queuedTotal, so we can't miss a thread going to sleep here.
+    if ( m_sleepers.load() > 0 )
+    {
+        wxMutexLocker lock(m_sleepMutex);
+        m_sleepCond.Signal();
+    }
+}
+
+wxTaskPtr wxThreadPoolImpl::Steal(int priority, wxThreadPoolWorker* thief)
+{
+    const size_t count = m_workers.size();
+
+    // Start with the next worker to avoid all the idle threads trying to
+    // steal from the same one.
+    const size_t start = thief ? thief->GetIndex() + 1 : 0;
+    for ( size_t n = 0; n < count; n++ )
+    {
+        wxThreadPoolWorker* const victim = m_workers[(start + n) % count];
+        if ( victim == thief )
+            continue;
+
+        wxTaskPtr task = victim->GetQueue().PopFront(priority);
+        if ( task )
+            return task;
+    }
+
+    return wxTaskPtr();
+}
+
+bool wxThreadPoolImpl::RunOneTask(wxThreadPoolWorker* worker)
+{
+    for ( int priority = TASK_PRIORITY_COUNT - 1; priority >= 0; priority-- )
+    {
+        if ( m_queued[priority].load(std::memory_order_relaxed) == 0 )
+            continue;
+
+        // Prefer the most recent task from our own queue, as its data is
+        // more likely to be still in cache, then the oldest shared task and
+        // steal from the other threads only if there is nothing else to do.
+        wxTaskPtr task = worker->GetQueue().PopBack(priority);
+        if ( !task )
+            task = m_sharedQueue.PopFront(priority);
+        if ( !task )
+            task = Steal(priority, worker);
+
+        if ( task )
+        {
+            m_queued[priority]--;
+            m_queuedTotal--;
+
+            RunTask(task);
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void wxThreadPoolImpl::WorkerMain(wxThreadPoolWorker* worker)
+{
+    while ( !m_stopping )
+    {
+        if ( RunOneTask(worker) )
+            continue;
+
+        wxMutexLocker lock(m_sleepMutex);
+
+        m_sleepers++;
+        if ( m_queuedTotal.load() == 0 && !m_stopping )
+            m_sleepCond.Wait();
+        m_sleepers--;
+    }
+}
+
+/* static */
+void wxThreadPoolImpl::RunTask(const wxTaskPtr& task)
+{
+    if ( !task->LeavePendingState(wxTASK_RUNNING) )
+    {
+        // It must have been cancelled.
+        return;
+    }
+
+    wxTaskImpl* const taskOuter = gs_currentTask;
+    gs_currentTask = task.get();
+
+    wxSafeCall(task->m_func);
+
+    gs_currentTask = taskOuter;
+
+    task->m_func = nullptr;
+
+    OnTaskDone(task, wxTASK_COMPLETED);
+}
+
+/* static */
+bool wxThreadPoolImpl::CancelTask(const wxTaskPtr& task)
+{
+    if ( !task->LeavePendingState(wxTASK_CANCELLED) )
+        return false;
+
+    task->m_func = nullptr;
+
+    OnTaskDone(task, wxTASK_CANCELLED);
+
+    return true;
+}
+
+/* static */
+void wxThreadPoolImpl::OnTaskDone(const wxTaskPtr& task, wxTaskState state)
+{
+    std::vector<wxTaskPtr> continuations;
+    {
+        wxCRIT_SECT_LOCKER(lock, task->m_csConts);
+
+        task->m_state = state;
+        continuations.swap(task->m_continuations);
+    }
+
+    wxThreadPoolImpl* const pool = task->m_pool.get();
+
+    if ( !task->m_runInMainThread )
+        pool->m_outstanding--;
+
+    pool->NotifyWaiters();
+
+    for ( const auto& cont : continuations )
+    {
+        if ( state == wxTASK_COMPLETED )
+            pool->Launch(cont);
+        else
+            CancelTask(cont);
+    }
+}
+
+void wxThreadPoolImpl::NotifyWaiters()
+{
+    // The waiting threads increment m_waiters before checking their
+    // condition, so either we see it here or they see the changed state.
+    if ( m_waiters.load() > 0 )
+    {
+        wxMutexLocker lock(m_waitMutex);
+        m_waitCond.Broadcast();
+    }
+}
+
+template <typename Predicate>
+bool wxThreadPoolImpl::WaitUntil(const Predicate& predicate, long timeout)
+{
+    if ( predicate() )
+        return true;
+
+    // Waiting in a pool thread would block it and could result in a deadlock
+    // if all pool threads were waiting, so execute the other tasks instead.
+    wxThreadPoolWorker* const worker = gs_currentWorker;
+    if ( worker && worker->GetPool() == this )
+    {
+        const wxMilliClock_t start = wxGetLocalTimeMillis();
+        while ( !predicate() )
+        {
+            unsigned long wait = WORKER_WAIT_INTERVAL;
+            if ( timeout >= 0 )
+            {
+                const wxMilliClock_t elapsed = wxGetLocalTimeMillis() - start;
+                if ( elapsed >= timeout )
+                    return false;
+
+                wait = wxMin(wait, (timeout - elapsed).GetLo());
+            }
+
+            if ( RunOneTask(worker) )
+                continue;
+
+            // There is nothing to do, so block until some task completes,
+            // which could be the one we're waiting for, but not for long as
+            // new tasks could be queued in the meanwhile.
+            wxMutexLocker lock(m_waitMutex);
+
+            m_waiters++;
+
+            if ( !predicate() )
+                m_waitCond.WaitTimeout(wait);
+
+            m_waiters--;
+        }
+
+        return true;
+    }
+
+    wxMutexLocker lock(m_waitMutex);
+
+    m_waiters++;
+
+    bool ok = true;
+    if ( timeout < 0 )
+    {
+        while ( !predicate() )
+            m_waitCond.Wait();
+    }
+    else
+    {
+        const wxMilliClock_t end = wxGetLocalTimeMillis() + timeout;
+        while ( !predicate() )
+        {
+            const wxMilliClock_t now = wxGetLocalTimeMillis();
+            if ( now >= end )
+            {
+                ok = false;
+                break;
+            }
+
+            m_waitCond.WaitTimeout((end - now).GetLo());
+        }
+    }
+
+    m_waiters--;
+
+    return ok;
+}
+
+// ----------------------------------------------------------------------------
+// wxTask
+// ----------------------------------------------------------------------------
+
+wxTaskState wxTask::GetState() const
+{
+    wxCHECK_MSG( m_impl, wxTASK_CANCELLED, "invalid task" );
+
+    return m_impl->GetState();
+}
+
+bool wxTask::IsDone() const
+{
+    wxCHECK_MSG( m_impl, true, "invalid task" );
+
+    return m_impl->IsDone();
+}
+
+bool wxTask::Cancel()
+{
+    wxCHECK_MSG( m_impl, false, "invalid task" );
+
+    m_impl->m_cancelRequested = true;
+
+    return wxThreadPoolImpl::CancelTask(m_impl);
+}
+
+bool wxTask::IsCancelRequested() const
+{
+    wxCHECK_MSG( m_impl, false, "invalid task" );
+
+    return m_impl->m_cancelRequested;
+}
+
+void wxTask::Wait() const
+{
+    wxCHECK_RET( m_impl, "invalid task" );
+
+    wxTaskImpl* const impl = m_impl.get();
+    impl->m_pool->WaitUntil([impl]() { return impl->IsDone(); });
+}
+
+bool wxTask::WaitTimeout(unsigned long milliseconds) const
+{
+    wxCHECK_MSG( m_impl, true, "invalid task" );
+
+    wxTaskImpl* const impl = m_impl.get();
+    return impl->m_pool->WaitUntil([impl]() { return impl->IsDone(); },
+                                   static_cast<long>(milliseconds));
+}
+
+namespace
+{
+
+wxTaskPtr
+AddContinuation(const wxTaskPtr& task,
+                const std::function<void()>& func,
+                wxTaskPriority priority,
+                bool runInMainThread)
+{
+    wxThreadPoolImpl* const pool = task->m_pool.get();
+
+    wxTaskPtr cont = pool->CreateTask(func, priority, runInMainThread);
+    if ( !cont )
+        return cont;
+
+    wxTaskState state;
+    {
+        wxCRIT_SECT_LOCKER(lock, task->m_csConts);
+
+        state = task->GetState();
+        if ( state == wxTASK_PENDING || state == wxTASK_RUNNING )
+        {
+            task->m_continuations.push_back(cont);
+            return cont;
+        }
+    }
+
+    // The task is already done, so launch or cancel the continuation now.
+    if ( state == wxTASK_COMPLETED )
+        pool->Launch(cont);
+    else
+        wxThreadPoolImpl::CancelTask(cont);
+
+    return cont;
+}
+
+} // anonymous namespace
+
+wxTask wxTask::Then(const std::function<void()>& func, wxTaskPriority priority)
+{
+    wxCHECK_MSG( m_impl, wxTask(), "invalid task" );
+
+    return wxTask(AddContinuation(m_impl, func, priority, false));
+}
+
+wxTask wxTask::ThenInMainThread(const std::function<void()>& func)
+{
+    wxCHECK_MSG( m_impl, wxTask(), "invalid task" );
+
+    return wxTask(AddContinuation(m_impl, func, wxTASK_PRIORITY_NORMAL, true));
+}
+
+// ----------------------------------------------------------------------------
+// wxThreadPool
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+wxCRIT_SECT_DECLARE(gs_csDefaultPool);
+wxThreadPool* gs_defaultPool = nullptr;
+
+} // anonymous namespace
+
+wxThreadPool::wxThreadPool(unsigned numThreads)
+    : m_impl(std::make_shared<wxThreadPoolImpl>())
+{
+    if ( !numThreads )
+    {
+        const int numCPUs = wxThread::GetCPUCount();
+        numThreads = numCPUs > 0 ? static_cast<unsigned>(numCPUs) : 1;
+    }
+
+    m_impl->Start(numThreads);
+}
+
+wxThreadPool::~wxThreadPool()
+{
+    m_impl->Shutdown();
+}
+
+/* static */
+wxThreadPool& wxThreadPool::Get()
+{
+    wxCRIT_SECT_LOCKER(lock, gs_csDefaultPool);
+
+    if ( !gs_defaultPool )
+        gs_defaultPool = new wxThreadPool();
+
+    return *gs_defaultPool;
+}
+
+unsigned wxThreadPool::GetThreadCount() const
+{
+    return m_impl->GetThreadCount();
+}
+
+wxTask
+wxThreadPool::Submit(const std::function<void()>& func, wxTaskPriority priority)
+{
+    wxTaskPtr task = m_impl->CreateTask(func, priority);
+    if ( task )
+        m_impl->Launch(task);
+
+    return wxTask(task);
+}
+
+void wxThreadPool::WaitAll()
+{
+    m_impl->WaitAll();
+}
+
+/* static */
+bool wxThreadPool::IsCancelRequested()
+{
+    const wxTaskImpl* const task = gs_currentTask;
+
+    return task && task->m_cancelRequested;
+}
+
+// ----------------------------------------------------------------------------
+// wxThreadPoolModule: destroys the global pool on shutdown
+// ----------------------------------------------------------------------------
+
+class wxThreadPoolModule : public wxModule
+{
+public:
+    wxThreadPoolModule() = default;
+
+    virtual bool OnInit() override { return true; }
+    virtual void OnExit() override
+    {
+        wxCRIT_SECT_LOCKER(lock, gs_csDefaultPool);
+
+        delete gs_defaultPool;
+        gs_defaultPool = nullptr;
+    }
+
+private:
+    wxDECLARE_DYNAMIC_CLASS(wxThreadPoolModule);
+};
+
+wxIMPLEMENT_DYNAMIC_CLASS(wxThreadPoolModule, wxModule);
+
+#endif // wxUSE_THREADS
@@ -36,6 +36,10 @@
     #include "wx/wxcrtvararg.h"
 #endif // WX_PRECOMP
 
+#include "wx/time.h"
+
+#include <memory>
+
 #if wxUSE_LOGGUI || wxUSE_LOGWINDOW
 
 #include "wx/file.h"
@@ -62,8 +66,6 @@
     #include "wx/image.h"
 #endif // wxUSE_LOG_DIALOG/!wxUSE_LOG_DIALOG
 
-#include "wx/time.h"
-
 #define CAN_SAVE_FILES (wxUSE_FILE && wxUSE_FILEDLG)
 
 // ----------------------------------------------------------------------------
@@ -492,7 +494,18 @@ public:
     // do show the message in the text control
     void ShowLogMessage(const wxString& message)
     {
-        m_pTextCtrl->AppendText(message + wxS('\n'));
+        m_textLog->LogText(message);
+    }
+
+    // append the messages shown since the last call to the text control
+    void FlushLogMessages()
+    {
+        m_textLog->Flush();
+    }
+
+    void SetMaxLines(int maxLines)
+    {
+        m_textLog->SetMaxLines(maxLines);
     }
 
 private:
@@ -510,6 +523,10 @@ private:
     wxTextCtrl  *m_pTextCtrl;
     wxLogWindow *m_log;
 
+    // the helper used for appending the messages to m_pTextCtrl, it is not
+    // used as a log target on its own
+    std::unique_ptr<wxLogTextCtrl> m_textLog;
+
     wxDECLARE_EVENT_TABLE();
     wxDECLARE_NO_COPY_CLASS(wxLogFrame);
 };
@@ -541,6 +558,8 @@ wxLogFrame::wxLogFrame(wxWindow *pParent, wxLogWindow *log, const wxString& szTi
             wxTE_RICH       |
             wxTE_READONLY);
 
+    m_textLog.reset(new wxLogTextCtrl(m_pTextCtrl));
+
 #if wxUSE_MENUS
     // create menu
     wxMenuBar *pMenuBar = new wxMenuBar;
@@ -595,6 +614,9 @@ void wxLogFrame::OnSave(wxCommandEvent& WXUNUSED(event))
 
     bool bOk = rc != 0;
 
+    // ensure that the messages logged since the last flush are saved too
+    FlushLogMessages();
+
     // retrieve text and save it
     // -------------------------
     int nLines = m_pTextCtrl->GetNumberOfLines();
@@ -667,6 +689,20 @@ void wxLogWindow::DoLogTextAtLevel(wxLogLevel level, const wxString& msg)
     m_pLogFrame->ShowLogMessage(msg);
 }
 
+void wxLogWindow::SetMaxLines(int maxLines)
+{
+    if ( m_pLogFrame )
+        m_pLogFrame->SetMaxLines(maxLines);
+}
+
+void wxLogWindow::Flush()
+{
+    wxLogPassThrough::Flush();
+
+    if ( m_pLogFrame )
+        m_pLogFrame->FlushLogMessages();
+}
+
 wxFrame *wxLogWindow::GetFrame() const
 {
     return m_pLogFrame;
@@ -1065,14 +1101,159 @@ static int OpenLogFile(wxFile& file, wxString *pFilename, wxWindow *parent)
 // wxLogTextCtrl implementation
 // ----------------------------------------------------------------------------
 
+namespace
+{
+
+// the interval between the updates of the control when the log is not being
+// flushed, e.g. because the messages are logged from a long running loop
+const wxLongLong_t wxLOG_TEXT_UPDATE_INTERVAL_MS = 100;
+
+// the maximal number of lines kept while the output is paused if there is no
+// limit on the number of lines in the control: when it is exceeded, the
+// messages are appended to the control even if it's scrolled
+const int wxLOG_TEXT_MAX_PAUSED_LINES = 10000;
+
+} // anonymous namespace
+
 wxLogTextCtrl::wxLogTextCtrl(wxTextCtrl *pTextCtrl)
 {
     m_pTextCtrl = pTextCtrl;
+
+    wxCHECK_RET( m_pTextCtrl, wxS("text control must be non-null") );
+
+    // we need to know when the control is destroyed to avoid using it after
+    // this happens, as the pending messages may be flushed later
+    m_pTextCtrl->Bind(wxEVT_DESTROY, &wxLogTextCtrl::OnTextCtrlDestroy, this);
+}
+
+wxLogTextCtrl::~wxLogTextCtrl()
+{
+    if ( m_pTextCtrl )
+    {
+        m_pauseOnScroll = false;
+        AppendPending();
+
+        m_pTextCtrl->Unbind(wxEVT_DESTROY,
+                            &wxLogTextCtrl::OnTextCtrlDestroy, this);
+    }
+}
+
+void wxLogTextCtrl::OnTextCtrlDestroy(wxWindowDestroyEvent& event)
+{
+    event.Skip();
+
+    if ( event.GetEventObject() == m_pTextCtrl )
+    {
+        m_pTextCtrl = nullptr;
+        m_pending.clear();
+        m_pendingLines = 0;
+    }
+}
+
+void wxLogTextCtrl::EnableBatching(bool enable)
+{
+    m_batching = enable;
+
+    if ( !m_batching )
+        AppendPending();
 }
 
 void wxLogTextCtrl::DoLogText(const wxString& msg)
 {
-    m_pTextCtrl->AppendText(msg + wxS('\n'));
+    if ( !m_pTextCtrl )
+        return;
+
+    m_pending << msg << wxS('\n');
+    m_pendingLines += 1 + static_cast<int>(msg.Freq(wxS('\n')));
+
+    if ( m_maxLines && m_pendingLines > m_maxLines )
+        TrimPending();
+
+    // appending the messages one by one is slow as it updates the control
+    // and scrolls it every time, so only do it when the log is flushed (which
+    // normally happens during the next idle time), unless batching is
+    // disabled or the log hasn't been flushed for some time
+    if ( !m_batching ||
+            wxGetUTCTimeMillis().GetValue() - m_lastAppendMS >=
+                wxLOG_TEXT_UPDATE_INTERVAL_MS )
+    {
+        AppendPending();
+    }
+}
+
+void wxLogTextCtrl::Flush()
+{
+    wxLog::Flush();
+
+    AppendPending();
+}
+
+void wxLogTextCtrl::AppendPending()
+{
+    if ( !m_pTextCtrl || m_pending.empty() )
+        return;
+
+    // if the user scrolled the control to look at the previous messages,
+    // don't disturb them by appending the new ones, which would scroll it to
+    // the end again, and keep them until the control is scrolled back, unless
+    // there are too many of them (if there is a limit on the number of lines,
+    // the pending text is already trimmed to it)
+    if ( m_pauseOnScroll &&
+            m_pendingLines <= wxLOG_TEXT_MAX_PAUSED_LINES &&
+                !IsScrolledToEnd() )
+        return;
+
+    m_lastAppendMS = wxGetUTCTimeMillis().GetValue();
+
+    m_pTextCtrl->AppendText(m_pending);
+
+    m_pending.clear();
+    m_pendingLines = 0;
+
+    if ( m_maxLines )
+        TrimControl();
+}
+
+void wxLogTextCtrl::TrimPending()
+{
+    // skip the extra lines at the beginning
+    int toSkip = m_pendingLines - m_maxLines;
+
+    size_t pos = 0;
+    while ( toSkip-- )
+        pos = m_pending.find(wxS('\n'), pos) + 1;
+
+    m_pending.erase(0, pos);
+    m_pendingLines = m_maxLines;
+}
+
+void wxLogTextCtrl::TrimControl()
+{
+    // the last line of the control is always empty because each message is
+    // followed by a new line, so don't count it
+    const int numLines = m_pTextCtrl->GetNumberOfLines() - 1;
+    if ( numLines <= m_maxLines )
+        return;
+
+    // remove all the extra lines at once
+    const long end = m_pTextCtrl->XYToPosition(0, numLines - m_maxLines);
+    if ( end > 0 )
+        m_pTextCtrl->Remove(0, end);
+}
+
+bool wxLogTextCtrl::IsScrolledToEnd() const
+{
+    const int range = m_pTextCtrl->GetScrollRange(wxVERTICAL);
+    if ( !range )
+    {
+        // no scrollbar or scrolling information is not available
+        return true;
+    }
+
+    // allow for a small difference as the scroll position may not be exactly
+    // at the end even when the control is scrolled as far as possible
+    return m_pTextCtrl->GetScrollPos(wxVERTICAL) +
+            m_pTextCtrl->GetScrollThumb(wxVERTICAL) >= range - 1;
 }
 
 #endif // wxUSE_LOG && wxUSE_TEXTCTRL
@@ -282,6 +282,77 @@ wxMutexError wxMutexInternal::Unlock()
     return wxMUTEX_NO_ERROR;
 }
 
+// --------------------------------------------------------------------------
+// wxSharedMutex
+// --------------------------------------------------------------------------
+
+// a trivial wrapper around Win32 slim reader/writer lock, which can't fail
+// and doesn't detect any errors
+class wxSharedMutexInternal
+{
+public:
+    wxSharedMutexInternal() { ::InitializeSRWLock(&m_lock); }
+
+    bool IsOk() const { return true; }
+
+    wxMutexError Lock()
+    {
+        ::AcquireSRWLockExclusive(&m_lock);
+        return wxMUTEX_NO_ERROR;
+    }
+
+    wxMutexError TryLock()
+    {
+        return ::TryAcquireSRWLockExclusive(&m_lock) ? wxMUTEX_NO_ERROR
+                                                     : wxMUTEX_BUSY;
+    }
+
+    wxMutexError Unlock()
+    {
+        ::ReleaseSRWLockExclusive(&m_lock);
+        return wxMUTEX_NO_ERROR;
+    }
+
+    wxMutexError LockShared()
+    {
+        ::AcquireSRWLockShared(&m_lock);
+        return wxMUTEX_NO_ERROR;
+    }
+
+    wxMutexError TryLockShared()
+    {
+        return ::TryAcquireSRWLockShared(&m_lock) ? wxMUTEX_NO_ERROR
+                                                  : wxMUTEX_BUSY;
+    }
+
+    wxMutexError UnlockShared()
+    {
+        ::ReleaseSRWLockShared(&m_lock);
+        return wxMUTEX_NO_ERROR;
+    }
+
+private:
+    SRWLOCK m_lock;
+
+    wxDECLARE_NO_COPY_CLASS(wxSharedMutexInternal);
+};
+
+// --------------------------------------------------------------------------
+// wxSpinMutex
+// --------------------------------------------------------------------------
+
+// WaitOnAddress() is not available in Windows 7, so just give up the time
+// slice while waiting.
+void wxSpinMutex::WaitWhileContended()
+{
+    if ( m_state.load(std::memory_order_relaxed) == State_Contended )
+        ::SwitchToThread();
+}
+
+void wxSpinMutex::WakeWaiter()
+{
+}
+
 // --------------------------------------------------------------------------
 // wxSemaphore
 // --------------------------------------------------------------------------
@@ -1262,6 +1333,195 @@ unsigned int wxThread::GetPriority() const
     return m_internal->GetPriority();
 }
 
+// scheduling and statistics
+// -------------------------
+
+namespace
+{
+
+bool DoSetAffinity(HANDLE hThread, const std::vector<int>& cpus)
+{
+    wxCHECK_MSG( !cpus.empty(), false, wxT("at least one CPU must be given") );
+
+    DWORD_PTR mask = 0;
+    for ( auto cpu : cpus )
+    {
+        // Only the CPUs in the current processor group can be used.
+        wxCHECK_MSG( cpu >= 0 && cpu < int(sizeof(DWORD_PTR)*8), false,
+                     wxT("invalid CPU index") );
+
+        mask |= DWORD_PTR(1) << cpu;
+    }
+
+    if ( !::SetThreadAffinityMask(hThread, mask) )
+    {
+        wxLogSysError(_("Failed to set thread CPU affinity"));
+        return false;
+    }
+
+    return true;
+}
+
+bool DoGetAffinity(HANDLE hThread, std::vector<int>& cpus)
+{
+    // There is no function to query the thread affinity mask, but setting it
+    // returns the old one, so set it to the process mask and restore it.
+    DWORD_PTR maskProcess, maskSystem;
+    if ( !::GetProcessAffinityMask(::GetCurrentProcess(),
+                                   &maskProcess, &maskSystem) )
+    {
+        wxLogSysError(_("Failed to get thread CPU affinity"));
+        return false;
+    }
+
+    const DWORD_PTR mask = ::SetThreadAffinityMask(hThread, maskProcess);
+    if ( !mask )
+    {
+        wxLogSysError(_("Failed to get thread CPU affinity"));
+        return false;
+    }
+
+    ::SetThreadAffinityMask(hThread, mask);
+
+    cpus.clear();
+    for ( int cpu = 0; cpu < int(sizeof(DWORD_PTR)*8); cpu++ )
+    {
+        if ( mask & (DWORD_PTR(1) << cpu) )
+            cpus.push_back(cpu);
+    }
+
+    return true;
+}
+
+// Windows doesn't have scheduling policies, so map them to the thread
+// priorities as well as possible.
+bool DoSetSchedPolicy(HANDLE hThread, wxThreadSchedPolicy policy, int priority)
+{
+    int win_priority = THREAD_PRIORITY_NORMAL;
+    switch ( policy )
+    {
+        case wxTHREAD_SCHED_DEFAULT:
+            break;
+
+        case wxTHREAD_SCHED_BATCH:
+            win_priority = THREAD_PRIORITY_BELOW_NORMAL;
+            break;
+
+        case wxTHREAD_SCHED_IDLE:
+            win_priority = THREAD_PRIORITY_IDLE;
+            break;
+
+        case wxTHREAD_SCHED_FIFO:
+            win_priority = THREAD_PRIORITY_TIME_CRITICAL;
+            break;
+
+        case wxTHREAD_SCHED_RR:
+            win_priority = THREAD_PRIORITY_HIGHEST;
+            break;
+    }
+
+    wxUnusedVar(priority);
+
+    if ( !::SetThreadPriority(hThread, win_priority) )
+    {
+        wxLogSysError(_("Failed to set thread scheduling policy"));
+        return false;
+    }
+
+    return true;
+}
+
+bool DoGetCPUStats(HANDLE hThread, wxThreadCPUStats& stats)
+{
+    FILETIME ftCreation, ftExit, ftKernel, ftUser;
+    if ( !::GetThreadTimes(hThread, &ftCreation, &ftExit, &ftKernel, &ftUser) )
+    {
+        wxLogSysError(_("Failed to get thread CPU usage"));
+        return false;
+    }
+
+    // FILETIME values are in 100ns units.
+    const auto toMicroseconds = [](const FILETIME& ft)
+    {
+        return ((wxUint64(ft.dwHighDateTime) << 32) | ft.dwLowDateTime) / 10;
+    };
+
+    stats.userTime = toMicroseconds(ftUser);
+    stats.systemTime = toMicroseconds(ftKernel);
+
+    // The number of context switches is not available via public API.
+    stats.voluntarySwitches =
+    stats.involuntarySwitches = 0;
+
+    return true;
+}
+
+} // anonymous namespace
+
+bool wxThread::SetAffinity(const std::vector<int>& cpus)
+{
+    wxCriticalSectionLocker lock(m_critsect);
+
+    wxCHECK_MSG( m_internal->GetHandle(), false,
+                 wxT("thread must be created first") );
+
+    return DoSetAffinity(m_internal->GetHandle(), cpus);
+}
+
+bool wxThread::GetAffinity(std::vector<int>& cpus) const
+{
+    wxCriticalSectionLocker lock(const_cast<wxCriticalSection &>(m_critsect));
+
+    wxCHECK_MSG( m_internal->GetHandle(), false,
+                 wxT("thread must be created first") );
+
+    return DoGetAffinity(m_internal->GetHandle(), cpus);
+}
+
+bool wxThread::SetSchedPolicy(wxThreadSchedPolicy policy, int priority)
+{
+    wxCriticalSectionLocker lock(m_critsect);
+
+    wxCHECK_MSG( m_internal->GetHandle(), false,
+                 wxT("thread must be created first") );
+
+    return DoSetSchedPolicy(m_internal->GetHandle(), policy, priority);
+}
+
+bool wxThread::GetCPUStats(wxThreadCPUStats& stats) const
+{
+    wxCriticalSectionLocker lock(const_cast<wxCriticalSection &>(m_critsect));
+
+    wxCHECK_MSG( m_internal->GetHandle(), false,
+                 wxT("thread must be created first") );
+
+    return DoGetCPUStats(m_internal->GetHandle(), stats);
+}
+
+/* static */
+bool wxThread::SetAffinityForCurrent(const std::vector<int>& cpus)
+{
+    return DoSetAffinity(::GetCurrentThread(), cpus);
+}
+
+/* static */
+bool wxThread::GetAffinityForCurrent(std::vector<int>& cpus)
+{
+    return DoGetAffinity(::GetCurrentThread(), cpus);
+}
+
+/* static */
+bool wxThread::SetSchedPolicyForCurrent(wxThreadSchedPolicy policy, int priority)
+{
+    return DoSetSchedPolicy(::GetCurrentThread(), policy, priority);
+}
+
+/* static */
+bool wxThread::GetCPUStatsForCurrent(wxThreadCPUStats& stats)
+{
+    return DoGetCPUStats(::GetCurrentThread(), stats);
+}
+
 unsigned long wxThread::GetId() const
 {
     wxCriticalSectionLocker lock(const_cast<wxCriticalSection &>(m_critsect));
@@ -0,0 +1,1047 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        src/unix/elfsymbols.cpp
+// Purpose:     In-process reader of ELF symbols and DWARF line information
+// Author:      wxWidgets team
+// Created:     2026-10-19
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+// ============================================================================
+// declarations
+// ============================================================================
+
+// ----------------------------------------------------------------------------
+// headers
+// ----------------------------------------------------------------------------
+
+// for compilers that support precompilation, includes "wx.h".
+#include "wx/wxprec.h"
+
+#ifndef WX_PRECOMP
+    #include "wx/string.h"
+#endif
+
+#include "wx/unix/private/elfsymbols.h"
+
+#ifdef wxHAS_ELF_SYMBOLS
+
+#include "wx/thread.h"
+
+#include <algorithm>
+
+#include <fcntl.h>
+#include <link.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifdef HAVE_CXA_DEMANGLE
+    #include <cxxabi.h>
+#endif // HAVE_CXA_DEMANGLE
+
+// ----------------------------------------------------------------------------
+// constants
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+// DWARF constants used when parsing .debug_line section: we don't use the
+// system <dwarf.h> as it is not always available.
+enum
+{
+    // Standard opcodes.
+    DW_LNS_copy = 1,
+    DW_LNS_advance_pc = 2,
+    DW_LNS_advance_line = 3,
+    DW_LNS_set_file = 4,
+    DW_LNS_const_add_pc = 8,
+    DW_LNS_fixed_advance_pc = 9,
+
+    // Extended opcodes.
+    DW_LNE_end_sequence = 1,
+    DW_LNE_set_address = 2,
+
+    // Line table entry content types (DWARF 5).
+    DW_LNCT_path = 1,
+    DW_LNCT_directory_index = 2,
+
+    // Attribute forms that can be used in the line table header (DWARF 5).
+    DW_FORM_block = 0x09,
+    DW_FORM_data1 = 0x0b,
+    DW_FORM_data2 = 0x05,
+    DW_FORM_data4 = 0x06,
+    DW_FORM_data8 = 0x07,
+    DW_FORM_data16 = 0x1e,
+    DW_FORM_line_strp = 0x1f,
+    DW_FORM_string = 0x08,
+    DW_FORM_strp = 0x0e,
+    DW_FORM_udata = 0x0f
+};
+
+// Used for the rows referencing a non-existent file.
+const wxUint32 NO_FILE = static_cast<wxUint32>(-1);
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------------
+// wxElfFile: read-only memory mapped ELF file
+// ----------------------------------------------------------------------------
+
+class wxElfFile
+{
+public:
+    explicit wxElfFile(const char* path);
+    ~wxElfFile();
+
+    bool IsOk() const { return m_data != nullptr; }
+
+    // Return the section with the given name or type or null if none.
+    const ElfW(Shdr)* FindSection(const char* name) const;
+    const ElfW(Shdr)* FindSectionByType(unsigned type) const;
+
+    // Return the section with the given index or null if it's invalid.
+    const ElfW(Shdr)* GetSection(size_t index) const
+    {
+        return index < m_numSections ? &m_sections[index] : nullptr;
+    }
+
+    // Get the contents of the section: returns false if it is empty or can't
+    // be used, e.g. because it is compressed.
+    bool GetData(const ElfW(Shdr)* sh,
+                 const wxUint8** start,
+                 const wxUint8** end) const;
+
+    // Return NUL-terminated string at the given offset in the section or
+    // null if the offset is invalid.
+    const char* GetString(const ElfW(Shdr)* sh, wxUint64 offset) const;
+
+    // Return the string referenced by DW_FORM_strp or DW_FORM_line_strp.
+    const char* GetDwarfString(unsigned form, wxUint64 offset) const
+    {
+        return GetString(form == DW_FORM_line_strp ? m_debugLineStr
+                                                   : m_debugStr,
+                         offset);
+    }
+
+private:
+    // Check the header and initialize the sections pointers.
+    bool Init();
+
+    void* m_data = nullptr;
+    size_t m_size = 0;
+
+    const ElfW(Shdr)* m_sections = nullptr;
+    size_t m_numSections = 0;
+
+    const ElfW(Shdr)* m_sectionNames = nullptr;
+
+    // String sections used by DWARF 5 line tables, may be null.
+    const ElfW(Shdr)* m_debugStr = nullptr;
+    const ElfW(Shdr)* m_debugLineStr = nullptr;
+
+    wxDECLARE_NO_COPY_CLASS(wxElfFile);
+};
+
+wxElfFile::wxElfFile(const char* path)
+{
+    const int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if ( fd == -1 )
+        return;
+
+    struct stat st;
+    if ( fstat(fd, &st) == 0 &&
+            S_ISREG(st.st_mode) &&
+                static_cast<size_t>(st.st_size) >= sizeof(ElfW(Ehdr)) )
+    {
+        void* const data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if ( data != MAP_FAILED )
+        {
+            m_data = data;
+            m_size = st.st_size;
+        }
+    }
+
+    close(fd);
+
+    if ( m_data && !Init() )
+    {
+        munmap(m_data, m_size);
+        m_data = nullptr;
+    }
+}
+
+wxElfFile::~wxElfFile()
+{
+    if ( m_data )
+        munmap(m_data, m_size);
+}
+
+bool wxElfFile::Init()
+{
+    const ElfW(Ehdr)* const eh = static_cast<const ElfW(Ehdr)*>(m_data);
+
+    // We only need to handle the files which can be loaded into our process,
+    // so don't bother with the other classes or byte orders.
+    if ( memcmp(eh->e_ident, ELFMAG, SELFMAG) != 0 ||
+            eh->e_ident[EI_CLASS] != (sizeof(void*) == 8 ? ELFCLASS64
+                                                         : ELFCLASS32) ||
+                eh->e_ident[EI_DATA] != (wxBYTE_ORDER == wxLITTLE_ENDIAN
+                                            ? ELFDATA2LSB : ELFDATA2MSB) )
+        return false;
+
+    if ( eh->e_shentsize != sizeof(ElfW(Shdr)) ||
+            !eh->e_shoff ||
+                eh->e_shoff > m_size - sizeof(ElfW(Shdr)) )
+        return false;
+
+    m_sections = reinterpret_cast<const ElfW(Shdr)*>
+                 (
+                    static_cast<const wxUint8*>(m_data) + eh->e_shoff
+                 );
+
+    // If the number of sections doesn't fit into the header, it is stored in
+    // the size of the first section.
+    m_numSections = eh->e_shnum ? eh->e_shnum : m_sections[0].sh_size;
+    if ( m_numSections > (m_size - eh->e_shoff) / sizeof(ElfW(Shdr)) )
+        return false;
+
+    // And the same is done for the index of section names section.
+    m_sectionNames = GetSection(eh->e_shstrndx == SHN_XINDEX
+                                    ? m_sections[0].sh_link
+                                    : eh->e_shstrndx);
+    if ( !m_sectionNames )
+        return false;
+
+    m_debugStr = FindSection(".debug_str");
+    m_debugLineStr = FindSection(".debug_line_str");
+
+    return true;
+}
+
+const ElfW(Shdr)* wxElfFile::FindSection(const char* name) const
+{
+    for ( size_t n = 0; n < m_numSections; n++ )
+    {
+        const char* const
+            sectionName = GetString(m_sectionNames, m_sections[n].sh_name);
+        if ( sectionName && strcmp(sectionName, name) == 0 )
+            return &m_sections[n];
+    }
+
+    return nullptr;
+}
+
+const ElfW(Shdr)* wxElfFile::FindSectionByType(unsigned type) const
+{
+    for ( size_t n = 0; n < m_numSections; n++ )
+    {
+        if ( m_sections[n].sh_type == type )
+            return &m_sections[n];
+    }
+
+    return nullptr;
+}
+
+bool wxElfFile::GetData(const ElfW(Shdr)* sh,
+                        const wxUint8** start,
+                        const wxUint8** end) const
+{
+    // Compressed sections are not supported, addr2line will be used for the
+    // modules using them.
+    if ( !sh || sh->sh_type == SHT_NOBITS || (sh->sh_flags & SHF_COMPRESSED) )
+        return false;
+
+    if ( !sh->sh_size ||
+            sh->sh_offset > m_size ||
+                sh->sh_size > m_size - sh->sh_offset )
+        return false;
+
+    *start = static_cast<const wxUint8*>(m_data) + sh->sh_offset;
+    *end = *start + sh->sh_size;
+
+    return true;
+}
+
+const char* wxElfFile::GetString(const ElfW(Shdr)* sh, wxUint64 offset) const
+{
+    const wxUint8 *start,
+                  *end;
+    if ( !GetData(sh, &start, &end) || offset >= static_cast<size_t>(end - start) )
+        return nullptr;
+
+    const char* const str = reinterpret_cast<const char*>(start + offset);
+
+    // Don't trust the section contents to be NUL-terminated.
+    if ( !memchr(str, '\0', end - start - offset) )
+        return nullptr;
+
+    return str;
+}
+
+// ----------------------------------------------------------------------------
+// wxDwarfReader: helper for reading DWARF data
+// ----------------------------------------------------------------------------
+
+// All the functions of this class check that they don't read beyond the end
+// of the data, and switch the reader into the error state if they would.
+class wxDwarfReader
+{
+public:
+    wxDwarfReader(const wxUint8* start, const wxUint8* end)
+        : m_ptr(start),
+          m_end(end)
+    {
+    }
+
+    bool IsOk() const { return m_ok; }
+    bool AtEnd() const { return m_ptr == m_end; }
+
+    const wxUint8* GetPtr() const { return m_ptr; }
+    const wxUint8* GetEnd() const { return m_end; }
+    size_t GetRemaining() const { return m_end - m_ptr; }
+
+    bool Skip(wxUint64 len)
+    {
+        if ( len > GetRemaining() )
+            return Fail();
+
+        m_ptr += len;
+        return true;
+    }
+
+    template <typename T>
+    T Read()
+    {
+        T value = 0;
+        if ( sizeof(T) > GetRemaining() )
+        {
+            Fail();
+            return value;
+        }
+
+        memcpy(&value, m_ptr, sizeof(T));
+        m_ptr += sizeof(T);
+
+        return value;
+    }
+
+    wxUint64 ReadOffset(bool is64)
+    {
+        return is64 ? Read<wxUint64>() : Read<wxUint32>();
+    }
+
+    wxUint64 ReadAddress(wxUint64 size)
+    {
+        switch ( size )
+        {
+            case 4:
+                return Read<wxUint32>();
+
+            case 8:
+                return Read<wxUint64>();
+        }
+
+        Fail();
+        return 0;
+    }
+
+    wxUint64 ReadULEB128()
+    {
+        wxUint64 value = 0;
+        for ( unsigned shift = 0; ; shift += 7 )
+        {
+            if ( AtEnd() )
+            {
+                Fail();
+                return 0;
+            }
+
+            const wxUint8 byte = *m_ptr++;
+            if ( shift < 64 )
+                value |= static_cast<wxUint64>(byte & 0x7f) << shift;
+
+            if ( !(byte & 0x80) )
+                break;
+        }
+
+        return value;
+    }
+
+    wxInt64 ReadSLEB128()
+    {
+        wxUint64 value = 0;
+        unsigned shift = 0;
+        wxUint8 byte;
+        do
+        {
+            if ( AtEnd() )
+            {
+                Fail();
+                return 0;
+            }
+
+            byte = *m_ptr++;
+            if ( shift < 64 )
+                value |= static_cast<wxUint64>(byte & 0x7f) << shift;
+            shift += 7;
+        } while ( byte & 0x80 );
+
+        // Sign extend the value if necessary.
+        if ( shift < 64 && (byte & 0x40) )
+            value |= ~static_cast<wxUint64>(0) << shift;
+
+        return static_cast<wxInt64>(value);
+    }
+
+    const char* ReadString()
+    {
+        const void* const nul = memchr(m_ptr, '\0', GetRemaining());
+        if ( !nul )
+        {
+            Fail();
+            return "";
+        }
+
+        const char* const str = reinterpret_cast<const char*>(m_ptr);
+        m_ptr = static_cast<const wxUint8*>(nul) + 1;
+
+        return str;
+    }
+
+private:
+    bool Fail()
+    {
+        m_ok = false;
+        m_ptr = m_end;
+
+        return false;
+    }
+
+    const wxUint8* m_ptr;
+    const wxUint8* const m_end;
+    bool m_ok = true;
+};
+
+// ----------------------------------------------------------------------------
+// helper functions
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+// Directory or file name entry in DWARF 5 line table header.
+struct LineTableEntry
+{
+    const char* path = "";
+    wxUint64 dirIndex = 0;
+};
+
+// Read the directories or file names table in DWARF 5 line table header.
+bool
+ReadLineTableEntries(wxDwarfReader& unit,
+                     bool is64,
+                     const wxElfFile& file,
+                     std::vector<LineTableEntry>& entries)
+{
+    struct Format
+    {
+        wxUint64 contentType;
+        wxUint64 form;
+    };
+
+    std::vector<Format> formats(unit.Read<wxUint8>());
+    for ( auto& format : formats )
+    {
+        format.contentType = unit.ReadULEB128();
+        format.form = unit.ReadULEB128();
+    }
+
+    const wxUint64 count = unit.ReadULEB128();
+    if ( !unit.IsOk() || count > unit.GetRemaining() )
+        return false;
+
+    entries.resize(count);
+    for ( auto& entry : entries )
+    {
+        for ( const auto& format : formats )
+        {
+            const char* str = nullptr;
+            wxUint64 value = 0;
+
+            switch ( format.form )
+            {
+                case DW_FORM_string:
+                    str = unit.ReadString();
+                    break;
+
+                case DW_FORM_line_strp:
+                case DW_FORM_strp:
+                    str = file.GetDwarfString(format.form, unit.ReadOffset(is64));
+                    if ( !str )
+                        return false;
+                    break;
+
+                case DW_FORM_udata:
+                    value = unit.ReadULEB128();
+                    break;
+
+                case DW_FORM_data1:
+                    value = unit.Read<wxUint8>();
+                    break;
+
+                case DW_FORM_data2:
+                    value = unit.Read<wxUint16>();
+                    break;
+
+                case DW_FORM_data4:
+                    value = unit.Read<wxUint32>();
+                    break;
+
+                case DW_FORM_data8:
+                    value = unit.Read<wxUint64>();
+                    break;
+
+                case DW_FORM_data16:
+                    unit.Skip(16);
+                    break;
+
+                case DW_FORM_block:
+                    unit.Skip(unit.ReadULEB128());
+                    break;
+
+                default:
+                    // Other forms, e.g. DW_FORM_strx, are not supported.
+                    return false;
+            }
+
+            switch ( format.contentType )
+            {
+                case DW_LNCT_path:
+                    if ( str )
+                        entry.path = str;
+                    break;
+
+                case DW_LNCT_directory_index:
+                    entry.dirIndex = value;
+                    break;
+            }
+        }
+    }
+
+    return unit.IsOk();
+}
+
+// Try to find the file with the debug information for a stripped module.
+std::unique_ptr<wxElfFile> OpenDebugFile(const wxElfFile& file, const char* path)
+{
+    std::unique_ptr<wxElfFile> debug;
+
+    const wxUint8 *start,
+                  *end;
+
+    // Use the build ID if possible, as it's the most reliable way.
+    if ( file.GetData(file.FindSection(".note.gnu.build-id"), &start, &end) &&
+            static_cast<size_t>(end - start) > sizeof(ElfW(Nhdr)) )
+    {
+        const ElfW(Nhdr)* const
+            nh = reinterpret_cast<const ElfW(Nhdr)*>(start);
+        const wxUint8* const
+            id = start + sizeof(ElfW(Nhdr)) + ((nh->n_namesz + 3) & ~3u);
+
+        if ( nh->n_type == NT_GNU_BUILD_ID &&
+                nh->n_descsz > 1 &&
+                    id + nh->n_descsz <= end )
+        {
+            std::string debugPath = "/usr/lib/debug/.build-id/";
+            for ( size_t n = 0; n < nh->n_descsz; n++ )
+            {
+                char hex[3];
+                snprintf(hex, sizeof(hex), "%02x", id[n]);
+                debugPath += hex;
+
+                if ( n == 0 )
+                    debugPath += '/';
+            }
+            debugPath += ".debug";
+
+            debug.reset(new wxElfFile(debugPath.c_str()));
+            if ( debug->IsOk() )
+                return debug;
+        }
+    }
+
+    // Otherwise fall back to the debug link, which just contains the name of
+    // the file to look for in the standard locations. Notice that we don't
+    // check its CRC, which would require reading the entire debug file.
+    const ElfW(Shdr)* const sh = file.FindSection(".gnu_debuglink");
+    const char* const name = file.GetString(sh, 0);
+    if ( !name || !*name )
+        return nullptr;
+
+    std::string dir(path);
+    const size_t posSlash = dir.rfind('/');
+    dir.erase(posSlash == std::string::npos ? 0 : posSlash + 1);
+
+    const std::string candidates[] =
+    {
+        dir + name,
+        dir + ".debug/" + name,
+        "/usr/lib/debug/" + dir + name,
+    };
+
+    for ( const auto& candidate : candidates )
+    {
+        // The debug link may have the same name as the file itself if it's
+        // in another directory.
+        if ( candidate == path )
+            continue;
+
+        debug.reset(new wxElfFile(candidate.c_str()));
+        if ( debug->IsOk() )
+            return debug;
+    }
+
+    return nullptr;
+}
+
+wxString DemangleName(const char* name)
+{
+#ifdef HAVE_CXA_DEMANGLE
+    int rc = -1;
+    char* const demangled = __cxxabiv1::__cxa_demangle(name, nullptr, nullptr, &rc);
+    if ( rc == 0 )
+    {
+        const wxString s = wxString::FromUTF8(demangled);
+        free(demangled);
+        return s;
+    }
+#endif // HAVE_CXA_DEMANGLE
+
+    return wxString::FromUTF8(name);
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// wxElfModule implementation
+// ============================================================================
+
+/* static */
+const wxElfModule& wxElfModule::Get(const char* path)
+{
+    wxCRIT_SECT_DECLARE(s_csModules);
+    wxCRIT_SECT_LOCKER(lock, s_csModules);
+
+    static std::unordered_map<std::string, std::unique_ptr<wxElfModule>> s_modules;
+
+    std::unique_ptr<wxElfModule>& module = s_modules[path];
+    if ( !module )
+        module.reset(new wxElfModule(path));
+
+    return *module;
+}
+
+wxElfModule::wxElfModule(const char* path)
+{
+    std::unique_ptr<wxElfFile> file(new wxElfFile(path));
+    if ( !file->IsOk() )
+        return;
+
+    bool symbolsInFile = LoadSymbols(*file, SHT_SYMTAB);
+    bool symbolsInDebug = false;
+
+    // If the module is stripped, its debug file should have both the full
+    // symbol table and the line information.
+    if ( !LoadLines(*file) || !symbolsInFile )
+    {
+        std::unique_ptr<wxElfFile> debug = OpenDebugFile(*file, path);
+        if ( debug )
+        {
+            if ( m_lines.empty() && LoadLines(*debug) )
+                m_hasUnsupportedLines = false;
+
+            if ( !symbolsInFile && LoadSymbols(*debug, SHT_SYMTAB) )
+            {
+                // The symbol names point into it, so it must be kept.
+                m_files.push_back(std::move(debug));
+                symbolsInDebug = true;
+            }
+        }
+    }
+
+    // Dynamic symbols are better than nothing.
+    if ( !symbolsInFile && !symbolsInDebug )
+        symbolsInFile = LoadSymbols(*file, SHT_DYNSYM);
+
+    if ( symbolsInFile )
+        m_files.push_back(std::move(file));
+
+    std::unordered_map<std::string, wxUint32>().swap(m_fileIndices);
+}
+
+wxElfModule::~wxElfModule() = default;
+
+bool wxElfModule::LoadSymbols(const wxElfFile& file, unsigned type)
+{
+    const ElfW(Shdr)* const sh = file.FindSectionByType(type);
+    if ( !sh || sh->sh_entsize != sizeof(ElfW(Sym)) )
+        return false;
+
+    const ElfW(Shdr)* const strtab = file.GetSection(sh->sh_link);
+
+    const wxUint8 *start,
+                  *end;
+    if ( !file.GetData(sh, &start, &end) )
+        return false;
+
+    const ElfW(Sym)* const syms = reinterpret_cast<const ElfW(Sym)*>(start);
+    const size_t count = (end - start) / sizeof(ElfW(Sym));
+    for ( size_t n = 0; n < count; n++ )
+    {
+        const ElfW(Sym)& sym = syms[n];
+
+        // Note that ELF32_ST_TYPE() and ELF64_ST_TYPE() are identical.
+        const unsigned symType = ELF64_ST_TYPE(sym.st_info);
+        if ( symType != STT_FUNC && symType != STT_GNU_IFUNC )
+            continue;
+
+        if ( sym.st_shndx == SHN_UNDEF || !sym.st_value )
+            continue;
+
+        const char* const name = file.GetString(strtab, sym.st_name);
+        if ( !name || !*name )
+            continue;
+
+        m_symbols.push_back({sym.st_value, sym.st_size, name});
+    }
+
+    std::sort(m_symbols.begin(), m_symbols.end(),
+              [](const Symbol& s1, const Symbol& s2)
+              {
+                  return s1.addr < s2.addr;
+              });
+
+    return !m_symbols.empty();
+}
+
+bool wxElfModule::LoadLines(const wxElfFile& file)
+{
+    const ElfW(Shdr)* const sh = file.FindSection(".debug_line");
+    if ( !sh )
+        return false;
+
+    const wxUint8 *start,
+                  *end;
+    if ( !file.GetData(sh, &start, &end) )
+    {
+        if ( sh->sh_flags & SHF_COMPRESSED )
+            m_hasUnsupportedLines = true;
+
+        return false;
+    }
+
+    wxDwarfReader reader(start, end);
+    while ( !reader.AtEnd() )
+    {
+        bool is64 = false;
+        wxUint64 length = reader.Read<wxUint32>();
+        if ( length == 0xffffffff )
+        {
+            is64 = true;
+            length = reader.Read<wxUint64>();
+        }
+
+        if ( !reader.IsOk() || length > reader.GetRemaining() )
+            break;
+
+        wxDwarfReader unit(reader.GetPtr(), reader.GetPtr() + length);
+        reader.Skip(length);
+
+        // Just ignore the units we can't parse, the other ones are still
+        // useful.
+        ParseLineUnit(unit, is64, file);
+    }
+
+    // The end of sequence rows must come before the rows starting another
+    // sequence at the same address for Lookup() to work correctly. Also keep
+    // the order of the rows for the same address, as the last one is used.
+    std::stable_sort(m_lines.begin(), m_lines.end(),
+              [](const LineRow& r1, const LineRow& r2)
+              {
+                  if ( r1.addr != r2.addr )
+                      return r1.addr < r2.addr;
+
+                  return r1.endSequence && !r2.endSequence;
+              });
+
+    return !m_lines.empty();
+}
+
+bool
+wxElfModule::ParseLineUnit(wxDwarfReader& unit, bool is64, const wxElfFile& file)
+{
+    const wxUint16 version = unit.Read<wxUint16>();
+    if ( version < 2 || version > 5 )
+        return false;
+
+    if ( version >= 5 )
+    {
+        unit.Read<wxUint8>(); // address_size
+        unit.Read<wxUint8>(); // segment_selector_size
+    }
+
+    const wxUint64 headerLength = unit.ReadOffset(is64);
+    if ( !unit.IsOk() || headerLength > unit.GetRemaining() )
+        return false;
+
+    wxDwarfReader program(unit.GetPtr() + headerLength, unit.GetEnd());
+
+    const unsigned minInstLength = unit.Read<wxUint8>();
+
+    // Skip maximum_operations_per_instruction, only used for VLIW, which we
+    // don't support, and default_is_stmt, which we don't need.
+    if ( version >= 4 )
+        unit.Read<wxUint8>();
+    unit.Read<wxUint8>();
+
+    const int lineBase = unit.Read<wxInt8>();
+    const unsigned lineRange = unit.Read<wxUint8>();
+    const unsigned opcodeBase = unit.Read<wxUint8>();
+    if ( !lineRange || !opcodeBase )
+        return false;
+
+    // Numbers of arguments of the standard opcodes, starting from 1.
+    const wxUint8* const opcodeLengths = unit.GetPtr();
+    if ( !unit.Skip(opcodeBase - 1) )
+        return false;
+
+    // Indices in m_fileNames of the files of this unit.
+    std::vector<wxUint32> files;
+
+    if ( version < 5 )
+    {
+        // Directory 0 is the compilation directory, which is only available
+        // in .debug_info, so we don't know it.
+        std::vector<const char*> dirs;
+        dirs.push_back("");
+        for ( ;; )
+        {
+            const char* const dir = unit.ReadString();
+            if ( !*dir )
+                break;
+
+            dirs.push_back(dir);
+        }
+
+        // Files are numbered from 1 before DWARF 5.
+        files.push_back(NO_FILE);
+        for ( ;; )
+        {
+            const char* const name = unit.ReadString();
+            if ( !*name )
+                break;
+
+            const wxUint64 dir = unit.ReadULEB128();
+            unit.ReadULEB128(); // modification time
+            unit.ReadULEB128(); // file length
+
+            files.push_back(AddFileName(dir < dirs.size() ? dirs[dir] : "", name));
+        }
+    }
+    else // DWARF 5
+    {
+        std::vector<LineTableEntry> dirs,
+                                    names;
+        if ( !ReadLineTableEntries(unit, is64, file, dirs) ||
+                !ReadLineTableEntries(unit, is64, file, names) )
+            return false;
+
+        for ( const auto& name : names )
+        {
+            const char* const
+                dir = name.dirIndex < dirs.size() ? dirs[name.dirIndex].path : "";
+
+            files.push_back(AddFileName(dir, name.path));
+        }
+    }
+
+    if ( !unit.IsOk() )
+        return false;
+
+    // Run the line number program: only the registers we need are used and
+    // the rows of each sequence are only added when it ends successfully.
+    wxUIntPtr address = 0;
+    wxUint64 fileNum = 1;
+    wxInt64 line = 1;
+
+    std::vector<LineRow> sequence;
+
+    const auto addRow = [&](bool endSequence)
+    {
+        LineRow row;
+        row.addr = address;
+        row.file = fileNum < files.size() ? files[fileNum] : NO_FILE;
+        row.line = line > 0 ? static_cast<wxUint32>(line) : 0;
+        row.endSequence = endSequence;
+
+        sequence.push_back(row);
+    };
+
+    while ( !program.AtEnd() )
+    {
+        const unsigned opcode = program.Read<wxUint8>();
+        if ( opcode >= opcodeBase )
+        {
+            // Special opcode advancing both the address and the line.
+            const unsigned adjusted = opcode - opcodeBase;
+            address += (adjusted / lineRange) * minInstLength;
+            line += lineBase + static_cast<int>(adjusted % lineRange);
+
+            addRow(false);
+            continue;
+        }
+
+        switch ( opcode )
+        {
+            case 0:
+                {
+                    // Extended opcode.
+                    const wxUint64 len = program.ReadULEB128();
+                    if ( !len || len > program.GetRemaining() )
+                        return false;
+
+                    const wxUint8* const next = program.GetPtr() + len;
+
+                    switch ( program.Read<wxUint8>() )
+                    {
+                        case DW_LNE_end_sequence:
+                            addRow(true);
+
+                            // Sequences starting at 0 or at the maximal
+                            // address correspond to the functions discarded
+                            // by the linker, ignore them.
+                            if ( sequence.front().addr != 0 &&
+                                    sequence.front().addr != static_cast<wxUIntPtr>(-1) )
+                            {
+                                m_lines.insert(m_lines.end(),
+                                               sequence.begin(), sequence.end());
+                            }
+
+                            sequence.clear();
+                            address = 0;
+                            fileNum = 1;
+                            line = 1;
+                            break;
+
+                        case DW_LNE_set_address:
+                            address = program.ReadAddress(len - 1);
+                            break;
+
+                        // Other extended opcodes are not needed.
+                    }
+
+                    if ( !program.IsOk() || program.GetPtr() > next )
+                        return false;
+
+                    program.Skip(next - program.GetPtr());
+                }
+                break;
+
+            case DW_LNS_copy:
+                addRow(false);
+                break;
+
+            case DW_LNS_advance_pc:
+                address += program.ReadULEB128() * minInstLength;
+                break;
+
+            case DW_LNS_advance_line:
+                line += program.ReadSLEB128();
+                break;
+
+            case DW_LNS_set_file:
+                fileNum = program.ReadULEB128();
+                break;
+
+            case DW_LNS_const_add_pc:
+                address += ((255 - opcodeBase) / lineRange) * minInstLength;
+                break;
+
+            case DW_LNS_fixed_advance_pc:
+                address += program.Read<wxUint16>();
+                break;
+
+            default:
+                // The other opcodes don't affect anything we use, but we
+                // still need to skip their arguments.
+                for ( unsigned n = 0; n < opcodeLengths[opcode - 1]; n++ )
+                    program.ReadULEB128();
+        }
+    }
+
+    return program.IsOk();
+}
+
+wxUint32 wxElfModule::AddFileName(const char* dir, const char* name)
+{
+    std::string path;
+    if ( *dir && *name != '/' )
+    {
+        path = dir;
+        path += '/';
+    }
+    path += name;
+
+    const auto it = m_fileIndices.find(path);
+    if ( it != m_fileIndices.end() )
+        return it->second;
+
+    const wxUint32 index = m_fileNames.size();
+    m_fileNames.push_back(path);
+    m_fileIndices.emplace(std::move(path), index);
+
+    return index;
+}
+
+bool wxElfModule::Lookup(wxUIntPtr addr, wxElfLocation& loc) const
+{
+    bool found = false;
+
+    const auto sym = std::upper_bound(m_symbols.begin(), m_symbols.end(), addr,
+                                      [](wxUIntPtr a, const Symbol& s)
+                                      {
+                                          return a < s.addr;
+                                      });
+    if ( sym != m_symbols.begin() )
+    {
+        const Symbol& s = *(sym - 1);
+
+        // Symbols without size are assumed to extend up to the next one.
+        if ( !s.size || addr < s.addr + s.size )
+        {
+            loc.name = DemangleName(s.name);
+            found = true;
+        }
+    }
+
+    const auto row = std::upper_bound(m_lines.begin(), m_lines.end(), addr,
+                                      [](wxUIntPtr a, const LineRow& r)
+                                      {
+                                          return a < r.addr;
+                                      });
+    if ( row != m_lines.begin() )
+    {
+        const LineRow& r = *(row - 1);
+        if ( !r.endSequence && r.file < m_fileNames.size() )
+        {
+            loc.filename = wxString::FromUTF8(m_fileNames[r.file]);
+            loc.line = r.line;
+            found = true;
+        }
+    }
+
+    return found;
+}
+
+#endif // wxHAS_ELF_SYMBOLS
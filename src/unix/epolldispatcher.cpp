@@ -23,6 +23,7 @@
 #include "wx/unix/private/epolldispatcher.h"
 #include "wx/unix/private.h"
 #include "wx/stopwatch.h"
+#include "wx/sysopt.h"
 
 #ifndef WX_PRECOMP
     #include "wx/log.h"
@@ -31,10 +32,14 @@
 
 #include <sys/epoll.h>
 #include <errno.h>
+#include <limits.h>
 #include <unistd.h>
 
 #define wxEpollDispatcher_Trace wxT("epolldispatcher")
 
+// default value for the maximal number of events retrieved at once
+static const size_t wxEPOLL_DEFAULT_MAX_EVENTS = 64;
+
 // ============================================================================
 // implementation
 // ============================================================================
@@ -68,6 +73,22 @@ static uint32_t GetEpollMask(int flags, int fd)
                    wxT("Registered fd %d for exceptional events"), fd);
     }
 
+    if ( flags & wxFDIO_EDGE_TRIGGERED )
+    {
+        ep |= EPOLLET;
+        wxLogTrace(wxEpollDispatcher_Trace,
+                   wxT("Using edge-triggered notifications for fd %d"), fd);
+    }
+
+#ifdef EPOLLEXCLUSIVE
+    if ( flags & wxFDIO_EXCLUSIVE )
+    {
+        ep |= EPOLLEXCLUSIVE;
+        wxLogTrace(wxEpollDispatcher_Trace,
+                   wxT("Using exclusive wake ups for fd %d"), fd);
+    }
+#endif // EPOLLEXCLUSIVE
+
     return ep;
 }
 
@@ -86,7 +107,14 @@ wxEpollDispatcher *wxEpollDispatcher::Create()
     }
     wxLogTrace(wxEpollDispatcher_Trace,
                    wxT("Epoll fd %d created"), epollDescriptor);
-    return new wxEpollDispatcher(epollDescriptor);
+
+    wxEpollDispatcher* const dispatcher = new wxEpollDispatcher(epollDescriptor);
+
+    const int maxEvents = wxSystemOptions::GetOptionInt("unix.epoll.max_events");
+    if ( maxEvents > 0 )
+        dispatcher->SetMaxEvents(maxEvents);
+
+    return dispatcher;
 }
 
 wxEpollDispatcher::wxEpollDispatcher(int epollDescriptor)
@@ -94,24 +122,40 @@ wxEpollDispatcher::wxEpollDispatcher(int epollDescriptor)
     wxASSERT_MSG( epollDescriptor != -1, wxT("invalid descriptor") );
 
     m_epollDescriptor = epollDescriptor;
+    m_maxEvents = wxEPOLL_DEFAULT_MAX_EVENTS;
 }
 
 wxEpollDispatcher::~wxEpollDispatcher()
 {
+    wxLogTrace(wxEpollDispatcher_Trace,
+               wxT("Epoll fd %d: %llu events in %llu wake ups (at most %u ")
+               wxT("at once, %llu times the batch of %zu events was full)"),
+               m_epollDescriptor,
+               static_cast<wxULongLong_t>(m_stats.events),
+               static_cast<wxULongLong_t>(m_stats.wakeups),
+               m_stats.maxEventsPerWakeup,
+               static_cast<wxULongLong_t>(m_stats.fullBatches),
+               m_maxEvents);
+
     if ( close(m_epollDescriptor) != 0 )
     {
         wxLogSysError(_("Error closing epoll descriptor"));
     }
 }
 
-bool wxEpollDispatcher::RegisterFD(int fd, wxFDIOHandler* handler, int flags)
+bool
+wxEpollDispatcher::DoCtl(int op, int fd, wxFDIOHandler* handler, int flags)
 {
     epoll_event ev;
     ev.events = GetEpollMask(flags, fd);
     ev.data.ptr = handler;
 
-    const int ret = epoll_ctl(m_epollDescriptor, EPOLL_CTL_ADD, fd, &ev);
-    if ( ret != 0 )
+    return epoll_ctl(m_epollDescriptor, op, fd, &ev) == 0;
+}
+
+bool wxEpollDispatcher::RegisterFD(int fd, wxFDIOHandler* handler, int flags)
+{
+    if ( !DoCtl(EPOLL_CTL_ADD, fd, handler, flags) )
     {
         wxLogSysError(_("Failed to add descriptor %d to epoll descriptor %d"),
                       fd, m_epollDescriptor);
@@ -126,12 +170,25 @@ bool wxEpollDispatcher::RegisterFD(int fd, wxFDIOHandler* handler, int flags)
 
 bool wxEpollDispatcher::ModifyFD(int fd, wxFDIOHandler* handler, int flags)
 {
-    epoll_event ev;
-    ev.events = GetEpollMask(flags, fd);
-    ev.data.ptr = handler;
+    bool ok;
 
-    const int ret = epoll_ctl(m_epollDescriptor, EPOLL_CTL_MOD, fd, &ev);
-    if ( ret != 0 )
+    // EPOLL_CTL_MOD can't be used with the descriptors registered with
+    // EPOLLEXCLUSIVE, so remove and add it back instead
+    if ( flags & wxFDIO_EXCLUSIVE )
+    {
+        epoll_event ev;
+        ev.events = 0;
+        ev.data.ptr = nullptr;
+
+        ok = epoll_ctl(m_epollDescriptor, EPOLL_CTL_DEL, fd, &ev) == 0 &&
+                DoCtl(EPOLL_CTL_ADD, fd, handler, flags);
+    }
+    else
+    {
+        ok = DoCtl(EPOLL_CTL_MOD, fd, handler, flags);
+    }
+
+    if ( !ok )
     {
         wxLogSysError(_("Failed to modify descriptor %d in epoll descriptor %d"),
                       fd, m_epollDescriptor);
@@ -202,11 +259,41 @@ bool wxEpollDispatcher::HasPending() const
     return DoPoll(&event, 1, 0) >= 1;
 }
 
+void wxEpollDispatcher::SetMaxEvents(size_t maxEvents)
+{
+    wxCHECK_RET( maxEvents > 0 && maxEvents <= INT_MAX,
+                 wxT("invalid maximal number of events") );
+
+    // the buffer is reallocated when it's used the next time, as it can't be
+    // done while it's being used by Dispatch()
+    m_maxEvents = maxEvents;
+}
+
 int wxEpollDispatcher::Dispatch(int timeout)
 {
-    epoll_event events[16];
+    wxRecursionGuard guard(m_dispatchLevel);
 
-    const int rc = DoPoll(events, WXSIZEOF(events), timeout);
+    // the main buffer is still used by the outer call if we're reentered, so
+    // use a temporary one in this (rare) case
+    std::unique_ptr<epoll_event[]> nestedEvents;
+    epoll_event* events;
+    if ( guard.IsInside() )
+    {
+        nestedEvents.reset(new epoll_event[m_maxEvents]);
+        events = nestedEvents.get();
+    }
+    else
+    {
+        if ( m_numEvents != m_maxEvents )
+        {
+            m_events.reset(new epoll_event[m_maxEvents]);
+            m_numEvents = m_maxEvents;
+        }
+
+        events = m_events.get();
+    }
+
+    const int rc = DoPoll(events, static_cast<int>(m_maxEvents), timeout);
 
     if ( rc == -1 )
     {
@@ -215,6 +302,16 @@ int wxEpollDispatcher::Dispatch(int timeout)
         return -1;
     }
 
+    if ( rc > 0 )
+    {
+        m_stats.wakeups++;
+        m_stats.events += rc;
+        if ( static_cast<unsigned>(rc) > m_stats.maxEventsPerWakeup )
+            m_stats.maxEventsPerWakeup = rc;
+        if ( static_cast<size_t>(rc) >= m_maxEvents )
+            m_stats.fullBatches++;
+    }
+
     int numEvents = 0;
     for ( epoll_event *p = events; p < events + rc; p++ )
     {
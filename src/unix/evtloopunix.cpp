@@ -180,11 +180,16 @@ bool wxConsoleEventLoop::Dispatch()
 int wxConsoleEventLoop::DispatchTimeout(unsigned long timeout)
 {
 #if wxUSE_TIMER
-    // check if we need to decrease the timeout to account for a timer
+    // check if we need to decrease the timeout to account for a timer, unless
+    // the dispatcher is woken up by the timer scheduler itself
+    wxTimerScheduler& timerScheduler = wxTimerScheduler::Get();
     wxUsecClock_t nextTimer;
-    if ( wxTimerScheduler::Get().GetNext(&nextTimer) )
+    if ( !timerScheduler.UsesTimerFD() && timerScheduler.GetNext(&nextTimer) )
     {
-        unsigned long timeUntilNextTimer = wxMilliClockToLong(nextTimer / 1000);
+        // round the time up to avoid waking up just before the timer expires
+        // and then busy waiting until it does
+        unsigned long timeUntilNextTimer =
+            wxMilliClockToLong((nextTimer + 999) / 1000);
         if ( timeUntilNextTimer < timeout )
             timeout = timeUntilNextTimer;
     }
@@ -193,7 +198,7 @@ int wxConsoleEventLoop::DispatchTimeout(unsigned long timeout)
     bool hadEvent = m_dispatcher->Dispatch(timeout) > 0;
 
 #if wxUSE_TIMER
-    if ( wxTimerScheduler::Get().NotifyExpired() )
+    if ( timerScheduler.NotifyExpired() )
         hadEvent = true;
 #endif // wxUSE_TIMER
 
@@ -43,13 +43,14 @@ int wxFDIOManagerUnix::AddInput(wxFDIOHandler *handler, int fd, Direction d)
     // registered for anything or not
     bool ok;
     const int regmask = handler->GetRegisteredEvents();
+    const int extra = handler->GetExtraFlags();
     if ( !regmask )
     {
-        ok = dispatcher->RegisterFD(fd, handler, flag);
+        ok = dispatcher->RegisterFD(fd, handler, flag | extra);
     }
     else
     {
-        ok = dispatcher->ModifyFD(fd, handler, regmask | flag);
+        ok = dispatcher->ModifyFD(fd, handler, regmask | flag | extra);
     }
 
     if ( !ok )
@@ -79,7 +80,8 @@ void wxFDIOManagerUnix::RemoveInput(wxFDIOHandler *handler, int fd, Direction d)
     }
     else
     {
-        ok = dispatcher->ModifyFD(fd, handler, regmask & ~flag);
+        ok = dispatcher->ModifyFD(fd, handler,
+                                  (regmask & ~flag) | handler->GetExtraFlags());
     }
 
     if ( !ok )
@@ -29,6 +29,7 @@
 
 #include "wx/stackwalk.h"
 #include "wx/stdpaths.h"
+#include "wx/sysopt.h"
 
 #include <execinfo.h>
 
@@ -46,6 +47,8 @@
     #include <vector>
 
     #define HAVE_DLADDR1
+
+    #include "wx/unix/private/elfsymbols.h"
 #endif
 
 namespace
@@ -209,6 +212,28 @@ void wxStackWalker::ProcessFrames(size_t skip)
         OnStackFrame(frames[n]);
 }
 
+void wxStackWalker::WalkAddresses(void* const* addresses, size_t count)
+{
+    count = wxMin(count, size_t(MAX_FRAMES));
+    if ( !count )
+        return;
+
+    // InitFrames() takes non-const pointers, so make a copy.
+    void* addrs[MAX_FRAMES];
+    memcpy(addrs, addresses, count*sizeof(void*));
+
+    char** const symbols = backtrace_symbols(addrs, count);
+    if ( !symbols )
+        return;
+
+    wxStackFrame frames[MAX_FRAMES];
+    const int numFrames = InitFrames(frames, count, addrs, symbols);
+    for ( int n = 0; n < numFrames; n++ )
+        OnStackFrame(frames[n]);
+
+    free(symbols);
+}
+
 void wxStackWalker::FreeStack()
 {
     // ms_symbols has been allocated by backtrace_symbols() and it's the responsibility
@@ -331,6 +356,15 @@ ModuleInfo GetModuleInfoFromAddr(void* addr)
 
 int wxStackWalker::InitFrames(wxStackFrame *arr, size_t n, void **addresses, char **syminfo)
 {
+    // We read the symbols and line information from the modules ourselves if
+    // possible, as this is much faster than running addr2line and also works
+    // if it is not installed, and only use addr2line for the modules we can't
+    // read, e.g. because they use compressed debug information.
+    //
+    // This can be disabled to always use addr2line if necessary.
+    const bool useAddr2line =
+        wxSystemOptions::GetOptionInt("unix.stackwalk.use_addr2line") != 0;
+
     // We want to optimize the number of addr2line invocations, but we have to
     // run it separately for each file, so find all the files first.
     //
@@ -352,30 +386,51 @@ int wxStackWalker::InitFrames(wxStackFrame *arr, size_t n, void **addresses, cha
     // The key of this map is the path of the module.
     std::unordered_map<const char*, ModuleData> modulesData;
 
-    // First pass: construct all commands to run.
+    // First pass: resolve what we can and construct all commands to run for
+    // the rest.
     for ( size_t i = 0; i < n; ++i )
     {
         void* const addr = addresses[i];
 
+        // Initialize the frame with the minimal information in case we can't
+        // find anything else about it below: wxStackFrame::OnGetName() may
+        // still be able to get the function name from syminfo.
+        arr[i].Set(wxString(), wxString(), syminfo[i], i, 0, addr);
+
         const ModuleInfo modInfo = GetModuleInfoFromAddr(addr);
 
         // We can't do anything if we failed to find the file name.
         if ( !modInfo.name )
-        {
-            arr[i].Set(wxString(), wxString(), syminfo[i], i, 0, addr);
             continue;
+
+        const wxUIntPtr addrInModule = wxPtrToUInt(addr) - modInfo.diff;
+
+        if ( !useAddr2line )
+        {
+            const wxElfModule& module = wxElfModule::Get(modInfo.name);
+            if ( module.IsOk() )
+            {
+                wxElfLocation loc;
+                if ( module.Lookup(addrInModule, loc) )
+                    arr[i].Set(loc.name, loc.filename, syminfo[i], i, loc.line, addr);
+
+                // Only use addr2line if it can find more than we did, as it
+                // uses the same information as we do otherwise.
+                if ( loc.line || !module.HasUnsupportedLines() )
+                    continue;
+            }
         }
 
         ModuleData& modData = modulesData[modInfo.name];
         if ( modData.command.empty() )
             modData.command.Printf("addr2line -C -f -e \"%s\"", modInfo.name);
 
-        modData.command +=
-            wxString::Format(" %zx", wxPtrToUInt(addr) - modInfo.diff);
+        modData.command += wxString::Format(" %zx", addrInModule);
         modData.indices.push_back(i);
     }
 
-    // Second pass: do run them.
+    // Second pass: do run them. If this fails, e.g. because addr2line is not
+    // available, just keep the information we already have.
     wxString name, filename;
     unsigned long line = 0;
 
@@ -385,12 +440,12 @@ int wxStackWalker::InitFrames(wxStackFrame *arr, size_t n, void **addresses, cha
 
         wxStdioPipe fp(modData.command.utf8_str(), "r");
         if ( !fp )
-            return 0;
+            continue;
 
         for ( const size_t i: modData.indices )
         {
             if ( !ReadSingleResult(fp, i, name, filename, line) )
-                return 0;
+                break;
 
             arr[i].Set(name, filename, syminfo[i], i, line, addresses[i]);
         }
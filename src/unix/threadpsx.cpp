@@ -62,9 +62,18 @@
     #include <sys/resource.h>   // for setpriority()
 #endif
 
+#ifdef __LINUX__
+    #include <sys/resource.h>   // for getrusage()
+    #include <string.h>         // for strrchr()
+#endif
+
 // we use wxFFile under Linux in GetCPUCount()
 #ifdef __LINUX__
     #include "wx/ffile.h"
+
+    // and futex() for wxSpinMutex (and gettid() for GetCPUStats())
+    #include <linux/futex.h>
+    #include <sys/syscall.h>
     #include "wx/private/glibc.h"
     #if wxCHECK_GLIBC_VERSION(2, 12)
         #define wxHAVE_PTHREAD_SETNAME_NP
@@ -425,6 +434,139 @@ wxMutexError wxMutexInternal::Unlock()
     return wxMUTEX_MISC_ERROR;
 }
 
+// ===========================================================================
+// wxSharedMutex implementation
+// ===========================================================================
+
+// this is a simple wrapper around pthread_rwlock_t
+class wxSharedMutexInternal
+{
+public:
+    wxSharedMutexInternal();
+    ~wxSharedMutexInternal();
+
+    bool IsOk() const { return m_isOk; }
+
+    wxMutexError Lock()
+        { return HandleResult(pthread_rwlock_wrlock(&m_rwlock), "wrlock"); }
+    wxMutexError TryLock()
+        { return HandleResult(pthread_rwlock_trywrlock(&m_rwlock), "trywrlock"); }
+    wxMutexError Unlock()
+        { return HandleResult(pthread_rwlock_unlock(&m_rwlock), "unlock"); }
+
+    wxMutexError LockShared()
+        { return HandleResult(pthread_rwlock_rdlock(&m_rwlock), "rdlock"); }
+    wxMutexError TryLockShared()
+        { return HandleResult(pthread_rwlock_tryrdlock(&m_rwlock), "tryrdlock"); }
+    wxMutexError UnlockShared()
+        { return Unlock(); }
+
+private:
+    static wxMutexError HandleResult(int err, const char* func);
+
+    pthread_rwlock_t m_rwlock;
+    bool m_isOk;
+
+    wxDECLARE_NO_COPY_CLASS(wxSharedMutexInternal);
+};
+
+wxSharedMutexInternal::wxSharedMutexInternal()
+{
+    int err;
+
+#if defined(__GLIBC__) && defined(PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP)
+    // glibc rwlocks prefer readers by default, which means that a writer can
+    // wait forever if there is a continuous stream of readers, which is
+    // especially likely to happen in the typical case of a read-mostly cache
+    // using this lock, so change this.
+    pthread_rwlockattr_t attr;
+    pthread_rwlockattr_init(&attr);
+    pthread_rwlockattr_setkind_np(&attr,
+                                  PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP);
+
+    err = pthread_rwlock_init(&m_rwlock, &attr);
+
+    pthread_rwlockattr_destroy(&attr);
+#else
+    err = pthread_rwlock_init(&m_rwlock, nullptr);
+#endif
+
+    m_isOk = err == 0;
+    if ( !m_isOk )
+    {
+        wxLogApiError( wxT("pthread_rwlock_init()"), err);
+    }
+}
+
+wxSharedMutexInternal::~wxSharedMutexInternal()
+{
+    if ( m_isOk )
+    {
+        int err = pthread_rwlock_destroy(&m_rwlock);
+        if ( err != 0 )
+        {
+            wxLogApiError( wxT("pthread_rwlock_destroy()"), err);
+        }
+    }
+}
+
+/* static */
+wxMutexError wxSharedMutexInternal::HandleResult(int err, const char* func)
+{
+    switch ( err )
+    {
+        case 0:
+            return wxMUTEX_NO_ERROR;
+
+        case EBUSY:
+            // not an error: the lock is already held, but we're prepared for
+            // this
+            return wxMUTEX_BUSY;
+
+        case EDEADLK:
+            wxFAIL_MSG( wxT("shared mutex deadlock prevented") );
+            return wxMUTEX_DEAD_LOCK;
+
+        case EPERM:
+            // we don't hold the lock
+            return wxMUTEX_UNLOCKED;
+
+        default:
+            wxLogApiError(wxString::Format("pthread_rwlock_%s()", func), err);
+    }
+
+    return wxMUTEX_MISC_ERROR;
+}
+
+// ===========================================================================
+// wxSpinMutex implementation
+// ===========================================================================
+
+void wxSpinMutex::WaitWhileContended()
+{
+#ifdef __LINUX__
+    static_assert( sizeof(m_state) == sizeof(int),
+                   "std::atomic<int> must be usable as futex" );
+
+    // This returns immediately if the state has already changed, and we
+    // don't care about the errors (e.g. EINTR) as the caller retries anyhow.
+    syscall(SYS_futex, reinterpret_cast<int*>(&m_state),
+            FUTEX_WAIT_PRIVATE, State_Contended, nullptr, nullptr, 0);
+#elif defined(HAVE_SCHED_YIELD)
+    sched_yield();
+#else
+    wxMicroSleep(1);
+#endif
+}
+
+void wxSpinMutex::WakeWaiter()
+{
+#ifdef __LINUX__
+    syscall(SYS_futex, reinterpret_cast<int*>(&m_state),
+            FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+#endif
+}
+
 // ===========================================================================
 // wxCondition implementation
 // ===========================================================================
@@ -763,8 +905,15 @@ public:
         // id
     pthread_t GetId() const { return m_threadId; }
     pthread_t *GetIdPtr() { return &m_threadId; }
+#ifdef __LINUX__
+        // kernel thread id, only valid once the thread started running
+    pid_t GetSystemId() const { return m_tid; }
+#endif // __LINUX__
         // "created" flag
     bool WasCreated() const { return m_created; }
+        // true if the underlying thread exists and its scheduling parameters
+        // can be changed
+    bool HasOSThread() const { return m_created && m_state != STATE_EXITED; }
         // "cancelled" flag
     void SetCancelFlag() { m_cancelled = true; }
     bool WasCancelled() const { return m_cancelled; }
@@ -795,6 +944,11 @@ private:
     wxThreadState m_state;      // see wxThreadState enum
     int           m_prio;       // in wxWidgets units: from 0 to 100
 
+#ifdef __LINUX__
+    // the id of the thread used by the kernel, set from the thread itself
+    std::atomic<pid_t> m_tid;
+#endif // __LINUX__
+
     // this flag is set when the thread was successfully created
     bool m_created;
 
@@ -838,6 +992,10 @@ void *wxThreadInternal::PthreadStart(wxThread *thread)
 
     wxLogTrace(TRACE_THREADS, wxT("Thread %p started."), THR_ID(pthread));
 
+#ifdef __LINUX__
+    pthread->m_tid = static_cast<pid_t>(syscall(SYS_gettid));
+#endif // __LINUX__
+
     // associate the thread pointer with the newly created thread so that
     // wxThread::This() will work
     int rc = pthread_setspecific(gs_keySelf, thread);
@@ -1000,6 +1158,10 @@ wxThreadInternal::wxThreadInternal()
     m_prio = wxPRIORITY_DEFAULT;
     m_exitcode = nullptr;
 
+#ifdef __LINUX__
+    m_tid = 0;
+#endif // __LINUX__
+
     // set to true only when the thread starts waiting on m_semSuspend
     m_isPaused = false;
 
@@ -1498,6 +1660,316 @@ wxThreadIdType wxThread::GetId() const
     return (wxThreadIdType) m_internal->GetId();
 }
 
+// -----------------------------------------------------------------------------
+// scheduling and statistics
+// -----------------------------------------------------------------------------
+
+namespace
+{
+
+#if defined(__LINUX__) && defined(CPU_SETSIZE)
+    #define wxHAS_THREAD_AFFINITY
+
+bool DoSetAffinity(pthread_t thread, const std::vector<int>& cpus)
+{
+    wxCHECK_MSG( !cpus.empty(), false, wxT("at least one CPU must be given") );
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for ( auto cpu : cpus )
+    {
+        wxCHECK_MSG( cpu >= 0 && cpu < CPU_SETSIZE, false,
+                     wxT("invalid CPU index") );
+
+        CPU_SET(cpu, &set);
+    }
+
+    const int rc = pthread_setaffinity_np(thread, sizeof(set), &set);
+    if ( rc != 0 )
+    {
+        wxLogSysError(rc, _("Failed to set thread CPU affinity"));
+        return false;
+    }
+
+    return true;
+}
+
+bool DoGetAffinity(pthread_t thread, std::vector<int>& cpus)
+{
+    cpu_set_t set;
+    CPU_ZERO(&set);
+
+    const int rc = pthread_getaffinity_np(thread, sizeof(set), &set);
+    if ( rc != 0 )
+    {
+        wxLogSysError(rc, _("Failed to get thread CPU affinity"));
+        return false;
+    }
+
+    cpus.clear();
+    for ( int cpu = 0; cpu < CPU_SETSIZE; cpu++ )
+    {
+        if ( CPU_ISSET(cpu, &set) )
+            cpus.push_back(cpu);
+    }
+
+    return true;
+}
+
+#endif // __LINUX__ && CPU_SETSIZE
+
+#ifdef HAVE_THREAD_PRIORITY_FUNCTIONS
+
+bool DoSetSchedPolicy(pthread_t thread, wxThreadSchedPolicy policy, int priority)
+{
+    int posixPolicy = -1;
+    switch ( policy )
+    {
+        case wxTHREAD_SCHED_DEFAULT:
+            posixPolicy = SCHED_OTHER;
+            break;
+
+        case wxTHREAD_SCHED_BATCH:
+#ifdef SCHED_BATCH
+            posixPolicy = SCHED_BATCH;
+#endif
+            break;
+
+        case wxTHREAD_SCHED_IDLE:
+#ifdef SCHED_IDLE
+            posixPolicy = SCHED_IDLE;
+#endif
+            break;
+
+        case wxTHREAD_SCHED_FIFO:
+#ifdef SCHED_FIFO
+            posixPolicy = SCHED_FIFO;
+#endif
+            break;
+
+        case wxTHREAD_SCHED_RR:
+#ifdef SCHED_RR
+            posixPolicy = SCHED_RR;
+#endif
+            break;
+    }
+
+    if ( posixPolicy == -1 )
+    {
+        wxLogDebug("Thread scheduling policy %d not supported.", policy);
+        return false;
+    }
+
+    struct sched_param sparam = { };
+    if ( policy == wxTHREAD_SCHED_FIFO || policy == wxTHREAD_SCHED_RR )
+    {
+        const int prioMin = sched_get_priority_min(posixPolicy);
+        const int prioMax = sched_get_priority_max(posixPolicy);
+
+        sparam.sched_priority = priority ? wxClip(priority, prioMin, prioMax)
+                                         : prioMin;
+    }
+    else
+    {
+        wxASSERT_MSG( priority == 0,
+                      wxT("priority is only used with real-time policies") );
+    }
+
+    const int rc = pthread_setschedparam(thread, posixPolicy, &sparam);
+    if ( rc != 0 )
+    {
+        wxLogSysError(rc, _("Failed to set thread scheduling policy"));
+        return false;
+    }
+
+    return true;
+}
+
+#endif // HAVE_THREAD_PRIORITY_FUNCTIONS
+
+#ifdef __LINUX__
+
+// Read the statistics of any thread of this process from /proc.
+bool DoGetCPUStats(pid_t tid, wxThreadCPUStats& stats)
+{
+    char path[64];
+    snprintf(path, sizeof(path), "/proc/self/task/%d/stat", static_cast<int>(tid));
+
+    FILE* fp = fopen(path, "r");
+    if ( !fp )
+        return false;
+
+    char buf[1024];
+    const size_t len = fread(buf, 1, sizeof(buf) - 1, fp);
+    fclose(fp);
+    buf[len] = '\0';
+
+    // Skip the thread name which may contain spaces and parentheses and then
+    // all the fields before utime and stime, see proc(5).
+    const char* const p = strrchr(buf, ')');
+    unsigned long long utime, stime;
+    if ( !p || sscanf(p + 1, " %*c %*d %*d %*d %*d %*d %*u %*u %*u %*u %*u %llu %llu",
+                      &utime, &stime) != 2 )
+        return false;
+
+    const long ticksPerSec = sysconf(_SC_CLK_TCK);
+    if ( ticksPerSec <= 0 )
+        return false;
+
+    stats.userTime = utime*1000000 / ticksPerSec;
+    stats.systemTime = stime*1000000 / ticksPerSec;
+
+    snprintf(path, sizeof(path), "/proc/self/task/%d/status", static_cast<int>(tid));
+    fp = fopen(path, "r");
+    if ( !fp )
+        return false;
+
+    while ( fgets(buf, sizeof(buf), fp) )
+    {
+        unsigned long long n;
+        if ( sscanf(buf, "voluntary_ctxt_switches: %llu", &n) == 1 )
+            stats.voluntarySwitches = n;
+        else if ( sscanf(buf, "nonvoluntary_ctxt_switches: %llu", &n) == 1 )
+            stats.involuntarySwitches = n;
+    }
+
+    fclose(fp);
+
+    return true;
+}
+
+#endif // __LINUX__
+
+} // anonymous namespace
+
+bool wxThread::SetAffinity(const std::vector<int>& cpus)
+{
+    wxCriticalSectionLocker lock(m_critsect);
+
+    wxCHECK_MSG( m_internal->HasOSThread(), false,
+                 wxT("thread must be created and not have exited") );
+
+#ifdef wxHAS_THREAD_AFFINITY
+    return DoSetAffinity(m_internal->GetId(), cpus);
+#else
+    wxUnusedVar(cpus);
+    return false;
+#endif
+}
+
+bool wxThread::GetAffinity(std::vector<int>& cpus) const
+{
+    wxCriticalSectionLocker lock(m_critsect);
+
+    wxCHECK_MSG( m_internal->HasOSThread(), false,
+                 wxT("thread must be created and not have exited") );
+
+#ifdef wxHAS_THREAD_AFFINITY
+    return DoGetAffinity(m_internal->GetId(), cpus);
+#else
+    wxUnusedVar(cpus);
+    return false;
+#endif
+}
+
+bool wxThread::SetSchedPolicy(wxThreadSchedPolicy policy, int priority)
+{
+    wxCriticalSectionLocker lock(m_critsect);
+
+    wxCHECK_MSG( m_internal->HasOSThread(), false,
+                 wxT("thread must be created and not have exited") );
+
+#ifdef HAVE_THREAD_PRIORITY_FUNCTIONS
+    return DoSetSchedPolicy(m_internal->GetId(), policy, priority);
+#else
+    wxUnusedVar(policy);
+    wxUnusedVar(priority);
+    return false;
+#endif
+}
+
+bool wxThread::GetCPUStats(wxThreadCPUStats& stats) const
+{
+    if ( This() == this )
+        return GetCPUStatsForCurrent(stats);
+
+    wxCriticalSectionLocker lock(m_critsect);
+
+    wxCHECK_MSG( m_internal->HasOSThread(), false,
+                 wxT("thread must be created and not have exited") );
+
+#ifdef __LINUX__
+    // The thread id is not available until the thread starts running.
+    const pid_t tid = m_internal->GetSystemId();
+    if ( !tid )
+        return false;
+
+    return DoGetCPUStats(tid, stats);
+#else
+    wxUnusedVar(stats);
+    return false;
+#endif
+}
+
+/* static */
+bool wxThread::SetAffinityForCurrent(const std::vector<int>& cpus)
+{
+#ifdef wxHAS_THREAD_AFFINITY
+    return DoSetAffinity(pthread_self(), cpus);
+#else
+    wxUnusedVar(cpus);
+    return false;
+#endif
+}
+
+/* static */
+bool wxThread::GetAffinityForCurrent(std::vector<int>& cpus)
+{
+#ifdef wxHAS_THREAD_AFFINITY
+    return DoGetAffinity(pthread_self(), cpus);
+#else
+    wxUnusedVar(cpus);
+    return false;
+#endif
+}
+
+/* static */
+bool wxThread::SetSchedPolicyForCurrent(wxThreadSchedPolicy policy, int priority)
+{
+#ifdef HAVE_THREAD_PRIORITY_FUNCTIONS
+    return DoSetSchedPolicy(pthread_self(), policy, priority);
+#else
+    wxUnusedVar(policy);
+    wxUnusedVar(priority);
+    return false;
+#endif
+}
+
+/* static */
+bool wxThread::GetCPUStatsForCurrent(wxThreadCPUStats& stats)
+{
+#ifdef RUSAGE_THREAD
+    struct rusage ru;
+    if ( getrusage(RUSAGE_THREAD, &ru) != 0 )
+    {
+        wxLogSysError(_("Failed to get thread CPU usage"));
+        return false;
+    }
+
+    stats.userTime = wxUint64(ru.ru_utime.tv_sec)*1000000 + ru.ru_utime.tv_usec;
+    stats.systemTime = wxUint64(ru.ru_stime.tv_sec)*1000000 + ru.ru_stime.tv_usec;
+    stats.voluntarySwitches = ru.ru_nvcsw;
+    stats.involuntarySwitches = ru.ru_nivcsw;
+
+    return true;
+#elif defined(__LINUX__)
+    return DoGetCPUStats(static_cast<pid_t>(syscall(SYS_gettid)), stats);
+#else
+    wxUnusedVar(stats);
+    return false;
+#endif
+}
+
 // -----------------------------------------------------------------------------
 // pause/resume
 // -----------------------------------------------------------------------------
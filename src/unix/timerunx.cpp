@@ -29,6 +29,7 @@
 
 #include "wx/apptrait.h"
 #include "wx/longlong.h"
+#include "wx/sysopt.h"
 #include "wx/time.h"
 #include "wx/vector.h"
 
@@ -37,56 +38,245 @@
 
 #include "wx/unix/private/timer.h"
 
+#if wxUSE_EPOLL_DISPATCHER
+    #include "wx/private/fdiodispatcher.h"
+
+    #include <sys/timerfd.h>
+    #include <errno.h>
+    #include <unistd.h>
+#endif // wxUSE_EPOLL_DISPATCHER
+
 // trace mask for the debugging messages used here
 #define wxTrace_Timer wxT("timer")
 
+// ============================================================================
+// wxTimerFDHandler: handles the expiration of the timer file descriptor
+// ============================================================================
+
+#if wxUSE_EPOLL_DISPATCHER
+
+class wxTimerFDHandler : public wxFDIOHandler
+{
+public:
+    explicit wxTimerFDHandler(int fd) : m_fd(fd) { }
+
+    virtual void OnReadWaiting() override
+    {
+        // reset the descriptor state by reading the number of expirations,
+        // which we don't need, as we check the timers expiration ourselves
+        wxUint64 expirations;
+        if ( read(m_fd, &expirations, sizeof(expirations)) == -1 &&
+                errno != EAGAIN )
+        {
+            wxLogTrace(wxTrace_Timer, "Reading timer fd failed: %s",
+                       wxSysErrorMsgStr());
+        }
+
+        wxTimerScheduler::Get().OnTimerFDExpired();
+    }
+
+    virtual void OnWriteWaiting() override { }
+    virtual void OnExceptionWaiting() override { }
+
+private:
+    const int m_fd;
+
+    wxDECLARE_NO_COPY_CLASS(wxTimerFDHandler);
+};
+
+#endif // wxUSE_EPOLL_DISPATCHER
+
 // ============================================================================
 // wxTimerScheduler implementation
 // ============================================================================
 
 wxTimerScheduler *wxTimerScheduler::ms_instance = nullptr;
 
-void wxTimerScheduler::AddTimer(wxUnixTimerImpl *timer, wxUsecClock_t expiration)
+wxTimerScheduler::wxTimerScheduler()
+    : m_slack(wxMax(wxSystemOptions::GetOptionInt("unix.timer.slack"), 0)*1000),
+      m_timerFDExpiration(0)
 {
-    DoAddTimer(wxTimerSchedule(timer, expiration));
+#if wxUSE_EPOLL_DISPATCHER
+    // using a timer file descriptor allows to wait for the timers expiration
+    // in the dispatcher without limiting its timeout and with microsecond
+    // precision instead of millisecond one
+    const int fd = timerfd_create(CLOCK_REALTIME, TFD_NONBLOCK | TFD_CLOEXEC);
+    if ( fd == -1 )
+    {
+        wxLogTrace(wxTrace_Timer, "Creating timer fd failed: %s",
+                   wxSysErrorMsgStr());
+        return;
+    }
+
+    wxFDIODispatcher* const dispatcher = wxFDIODispatcher::Get();
+    wxTimerFDHandler* const handler = new wxTimerFDHandler(fd);
+    // a single read() always resets the timer fd, so we can use edge-triggered
+    // notifications for it
+    if ( !dispatcher ||
+            !dispatcher->RegisterFD(fd, handler,
+                                    wxFDIO_INPUT | wxFDIO_EDGE_TRIGGERED) )
+    {
+        delete handler;
+        close(fd);
+        return;
+    }
+
+    m_timerFD = fd;
+    m_timerFDHandler = handler;
+#endif // wxUSE_EPOLL_DISPATCHER
 }
 
-void wxTimerScheduler::DoAddTimer(const wxTimerSchedule& s)
+wxTimerScheduler::~wxTimerScheduler()
 {
-    // do an insertion sort to keep the list sorted in expiration order
-    wxTimerList::iterator node;
-    for ( node = m_timers.begin(); node != m_timers.end(); ++node )
+#if wxUSE_EPOLL_DISPATCHER
+    if ( m_timerFD != -1 )
     {
-        wxASSERT_MSG( node->m_timer != s.m_timer,
-                      wxT("adding the same timer twice?") );
-
-        if ( node->m_expiration > s.m_expiration )
-            break;
+        wxFDIODispatcher::Get()->UnregisterFD(m_timerFD);
+        delete m_timerFDHandler;
+        close(m_timerFD);
     }
+#endif // wxUSE_EPOLL_DISPATCHER
+}
 
-    m_timers.insert(node, s);
+void wxTimerScheduler::AddTimer(wxUnixTimerImpl *timer, wxUsecClock_t expiration)
+{
+    DoAddTimer(timer, expiration);
+
+    if ( timer->m_heapIndex == 0 )
+        UpdateTimerFD();
+}
+
+void wxTimerScheduler::DoAddTimer(wxUnixTimerImpl *timer, wxUsecClock_t expiration)
+{
+    wxASSERT_MSG( timer->m_heapIndex == static_cast<size_t>(-1),
+                  wxT("adding the same timer twice?") );
+
+    const size_t n = m_timers.size();
+    m_timers.push_back(wxTimerSchedule(timer, expiration, m_seq++));
+    timer->m_heapIndex = n;
+    SiftUp(n);
 
     wxLogTrace(wxTrace_Timer, wxT("Inserted timer %d expiring at %s"),
-               s.m_timer->GetId(),
-               s.m_expiration.ToString());
+               timer->GetId(),
+               expiration.ToString());
 }
 
 void wxTimerScheduler::RemoveTimer(wxUnixTimerImpl *timer)
 {
     wxLogTrace(wxTrace_Timer, wxT("Removing timer %d"), timer->GetId());
 
-    for ( wxTimerList::iterator node = m_timers.begin();
-          node != m_timers.end();
-          ++node )
+    const size_t n = timer->m_heapIndex;
+    wxCHECK_RET( n < m_timers.size() && m_timers[n].m_timer == timer,
+                 wxT("removing inexistent timer?") );
+
+    DoRemoveAt(n);
+
+    if ( n == 0 )
+        UpdateTimerFD();
+}
+
+void wxTimerScheduler::DoRemoveAt(size_t n)
+{
+    m_timers[n].m_timer->m_heapIndex = static_cast<size_t>(-1);
+
+    const size_t last = m_timers.size() - 1;
+    if ( n != last )
     {
-        if ( node->m_timer == timer )
-        {
-            m_timers.erase(node);
-            return;
-        }
+        // replace the removed element with the last one and restore the heap
+        // property, which may require moving it either up or down
+        SetAt(n, m_timers[last]);
+        m_timers.pop_back();
+
+        if ( n > 0 && m_timers[n].IsBefore(m_timers[(n - 1) / 2]) )
+            SiftUp(n);
+        else
+            SiftDown(n);
+    }
+    else
+    {
+        m_timers.pop_back();
     }
+}
+
+void wxTimerScheduler::SiftUp(size_t n)
+{
+    const wxTimerSchedule s = m_timers[n];
+    while ( n > 0 )
+    {
+        const size_t parent = (n - 1) / 2;
+        if ( !s.IsBefore(m_timers[parent]) )
+            break;
+
+        SetAt(n, m_timers[parent]);
+        n = parent;
+    }
+
+    SetAt(n, s);
+}
+
+void wxTimerScheduler::SiftDown(size_t n)
+{
+    const size_t count = m_timers.size();
+    const wxTimerSchedule s = m_timers[n];
+    for ( ;; )
+    {
+        size_t child = 2*n + 1;
+        if ( child >= count )
+            break;
+
+        if ( child + 1 < count && m_timers[child + 1].IsBefore(m_timers[child]) )
+            child++;
+
+        if ( !m_timers[child].IsBefore(s) )
+            break;
+
+        SetAt(n, m_timers[child]);
+        n = child;
+    }
+
+    SetAt(n, s);
+}
+
+void wxTimerScheduler::UpdateTimerFD()
+{
+#if wxUSE_EPOLL_DISPATCHER
+    if ( m_timerFD == -1 )
+        return;
+
+    const wxUsecClock_t expiration = m_timers.empty() ? wxUsecClock_t(0)
+                                                      : GetWakeUpTime();
+    if ( expiration == m_timerFDExpiration )
+        return;
+
+    // notice that all zero value disarms the timer, which is what we need if
+    // there are no timers
+    itimerspec spec = itimerspec();
+    if ( expiration != 0 )
+    {
+        spec.it_value.tv_sec = (expiration / 1000000).GetValue();
+        spec.it_value.tv_nsec = (expiration % 1000000).GetValue() * 1000;
+    }
+
+    if ( timerfd_settime(m_timerFD, TFD_TIMER_ABSTIME, &spec, nullptr) != 0 )
+    {
+        wxLogTrace(wxTrace_Timer, "Setting timer fd failed: %s",
+                   wxSysErrorMsgStr());
+        return;
+    }
+
+    m_timerFDExpiration = expiration;
+#endif // wxUSE_EPOLL_DISPATCHER
+}
 
-    wxFAIL_MSG( wxT("removing inexistent timer?") );
+void wxTimerScheduler::OnTimerFDExpired()
+{
+    // the descriptor is not armed any more after expiring, so ensure that we
+    // set it again, even if no timers are found to have expired (which could
+    // happen if the system time changed)
+    m_timerFDExpiration = 0;
+
+    if ( !NotifyExpired() )
+        UpdateTimerFD();
 }
 
 bool wxTimerScheduler::GetNext(wxUsecClock_t *remaining) const
@@ -96,7 +286,7 @@ bool wxTimerScheduler::GetNext(wxUsecClock_t *remaining) const
 
     wxCHECK_MSG( remaining, false, wxT("null pointer") );
 
-    *remaining = m_timers.begin()->m_expiration - wxGetUTCTimeUSec();
+    *remaining = GetWakeUpTime() - wxGetUTCTimeUSec();
     if ( *remaining < 0 )
     {
         // timer already expired, don't wait at all before notifying it
@@ -113,30 +303,32 @@ bool wxTimerScheduler::NotifyExpired()
 
     const wxUsecClock_t now = wxGetUTCTimeUSec();
 
+    // notice that we don't use the slack here: it's used to delay waking up
+    // to wait for more timers to expire, but once we're awake, all the timers
+    // which have already expired can be notified, and no others
     typedef wxVector<wxUnixTimerImpl *> TimerImpls;
     TimerImpls toNotify;
-    for ( wxTimerList::iterator next,
-            cur = m_timers.begin(); cur != m_timers.end(); cur = next )
+    while ( !m_timers.empty() && m_timers[0].m_expiration <= now )
     {
-        wxTimerSchedule s = *cur;
-        if ( s.m_expiration > now )
-        {
-            // as the list is sorted by expiration time, we can skip the rest
-            break;
-        }
+        wxUnixTimerImpl * const timer = m_timers[0].m_timer;
+        toNotify.push_back(timer);
 
-        // remember next as we will delete the node pointed to by cur
-        next = cur;
-        ++next;
+        DoRemoveAt(0);
+    }
 
-        m_timers.erase(cur);
+    if ( toNotify.empty() )
+        return false;
 
+    // reschedule the periodic timers only after removing all the expired
+    // ones to ensure that we don't notify them again in the loop above even
+    // if their interval is very short
+    for ( auto* timer : toNotify )
+    {
         // check whether we need to keep this timer
-        wxUnixTimerImpl * const timer = s.m_timer;
         if ( timer->IsOneShot() )
         {
             // the timer needs to be stopped but don't call its Stop() from
-            // here as it would attempt to remove the timer from our list and
+            // here as it would attempt to remove the timer from our heap and
             // we had already done it, so we just need to reset its state
             timer->MarkStopped();
         }
@@ -146,20 +338,15 @@ bool wxTimerScheduler::NotifyExpired()
             // the current time instead of just offsetting it from the current
             // expiration time because it could happen that we're late and the
             // current expiration time is (far) in the past
-            s.m_expiration = now + timer->GetInterval()*1000;
-            DoAddTimer(s);
+            DoAddTimer(timer, now + timer->GetInterval()*1000);
         }
-
-        // we can't notify the timer from this loop as the timer event handler
-        // could modify m_timers (for example, but not only, by stopping this
-        // timer) which would render our iterators invalid, so do it after the
-        // loop end
-        toNotify.push_back(timer);
     }
 
-    if ( toNotify.empty() )
-        return false;
+    UpdateTimerFD();
 
+    // we can't notify the timers before updating m_timers as the timer event
+    // handler could modify it (for example, but not only, by stopping this
+    // timer), so do it only now
     for ( auto* item : toNotify )
     {
         item->Notify();
@@ -216,7 +403,14 @@ wxUnixTimerImpl::~wxUnixTimerImpl()
 class wxTimerUnixModule : public wxModule
 {
 public:
-    wxTimerUnixModule() {}
+    wxTimerUnixModule()
+    {
+#if wxUSE_EPOLL_DISPATCHER
+        // the scheduler uses the dispatcher, so it must be destroyed first
+        AddDependency("wxFDIODispatcherModule");
+#endif // wxUSE_EPOLL_DISPATCHER
+    }
+
     virtual bool OnInit() override { return true; }
     virtual void OnExit() override { wxTimerScheduler::Shutdown(); }
 
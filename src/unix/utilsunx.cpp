@@ -58,8 +58,10 @@
 #include "wx/private/fdioeventloopsourcehandler.h"
 #include "wx/config.h"
 #include "wx/filename.h"
+#include "wx/sysopt.h"
 
 #include <memory>
+#include <vector>
 
 #include <pwd.h>
 #include <sys/wait.h>       // waitpid()
@@ -142,6 +144,29 @@
     #include <sys/resource.h>   // for setpriority()
 #endif
 
+#ifdef HAVE_POSIX_SPAWNP
+    #include <spawn.h>
+
+    // posix_spawn() can only be used if we can close all the descriptors
+    // which would be inherited by the child, as we do when using fork()
+    #if defined(HAVE_POSIX_SPAWN_FILE_ACTIONS_ADDCLOSEFROM_NP) || \
+        defined(POSIX_SPAWN_CLOEXEC_DEFAULT)
+        #define wxHAS_POSIX_SPAWN
+    #endif
+#endif // HAVE_POSIX_SPAWNP
+
+#ifdef wxHAS_POSIX_SPAWN
+    #ifdef __DARWIN__
+        // shared libraries don't have access to environ under Mac
+        #include <crt_externs.h>
+        #define wxEnviron (*_NSGetEnviron())
+    #else
+        // this variable is not declared in the headers of all systems
+        extern char **environ;
+        #define wxEnviron environ
+    #endif
+#endif // wxHAS_POSIX_SPAWN
+
 #if defined(__DARWIN__)
     #include <sys/sysctl.h>
     #include <AvailabilityMacros.h>
@@ -585,6 +610,191 @@ int BlockUntilChildExit(wxExecuteData& execData)
 #endif // wxUSE_SELECT_DISPATCHER/!wxUSE_SELECT_DISPATCHER
 }
 
+#ifdef wxHAS_POSIX_SPAWN
+
+// Trivial RAII wrappers for the objects used with posix_spawn().
+class SpawnFileActions
+{
+public:
+    SpawnFileActions() { m_ok = posix_spawn_file_actions_init(&m_actions) == 0; }
+    ~SpawnFileActions() { if ( m_ok ) posix_spawn_file_actions_destroy(&m_actions); }
+
+    bool IsOk() const { return m_ok; }
+    posix_spawn_file_actions_t* Get() { return &m_actions; }
+
+private:
+    posix_spawn_file_actions_t m_actions;
+    bool m_ok;
+
+    wxDECLARE_NO_COPY_CLASS(SpawnFileActions);
+};
+
+class SpawnAttr
+{
+public:
+    SpawnAttr() { m_ok = posix_spawnattr_init(&m_attr) == 0; }
+    ~SpawnAttr() { if ( m_ok ) posix_spawnattr_destroy(&m_attr); }
+
+    bool IsOk() const { return m_ok; }
+    posix_spawnattr_t* Get() { return &m_attr; }
+
+private:
+    posix_spawnattr_t m_attr;
+    bool m_ok;
+
+    wxDECLARE_NO_COPY_CLASS(SpawnAttr);
+};
+
+// Helper function of wxExecute(): launch the child process using
+// posix_spawnp(), which is much faster than fork() for the processes using a
+// lot of memory as it doesn't need to copy their page tables.
+//
+// Returns false if posix_spawnp() can't be used because some of the requested
+// options are not supported by it, in which case fork() must be used instead.
+// Otherwise returns true and fills in the PID of the new process or -1 if it
+// couldn't be launched, with errno indicating the error.
+bool SpawnChild(const char* const* argv,
+                int flags,
+                int prio,
+                const wxPipe& pipeIn,
+                const wxPipe& pipeOut,
+                const wxPipe& pipeErr,
+                const wxExecuteEnv* env,
+                pid_t& pid)
+{
+    // There is no way to change the priority of the child process.
+    if ( prio )
+        return false;
+
+#ifndef POSIX_SPAWN_SETSID
+    if ( flags & wxEXEC_MAKE_GROUP_LEADER )
+        return false;
+#endif // !POSIX_SPAWN_SETSID
+
+    const bool hasCwd = env && !env->cwd.empty();
+#ifndef HAVE_POSIX_SPAWN_FILE_ACTIONS_ADDCHDIR_NP
+    if ( hasCwd )
+        return false;
+#endif // !HAVE_POSIX_SPAWN_FILE_ACTIONS_ADDCHDIR_NP
+
+    // posix_spawnp() searches for the program in our PATH and not in the one
+    // in the child environment, as execvp() called after changing the
+    // environment in the child does, so we can't use it if they differ.
+    const bool hasEnv = env && !env->env.empty();
+    if ( hasEnv && !strchr(*argv, '/') )
+    {
+        wxString path;
+        const bool hasPath = wxGetEnv("PATH", &path);
+
+        const wxEnvVariableHashMap::const_iterator it = env->env.find("PATH");
+        if ( it == env->env.end() ? hasPath : !hasPath || it->second != path )
+            return false;
+    }
+
+    // This option is mostly useful for testing, but could also be used if
+    // some platform turns out to have a buggy posix_spawn() implementation.
+    if ( wxSystemOptions::GetOptionInt("unix.execute.use_fork") )
+        return false;
+
+    SpawnFileActions actions;
+    SpawnAttr attr;
+    if ( !actions.IsOk() || !attr.IsOk() )
+        return false;
+
+    short spawnFlags = 0;
+    int rc = 0;
+
+    // Redirect stdin, stdout and stderr and close all the other descriptors,
+    // just as we do in the child process after fork().
+    if ( pipeIn.IsOk() )
+    {
+        rc = posix_spawn_file_actions_adddup2(actions.Get(),
+                                              pipeIn[wxPipe::Read],
+                                              STDIN_FILENO);
+        if ( !rc )
+            rc = posix_spawn_file_actions_adddup2(actions.Get(),
+                                                  pipeOut[wxPipe::Write],
+                                                  STDOUT_FILENO);
+        if ( !rc )
+            rc = posix_spawn_file_actions_adddup2(actions.Get(),
+                                                  pipeErr[wxPipe::Write],
+                                                  STDERR_FILENO);
+    }
+
+#ifdef HAVE_POSIX_SPAWN_FILE_ACTIONS_ADDCLOSEFROM_NP
+    if ( !rc )
+        rc = posix_spawn_file_actions_addclosefrom_np(actions.Get(),
+                                                      STDERR_FILENO + 1);
+#else // POSIX_SPAWN_CLOEXEC_DEFAULT
+    // All the descriptors not mentioned in the file actions are closed when
+    // using this flag, so explicitly inherit the standard ones.
+    spawnFlags |= POSIX_SPAWN_CLOEXEC_DEFAULT;
+
+    if ( !pipeIn.IsOk() )
+    {
+        for ( int fd = STDIN_FILENO; !rc && fd <= STDERR_FILENO; fd++ )
+            rc = posix_spawn_file_actions_addinherit_np(actions.Get(), fd);
+    }
+#endif // HAVE_POSIX_SPAWN_FILE_ACTIONS_ADDCLOSEFROM_NP/POSIX_SPAWN_CLOEXEC_DEFAULT
+
+#ifdef HAVE_POSIX_SPAWN_FILE_ACTIONS_ADDCHDIR_NP
+    if ( !rc && hasCwd )
+        rc = posix_spawn_file_actions_addchdir_np(actions.Get(),
+                                                  env->cwd.fn_str());
+#endif // HAVE_POSIX_SPAWN_FILE_ACTIONS_ADDCHDIR_NP
+
+#ifdef POSIX_SPAWN_SETSID
+    if ( flags & wxEXEC_MAKE_GROUP_LEADER )
+        spawnFlags |= POSIX_SPAWN_SETSID;
+#endif // POSIX_SPAWN_SETSID
+
+    if ( !rc && spawnFlags )
+        rc = posix_spawnattr_setflags(attr.Get(), spawnFlags);
+
+    // If we failed to set up something, fall back to using fork(), which may
+    // still work.
+    if ( rc )
+        return false;
+
+    // Pass the new environment to the child directly instead of modifying
+    // it in the child process as we do when using fork().
+    std::vector<wxCharBuffer> envStrings;
+    std::vector<char*> envp;
+    char** childEnv;
+    if ( hasEnv )
+    {
+        envStrings.reserve(env->env.size());
+        envp.reserve(env->env.size() + 1);
+
+        for ( const auto& var : env->env )
+        {
+            envStrings.push_back((var.first + '=' + var.second).
+                                    mb_str(wxConvWhateverWorks));
+            envp.push_back(envStrings.back().data());
+        }
+
+        envp.push_back(nullptr);
+
+        childEnv = &envp[0];
+    }
+    else
+    {
+        childEnv = wxEnviron;
+    }
+
+    rc = posix_spawnp(&pid, *argv, actions.Get(), attr.Get(),
+                      const_cast<char**>(argv), childEnv);
+    if ( rc )
+    {
+        pid = -1;
+        errno = rc;
+    }
+
+    return true;
+}
+
+#endif // wxHAS_POSIX_SPAWN
+
 } // anonymous namespace
 
 // wxExecute: the real worker function
@@ -658,17 +868,33 @@ long wxExecute(const char* const* argv, int flags, wxProcess* process,
     else
         prio = (2*prio)/5 - 21;
 
-    // fork the process
-    //
-    // NB: do *not* use vfork() here, it completely breaks this code for some
-    //     reason under Solaris (and maybe others, although not under Linux)
-    //     But on OpenVMS we do not have fork so we have to use vfork and
-    //     cross our fingers that it works.
+#ifdef wxHAS_POSIX_SPAWN
+    // try to use posix_spawn() if possible, as it's much faster than fork()
+    if ( SpawnChild(argv, flags, prio, pipeIn, pipeOut, pipeErr, env, pid) )
+    {
+        if ( pid == -1 )
+        {
+            wxLogSysError(_("Execution of command '%s' failed"), *argv);
+
+            return ERROR_RETURN_CODE;
+        }
+    }
+    else
+#endif // wxHAS_POSIX_SPAWN
+    {
+        // fork the process
+        //
+        // NB: do *not* use vfork() here, it completely breaks this code for
+        //     some reason under Solaris (and maybe others, although not under
+        //     Linux) But on OpenVMS we do not have fork so we have to use
+        //     vfork and cross our fingers that it works.
 #ifdef __VMS
-   pid = vfork();
+        pid = vfork();
 #else
-   pid = fork();
+        pid = fork();
 #endif
+    }
+
    if ( pid == -1 )     // error?
     {
         wxLogSysError( _("Fork failed") );
@@ -819,21 +1045,44 @@ long wxExecute(const char* const* argv, int flags, wxProcess* process,
             wxOutputStream *inStream =
                 new wxPipeOutputStream(pipeIn.Detach(wxPipe::Write));
 
-            const int fdOut = pipeOut.Detach(wxPipe::Read);
-            wxPipeInputStream *outStream = new wxPipeInputStream(fdOut);
+#if wxUSE_EVENTLOOP_SOURCE
+            // Streaming the output is only possible when running
+            // asynchronously, synchronous execution just uses the streams.
+            if ( process->IsOutputStreamed() && !(flags & wxEXEC_SYNC) )
+            {
+                // We must never block when reading from the child, as this
+                // happens from the event loop.
+                pipeOut.MakeNonBlocking(wxPipe::Read);
+                pipeErr.MakeNonBlocking(wxPipe::Read);
+
+                execData.m_outputReader.reset
+                (
+                    new wxExecuteOutputReader(execData,
+                                              pipeOut.Detach(wxPipe::Read),
+                                              pipeErr.Detach(wxPipe::Read))
+                );
+
+                process->SetPipeStreams(nullptr, inStream, nullptr);
+            }
+            else
+#endif // wxUSE_EVENTLOOP_SOURCE
+            {
+                const int fdOut = pipeOut.Detach(wxPipe::Read);
+                wxPipeInputStream *outStream = new wxPipeInputStream(fdOut);
 
-            const int fdErr = pipeErr.Detach(wxPipe::Read);
-            wxPipeInputStream *errStream = new wxPipeInputStream(fdErr);
+                const int fdErr = pipeErr.Detach(wxPipe::Read);
+                wxPipeInputStream *errStream = new wxPipeInputStream(fdErr);
 
-            process->SetPipeStreams(outStream, inStream, errStream);
+                process->SetPipeStreams(outStream, inStream, errStream);
 
-            if ( flags & wxEXEC_SYNC )
-            {
-                execData.m_bufOut.Init(outStream);
-                execData.m_bufErr.Init(errStream);
+                if ( flags & wxEXEC_SYNC )
+                {
+                    execData.m_bufOut.Init(outStream);
+                    execData.m_bufErr.Init(errStream);
 
-                execData.m_fdOut = fdOut;
-                execData.m_fdErr = fdErr;
+                    execData.m_fdOut = fdOut;
+                    execData.m_fdErr = fdErr;
+                }
             }
         }
 #endif // HAS_PIPE_STREAMS
@@ -1862,6 +2111,7 @@ void wxExecuteData::OnExit(int exitcode)
 
 
     m_exitcode = exitcode;
+    m_exited = true;
 
 #if wxUSE_STREAMS
     if ( IsRedirected() )
@@ -1874,6 +2124,28 @@ void wxExecuteData::OnExit(int exitcode)
     }
 #endif // wxUSE_STREAMS
 
+#if wxUSE_EVENTLOOP_SOURCE
+    // If the output is streamed, don't notify about the termination before
+    // all of it is passed to wxProcess: this will be done from OnOutputEOF().
+    if ( m_outputReader && !m_outputReader->IsEOF() )
+        return;
+#endif // wxUSE_EVENTLOOP_SOURCE
+
+    NotifyExit();
+}
+
+#if wxUSE_EVENTLOOP_SOURCE
+
+void wxExecuteData::OnOutputEOF()
+{
+    if ( m_exited )
+        NotifyExit();
+}
+
+#endif // wxUSE_EVENTLOOP_SOURCE
+
+void wxExecuteData::NotifyExit()
+{
     // Notify user about termination if required
     if ( !(m_flags & wxEXEC_SYNC) )
     {
@@ -1894,3 +2166,127 @@ void wxExecuteData::OnExit(int exitcode)
             m_syncEventLoop->ScheduleExit();
     }
 }
+
+// ----------------------------------------------------------------------------
+// wxExecuteOutputReader
+// ----------------------------------------------------------------------------
+
+#if wxUSE_EVENTLOOP_SOURCE
+
+wxExecuteOutputReader::wxExecuteOutputReader(wxExecuteData& execData,
+                                             int fdOut,
+                                             int fdErr)
+    : m_execData(execData),
+      m_chunkSize(execData.m_process->GetOutputChunkSize()),
+      m_paused(false),
+      m_out(*this, fdOut, false),
+      m_err(*this, fdErr, true)
+{
+    m_out.Start();
+    m_err.Start();
+
+    // This may call our Pause() if PauseOutput() had been already called.
+    m_execData.m_process->SetOutputReader(this);
+}
+
+wxExecuteOutputReader::~wxExecuteOutputReader()
+{
+    m_execData.m_process->SetOutputReader(nullptr);
+}
+
+void wxExecuteOutputReader::Pause()
+{
+    // We don't stop monitoring the descriptors immediately because this could
+    // be called from the handler of another descriptor and removing the
+    // handlers other than the current one is unsafe during the dispatching,
+    // so the channels stop themselves when they're notified the next time.
+    m_paused = true;
+}
+
+void wxExecuteOutputReader::Resume()
+{
+    m_paused = false;
+
+    m_out.Start();
+    m_err.Start();
+}
+
+void wxExecuteOutputReader::OnChannelEOF()
+{
+    if ( IsEOF() )
+        m_execData.OnOutputEOF();
+}
+
+wxExecuteOutputReader::Channel::Channel(wxExecuteOutputReader& reader,
+                                        int fd,
+                                        bool isError)
+    : m_reader(reader),
+      m_fd(fd),
+      m_isError(isError),
+      m_source(nullptr),
+      m_buffer(new char[reader.m_chunkSize]),
+      m_inOnOutput(false)
+{
+}
+
+wxExecuteOutputReader::Channel::~Channel()
+{
+    Stop();
+
+    if ( m_fd != -1 )
+        close(m_fd);
+}
+
+void wxExecuteOutputReader::Channel::Start()
+{
+    if ( m_source || IsEOF() )
+        return;
+
+    m_source = wxEventLoopBase::AddSourceForFD(m_fd, this, wxEVENT_SOURCE_INPUT);
+}
+
+void wxExecuteOutputReader::Channel::Stop()
+{
+    wxDELETE(m_source);
+}
+
+void wxExecuteOutputReader::Channel::OnReadWaiting()
+{
+    // Stop monitoring the descriptor if the output was paused or if we're
+    // called from a nested event loop run by the code processing the previous
+    // chunk of data, which still uses our buffer.
+    if ( m_reader.m_paused || m_inOnOutput )
+    {
+        Stop();
+        return;
+    }
+
+    const ssize_t len = read(m_fd, m_buffer.get(), m_reader.m_chunkSize);
+    if ( len > 0 )
+    {
+        m_inOnOutput = true;
+        m_reader.m_execData.m_process->OnOutput(m_buffer.get(), len, m_isError);
+        m_inOnOutput = false;
+
+        // Restart monitoring if we stopped it above in a nested call.
+        if ( !m_reader.m_paused )
+            Start();
+
+        return;
+    }
+
+    if ( len == -1 && (errno == EAGAIN || errno == EINTR) )
+        return;
+
+    // We either reached the end of the output or got an error, in both cases
+    // we won't be able to read anything more.
+    Stop();
+    close(m_fd);
+    m_fd = -1;
+
+    // This may delete the reader and this object, so nothing can be done
+    // after this call.
+    m_reader.OnChannelEOF();
+}
+
+#endif // wxUSE_EVENTLOOP_SOURCE
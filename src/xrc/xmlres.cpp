@@ -2253,7 +2253,18 @@ wxXmlNode *wxXmlResourceHandlerImpl::GetParamNode(const wxString& param)
 
 bool wxXmlResourceHandlerImpl::IsOfClass(wxXmlNode *node, const wxString& classname) const
 {
-    return node->GetAttribute(wxT("class")) == classname;
+    // This is called by CanHandle() of all handlers for all nodes, so avoid
+    // copying the attribute value.
+    for ( const wxXmlAttribute *attr = node->GetAttributes();
+          attr;
+          attr = attr->GetNext() )
+    {
+        if ( attr->GetName() == wxS("class") )
+            return attr->GetValue() == classname;
+    }
+
+    // Missing attribute is the same as an empty one.
+    return classname.empty();
 }
 
 
@@ -735,5 +735,64 @@ void wxAnyTestCase::Misc()
     CPPUNIT_ASSERT_EQUAL(gs_myClassInstances.size(), 0);
 }
 
+namespace
+{
+
+// Class counting its copies, of the given size.
+template <size_t N>
+class CopyCounter
+{
+public:
+    CopyCounter() = default;
+    CopyCounter(const CopyCounter&) { ms_copies++; }
+    CopyCounter(CopyCounter&&) = default;
+
+    static int ms_copies;
+
+private:
+    char m_data[N] = { 0 };
+};
+
+template <size_t N>
+int CopyCounter<N>::ms_copies = 0;
+
+// Check that moving wxAny containing the given type doesn't copy it.
+template <typename T>
+void CheckMoveDoesntCopy()
+{
+    wxAny any1 = T();
+    T::ms_copies = 0;
+
+    wxAny any2(std::move(any1));
+    CHECK( any1.IsNull() );
+    CHECK( any2.CheckType<T>() );
+
+    wxAny any3;
+    any3 = std::move(any2);
+    CHECK( any2.IsNull() );
+    CHECK( any3.CheckType<T>() );
+
+    CHECK( T::ms_copies == 0 );
+}
+
+} // anonymous namespace
+
+TEST_CASE("wxAny::Move", "[any]")
+{
+    // Check both the values stored in wxAny itself and on the heap.
+    CheckMoveDoesntCopy< CopyCounter<1> >();
+    CheckMoveDoesntCopy< CopyCounter<WX_ANY_VALUE_BUFFER_SIZE * 2> >();
+
+    wxAny any1(wxString("Hello"));
+    wxAny any2(std::move(any1));
+    CHECK( any1.IsNull() );
+    CHECK( any2.As<wxString>() == "Hello" );
+
+    any1 = 17;
+    any2 = std::move(any1);
+    CHECK( any1.IsNull() );
+    CHECK( any2.As<int>() == 17 );
+}
+
 #endif // wxUSE_ANY
 
@@ -384,6 +384,12 @@ TEST_CASE("wxArrayString::Vector", "[dynarray][vector]")
     }
 }
 
+static int wxCMPFUNC_CONV
+StringSortAscendingNoCase(const wxString& s1, const wxString& s2)
+{
+    return s1.CmpNoCase(s2);
+}
+
 TEST_CASE("wxSortedArrayString", "[dynarray]")
 {
     wxSortedArrayString a;
@@ -413,6 +419,141 @@ TEST_CASE("wxSortedArrayString", "[dynarray]")
     CHECK( ad.Index("AB") == 2 );
     CHECK( ad.Index("A") == wxNOT_FOUND );
     CHECK( ad.Index("z") == wxNOT_FOUND );
+
+    wxArrayString src;
+    src.push_back("b");
+    src.push_back("B");
+    src.push_back("a");
+    src.push_back("A");
+
+    wxSortedArrayString as(src);
+    REQUIRE( as.size() == 4 );
+    CHECK( as[0] == "A" );
+    CHECK( as[1] == "B" );
+    CHECK( as[2] == "a" );
+    CHECK( as[3] == "b" );
+    CHECK( as.Index("a") == 2 );
+
+    // The strings comparing equal must keep their relative order.
+    wxSortedArrayString asc(src, StringSortAscendingNoCase);
+    REQUIRE( asc.size() == 4 );
+    CHECK( asc[0] == "a" );
+    CHECK( asc[1] == "A" );
+    CHECK( asc[2] == "b" );
+    CHECK( asc[3] == "B" );
+}
+
+namespace
+{
+
+// Return a big array of strings in random order, including the strings with
+// common prefixes, empty and non-ASCII strings, so that it exercises all the
+// code paths of the sorting algorithms.
+wxArrayString GetBigTestArray(size_t count)
+{
+    wxArrayString a;
+    a.reserve(count);
+
+    srand(17);
+    for ( size_t n = 0; n < count; n++ )
+    {
+        wxString s;
+        switch ( rand() % 4 )
+        {
+            case 0:
+                s.Printf("file%d.txt", rand() % 1000);
+                break;
+
+            case 1:
+                s.Printf("common/prefix/%d/%d", rand() % 10, rand());
+                break;
+
+            case 2:
+                s = wxString(wxUniChar(0x400 + rand() % 64), rand() % 4);
+                break;
+
+            case 3:
+                s.Printf("%c%c", 'A' + rand() % 50, 'A' + rand() % 50);
+                break;
+        }
+
+        a.push_back(s);
+    }
+
+    return a;
+}
+
+} // anonymous namespace
+
+TEST_CASE("wxArrayString::SortBig", "[dynarray][sort]")
+{
+    const wxArrayString orig = GetBigTestArray(50000);
+
+    std::vector<wxString> expected(orig.begin(), orig.end());
+    std::sort(expected.begin(), expected.end());
+
+    SECTION("Sort")
+    {
+        wxArrayString a(orig);
+        a.Sort();
+        CHECK( a.AsVector() == expected );
+
+        a.Sort(true /* reverse */);
+        std::reverse(expected.begin(), expected.end());
+        CHECK( a.AsVector() == expected );
+    }
+
+    SECTION("SortParallel")
+    {
+        wxArrayString a(orig);
+        a.SortParallel();
+        CHECK( a.AsVector() == expected );
+
+        a.SortParallel(true /* reverse */);
+        std::reverse(expected.begin(), expected.end());
+        CHECK( a.AsVector() == expected );
+    }
+
+    SECTION("SortParallelFunction")
+    {
+        wxArrayString a(orig);
+        a.SortParallel(StringSortAscendingNoCase);
+
+        for ( size_t n = 1; n < a.size(); n++ )
+        {
+            if ( a[n - 1].CmpNoCase(a[n]) > 0 )
+            {
+                FAIL_CHECK("Not sorted at " << n);
+                break;
+            }
+        }
+    }
+
+    SECTION("SortedArray")
+    {
+        wxSortedArrayString a(orig);
+        CHECK( std::equal(a.begin(), a.end(), expected.begin()) );
+        CHECK( a.Index(expected[1234]) != wxNOT_FOUND );
+    }
+}
+
+TEST_CASE("wxArrayString::SortDeep", "[dynarray][sort]")
+{
+    // Each of these strings differs from the others at a different position,
+    // check that sorting them doesn't recurse once per character.
+    wxArrayString a;
+    std::vector<wxString> expected;
+    for ( size_t n = 0; n < 3000; n++ )
+    {
+        const wxString s = wxString('a', n) + 'b';
+        a.push_back(s);
+        expected.push_back(s);
+    }
+
+    std::sort(expected.begin(), expected.end());
+
+    a.Sort();
+    CHECK( a.AsVector() == expected );
 }
 
 TEST_CASE("Arrays::Split", "[dynarray]")
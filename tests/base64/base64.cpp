@@ -19,6 +19,10 @@
 #if wxUSE_BASE64
 
 #include "wx/base64.h"
+#include "wx/base64stream.h"
+#include "wx/mstream.h"
+
+#include <string>
 
 static const char encoded0to255[] =
     "AAECAwQFBgcICQoLDA0ODxAREhMUFRYXGBkaGxwdHh8gISIj"
@@ -65,6 +69,30 @@ static void generateGibberish(void* buff, size_t len)
     }
 }
 
+// Straightforward encoder used for checking the results of the optimized one.
+static std::string encodeSimple(const unsigned char* buff, size_t len)
+{
+    static const char cb64[] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    std::string s;
+    for ( size_t n = 0; n < len; n += 3 )
+    {
+        unsigned long bits = (unsigned long)buff[n] << 16;
+        if ( n + 1 < len )
+            bits |= buff[n + 1] << 8;
+        if ( n + 2 < len )
+            bits |= buff[n + 2];
+
+        s += cb64[(bits >> 18) & 63];
+        s += cb64[(bits >> 12) & 63];
+        s += n + 1 < len ? cb64[(bits >> 6) & 63] : '=';
+        s += n + 2 < len ? cb64[bits & 63] : '=';
+    }
+
+    return s;
+}
+
 // --------------------------------------------------------------------------
 // test class
 // --------------------------------------------------------------------------
@@ -262,4 +290,241 @@ TEST_CASE("Decode Invalid", "[base64]")
     CHECK( !wxBase64Decode("wxGetApp()").GetDataLen() );
 }
 
+TEST_CASE("Encode Decode Big", "[base64]")
+{
+    // Use all the sizes around the multiples of the block sizes used by the
+    // optimized code to check that the tail is handled correctly.
+    for ( size_t size = 0; size < 100; size++ )
+    {
+        INFO("Size " << size);
+
+        unsigned char buff[100];
+        generateRandomData(buff, size);
+
+        const std::string expected = encodeSimple(buff, size);
+
+        char encoded[136];
+        REQUIRE( wxBase64Encode(encoded, sizeof(encoded), buff, size)
+                    == expected.length() );
+        CHECK( std::string(encoded, expected.length()) == expected );
+
+        // Buffer too small by one character must result in an error.
+        if ( size )
+        {
+            CHECK( wxBase64Encode(encoded, expected.length() - 1, buff, size)
+                    == wxCONV_FAILED );
+        }
+
+        unsigned char decoded[100];
+        REQUIRE( wxBase64Decode(decoded, sizeof(decoded), expected.c_str())
+                    == size );
+        CHECK( memcmp(decoded, buff, size) == 0 );
+
+        if ( size )
+        {
+            CHECK( wxBase64Decode(decoded, size - 1, expected.c_str())
+                    == wxCONV_FAILED );
+        }
+    }
+
+    const size_t size = 100000;
+    wxMemoryBuffer buf(size);
+    generateRandomData(buf.GetWriteBuf(size), size);
+    buf.UngetWriteBuf(size);
+
+    const wxString str = wxBase64Encode(buf);
+    CHECK( str.utf8_string()
+            == encodeSimple((unsigned char*)buf.GetData(), size) );
+
+    const wxMemoryBuffer buf2 = wxBase64Decode(str);
+    REQUIRE( buf2.GetDataLen() == size );
+    CHECK( memcmp(buf2.GetData(), buf.GetData(), size) == 0 );
+}
+
+TEST_CASE("Decode Invalid Big", "[base64]")
+{
+    unsigned char buff[300];
+    generateRandomData(buff, sizeof(buff));
+
+    const std::string encoded = encodeSimple(buff, sizeof(buff));
+
+    // An invalid character must be detected wherever it occurs.
+    for ( size_t pos = 0; pos < encoded.length(); pos += 7 )
+    {
+        INFO("Position " << pos);
+
+        std::string s = encoded;
+        s[pos] = '!';
+
+        size_t posErr = 0;
+        CHECK( wxBase64Decode(nullptr, 0, s.c_str(), s.length(),
+                              wxBase64DecodeMode_Strict, &posErr)
+                == wxCONV_FAILED );
+        CHECK( posErr == pos );
+
+        unsigned char decoded[300];
+        CHECK( wxBase64Decode(decoded, sizeof(decoded), s.c_str(), s.length(),
+                              wxBase64DecodeMode_Strict, &posErr)
+                == wxCONV_FAILED );
+        CHECK( posErr == pos );
+    }
+
+    // Whitespace in the middle of long lines must be skipped if requested.
+    std::string withLines;
+    for ( size_t pos = 0; pos < encoded.length(); pos += 76 )
+    {
+        withLines += encoded.substr(pos, 76);
+        withLines += "\r\n";
+    }
+
+    unsigned char decoded[300];
+    CHECK( wxBase64Decode(decoded, sizeof(decoded),
+                          withLines.c_str(), withLines.length(),
+                          wxBase64DecodeMode_Strict) == wxCONV_FAILED );
+    REQUIRE( wxBase64Decode(decoded, sizeof(decoded),
+                            withLines.c_str(), withLines.length(),
+                            wxBase64DecodeMode_SkipWS) == sizeof(buff) );
+    CHECK( memcmp(decoded, buff, sizeof(buff)) == 0 );
+}
+
+#if wxUSE_STREAMS
+
+TEST_CASE("Base64 Streams", "[base64][stream]")
+{
+    const size_t size = 10000;
+    wxMemoryBuffer buf(size);
+    generateRandomData(buf.GetWriteBuf(size), size);
+    buf.UngetWriteBuf(size);
+
+    const unsigned char* const data = (unsigned char*)buf.GetData();
+    const std::string expected = encodeSimple(data, size);
+
+    // Check that writing the data in chunks of different sizes produces the
+    // same result.
+    const size_t chunkSizes[] = { 1, 2, 3, 5, 1000, 4096, size };
+    for ( size_t n = 0; n < WXSIZEOF(chunkSizes); n++ )
+    {
+        const size_t chunkSize = chunkSizes[n];
+        INFO("Chunk size " << chunkSize);
+
+        wxMemoryOutputStream mos;
+        {
+            wxBase64EncoderOutputStream enc(mos);
+            for ( size_t pos = 0; pos < size; pos += chunkSize )
+            {
+                const size_t len = wxMin(chunkSize, size - pos);
+                REQUIRE( enc.Write(data + pos, len).LastWrite() == len );
+            }
+
+            CHECK( enc.GetLength() == wxFileOffset(size) );
+            CHECK( enc.Close() );
+        }
+
+        const size_t lenEncoded = mos.GetLength();
+        REQUIRE( lenEncoded == expected.length() );
+
+        std::string encoded(lenEncoded, '\0');
+        mos.CopyTo(&encoded[0], lenEncoded);
+        CHECK( encoded == expected );
+
+        // And reading it back in chunks works as well.
+        wxMemoryInputStream mis(mos);
+        wxBase64DecoderInputStream dec(mis);
+
+        wxMemoryBuffer decoded;
+        char chunk[4096];
+        for ( ;; )
+        {
+            const size_t len = dec.Read(chunk, wxMin(chunkSize, sizeof(chunk)))
+                                  .LastRead();
+            if ( !len )
+                break;
+
+            decoded.AppendData(chunk, len);
+        }
+
+        CHECK( dec.GetLastError() == wxSTREAM_EOF );
+        REQUIRE( decoded.GetDataLen() == size );
+        CHECK( memcmp(decoded.GetData(), data, size) == 0 );
+    }
+
+    SECTION("Short")
+    {
+        wxMemoryOutputStream mos;
+        {
+            wxBase64EncoderOutputStream enc(mos);
+            enc.Write("AB", 2);
+        }
+
+        CHECK( mos.GetLength() == 4 );
+
+        char encoded[4];
+        mos.CopyTo(encoded, 4);
+        CHECK( memcmp(encoded, "QUI=", 4) == 0 );
+    }
+
+    SECTION("Whitespace")
+    {
+        std::string withLines;
+        for ( size_t pos = 0; pos < expected.length(); pos += 76 )
+        {
+            withLines += expected.substr(pos, 76);
+            withLines += "\n";
+        }
+
+        wxMemoryInputStream mis(withLines.c_str(), withLines.length());
+        wxBase64DecoderInputStream dec(mis);
+
+        wxMemoryOutputStream mos;
+        dec.Read(mos);
+        CHECK( dec.GetLastError() == wxSTREAM_EOF );
+        REQUIRE( mos.GetLength() == wxFileOffset(size) );
+
+        wxMemoryBuffer decoded(size);
+        mos.CopyTo(decoded.GetWriteBuf(size), size);
+        CHECK( memcmp(decoded.GetData(), data, size) == 0 );
+
+        // This is not allowed in strict mode.
+        wxMemoryInputStream mis2(withLines.c_str(), withLines.length());
+        wxBase64DecoderInputStream dec2(mis2, wxBase64DecodeMode_Strict);
+
+        char chunk[4096];
+        while ( dec2.Read(chunk, sizeof(chunk)).LastRead() )
+            ;
+        CHECK( dec2.GetLastError() == wxSTREAM_READ_ERROR );
+    }
+
+    SECTION("Errors")
+    {
+        char chunk[16];
+
+        // Truncated input.
+        wxMemoryInputStream mis1("QUJDRA=", 7);
+        wxBase64DecoderInputStream dec1(mis1);
+        CHECK( dec1.Read(chunk, sizeof(chunk)).LastRead() == 3 );
+        CHECK( dec1.GetLastError() == wxSTREAM_READ_ERROR );
+
+        // Invalid character.
+        wxMemoryInputStream mis2("QUJD!", 5);
+        wxBase64DecoderInputStream dec2(mis2);
+        dec2.Read(chunk, sizeof(chunk));
+        CHECK( dec2.GetLastError() == wxSTREAM_READ_ERROR );
+
+        // Data after the padding.
+        wxMemoryInputStream mis3("QUI=QUI=", 8);
+        wxBase64DecoderInputStream dec3(mis3);
+        dec3.Read(chunk, sizeof(chunk));
+        CHECK( dec3.GetLastError() == wxSTREAM_READ_ERROR );
+
+        // But just whitespace after it is fine.
+        wxMemoryInputStream mis4("QUI=\r\n", 6);
+        wxBase64DecoderInputStream dec4(mis4);
+        CHECK( dec4.Read(chunk, sizeof(chunk)).LastRead() == 2 );
+        CHECK( dec4.GetLastError() == wxSTREAM_EOF );
+        CHECK( memcmp(chunk, "AB", 2) == 0 );
+    }
+}
+
+#endif // wxUSE_STREAMS
+
 #endif // wxUSE_BASE64
@@ -0,0 +1,152 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        tests/benchmarks/base64.cpp
+// Purpose:     BASE64 encoding and decoding benchmarks
+// Author:      wxWidgets team
+// Created:     2026-10-19
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include "wx/base64.h"
+#include "wx/base64stream.h"
+#include "wx/mstream.h"
+#include "wx/utils.h"
+
+#include "bench.h"
+
+namespace
+{
+
+// Size of the data used by the benchmarks, 1MB by default.
+size_t GetDataSize()
+{
+    return Bench::GetNumericParameter(1024*1024);
+}
+
+const wxMemoryBuffer& GetTestData()
+{
+    static wxMemoryBuffer s_data;
+    if ( s_data.IsEmpty() )
+    {
+        const size_t size = GetDataSize();
+        unsigned char* const p = static_cast<unsigned char*>(s_data.GetWriteBuf(size));
+        for ( size_t n = 0; n < size; n++ )
+            p[n] = static_cast<unsigned char>(rand());
+        s_data.UngetWriteBuf(size);
+    }
+
+    return s_data;
+}
+
+const wxCharBuffer& GetEncodedTestData()
+{
+    static wxCharBuffer s_encoded;
+    if ( !s_encoded.length() )
+    {
+        const wxMemoryBuffer& data = GetTestData();
+        const size_t len = wxBase64EncodedSize(data.GetDataLen());
+
+        s_encoded.extend(len);
+        wxBase64Encode(s_encoded.data(), len, data.GetData(), data.GetDataLen());
+    }
+
+    return s_encoded;
+}
+
+// Return the encoded data split into lines of 76 characters, as in MIME.
+const wxCharBuffer& GetEncodedTestDataWithLines()
+{
+    static wxCharBuffer s_encoded;
+    if ( !s_encoded.length() )
+    {
+        const wxCharBuffer& encoded = GetEncodedTestData();
+        const size_t len = encoded.length();
+
+        wxString s;
+        s.reserve(len + len / 38);
+        for ( size_t pos = 0; pos < len; pos += 76 )
+        {
+            s.append(encoded.data() + pos, wxMin(len - pos, size_t(76)));
+            s.append("\r\n");
+        }
+
+        s_encoded = s.utf8_str();
+    }
+
+    return s_encoded;
+}
+
+} // anonymous namespace
+
+BENCHMARK_FUNC(Base64Encode)
+{
+    static wxCharBuffer s_buf;
+
+    const wxMemoryBuffer& data = GetTestData();
+    const size_t len = wxBase64EncodedSize(data.GetDataLen());
+    if ( s_buf.length() != len )
+        s_buf.extend(len);
+
+    return wxBase64Encode(s_buf.data(), len, data.GetData(), data.GetDataLen())
+            == len;
+}
+
+BENCHMARK_FUNC(Base64EncodeString)
+{
+    return !wxBase64Encode(GetTestData()).empty();
+}
+
+BENCHMARK_FUNC(Base64Decode)
+{
+    static wxMemoryBuffer s_buf;
+
+    const wxCharBuffer& encoded = GetEncodedTestData();
+    const size_t len = GetDataSize();
+
+    return wxBase64Decode(s_buf.GetWriteBuf(len), len,
+                          encoded.data(), encoded.length()) == len;
+}
+
+BENCHMARK_FUNC(Base64DecodeLines)
+{
+    static wxMemoryBuffer s_buf;
+
+    const wxCharBuffer& encoded = GetEncodedTestDataWithLines();
+    const size_t len = GetDataSize();
+
+    return wxBase64Decode(s_buf.GetWriteBuf(len), len,
+                          encoded.data(), encoded.length(),
+                          wxBase64DecodeMode_SkipWS) == len;
+}
+
+BENCHMARK_FUNC(Base64EncoderStream)
+{
+    const wxMemoryBuffer& data = GetTestData();
+
+    wxMemoryOutputStream mos;
+    wxBase64EncoderOutputStream enc(mos);
+
+    // Write the data in relatively small chunks, as a typical application
+    // serializing its data to the stream would do.
+    const char* p = static_cast<const char*>(data.GetData());
+    const size_t size = data.GetDataLen();
+    for ( size_t pos = 0; pos < size; pos += 1000 )
+        enc.Write(p + pos, wxMin(size - pos, size_t(1000)));
+
+    return enc.Close() &&
+            mos.GetLength() == wxFileOffset(wxBase64EncodedSize(size));
+}
+
+BENCHMARK_FUNC(Base64DecoderStream)
+{
+    const wxCharBuffer& encoded = GetEncodedTestDataWithLines();
+
+    wxMemoryInputStream mis(encoded.data(), encoded.length());
+    wxBase64DecoderInputStream dec(mis);
+
+    char buf[1000];
+    size_t total = 0;
+    while ( dec.Read(buf, sizeof(buf)).LastRead() )
+        total += dec.LastRead();
+
+    return total == GetDataSize();
+}
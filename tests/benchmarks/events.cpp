@@ -0,0 +1,281 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        tests/benchmarks/events.cpp
+// Purpose:     Benchmarks for dispatching, queuing and processing events
+// Author:      wxWidgets team
+// Created:     2026-10-19
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include "wx/app.h"
+#include "wx/event.h"
+#include "wx/thread.h"
+
+#include "bench.h"
+
+#include <memory>
+#include <vector>
+
+namespace
+{
+
+// Number of events queued by a single benchmark run, 100000 by default.
+int GetEventsCount()
+{
+    return Bench::GetNumericParameter(100000);
+}
+
+// Number of the threads queuing the events.
+int GetThreadsCount()
+{
+    const int count = wxThread::GetCPUCount();
+    return count > 1 ? count - 1 : 1;
+}
+
+// Handler simply counting the events it receives.
+class CountingHandler : public wxEvtHandler
+{
+public:
+    CountingHandler()
+    {
+        Bind(wxEVT_THREAD, &CountingHandler::OnThreadEvent, this);
+    }
+
+    int GetCount() const { return m_count; }
+
+private:
+    void OnThreadEvent(wxThreadEvent& event)
+    {
+        m_count++;
+
+        if ( event.GetPayload<wxSemaphore*>() )
+            event.GetPayload<wxSemaphore*>()->Post();
+    }
+
+    int m_count = 0;
+};
+
+// Thread queuing the given number of events to the handler, optionally
+// waiting until each of them is processed before queuing the next one.
+class QueuingThread : public wxThread
+{
+public:
+    QueuingThread(wxEvtHandler& handler, int count, bool waitForEach)
+        : wxThread(wxTHREAD_JOINABLE),
+          m_handler(handler),
+          m_count(count),
+          m_waitForEach(waitForEach)
+    {
+    }
+
+protected:
+    virtual ExitCode Entry() override
+    {
+        for ( int n = 0; n < m_count; n++ )
+        {
+            wxThreadEvent* const event = new wxThreadEvent();
+            if ( m_waitForEach )
+                event->SetPayload(&m_processed);
+            else
+                event->SetPayload<wxSemaphore*>(nullptr);
+
+            m_handler.QueueEvent(event);
+
+            if ( m_waitForEach )
+                m_processed.Wait();
+        }
+
+        return nullptr;
+    }
+
+private:
+    wxEvtHandler& m_handler;
+    const int m_count;
+    const bool m_waitForEach;
+
+    wxSemaphore m_processed;
+};
+
+// Run the threads queuing the given total number of events and process them
+// in this thread, returns true if all of them were processed.
+bool RunQueuingThreads(int numThreads, bool waitForEach)
+{
+    CountingHandler handler;
+
+    const int total = GetEventsCount();
+
+    std::vector<std::unique_ptr<QueuingThread>> threads;
+    for ( int n = 0; n < numThreads; n++ )
+    {
+        // Distribute the remainder of the division among the first threads.
+        const int count = total / numThreads + (n < total % numThreads);
+
+        threads.emplace_back(new QueuingThread(handler, count, waitForEach));
+        if ( threads.back()->Run() != wxTHREAD_NO_ERROR )
+            return false;
+    }
+
+    while ( handler.GetCount() < total )
+        wxTheApp->ProcessPendingEvents();
+
+    for ( auto& thread : threads )
+        thread->Wait();
+
+    return handler.GetCount() == total;
+}
+
+// Number of the handlers bound to the handler used by dispatch benchmarks.
+size_t GetBoundHandlersCount()
+{
+    return Bench::GetNumericParameter(100);
+}
+
+// Number of events dispatched by a single run of these benchmarks.
+const int NUM_DISPATCHED = 1000;
+
+// Event type for which no handlers are bound.
+wxDEFINE_EVENT(EVT_BENCH_UNBOUND, wxThreadEvent);
+
+// Handler with many handlers bound to it, for different event types, as is
+// typical for the top level windows of the real applications.
+class ManyBoundHandler : public wxEvtHandler
+{
+public:
+    ManyBoundHandler()
+    {
+        for ( size_t n = 0; n < GetBoundHandlersCount(); n++ )
+        {
+            const wxEventType eventType = wxNewEventType();
+            if ( !n )
+                m_firstType = eventType;
+
+            Bind(wxEventTypeTag<wxThreadEvent>(eventType),
+                 &ManyBoundHandler::OnEvent, this);
+        }
+    }
+
+    // The type of the event bound first, i.e. checked last.
+    wxEventType GetFirstType() const { return m_firstType; }
+
+    int GetCount() const { return m_count; }
+
+private:
+    void OnEvent(wxThreadEvent&) { m_count++; }
+
+    wxEventType m_firstType = wxEVT_NULL;
+    int m_count = 0;
+};
+
+ManyBoundHandler* gs_manyBoundHandler = nullptr;
+
+bool CreateManyBoundHandler()
+{
+    gs_manyBoundHandler = new ManyBoundHandler();
+    return true;
+}
+
+void DeleteManyBoundHandler()
+{
+    wxDELETE(gs_manyBoundHandler);
+}
+
+} // anonymous namespace
+
+// Dispatch the event for which the handler was bound first, which is the last
+// one to be found when searching the handlers in the reverse order of binding.
+BENCHMARK_FUNC_WITH_INIT(DispatchBoundFirst,
+                         CreateManyBoundHandler, DeleteManyBoundHandler)
+{
+    ManyBoundHandler& handler = *gs_manyBoundHandler;
+
+    const int countOld = handler.GetCount();
+
+    wxThreadEvent event(handler.GetFirstType());
+    for ( int n = 0; n < NUM_DISPATCHED; n++ )
+        handler.ProcessEvent(event);
+
+    return handler.GetCount() == countOld + NUM_DISPATCHED;
+}
+
+// Dispatch the event for which no handlers are bound at all.
+BENCHMARK_FUNC_WITH_INIT(DispatchUnbound,
+                         CreateManyBoundHandler, DeleteManyBoundHandler)
+{
+    ManyBoundHandler& handler = *gs_manyBoundHandler;
+
+    wxThreadEvent event(EVT_BENCH_UNBOUND);
+    bool processed = false;
+    for ( int n = 0; n < NUM_DISPATCHED; n++ )
+        processed |= handler.ProcessEvent(event);
+
+    return !processed;
+}
+
+// Queue the events from the main thread and process them all at once.
+BENCHMARK_FUNC(QueueEventSameThread)
+{
+    CountingHandler handler;
+
+    const int total = GetEventsCount();
+    for ( int n = 0; n < total; n++ )
+    {
+        wxThreadEvent* const event = new wxThreadEvent();
+        event->SetPayload<wxSemaphore*>(nullptr);
+        handler.QueueEvent(event);
+    }
+
+    wxTheApp->ProcessPendingEvents();
+
+    return handler.GetCount() == total;
+}
+
+// Queue the events with a string and payload, as typically done by the worker
+// threads to pass their results to the main thread, either by cloning or by
+// moving the event.
+static bool QueueEventsWithPayload(bool move)
+{
+    CountingHandler handler;
+
+    const wxString str(wxS('x'), 100);
+
+    const int total = GetEventsCount();
+    for ( int n = 0; n < total; n++ )
+    {
+        wxThreadEvent event;
+        event.SetString(str);
+        event.SetPayload<wxSemaphore*>(nullptr);
+
+        if ( move )
+            wxQueueEvent(&handler, std::move(event));
+        else
+            wxQueueEvent(&handler, event.Clone());
+    }
+
+    wxTheApp->ProcessPendingEvents();
+
+    return handler.GetCount() == total;
+}
+
+BENCHMARK_FUNC(QueueEventClone)
+{
+    return QueueEventsWithPayload(false);
+}
+
+BENCHMARK_FUNC(QueueEventMove)
+{
+    return QueueEventsWithPayload(true);
+}
+
+// Throughput: all threads queue their events as fast as they can while the
+// main thread processes them concurrently.
+BENCHMARK_FUNC(QueueEventThreads)
+{
+    return RunQueuingThreads(GetThreadsCount(), false);
+}
+
+// Latency: a single thread queues an event and waits until it's processed by
+// the main thread before queuing the next one, so the time of a single run
+// divided by the number of events is the round trip time.
+BENCHMARK_FUNC(QueueEventLatency)
+{
+    return RunQueuingThreads(1, true);
+}
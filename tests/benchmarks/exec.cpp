@@ -0,0 +1,91 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        tests/benchmarks/exec.cpp
+// Purpose:     Benchmarks for launching short-lived child processes
+// Author:      wxWidgets team
+// Created:     2026-10-19
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include "wx/utils.h"
+#include "wx/sysopt.h"
+
+#include "bench.h"
+
+// These benchmarks use Unix commands and the Unix-specific system option.
+#ifdef __UNIX__
+
+#include <string.h>
+
+namespace
+{
+
+// Number of processes launched by a single benchmark run.
+const int NUM_PROCESSES = 20;
+
+// Memory allocated by InitMemory() to make the process bigger, as the cost of
+// fork() is proportional to the amount of memory used by the parent.
+char* gs_memory = nullptr;
+
+bool InitMemory()
+{
+    // Use the benchmark parameter as the size of the memory to use in MiB.
+    const size_t size = static_cast<size_t>(Bench::GetNumericParameter(0))
+                            * 1024 * 1024;
+    if ( size )
+    {
+        gs_memory = new char[size];
+
+        // Touch all the pages to really map them.
+        memset(gs_memory, 1, size);
+    }
+
+    return true;
+}
+
+void FreeMemory()
+{
+    delete [] gs_memory;
+    gs_memory = nullptr;
+}
+
+bool LaunchProcesses()
+{
+    for ( int n = 0; n < NUM_PROCESSES; n++ )
+    {
+        if ( wxExecute("true", wxEXEC_BLOCK) != 0 )
+            return false;
+    }
+
+    return true;
+}
+
+bool InitMemoryForFork()
+{
+    wxSystemOptions::SetOption("unix.execute.use_fork", 1);
+
+    return InitMemory();
+}
+
+void FreeMemoryForFork()
+{
+    wxSystemOptions::SetOption("unix.execute.use_fork", 0);
+
+    FreeMemory();
+}
+
+} // anonymous namespace
+
+// Launch short-lived processes using the default method, i.e. posix_spawn()
+// if it's available.
+BENCHMARK_FUNC_WITH_INIT(ExecuteDefault, InitMemory, FreeMemory)
+{
+    return LaunchProcesses();
+}
+
+// Launch the same processes always using fork().
+BENCHMARK_FUNC_WITH_INIT(ExecuteFork, InitMemoryForFork, FreeMemoryForFork)
+{
+    return LaunchProcesses();
+}
+
+#endif // __UNIX__
@@ -0,0 +1,179 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        tests/benchmarks/locks.cpp
+// Purpose:     Benchmarks for the different kinds of locks
+// Author:      wxWidgets team
+// Created:     2026-10-19
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include "bench.h"
+
+#include "wx/thread.h"
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#if wxUSE_THREADS
+
+// All the benchmarks here perform the same number of short critical sections
+// using the number of threads given by the numeric parameter (4 by default),
+// e.g. use "bench -p 1" to measure the uncontended case.
+
+namespace
+{
+
+const int NUM_ITERATIONS = 100000;
+
+int GetThreadsCount()
+{
+    return Bench::GetNumericParameter(4);
+}
+
+class FunctionThread : public wxThread
+{
+public:
+    explicit FunctionThread(const std::function<void()>& func)
+        : wxThread(wxTHREAD_JOINABLE),
+          m_func(func)
+    {
+    }
+
+protected:
+    virtual void* Entry() override
+    {
+        m_func();
+        return nullptr;
+    }
+
+private:
+    const std::function<void()> m_func;
+};
+
+// Divide NUM_ITERATIONS between the threads calling the given function.
+bool RunInThreads(const std::function<void (int)>& func)
+{
+    const int numThreads = GetThreadsCount();
+    const int count = NUM_ITERATIONS / numThreads;
+
+    std::vector< std::unique_ptr<FunctionThread> > threads;
+    for ( int n = 0; n < numThreads; n++ )
+    {
+        threads.emplace_back(new FunctionThread([&func, count]() { func(count); }));
+        if ( threads.back()->Run() != wxTHREAD_NO_ERROR )
+            return false;
+    }
+
+    for ( auto& thread : threads )
+        thread->Wait();
+
+    return true;
+}
+
+// Data protected by the locks.
+int gs_data[16];
+
+int ReadData()
+{
+    int sum = 0;
+    for ( auto x : gs_data )
+        sum += x;
+    return sum;
+}
+
+void WriteData()
+{
+    for ( auto& x : gs_data )
+        x++;
+}
+
+} // anonymous namespace
+
+BENCHMARK_FUNC(MutexLock)
+{
+    static wxMutex s_mutex;
+
+    return RunInThreads([](int count)
+        {
+            for ( int n = 0; n < count; n++ )
+            {
+                wxMutexLocker lock(s_mutex);
+                WriteData();
+            }
+        });
+}
+
+BENCHMARK_FUNC(CriticalSectionLock)
+{
+    static wxCriticalSection s_cs;
+
+    return RunInThreads([](int count)
+        {
+            for ( int n = 0; n < count; n++ )
+            {
+                wxCriticalSectionLocker lock(s_cs);
+                WriteData();
+            }
+        });
+}
+
+BENCHMARK_FUNC(SpinMutexLock)
+{
+    static wxSpinMutex s_mutex;
+
+    return RunInThreads([](int count)
+        {
+            for ( int n = 0; n < count; n++ )
+            {
+                wxSpinMutexLocker lock(s_mutex);
+                WriteData();
+            }
+        });
+}
+
+// Read-mostly workload with 1 write for 20 reads: compare using exclusive
+// lock for everything with using the shared one.
+BENCHMARK_FUNC(ReadMostlyMutex)
+{
+    static wxMutex s_mutex;
+
+    return RunInThreads([](int count)
+        {
+            int sum = 0;
+            for ( int n = 0; n < count; n++ )
+            {
+                wxMutexLocker lock(s_mutex);
+                if ( n % 20 )
+                    sum += ReadData();
+                else
+                    WriteData();
+            }
+            wxUnusedVar(sum);
+        });
+}
+
+BENCHMARK_FUNC(ReadMostlySharedMutex)
+{
+    static wxSharedMutex s_mutex;
+
+    return RunInThreads([](int count)
+        {
+            int sum = 0;
+            for ( int n = 0; n < count; n++ )
+            {
+                if ( n % 20 )
+                {
+                    wxReadLocker lock(s_mutex);
+                    sum += ReadData();
+                }
+                else
+                {
+                    wxWriteLocker lock(s_mutex);
+                    WriteData();
+                }
+            }
+            wxUnusedVar(sum);
+        });
+}
+
+#endif // wxUSE_THREADS
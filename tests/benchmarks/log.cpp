@@ -10,6 +10,10 @@
 #include "bench.h"
 
 #include "wx/log.h"
+#include "wx/thread.h"
+
+#include <memory>
+#include <vector>
 
 // This class is used to check that the arguments of log functions are not
 // evaluated.
@@ -59,7 +63,31 @@ BENCHMARK_FUNC(LogTraceDisabled)
     return true;
 }
 
-BENCHMARK_FUNC(LogTraceActive)
+// Remove the actual logging overhead by simply throwing away the log messages.
+class NulLog : public wxLog
+{
+public:
+    NulLog()
+        : m_logOld(wxLog::SetActiveTarget(this))
+    {
+    }
+
+    virtual ~NulLog()
+    {
+        wxLog::SetActiveTarget(m_logOld);
+    }
+
+protected:
+    virtual void DoLogRecord(wxLogLevel,
+                             const wxString&,
+                             const wxLogRecordInfo&) override
+    {
+    }
+
+    wxLog* m_logOld;
+};
+
+void EnableBenchTraceMask()
 {
     static bool s_added = false;
     if ( !s_added )
@@ -67,39 +95,70 @@ BENCHMARK_FUNC(LogTraceActive)
         s_added = true;
         wxLog::AddTraceMask("logbench");
     }
+}
 
-    // Remove the actual logging overhead by simply throwing away the log
-    // messages.
-    class NulLog : public wxLog
+BENCHMARK_FUNC(LogTraceActive)
+{
+    EnableBenchTraceMask();
+
+    NulLog nulLog;
+
+    wxLogTrace("logbench", "Trace message");
+
+    return true;
+}
+
+#if wxUSE_THREADS
+
+// Log the fixed total number of messages from the number of threads given by
+// the numeric parameter (4 by default) and then show them from the main thread.
+BENCHMARK_FUNC(LogMessageThreads)
+{
+    class LoggingThread : public wxThread
     {
     public:
-        NulLog()
-            : m_logOld(wxLog::SetActiveTarget(this))
+        explicit LoggingThread(int count)
+            : wxThread(wxTHREAD_JOINABLE),
+              m_count(count)
         {
         }
 
-        virtual ~NulLog()
-        {
-            wxLog::SetActiveTarget(m_logOld);
-        }
-
     protected:
-        virtual void DoLogRecord(wxLogLevel,
-                                 const wxString&,
-                                 const wxLogRecordInfo&)
+        virtual void* Entry() override
         {
+            for ( int n = 0; n < m_count; n++ )
+                wxLogMessage("Message %d", n);
+
+            return nullptr;
         }
 
-        wxLog* m_logOld;
+    private:
+        const int m_count;
     };
 
     NulLog nulLog;
 
-    wxLogTrace("logbench", "Trace message");
+    const int numThreads = Bench::GetNumericParameter(4);
+    const int count = 10000 / numThreads;
+
+    std::vector< std::unique_ptr<LoggingThread> > threads;
+    for ( int n = 0; n < numThreads; n++ )
+    {
+        threads.emplace_back(new LoggingThread(count));
+        if ( threads.back()->Run() != wxTHREAD_NO_ERROR )
+            return false;
+    }
+
+    for ( auto& thread : threads )
+        thread->Wait();
+
+    wxLog::FlushActive();
 
     return true;
 }
 
+#endif // wxUSE_THREADS
+
 BENCHMARK_FUNC(LogTraceInactive)
 {
     wxLogTrace("bloordyblop", "Trace message");
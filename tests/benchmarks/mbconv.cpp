@@ -76,3 +76,56 @@ BENCHMARK_FUNC(UTF16Sys)
     return ConvertToMB(wxCSConv("UTF-16LE"));
 }
 
+
+namespace
+{
+
+// Convert many short strings, as is typical for the real programs, using the
+// given converter.
+template <size_t N>
+bool ConvertShortStrings(const wxMBConv& conv, const wxString (&words)[N])
+{
+    for ( const wxString& word : words )
+    {
+        const wxScopedCharBuffer buf = word.mb_str(conv);
+        if ( !buf.length() )
+            return false;
+
+        if ( wxString(buf.data(), conv, buf.length()) != word )
+            return false;
+    }
+
+    return true;
+}
+
+const wxString WESTERN_WORDS[] =
+    { L"caf\xe9", L"na\xefve", L"r\xe9sum\xe9", L"\x20ac" L"100", L"plain" };
+
+const wxString JAPANESE_WORDS[] =
+    { L"\x65e5\x672c", L"\x6771\x4eac", L"\x3053\x3093\x306b\x3061\x306f", L"plain" };
+
+} // anonymous namespace
+
+BENCHMARK_FUNC(CP1252Init)
+{
+    wxCSConv conv(wxFONTENCODING_CP1252);
+    return conv.IsOk();
+}
+
+BENCHMARK_FUNC(CP1252Short)
+{
+    static const wxCSConv conv(wxFONTENCODING_CP1252);
+    return ConvertShortStrings(conv, WESTERN_WORDS);
+}
+
+BENCHMARK_FUNC(ISO885915Short)
+{
+    static const wxCSConv conv("ISO-8859-15");
+    return ConvertShortStrings(conv, WESTERN_WORDS);
+}
+
+BENCHMARK_FUNC(EUCJPShort)
+{
+    static const wxCSConv conv("EUC-JP");
+    return ConvertShortStrings(conv, JAPANESE_WORDS);
+}
@@ -0,0 +1,150 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        tests/benchmarks/msgqueue.cpp
+// Purpose:     Benchmarks for the message queues
+// Author:      wxWidgets team
+// Created:     2026-10-19
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include "bench.h"
+
+#include "wx/msgqueue.h"
+
+#include <memory>
+#include <vector>
+
+#if wxUSE_THREADS
+
+// All the benchmarks here pass the same number of messages from producer
+// threads to the main thread. The numeric parameter can be used to specify
+// the number of producers for the MPMC benchmarks (4 by default).
+
+namespace
+{
+
+const int NUM_MESSAGES = 100000;
+
+// This is the capacity of the bounded queues.
+const size_t QUEUE_CAPACITY = 1024;
+
+template <typename Q>
+class ProducerThread : public wxThread
+{
+public:
+    ProducerThread(Q& queue, int count)
+        : wxThread(wxTHREAD_JOINABLE),
+          m_queue(queue),
+          m_count(count)
+    {
+    }
+
+protected:
+    virtual void* Entry() override
+    {
+        for ( int n = 0; n < m_count; n++ )
+            m_queue.Post(n);
+
+        return nullptr;
+    }
+
+private:
+    Q& m_queue;
+    const int m_count;
+};
+
+template <typename Q>
+bool RunProducers(Q& queue, int numProducers)
+{
+    const int count = NUM_MESSAGES / numProducers;
+
+    std::vector< std::unique_ptr< ProducerThread<Q> > > threads;
+    for ( int n = 0; n < numProducers; n++ )
+    {
+        threads.emplace_back(new ProducerThread<Q>(queue, count));
+        if ( threads.back()->Run() != wxTHREAD_NO_ERROR )
+            return false;
+    }
+
+    long sum = 0;
+    int value;
+    for ( int n = 0; n < count*numProducers; n++ )
+    {
+        if ( queue.Receive(value) != wxMSGQUEUE_NO_ERROR )
+            return false;
+        sum += value;
+    }
+
+    for ( auto& thread : threads )
+        thread->Wait();
+
+    return sum > 0;
+}
+
+int GetProducersCount()
+{
+    return Bench::GetNumericParameter(4);
+}
+
+} // anonymous namespace
+
+BENCHMARK_FUNC(MessageQueueSPSC)
+{
+    wxMessageQueue<int> queue;
+    return RunProducers(queue, 1);
+}
+
+BENCHMARK_FUNC(BoundedQueueSPSC)
+{
+    wxSPSCMessageQueue<int> queue(QUEUE_CAPACITY);
+    return RunProducers(queue, 1);
+}
+
+BENCHMARK_FUNC(MessageQueueMPSC)
+{
+    wxMessageQueue<int> queue;
+    return RunProducers(queue, GetProducersCount());
+}
+
+BENCHMARK_FUNC(BoundedQueueMPSC)
+{
+    wxBoundedMessageQueue<int> queue(QUEUE_CAPACITY);
+    return RunProducers(queue, GetProducersCount());
+}
+
+// Same as above but receive the messages in batches.
+BENCHMARK_FUNC(BoundedQueueMPSCBatch)
+{
+    wxBoundedMessageQueue<int> queue(QUEUE_CAPACITY);
+
+    const int numProducers = GetProducersCount();
+    const int count = NUM_MESSAGES / numProducers;
+
+    std::vector< std::unique_ptr< ProducerThread<wxBoundedMessageQueue<int>> > > threads;
+    for ( int n = 0; n < numProducers; n++ )
+    {
+        threads.emplace_back(new ProducerThread<wxBoundedMessageQueue<int>>(queue, count));
+        if ( threads.back()->Run() != wxTHREAD_NO_ERROR )
+            return false;
+    }
+
+    long sum = 0;
+    std::vector<int> batch;
+    for ( int received = 0; received < count*numProducers; )
+    {
+        batch.clear();
+        if ( queue.ReceiveBatch(batch, 64) != wxMSGQUEUE_NO_ERROR )
+            return false;
+
+        for ( auto value : batch )
+            sum += value;
+
+        received += static_cast<int>(batch.size());
+    }
+
+    for ( auto& thread : threads )
+        thread->Wait();
+
+    return sum > 0;
+}
+
+#endif // wxUSE_THREADS
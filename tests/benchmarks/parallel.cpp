@@ -0,0 +1,136 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        tests/benchmarks/parallel.cpp
+// Purpose:     Benchmarks for the parallel algorithms
+// Author:      wxWidgets team
+// Created:     2026-10-19
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include "bench.h"
+
+#include "wx/parallel.h"
+
+#include <math.h>
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+// All the benchmarks in this file use the number of threads given by the
+// numeric parameter, e.g. run "bench -p 1 ParallelFor", then with "-p 2" and
+// so on to see how they scale, or all CPUs if it's not given. The "Serial"
+// benchmarks don't use the parallel algorithms at all and serve as baseline.
+
+namespace
+{
+
+const size_t NUM_ELEMENTS = 1000000;
+
+void SetConcurrency()
+{
+    wxSetParallelConcurrency(Bench::GetNumericParameter(0));
+}
+
+const std::vector<double>& GetInputData()
+{
+    static std::vector<double> s_data;
+    if ( s_data.empty() )
+    {
+        s_data.resize(NUM_ELEMENTS);
+        for ( size_t n = 0; n < NUM_ELEMENTS; n++ )
+            s_data[n] = static_cast<double>(n) / NUM_ELEMENTS;
+    }
+
+    return s_data;
+}
+
+const std::vector<unsigned>& GetSortData()
+{
+    static std::vector<unsigned> s_data;
+    if ( s_data.empty() )
+    {
+        s_data.resize(NUM_ELEMENTS);
+
+        unsigned x = 1;
+        for ( auto& n : s_data )
+        {
+            x = x*1103515245 + 12345;
+            n = x >> 8;
+        }
+    }
+
+    return s_data;
+}
+
+// Some arbitrary but not completely trivial computation.
+inline double Transform(double x)
+{
+    return sin(x)*cos(x) + sqrt(x);
+}
+
+} // anonymous namespace
+
+BENCHMARK_FUNC(SerialFor)
+{
+    const std::vector<double>& in = GetInputData();
+    std::vector<double> out(in.size());
+
+    for ( size_t n = 0; n < in.size(); n++ )
+        out[n] = Transform(in[n]);
+
+    return out[1] != 0;
+}
+
+BENCHMARK_FUNC(ParallelFor)
+{
+    SetConcurrency();
+
+    const std::vector<double>& in = GetInputData();
+    std::vector<double> out(in.size());
+
+    wxParallelFor(0, in.size(), [&](size_t n) { out[n] = Transform(in[n]); });
+
+    return out[1] != 0;
+}
+
+BENCHMARK_FUNC(SerialReduce)
+{
+    const std::vector<double>& in = GetInputData();
+
+    double sum = 0;
+    for ( size_t n = 0; n < in.size(); n++ )
+        sum += Transform(in[n]);
+
+    return sum > 0;
+}
+
+BENCHMARK_FUNC(ParallelReduce)
+{
+    SetConcurrency();
+
+    const std::vector<double>& in = GetInputData();
+
+    const double sum = wxParallelReduce(0, in.size(), 0.0,
+                                        [&in](size_t n) { return Transform(in[n]); },
+                                        std::plus<double>());
+
+    return sum > 0;
+}
+
+BENCHMARK_FUNC(SerialSort)
+{
+    std::vector<unsigned> v = GetSortData();
+    std::sort(v.begin(), v.end());
+
+    return v[0] <= v[1];
+}
+
+BENCHMARK_FUNC(ParallelSort)
+{
+    SetConcurrency();
+
+    std::vector<unsigned> v = GetSortData();
+    wxParallelSort(v.begin(), v.end());
+
+    return v[0] <= v[1];
+}
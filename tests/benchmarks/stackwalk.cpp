@@ -0,0 +1,70 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        tests/benchmarks/stackwalk.cpp
+// Purpose:     Benchmarks for resolving the stack frames with wxStackWalker
+// Author:      wxWidgets team
+// Created:     2026-10-19
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include "wx/stackwalk.h"
+#include "wx/sysopt.h"
+
+#include "bench.h"
+
+// The system option used here is only used under Linux.
+#if wxUSE_STACKWALKER && defined(__LINUX__)
+
+namespace
+{
+
+class CountingStackWalker : public wxStackWalker
+{
+public:
+    size_t GetNamedFrames() const { return m_namedFrames; }
+
+protected:
+    virtual void OnStackFrame(const wxStackFrame& frame) override
+    {
+        if ( !frame.GetName().empty() )
+            m_namedFrames++;
+    }
+
+private:
+    size_t m_namedFrames = 0;
+};
+
+bool WalkStack()
+{
+    CountingStackWalker walker;
+    walker.Walk();
+
+    return walker.GetNamedFrames() != 0;
+}
+
+bool UseAddr2line()
+{
+    wxSystemOptions::SetOption("unix.stackwalk.use_addr2line", 1);
+
+    return true;
+}
+
+void DontUseAddr2line()
+{
+    wxSystemOptions::SetOption("unix.stackwalk.use_addr2line", 0);
+}
+
+} // anonymous namespace
+
+// Walk the stack reading the symbols in process, as done by default.
+BENCHMARK_FUNC(StackWalk)
+{
+    return WalkStack();
+}
+
+// Walk the stack using addr2line for comparison.
+BENCHMARK_FUNC_WITH_INIT(StackWalkAddr2line, UseAddr2line, DontUseAddr2line)
+{
+    return WalkStack();
+}
+
+#endif // wxUSE_STACKWALKER && __LINUX__
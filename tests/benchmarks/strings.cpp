@@ -10,6 +10,7 @@
 #include "wx/string.h"
 #include "wx/ffile.h"
 #include "wx/arrstr.h"
+#include "wx/hashmap.h"
 
 #include "bench.h"
 #include "htmlparser/htmlpars.h"
@@ -59,6 +60,40 @@ const wxString& GetTestAsciiString()
     return testString;
 }
 
+// Same as GetTestAsciiString() but with some non-ASCII characters in it.
+const wxString& GetTestMixedString()
+{
+    static wxString testString;
+    if ( testString.empty() )
+    {
+        long num = Bench::GetNumericParameter();
+        if ( !num )
+            num = 1;
+
+        for ( long n = 0; n < num; n++ )
+        {
+            testString += wxString::FromAscii(asciistr);
+            testString += wxString::FromUTF8(utf8str);
+        }
+    }
+
+    return testString;
+}
+
+// Return the given string with all its letters in the other case.
+wxString GetSwappedCase(const wxString& s)
+{
+    wxString swapped;
+    swapped.reserve(s.length());
+    for ( wxString::const_iterator it = s.begin(); it != s.end(); ++it )
+    {
+        const wxUniChar c = *it;
+        swapped += wxIsupper(c) ? wxTolower(c) : wxToupper(c);
+    }
+
+    return swapped;
+}
+
 } // anonymous namespace
 
 // this is just a baseline
@@ -329,6 +364,66 @@ BENCHMARK_FUNC(ArrStrSort)
     return !a.empty();
 }
 
+namespace
+{
+
+// Return an array with the given number of file-name-like strings.
+const wxArrayString& GetBigTestArray()
+{
+    static wxArrayString s_array;
+    if ( s_array.empty() )
+    {
+        const long num = Bench::GetNumericParameter(100000);
+
+        s_array.reserve(num);
+
+        srand(17);
+        for ( long n = 0; n < num; n++ )
+        {
+            s_array.push_back(wxString::Format("/usr/share/dir%d/file%d.txt",
+                                               rand() % 100, rand()));
+        }
+    }
+
+    return s_array;
+}
+
+} // anonymous namespace
+
+BENCHMARK_FUNC(ArrStrSortBig)
+{
+    wxArrayString a(GetBigTestArray());
+    a.Sort();
+    return !a.empty();
+}
+
+BENCHMARK_FUNC(ArrStrSortParallel)
+{
+    wxArrayString a(GetBigTestArray());
+    a.SortParallel();
+    return !a.empty();
+}
+
+BENCHMARK_FUNC(ArrStrSortParallelFunction)
+{
+    wxArrayString a(GetBigTestArray());
+    a.SortParallel(wxDictionaryStringSortAscending);
+    return !a.empty();
+}
+
+BENCHMARK_FUNC(SortedArrStrFromArray)
+{
+    wxSortedArrayString a(GetBigTestArray());
+    return !a.empty();
+}
+
+BENCHMARK_FUNC(VectorStrSortBig)
+{
+    std::vector<wxString> v(GetBigTestArray().begin(), GetBigTestArray().end());
+    std::sort(v.begin(), v.end());
+    return !v.empty();
+}
+
 BENCHMARK_FUNC(VectorStrPushBack)
 {
     std::vector<wxString> v;
@@ -375,6 +470,16 @@ BENCHMARK_FUNC(Upper)
     return GetTestAsciiString().Upper().length() > 0;
 }
 
+BENCHMARK_FUNC(LowerMixed)
+{
+    return GetTestMixedString().Lower().length() > 0;
+}
+
+BENCHMARK_FUNC(UpperMixed)
+{
+    return GetTestMixedString().Upper().length() > 0;
+}
+
 // ----------------------------------------------------------------------------
 // string comparison
 // ----------------------------------------------------------------------------
@@ -414,6 +519,31 @@ BENCHMARK_FUNC(StringCmp)
     return s.Cmp(s) == 0;
 }
 
+// Unlike the benchmarks above, these ones use wxStricmp() and not the CRT
+// function directly.
+BENCHMARK_FUNC(WxStricmp)
+{
+    const wxString& s = GetTestAsciiString();
+
+    return wxStricmp(s.wc_str(), s.wc_str()) == 0;
+}
+
+BENCHMARK_FUNC(WxStricmpSwappedCase)
+{
+    const wxString& s = GetTestAsciiString();
+    static const wxString swapped = GetSwappedCase(s);
+
+    return wxStricmp(s.wc_str(), swapped.wc_str()) == 0;
+}
+
+BENCHMARK_FUNC(WxStricmpMixed)
+{
+    const wxString& s = GetTestMixedString();
+    static const wxString swapped = GetSwappedCase(s);
+
+    return wxStricmp(s.wc_str(), swapped.wc_str()) == 0;
+}
+
 BENCHMARK_FUNC(StringCmpNoCase)
 {
     const wxString& s = GetTestAsciiString();
@@ -421,6 +551,49 @@ BENCHMARK_FUNC(StringCmpNoCase)
     return s.CmpNoCase(s) == 0;
 }
 
+BENCHMARK_FUNC(StringCmpNoCaseSwappedCase)
+{
+    const wxString& s = GetTestAsciiString();
+    static const wxString swapped = GetSwappedCase(s);
+
+    return s.CmpNoCase(swapped) == 0;
+}
+
+BENCHMARK_FUNC(StringCmpNoCaseMixed)
+{
+    const wxString& s = GetTestMixedString();
+    static const wxString swapped = GetSwappedCase(s);
+
+    return s.CmpNoCase(swapped) == 0;
+}
+
+BENCHMARK_FUNC(StringCmpNoCaseShort)
+{
+    // This is typical for sorting relatively short strings, e.g. file names.
+    static wxArrayString names;
+    if ( names.empty() )
+    {
+        for ( int i = 0; i < 100; ++i )
+        {
+            names.push_back(wxString::Format(i % 2 ? "Some_File_Name_%03d.TXT"
+                                                   : "some_file_name_%03d.txt",
+                                             100 - i));
+        }
+    }
+
+    wxArrayString a(names);
+    a.Sort(wxDictionaryStringSortAscending);
+
+    return !a.empty();
+}
+
+BENCHMARK_FUNC(StringHashNoCase)
+{
+    const wxString& s = GetTestMixedString();
+
+    return wxStringHashNoCase()(s) != 0;
+}
+
 // Also benchmark various native functions under MSW. Surprisingly/annoyingly
 // they sometimes have vastly better performance than alternatives, especially
 // for case-sensitive comparison (see #10375).
@@ -0,0 +1,123 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        tests/benchmarks/threadpool.cpp
+// Purpose:     wxThreadPool benchmarks
+// Author:      wxWidgets team
+// Created:     2026-10-19
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include "bench.h"
+
+#include "wx/thread.h"
+#include "wx/threadpool.h"
+
+#include <atomic>
+
+#if wxUSE_THREADS
+
+namespace
+{
+
+// The number of tasks to execute on each iteration.
+int GetTasksCount()
+{
+    return Bench::GetNumericParameter(10000);
+}
+
+std::atomic<int> gs_tasksDone;
+
+void EmptyTask()
+{
+    gs_tasksDone++;
+}
+
+class EmptyThread : public wxThread
+{
+public:
+    EmptyThread() : wxThread(wxTHREAD_JOINABLE) { }
+
+protected:
+    virtual void* Entry() override
+    {
+        EmptyTask();
+        return nullptr;
+    }
+};
+
+} // anonymous namespace
+
+// Baseline: create a new thread for each "task".
+BENCHMARK_FUNC(ThreadPerTask)
+{
+    // Creating threads is much slower, so use fewer of them.
+    const int count = GetTasksCount() / 100;
+
+    gs_tasksDone = 0;
+    for ( int n = 0; n < count; n++ )
+    {
+        EmptyThread thread;
+        if ( thread.Run() != wxTHREAD_NO_ERROR )
+            return false;
+        thread.Wait();
+    }
+
+    return gs_tasksDone == count;
+}
+
+// Submit tasks from the main thread and wait for all of them.
+BENCHMARK_FUNC(ThreadPoolSubmit)
+{
+    const int count = GetTasksCount();
+    wxThreadPool& pool = wxThreadPool::Get();
+
+    gs_tasksDone = 0;
+    for ( int n = 0; n < count; n++ )
+        pool.Submit(EmptyTask);
+
+    pool.WaitAll();
+
+    return gs_tasksDone == count;
+}
+
+// Spawn the tasks from inside the pool, which uses the per-thread queues and
+// work stealing.
+BENCHMARK_FUNC(ThreadPoolSpawnNested)
+{
+    const int count = GetTasksCount();
+    wxThreadPool& pool = wxThreadPool::Get();
+
+    gs_tasksDone = 0;
+
+    const int numSpawners = 10;
+    for ( int n = 0; n < numSpawners; n++ )
+    {
+        pool.Submit([&pool, count]()
+            {
+                for ( int i = 0; i < count / numSpawners; i++ )
+                    pool.Submit(EmptyTask);
+            });
+    }
+
+    pool.WaitAll();
+
+    return gs_tasksDone == count / numSpawners * numSpawners;
+}
+
+// Chain of continuations, each one scheduled only after the previous one.
+BENCHMARK_FUNC(ThreadPoolContinuations)
+{
+    const int count = GetTasksCount();
+    wxThreadPool& pool = wxThreadPool::Get();
+
+    gs_tasksDone = 0;
+
+    wxTask task = pool.Submit(EmptyTask);
+    for ( int n = 1; n < count; n++ )
+        task = task.Then(EmptyTask);
+
+    task.Wait();
+
+    return gs_tasksDone == count;
+}
+
+#endif // wxUSE_THREADS
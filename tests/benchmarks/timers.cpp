@@ -0,0 +1,51 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        tests/benchmarks/timers.cpp
+// Purpose:     Benchmarks for starting and stopping many timers
+// Author:      wxWidgets team
+// Created:     2026-10-19
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include "wx/event.h"
+#include "wx/timer.h"
+
+#include "bench.h"
+
+#include <memory>
+#include <vector>
+
+namespace
+{
+
+// Number of timers used by a single benchmark run, 10000 by default.
+int GetTimersCount()
+{
+    return Bench::GetNumericParameter(10000);
+}
+
+} // anonymous namespace
+
+// Start many timers with different intervals and then stop all of them, in
+// the order different from the one in which they were started, as happens
+// when timers are used for connection timeouts, for example.
+BENCHMARK_FUNC(TimersStartStop)
+{
+    const int count = GetTimersCount();
+
+    wxEvtHandler handler;
+
+    std::vector<std::unique_ptr<wxTimer>> timers;
+    timers.reserve(count);
+    for ( int n = 0; n < count; n++ )
+    {
+        timers.emplace_back(new wxTimer(&handler));
+
+        // Use long intervals to ensure that none of the timers expires.
+        timers.back()->StartOnce(1000000 + (n*7919) % count);
+    }
+
+    for ( int n = 0; n < count; n++ )
+        timers[static_cast<size_t>(n)*104729 % count]->Stop();
+
+    return !timers[0]->IsRunning();
+}
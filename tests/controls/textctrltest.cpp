@@ -755,6 +755,19 @@ void TextCtrlTestCase::LogTextCtrl()
     delete wxLog::SetActiveTarget(old);
 
     CPPUNIT_ASSERT(!m_text->IsEmpty());
+
+    // Check that the number of lines is limited if requested.
+    delete m_text;
+    CreateText(wxTE_MULTILINE);
+
+    wxLogTextCtrl logMax(m_text);
+    logMax.SetMaxLines(3);
+
+    for ( int n = 0; n < 10; n++ )
+        logMax.LogText(wxString::Format("line %d", n));
+
+    logMax.Flush();
+    CPPUNIT_ASSERT_EQUAL( "line 7\nline 8\nline 9\n", m_text->GetValue() );
 }
 #endif // wxUSE_LOG
 
@@ -0,0 +1,183 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        tests/events/epolldispatcher.cpp
+// Purpose:     Test wxEpollDispatcher
+// Author:      wxWidgets team
+// Created:     2026-10-19
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+// ----------------------------------------------------------------------------
+// headers
+// ----------------------------------------------------------------------------
+
+#include "testprec.h"
+
+#if wxUSE_EPOLL_DISPATCHER
+
+#include "wx/unix/pipe.h"
+#include "wx/unix/private/epolldispatcher.h"
+
+#include <memory>
+#include <vector>
+
+#include <unistd.h>
+
+namespace
+{
+
+// handler counting the number of times it's called and, optionally, reading
+// the available data
+class CountingHandler : public wxFDIOHandler
+{
+public:
+    explicit CountingHandler(int fd, bool drain = true)
+        : m_fd(fd),
+          m_drain(drain)
+    {
+    }
+
+    virtual void OnReadWaiting() override
+    {
+        m_count++;
+
+        if ( m_drain )
+        {
+            char buf[16];
+            while ( read(m_fd, buf, sizeof(buf)) > 0 )
+                ;
+        }
+    }
+
+    virtual void OnWriteWaiting() override { }
+    virtual void OnExceptionWaiting() override { }
+
+    int GetCount() const { return m_count; }
+
+private:
+    const int m_fd;
+    const bool m_drain;
+    int m_count = 0;
+};
+
+// write a single byte to the pipe
+void WriteByte(const wxPipe& pipe)
+{
+    REQUIRE( write(pipe[wxPipe::Write], "x", 1) == 1 );
+}
+
+} // anonymous namespace
+
+TEST_CASE("wxEpollDispatcher::Batch", "[epolldispatcher]")
+{
+    std::unique_ptr<wxEpollDispatcher> dispatcher(wxEpollDispatcher::Create());
+    REQUIRE( dispatcher );
+
+    dispatcher->SetMaxEvents(8);
+    CHECK( dispatcher->GetMaxEvents() == 8 );
+
+    const int numPipes = 20;
+
+    std::vector<std::unique_ptr<wxPipe>> pipes;
+    std::vector<std::unique_ptr<CountingHandler>> handlers;
+    for ( int n = 0; n < numPipes; n++ )
+    {
+        pipes.emplace_back(new wxPipe);
+        REQUIRE( pipes.back()->Create() );
+        REQUIRE( pipes.back()->MakeNonBlocking(wxPipe::Read) );
+
+        const int fd = (*pipes.back())[wxPipe::Read];
+        handlers.emplace_back(new CountingHandler(fd));
+        REQUIRE( dispatcher->RegisterFD(fd, handlers.back().get(), wxFDIO_INPUT) );
+
+        WriteByte(*pipes.back());
+    }
+
+    CHECK( dispatcher->Dispatch(0) == 8 );
+    CHECK( dispatcher->Dispatch(0) == 8 );
+    CHECK( dispatcher->Dispatch(0) == 4 );
+    CHECK( dispatcher->Dispatch(0) == 0 );
+
+    for ( const auto& handler : handlers )
+        CHECK( handler->GetCount() == 1 );
+
+    const wxEpollDispatcherStats& stats = dispatcher->GetStats();
+    CHECK( stats.wakeups == 3 );
+    CHECK( stats.events == numPipes );
+    CHECK( stats.maxEventsPerWakeup == 8 );
+    CHECK( stats.fullBatches == 2 );
+
+    dispatcher->ResetStats();
+    CHECK( dispatcher->GetStats().events == 0 );
+
+    for ( const auto& pipe : pipes )
+        dispatcher->UnregisterFD((*pipe)[wxPipe::Read]);
+}
+
+TEST_CASE("wxEpollDispatcher::EdgeTriggered", "[epolldispatcher]")
+{
+    std::unique_ptr<wxEpollDispatcher> dispatcher(wxEpollDispatcher::Create());
+    REQUIRE( dispatcher );
+
+    wxPipe pipe;
+    REQUIRE( pipe.Create() );
+
+    const int fd = pipe[wxPipe::Read];
+
+    // don't read the data to check that we're notified only once about it
+    CountingHandler handler(fd, false);
+
+    SECTION("Level")
+    {
+        REQUIRE( dispatcher->RegisterFD(fd, &handler, wxFDIO_INPUT) );
+
+        WriteByte(pipe);
+        CHECK( dispatcher->Dispatch(0) == 1 );
+        CHECK( dispatcher->Dispatch(0) == 1 );
+        CHECK( handler.GetCount() == 2 );
+    }
+
+    SECTION("Edge")
+    {
+        REQUIRE( dispatcher->RegisterFD(fd, &handler,
+                                        wxFDIO_INPUT | wxFDIO_EDGE_TRIGGERED) );
+
+        WriteByte(pipe);
+        CHECK( dispatcher->Dispatch(0) == 1 );
+        CHECK( dispatcher->Dispatch(0) == 0 );
+        CHECK( handler.GetCount() == 1 );
+
+        WriteByte(pipe);
+        CHECK( dispatcher->Dispatch(0) == 1 );
+        CHECK( handler.GetCount() == 2 );
+    }
+
+    dispatcher->UnregisterFD(fd);
+}
+
+TEST_CASE("wxEpollDispatcher::Exclusive", "[epolldispatcher]")
+{
+    std::unique_ptr<wxEpollDispatcher> dispatcher(wxEpollDispatcher::Create());
+    REQUIRE( dispatcher );
+
+    wxPipe pipe;
+    REQUIRE( pipe.Create() );
+    REQUIRE( pipe.MakeNonBlocking(wxPipe::Read) );
+
+    const int fd = pipe[wxPipe::Read];
+    CountingHandler handler(fd);
+
+    REQUIRE( dispatcher->RegisterFD(fd, &handler,
+                                    wxFDIO_INPUT | wxFDIO_EXCLUSIVE) );
+
+    // modifying the exclusive descriptors must work too
+    REQUIRE( dispatcher->ModifyFD(fd, &handler,
+                                  wxFDIO_INPUT | wxFDIO_EXCEPTION | wxFDIO_EXCLUSIVE) );
+
+    WriteByte(pipe);
+    CHECK( dispatcher->Dispatch(0) == 1 );
+    CHECK( handler.GetCount() == 1 );
+
+    dispatcher->UnregisterFD(fd);
+}
+
+#endif // wxUSE_EPOLL_DISPATCHER
@@ -13,7 +13,13 @@
 #include "testprec.h"
 
 
+#include "wx/app.h"
 #include "wx/event.h"
+#include "wx/thread.h"
+
+#include <functional>
+#include <memory>
+#include <vector>
 
 // ----------------------------------------------------------------------------
 // test events and their handlers
@@ -510,6 +516,421 @@ TEST_CASE("Event::UnbindFromHandler", "[event][bind][unbind]")
     handler.ProcessEvent(e);
 }
 
+TEST_CASE("Event::BindMany", "[event][bind]")
+{
+    // Bind enough handlers to use the index of the dynamic event table.
+    static const int NUM_HANDLERS = 50;
+
+    wxEvtHandler handler;
+    std::vector<int> calls;
+
+    const wxEventType otherType = wxNewEventType();
+    for ( int n = 0; n < NUM_HANDLERS; n++ )
+    {
+        // Interleave the handlers for different event types.
+        handler.Bind(wxEventTypeTag<wxThreadEvent>(n % 2 ? otherType
+                                                         : wxEventType(wxEVT_THREAD)),
+                     [&calls, n](wxThreadEvent& event)
+                     {
+                         calls.push_back(n);
+                         event.Skip();
+                     });
+    }
+
+    wxThreadEvent event;
+    handler.ProcessEvent(event);
+
+    // The handlers must have been called in the reverse order of binding.
+    REQUIRE( calls.size() == NUM_HANDLERS / 2 );
+    for ( int n = 0; n < NUM_HANDLERS / 2; n++ )
+        CHECK( calls[n] == NUM_HANDLERS - 2 - 2*n );
+
+    // Bind a handler which unbinds another one and binds a new one when
+    // called: the unbound handler must not be called any more and the new
+    // handler must not be called for this event but only for the next one.
+    calls.clear();
+    std::function<void (wxThreadEvent&)> unbound = [&calls](wxThreadEvent& e)
+        {
+            calls.push_back(-1);
+            e.Skip();
+        };
+    handler.Bind(wxEVT_THREAD, unbound);
+
+    bool changed = false;
+    handler.Bind(wxEVT_THREAD, [&](wxThreadEvent& e)
+        {
+            if ( !changed )
+            {
+                CHECK( handler.Unbind(wxEVT_THREAD, unbound) );
+                handler.Bind(wxEVT_THREAD, [&calls](wxThreadEvent& e2)
+                    {
+                        calls.push_back(-2);
+                        e2.Skip();
+                    });
+                changed = true;
+            }
+            e.Skip();
+        });
+
+    handler.ProcessEvent(event);
+    REQUIRE( calls.size() == NUM_HANDLERS / 2 );
+    CHECK( calls[0] == NUM_HANDLERS - 2 );
+
+    calls.clear();
+    handler.ProcessEvent(event);
+    REQUIRE( calls.size() == NUM_HANDLERS / 2 + 1 );
+    CHECK( calls[0] == -2 );
+    CHECK( calls[1] == NUM_HANDLERS - 2 );
+
+    // Check that the handlers for the other event type are still found after
+    // pruning the unbound handler.
+    calls.clear();
+    wxThreadEvent other(otherType);
+    handler.ProcessEvent(other);
+    REQUIRE( calls.size() == NUM_HANDLERS / 2 );
+    CHECK( calls[0] == NUM_HANDLERS - 1 );
+}
+
+// Handler remembering the integer values of the thread events it gets.
+class QueueHandler : public wxEvtHandler
+{
+public:
+    QueueHandler()
+    {
+        Bind(wxEVT_THREAD, &QueueHandler::OnThreadEvent, this);
+    }
+
+    std::vector<int> m_values;
+
+private:
+    void OnThreadEvent(wxThreadEvent& event)
+    {
+        m_values.push_back(event.GetInt());
+    }
+};
+
+static void QueueIntEvent(wxEvtHandler& handler, int value)
+{
+    wxThreadEvent* const event = new wxThreadEvent();
+    event->SetInt(value);
+    handler.QueueEvent(event);
+}
+
+TEST_CASE("Event::QueueEvent", "[event][queue]")
+{
+    QueueHandler handler;
+
+    SECTION("Order")
+    {
+        for ( int n = 0; n < 10; n++ )
+            QueueIntEvent(handler, n);
+
+        CHECK( wxTheApp->HasPendingEvents() );
+
+        // Queue more events while processing the existing ones.
+        handler.Bind(wxEVT_THREAD, [&handler](wxThreadEvent& event)
+            {
+                if ( event.GetInt() == 5 )
+                    QueueIntEvent(handler, 10);
+                event.Skip();
+            });
+
+        wxTheApp->ProcessPendingEvents();
+
+        REQUIRE( handler.m_values.size() == 11 );
+        for ( int n = 0; n < 11; n++ )
+            CHECK( handler.m_values[n] == n );
+
+        CHECK( !wxTheApp->HasPendingEvents() );
+    }
+
+    SECTION("Delete")
+    {
+        QueueIntEvent(handler, 1);
+        QueueIntEvent(handler, 2);
+
+        handler.DeletePendingEvents();
+        wxTheApp->ProcessPendingEvents();
+        CHECK( handler.m_values.empty() );
+        CHECK( !wxTheApp->HasPendingEvents() );
+
+        // Check that the handler is still notified about the new events.
+        QueueIntEvent(handler, 3);
+        wxTheApp->ProcessPendingEvents();
+        REQUIRE( handler.m_values.size() == 1 );
+        CHECK( handler.m_values[0] == 3 );
+    }
+
+    SECTION("Destroy")
+    {
+        std::unique_ptr<QueueHandler> other(new QueueHandler);
+        QueueIntEvent(*other, 1);
+        QueueIntEvent(handler, 2);
+
+        // The pending events of the destroyed handler must be just discarded.
+        other.reset();
+        wxTheApp->ProcessPendingEvents();
+        REQUIRE( handler.m_values.size() == 1 );
+        CHECK( handler.m_values[0] == 2 );
+    }
+}
+
+// Functor counting the number of times it was copied.
+class CopyCountingFunctor
+{
+public:
+    explicit CopyCountingFunctor(int* copies, bool* called)
+        : m_copies(copies), m_called(called)
+    {
+    }
+
+    CopyCountingFunctor(const CopyCountingFunctor& other)
+        : m_copies(other.m_copies), m_called(other.m_called)
+    {
+        ++*m_copies;
+    }
+
+    CopyCountingFunctor(CopyCountingFunctor&&) = default;
+
+    void operator()() const { *m_called = true; }
+
+private:
+    int* const m_copies;
+    bool* const m_called;
+};
+
+TEST_CASE("Event::QueueMove", "[event][queue]")
+{
+    QueueHandler handler;
+
+    SECTION("Event")
+    {
+        wxString received;
+        handler.Bind(wxEVT_THREAD, [&received](wxThreadEvent& event)
+            {
+                received = event.GetString() + event.GetPayload<wxString>();
+                event.Skip();
+            });
+
+        wxThreadEvent event;
+        event.SetInt(17);
+        event.SetString("Hello, ");
+        event.SetPayload(wxString("world"));
+        wxQueueEvent(&handler, std::move(event));
+
+        // The string and payload were moved out of the original event.
+        CHECK( event.GetString().empty() );
+
+        wxTheApp->ProcessPendingEvents();
+
+        REQUIRE( handler.m_values.size() == 1 );
+        CHECK( handler.m_values[0] == 17 );
+        CHECK( received == "Hello, world" );
+    }
+
+    SECTION("CallAfter")
+    {
+        int copies = 0;
+        bool called = false;
+        handler.CallAfter(CopyCountingFunctor(&copies, &called));
+        wxTheApp->ProcessPendingEvents();
+
+        CHECK( called );
+        CHECK( copies == 0 );
+
+        // Functors passed by lvalue are still copied.
+        called = false;
+        const CopyCountingFunctor functor(&copies, &called);
+        handler.CallAfter(functor);
+        wxTheApp->ProcessPendingEvents();
+
+        CHECK( called );
+        CHECK( copies == 1 );
+    }
+}
+
+// Event much bigger than the ones normally allocated from the pool.
+class BigEvent : public wxThreadEvent
+{
+public:
+    BigEvent() { memset(m_data, 0, sizeof(m_data)); }
+
+    virtual wxEvent *Clone() const override { return new BigEvent(*this); }
+
+    char m_data[4096];
+};
+
+TEST_CASE("Event::Pool", "[event][pool]")
+{
+    // Allocate the events of different sizes in different order to check
+    // that the blocks reused from the pool are not mixed up.
+    std::vector<std::unique_ptr<wxEvent>> events;
+    for ( int n = 0; n < 1000; n++ )
+    {
+        wxThreadEvent* event;
+        if ( n % 3 == 2 )
+            event = new BigEvent();
+        else
+            event = new wxThreadEvent();
+
+        event->SetInt(n);
+        event->SetString(wxString::Format("event %d", n));
+        events.emplace_back(event->Clone());
+
+        if ( n % 5 == 0 )
+            events.erase(events.begin() + n / 10);
+
+        delete event;
+    }
+
+    for ( const auto& event : events )
+    {
+        const wxThreadEvent& te = static_cast<wxThreadEvent&>(*event);
+        CHECK( te.GetString() == wxString::Format("event %d", te.GetInt()) );
+        CHECK( (dynamic_cast<BigEvent*>(event.get()) != nullptr) ==
+                    (te.GetInt() % 3 == 2) );
+    }
+
+    // Placement new must still work for the events.
+    alignas(wxThreadEvent) char buf[sizeof(wxThreadEvent)];
+    wxThreadEvent* const event = new(buf) wxThreadEvent(wxEVT_THREAD, 17);
+    CHECK( event->GetId() == 17 );
+    event->~wxThreadEvent();
+}
+
+TEST_CASE("Event::QueueCoalescedEvent", "[event][queue][coalesce]")
+{
+    QueueHandler handler;
+
+    SECTION("Replace")
+    {
+        QueueIntEvent(handler, 0);
+        for ( int n = 1; n <= 10; n++ )
+        {
+            wxThreadEvent* const event = new wxThreadEvent();
+            event->SetInt(n);
+            handler.QueueCoalescedEvent(event);
+        }
+
+        // Events with a different key or type must not be replaced.
+        wxThreadEvent* const other = new wxThreadEvent();
+        other->SetInt(100);
+        handler.QueueCoalescedEvent(other, 1);
+
+        handler.QueueCoalescedEvent(new MyEvent());
+
+        QueueIntEvent(handler, 11);
+
+        wxTheApp->ProcessPendingEvents();
+
+        REQUIRE( handler.m_values.size() == 4 );
+        CHECK( handler.m_values[0] == 0 );
+        CHECK( handler.m_values[1] == 10 );
+        CHECK( handler.m_values[2] == 100 );
+        CHECK( handler.m_values[3] == 11 );
+
+        // Once the event is processed, the next one is queued normally.
+        handler.m_values.clear();
+        wxQueueCoalescedEvent(&handler, new wxThreadEvent());
+        wxTheApp->ProcessPendingEvents();
+        CHECK( handler.m_values.size() == 1 );
+    }
+
+    SECTION("Delete")
+    {
+        handler.QueueCoalescedEvent(new wxThreadEvent());
+        handler.DeletePendingEvents();
+
+        wxTheApp->ProcessPendingEvents();
+        CHECK( handler.m_values.empty() );
+    }
+
+    SECTION("CallAfter")
+    {
+        std::vector<int> calls;
+        for ( int n = 0; n < 5; n++ )
+        {
+            handler.CallAfterCoalesced(1, [&calls, n]() { calls.push_back(n); });
+            handler.CallAfterCoalesced(2, [&calls, n]() { calls.push_back(-n); });
+        }
+
+        wxTheApp->ProcessPendingEvents();
+
+        REQUIRE( calls.size() == 2 );
+        CHECK( calls[0] == 4 );
+        CHECK( calls[1] == -4 );
+    }
+}
+
+#if wxUSE_THREADS
+
+TEST_CASE("Event::QueueEventThreads", "[event][queue][thread]")
+{
+    class QueueThread : public wxThread
+    {
+    public:
+        QueueThread(wxEvtHandler& handler, int index, int count)
+            : wxThread(wxTHREAD_JOINABLE),
+              m_handler(handler),
+              m_index(index),
+              m_count(count)
+        {
+        }
+
+    protected:
+        virtual ExitCode Entry() override
+        {
+            for ( int n = 0; n < m_count; n++ )
+                QueueIntEvent(m_handler, m_index*m_count + n);
+
+            return nullptr;
+        }
+
+    private:
+        wxEvtHandler& m_handler;
+        const int m_index;
+        const int m_count;
+    };
+
+    static const int NUM_THREADS = 4;
+    static const int NUM_EVENTS = 10000;
+
+    QueueHandler handler;
+
+    std::vector<std::unique_ptr<QueueThread>> threads;
+    for ( int n = 0; n < NUM_THREADS; n++ )
+    {
+        threads.emplace_back(new QueueThread(handler, n, NUM_EVENTS));
+        REQUIRE( threads.back()->Run() == wxTHREAD_NO_ERROR );
+    }
+
+    // Process the events concurrently with the threads queuing them.
+    while ( handler.m_values.size() < NUM_THREADS*NUM_EVENTS )
+        wxTheApp->ProcessPendingEvents();
+
+    for ( auto& thread : threads )
+        thread->Wait();
+
+    CHECK( handler.m_values.size() == NUM_THREADS*NUM_EVENTS );
+    CHECK( !wxTheApp->HasPendingEvents() );
+
+    // All events must have been received and the events queued by each thread
+    // must have been received in order.
+    std::vector<int> last(NUM_THREADS, -1);
+    for ( int value : handler.m_values )
+    {
+        const int index = value / NUM_EVENTS;
+        REQUIRE( index < NUM_THREADS );
+        REQUIRE( last[index] < value );
+        last[index] = value;
+    }
+
+    for ( int n = 0; n < NUM_THREADS; n++ )
+        CHECK( last[n] == (n + 1)*NUM_EVENTS - 1 );
+}
+
+#endif // wxUSE_THREADS
+
 // This is a compilation-time-only test: just check that a class inheriting
 // from wxEvtHandler non-publicly can use Bind() with its method, this used to
 // result in compilation errors.
@@ -0,0 +1,263 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        tests/events/evtprofiler.cpp
+// Purpose:     wxEventProfiler unit test
+// Author:      wxWidgets team
+// Created:     2026-10-19
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+// ----------------------------------------------------------------------------
+// headers
+// ----------------------------------------------------------------------------
+
+#include "testprec.h"
+
+
+#include "wx/evtprofiler.h"
+#include "wx/time.h"
+#include "wx/utils.h"
+
+// ----------------------------------------------------------------------------
+// helpers
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+wxDEFINE_EVENT(EVT_PROFILED, wxThreadEvent);
+wxDEFINE_EVENT(EVT_UNHANDLED, wxThreadEvent);
+
+// Enable the profiler for the lifetime of this object, starting from scratch.
+class ProfilerEnabler
+{
+public:
+    ProfilerEnabler()
+    {
+        wxEventProfiler::Reset();
+        wxEventProfiler::Enable();
+    }
+
+    ~ProfilerEnabler()
+    {
+        wxEventProfiler::Enable(false);
+        wxEventProfiler::Reset();
+    }
+};
+
+// Handler sleeping for the given number of milliseconds when processing the
+// event.
+class SleepingHandler : public wxEvtHandler
+{
+public:
+    explicit SleepingHandler(unsigned long ms = 0)
+        : m_ms(ms)
+    {
+        Bind(EVT_PROFILED, &SleepingHandler::OnEvent, this);
+    }
+
+    void SendEvents(int count)
+    {
+        for ( int n = 0; n < count; n++ )
+        {
+            wxThreadEvent event(EVT_PROFILED);
+            ProcessEvent(event);
+        }
+    }
+
+private:
+    void OnEvent(wxThreadEvent&)
+    {
+        // Sleep may be interrupted by the signal used for retrieving the stack
+        // when a stall is detected, so continue sleeping if necessary.
+        const wxMilliClock_t end = wxGetLocalTimeMillis() + m_ms;
+        for ( ;; )
+        {
+            const wxMilliClock_t now = wxGetLocalTimeMillis();
+            if ( now >= end )
+                break;
+
+            wxMilliSleep((end - now).ToLong());
+        }
+    }
+
+    const unsigned long m_ms;
+};
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------------
+// tests
+// ----------------------------------------------------------------------------
+
+TEST_CASE("wxEventDispatchStats", "[events][profiler]")
+{
+    wxEventDispatchStats stats;
+    CHECK( stats.GetCount() == 0 );
+    CHECK( stats.GetAverageTime() == 0 );
+
+    stats.Add(0);
+    stats.Add(1);
+    stats.Add(3);
+    stats.Add(wxUINT64_MAX);
+
+    CHECK( stats.GetCount() == 4 );
+    CHECK( stats.GetMaxTime() == wxUINT64_MAX );
+
+    CHECK( stats.GetHistogramCount(0) == 1 );
+    CHECK( stats.GetHistogramCount(1) == 1 );
+    CHECK( stats.GetHistogramCount(2) == 1 );
+    CHECK( stats.GetHistogramCount(wxEventDispatchStats::HISTOGRAM_SIZE - 1) == 1 );
+}
+
+TEST_CASE("wxEventProfiler::Stats", "[events][profiler]")
+{
+    // Nothing is recorded unless the profiler is enabled.
+    wxEventProfiler::Reset();
+    SleepingHandler handler;
+    handler.SendEvents(1);
+    CHECK( wxEventProfiler::GetEventTypeStats().empty() );
+
+    ProfilerEnabler enabler;
+
+    handler.SendEvents(3);
+
+    wxThreadEvent unhandled(EVT_UNHANDLED);
+    handler.ProcessEvent(unhandled);
+
+    const auto eventStats = wxEventProfiler::GetEventTypeStats();
+    REQUIRE( eventStats.count(EVT_PROFILED) == 1 );
+    CHECK( eventStats.at(EVT_PROFILED).GetCount() == 3 );
+    REQUIRE( eventStats.count(EVT_UNHANDLED) == 1 );
+    CHECK( eventStats.at(EVT_UNHANDLED).GetCount() == 1 );
+
+    // Unhandled events are not attributed to any handler.
+    const auto handlerStats = wxEventProfiler::GetHandlerStats();
+    REQUIRE( handlerStats.count("wxEvtHandler") == 1 );
+    CHECK( handlerStats.at("wxEvtHandler").GetCount() == 3 );
+}
+
+TEST_CASE("wxEventProfiler::SlowDispatch", "[events][profiler]")
+{
+    ProfilerEnabler enabler;
+
+    const wxUint64 thresholdOld = wxEventProfiler::GetSlowDispatchThreshold();
+    wxEventProfiler::SetSlowDispatchThreshold(5000);
+
+    SleepingHandler fast;
+    fast.SendEvents(10);
+    CHECK( wxEventProfiler::GetSlowDispatches().empty() );
+
+    SleepingHandler slow(10);
+    slow.SendEvents(1);
+
+    const auto slowDispatches = wxEventProfiler::GetSlowDispatches();
+    REQUIRE( slowDispatches.size() == 1 );
+    CHECK( slowDispatches[0].eventType == EVT_PROFILED );
+    CHECK( slowDispatches[0].handler == "wxEvtHandler" );
+    CHECK( slowDispatches[0].duration >= 10000 );
+
+    const wxString json = wxEventProfiler::DumpAsJSON();
+    INFO( json );
+    CHECK( json.Contains("\"eventTypes\": {") );
+    CHECK( json.Contains("\"wxEvtHandler\": {\"count\": 11,") );
+    CHECK( json.Contains("\"slowDispatches\": [") );
+    CHECK( json.Contains("\"stalls\": [") );
+
+    wxEventProfiler::SetSlowDispatchThreshold(thresholdOld);
+}
+
+#if wxUSE_THREADS
+
+TEST_CASE("wxEventProfiler::Threads", "[events][profiler]")
+{
+    ProfilerEnabler enabler;
+
+    // The statistics of the threads, including the ones which already
+    // terminated, are combined with those of the main thread.
+    class DispatchingThread : public wxThread
+    {
+    public:
+        DispatchingThread() : wxThread(wxTHREAD_JOINABLE) { }
+
+    protected:
+        virtual void* Entry() override
+        {
+            SleepingHandler handler;
+            handler.SendEvents(5);
+
+            return nullptr;
+        }
+    };
+
+    DispatchingThread thread1, thread2;
+    REQUIRE( thread1.Run() == wxTHREAD_NO_ERROR );
+    REQUIRE( thread2.Run() == wxTHREAD_NO_ERROR );
+    thread1.Wait();
+    thread2.Wait();
+
+    SleepingHandler handler;
+    handler.SendEvents(2);
+
+    const auto eventStats = wxEventProfiler::GetEventTypeStats();
+    REQUIRE( eventStats.count(EVT_PROFILED) == 1 );
+    CHECK( eventStats.at(EVT_PROFILED).GetCount() == 12 );
+
+    const auto handlerStats = wxEventProfiler::GetHandlerStats();
+    REQUIRE( handlerStats.count("wxEvtHandler") == 1 );
+    CHECK( handlerStats.at("wxEvtHandler").GetCount() == 12 );
+
+    wxEventProfiler::Reset();
+    CHECK( wxEventProfiler::GetEventTypeStats().empty() );
+}
+
+TEST_CASE("wxEventProfiler::Stalls", "[events][profiler]")
+{
+    wxEventProfiler::Reset();
+
+    struct ResetStallSignal
+    {
+        const int sig = wxEventProfiler::GetStallStackSignal();
+        ~ResetStallSignal() { wxEventProfiler::SetStallStackSignal(sig); }
+    } resetStallSignal;
+
+    bool withStack = true;
+    SECTION("Default") { }
+    SECTION("NoStack")
+    {
+        wxEventProfiler::SetStallStackSignal(0);
+        withStack = false;
+    }
+
+    REQUIRE( wxEventProfiler::StartStallDetection(100) );
+    CHECK( wxEventProfiler::IsStallDetectionRunning() );
+
+    // Short dispatches don't result in stalls.
+    SleepingHandler fast;
+    fast.SendEvents(100);
+
+    SleepingHandler slow(400);
+    slow.SendEvents(1);
+
+    wxEventProfiler::StopStallDetection();
+    CHECK( !wxEventProfiler::IsStallDetectionRunning() );
+
+    const auto stalls = wxEventProfiler::GetStalls();
+    REQUIRE( stalls.size() == 1 );
+    CHECK( stalls[0].eventType == EVT_PROFILED );
+    CHECK( stalls[0].handler == "wxEvtHandler" );
+
+    // The duration is updated when the stall ends, so it must be greater than
+    // the threshold (allow for different clocks used by the test and wx).
+    CHECK( stalls[0].duration >= 300 );
+
+#if wxUSE_STACKWALKER && defined(__LINUX__)
+    INFO( stalls[0].stack );
+    CHECK( stalls[0].stack.empty() != withStack );
+#else
+    wxUnusedVar(withStack);
+#endif
+
+    wxEventProfiler::Reset();
+}
+
+#endif // wxUSE_THREADS
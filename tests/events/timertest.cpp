@@ -21,6 +21,9 @@
 #include "wx/evtloop.h"
 #include "wx/timer.h"
 
+#include <memory>
+#include <vector>
+
 // --------------------------------------------------------------------------
 // helper class counting the number of timer events
 // --------------------------------------------------------------------------
@@ -137,3 +140,55 @@ void TimerEventTestCase::Multiple()
     // more than one
     CPPUNIT_ASSERT( numTicks > 1 );
 }
+
+TEST_CASE("wxTimer::Order", "[timer]")
+{
+    wxEventLoop loop;
+
+    // Timer with this ID is used to ensure the test terminates even if the
+    // other timers don't fire.
+    const int ID_TIMEOUT = 1000;
+
+    const int NUM_TIMERS = 50;
+    const size_t NUM_RUNNING = NUM_TIMERS - NUM_TIMERS / 5;
+
+    std::vector<int> order;
+
+    wxEvtHandler handler;
+    handler.Bind(wxEVT_TIMER, [&](wxTimerEvent& event)
+        {
+            if ( event.GetId() != ID_TIMEOUT )
+                order.push_back(event.GetId());
+
+            if ( event.GetId() == ID_TIMEOUT || order.size() == NUM_RUNNING )
+                loop.Exit();
+        });
+
+    // Start the timers in an order different from the expiration one: as 7
+    // and NUM_TIMERS are coprime, all intervals are different.
+    std::vector<std::unique_ptr<wxTimer>> timers;
+    for ( int n = 0; n < NUM_TIMERS; n++ )
+    {
+        timers.emplace_back(new wxTimer(&handler, n));
+        timers.back()->StartOnce(50 + 5*((n*7) % NUM_TIMERS));
+    }
+
+    // Stop some of them to check that removing them from the middle of the
+    // schedule works.
+    for ( int n = 0; n < NUM_TIMERS; n += 5 )
+        timers[n]->Stop();
+
+    wxTimer timeout(&handler, ID_TIMEOUT);
+    timeout.StartOnce(10000);
+
+    loop.Run();
+
+    REQUIRE( order.size() == NUM_RUNNING );
+
+    for ( size_t n = 1; n < order.size(); n++ )
+    {
+        INFO("Timer #" << n << " is " << order[n]);
+        CHECK( (order[n - 1]*7) % NUM_TIMERS < (order[n]*7) % NUM_TIMERS );
+        CHECK( order[n] % 5 != 0 );
+    }
+}
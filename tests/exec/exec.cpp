@@ -21,9 +21,11 @@
 #include "wx/sstream.h"
 #include "wx/evtloop.h"
 #include "wx/file.h"
+#include "wx/log.h"
 #include "wx/filename.h"
 #include "wx/mstream.h"
 #include "wx/scopeguard.h"
+#include "wx/sysopt.h"
 #include "wx/txtstrm.h"
 #include "wx/timer.h"
 
@@ -506,6 +508,139 @@ TEST_CASE_METHOD(ExecTestCase, "wxExecute::Overlapped", "[exec]")
 
 #ifdef __UNIX__
 
+TEST_CASE("wxExecute::Env", "[exec]")
+{
+    // Check that the options work both with posix_spawn(), if it's used, and
+    // with fork().
+    int useFork = 0;
+    SECTION("Default") { useFork = 0; }
+    SECTION("Fork") { useFork = 1; }
+
+    wxSystemOptions::SetOption("unix.execute.use_fork", useFork);
+    struct ResetUseFork
+    {
+        ~ResetUseFork() { wxSystemOptions::SetOption("unix.execute.use_fork", 0); }
+    } resetUseFork;
+
+    wxExecuteEnv env;
+    wxArrayString output;
+
+    env.cwd = "/";
+    REQUIRE( wxExecute("pwd", output, wxEXEC_SYNC, &env) == 0 );
+    REQUIRE( output.size() == 1 );
+    CHECK( output[0] == "/" );
+
+    // Keep PATH unchanged, as posix_spawn() can't be used otherwise.
+    wxString path;
+    REQUIRE( wxGetEnv("PATH", &path) );
+    env.env["PATH"] = path;
+    env.env["wxTEST_EXEC_VAR"] = "Hello from child";
+
+    output.clear();
+    REQUIRE( wxExecute("sh -c 'echo $wxTEST_EXEC_VAR $HOME.'",
+                       output, wxEXEC_SYNC, &env) == 0 );
+    REQUIRE( output.size() == 1 );
+    CHECK( output[0] == "Hello from child ." );
+
+    wxLogNull noLog;
+    CHECK( wxExecute("/nonexistent/program", wxEXEC_SYNC) != 0 );
+}
+
+// This class collects the output of the child process which is streamed to it
+// and exits the event loop when the child process terminates.
+class StreamingProcess : public wxProcess
+{
+public:
+    explicit StreamingProcess(bool pauseOnFirstChunk)
+        : m_pauseOnFirstChunk(pauseOnFirstChunk)
+    {
+        StreamOutput(4096);
+
+        Bind(wxEVT_PROCESS_OUTPUT, &StreamingProcess::OnOutputEvent, this);
+    }
+
+    virtual void OnTerminate(int WXUNUSED(pid), int status) override
+    {
+        m_terminated = true;
+        m_status = status;
+
+        wxEventLoop::GetActive()->ScheduleExit();
+    }
+
+    void OnOutputEvent(wxProcessOutputEvent& event)
+    {
+        // Output must never be received after the termination notification.
+        CHECK( !m_terminated );
+        CHECK( event.GetDataLen() <= GetOutputChunkSize() );
+
+        std::string& out = event.IsError() ? m_err : m_out;
+        out.append(static_cast<const char*>(event.GetData()),
+                   event.GetDataLen());
+
+        if ( m_pauseOnFirstChunk )
+        {
+            m_pauseOnFirstChunk = false;
+
+            PauseOutput();
+            m_resumeTimer.Bind(wxEVT_TIMER,
+                               [this](wxTimerEvent&) { ResumeOutput(); });
+            m_resumeTimer.StartOnce(100);
+        }
+    }
+
+    const std::string& GetOut() const { return m_out; }
+    const std::string& GetErr() const { return m_err; }
+    bool IsTerminated() const { return m_terminated; }
+    int GetStatus() const { return m_status; }
+
+private:
+    bool m_pauseOnFirstChunk;
+    bool m_terminated = false;
+    int m_status = -1;
+
+    std::string m_out,
+                m_err;
+
+    wxTimer m_resumeTimer;
+
+    wxDECLARE_NO_COPY_CLASS(StreamingProcess);
+};
+
+TEST_CASE("wxExecute::StreamOutput", "[exec]")
+{
+    bool pause = false;
+    SECTION("Continuous") { pause = false; }
+    SECTION("Paused") { pause = true; }
+
+    StreamingProcess proc(pause);
+
+    wxEventLoop loop;
+    REQUIRE( wxExecute("sh -c 'seq 1 100000; echo done >&2'",
+                       wxEXEC_ASYNC, &proc) != 0 );
+
+    // Streamed output is not available as a stream.
+    CHECK( !proc.GetInputStream() );
+    CHECK( !proc.GetErrorStream() );
+
+    loop.Run();
+
+    REQUIRE( proc.IsTerminated() );
+    CHECK( proc.GetStatus() == 0 );
+    CHECK( !proc.IsOutputPaused() );
+
+    std::string expected;
+    for ( int n = 1; n <= 100000; n++ )
+    {
+        expected += std::to_string(n);
+        expected += '\n';
+    }
+
+    // Use extra parentheses to avoid dumping the huge strings if they differ.
+    CHECK( proc.GetOut().size() == expected.size() );
+    CHECK( (proc.GetOut() == expected) );
+    CHECK( proc.GetErr() == "done\n" );
+}
+
 // This test is disabled by default because it must be run in French locale,
 // i.e. with explicit LC_ALL=fr_FR.UTF-8 and only works with GNU ls, which
 // produces the expected output.
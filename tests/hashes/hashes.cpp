@@ -556,3 +556,30 @@ void HashesTestCase::wxHashSetTest()
     CPPUNIT_ASSERT( it->ptr == &dummy );
     CPPUNIT_ASSERT( it->str == wxT("ABC") );
 }
+
+WX_DECLARE_HASH_MAP( wxString, int, wxStringHashNoCase, wxStringEqualNoCase,
+                     wxStringToIntNoCaseHashMap );
+
+TEST_CASE("wxHashMap::NoCase", "[hashmap]")
+{
+    const wxString longStr("A Somewhat Longer Key Which Is Longer Than 16 Chars");
+
+    wxStringHashNoCase hash;
+    CHECK( hash("abc") == hash("ABC") );
+    CHECK( hash(longStr) == hash(longStr.Lower()) );
+    CHECK( hash(longStr) == hash(longStr.Upper()) );
+    CHECK( hash(wxString::FromUTF8("\xc3\x84pfel")) ==
+           hash(wxString::FromUTF8("\xc3\x84PFEL")) );
+
+    wxStringToIntNoCaseHashMap map;
+    map["Key"] = 1;
+    map[longStr] = 2;
+
+    CHECK( map.size() == 2 );
+    CHECK( map["KEY"] == 1 );
+    CHECK( map[longStr.Upper()] == 2 );
+    CHECK( map.size() == 2 );
+
+    CHECK( map.find("kEy") != map.end() );
+    CHECK( map.find("Keys") == map.end() );
+}
@@ -18,7 +18,16 @@
     #include "wx/filefn.h"
 #endif // WX_PRECOMP
 
+#include "wx/ffile.h"
+#include "wx/logasync.h"
+#include "wx/logbinary.h"
 #include "wx/scopeguard.h"
+#include "wx/thread.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
 
 #if wxUSE_LOG
 
@@ -31,6 +40,7 @@
 // all calls to wxLogXXX() functions from this file will use this log component
 #define wxLOG_COMPONENT "test"
 
+#include "testfile.h"
 #include "testlog.h"
 
 TEST_CASE_METHOD(LogTestCase, "wxLog::Functions", "[log]")
@@ -188,6 +198,414 @@ TEST_CASE_METHOD(LogTestCase, "wxLog::NoWarnings", "[log]")
     CHECK( m_log->GetLog(wxLOG_Error) == "If" );
 }
 
+// ----------------------------------------------------------------------------
+// deferred logging tests
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+// Install the given log target for the lifetime of this object.
+class ActiveLogSetter
+{
+public:
+    explicit ActiveLogSetter(wxLog* log)
+        : m_log(log),
+          m_logOld(wxLog::SetActiveTarget(log))
+    {
+    }
+
+    ~ActiveLogSetter()
+    {
+        wxLog::SetActiveTarget(m_logOld);
+        delete m_log;
+    }
+
+private:
+    wxLog* const m_log;
+    wxLog* const m_logOld;
+};
+
+} // anonymous namespace
+
+// Check that formatting the deferred message gives the same result as
+// formatting it immediately.
+#define CHECK_DEFERRED(...) \
+    wxLogGenericDeferred(wxLOG_Message, __VA_ARGS__); \
+    CHECK( m_log->GetLog(wxLOG_Message) == wxString::Format(__VA_ARGS__) )
+
+TEST_CASE_METHOD(LogTestCase, "wxLog::Deferred", "[log][deferred]")
+{
+    int i = 42;
+    const char* const narrow = "narrow";
+    const wchar_t* const wide = L"wide";
+
+    CHECK_DEFERRED("No arguments");
+    CHECK_DEFERRED("%d apples", 17);
+    CHECK_DEFERRED("%5d|%-5d|%05d|%+d", 42, -42, 42, 42);
+    CHECK_DEFERRED("%u %lu %llu %zu", 1u, 2ul, 3ull, sizeof(int));
+    CHECK_DEFERRED("%hd %ld %lld", static_cast<short>(-1), -2l, -3ll);
+    CHECK_DEFERRED("%x %X %o %#x", 255, 255, 8, 255);
+    CHECK_DEFERRED("%c%c", 'o', 'k');
+    CHECK_DEFERRED("%.2f %e %g %10.3f", 3.14159, 1e10, 0.5, 2.0f);
+    CHECK_DEFERRED("%s and %s", narrow, wide);
+    CHECK_DEFERRED("%s and %s", wxString("wxString"), std::string("std"));
+    CHECK_DEFERRED("[%10s|%-10s|%.3s]", "right", "left", "truncated");
+    CHECK_DEFERRED("%2$s %1$s", "world", "hello");
+    CHECK_DEFERRED("100%% done in %d steps", 3);
+    CHECK_DEFERRED("%p", &i);
+    CHECK_DEFERRED("%d %s %d %g %s %d %s %u",
+                   1, "two", 3, 4.5, "six", 7, "eight", 9u);
+
+    // Type mismatches are handled gracefully.
+    wxLogGenericDeferred(wxLOG_Message, "%s|%d", 17, "str");
+    CHECK( m_log->GetLog(wxLOG_Message) == "17|str" );
+
+    // Missing arguments are just not substituted.
+    wxLogGenericDeferred(wxLOG_Message, "%d and %d", 1);
+    CHECK( m_log->GetLog(wxLOG_Message) == "1 and %d" );
+
+    // The string arguments are copied.
+    {
+        wxString temp("temporary");
+        wxLogGenericDeferred(wxLOG_Warning, "%s", temp);
+    }
+    CHECK( m_log->GetLog(wxLOG_Warning) == "temporary" );
+
+    // And the usual filtering applies.
+    {
+        wxLogNull noLog;
+        wxLogGenericDeferred(wxLOG_Error, "Not logged");
+    }
+    CHECK( m_log->GetLog(wxLOG_Error) == "" );
+
+    const wxLogRecordInfo& info = m_log->GetInfo(wxLOG_Warning);
+    CHECK( wxString(info.component) == "test" );
+    CHECK( info.timestampMS != 0 );
+}
+
+#undef CHECK_DEFERRED
+
+#if wxDEBUG_LEVEL
+
+TEST_CASE_METHOD(LogTestCase, "wxLog::TraceDeferred", "[log][deferred]")
+{
+    wxLogTraceDeferred(TEST_MASK, "Not shown %d", 1);
+    CHECK( m_log->GetLog(wxLOG_Trace) == "" );
+
+    wxLog::AddTraceMask(TEST_MASK);
+    wxON_BLOCK_EXIT1(wxLog::RemoveTraceMask, TEST_MASK);
+
+    wxLogTraceDeferred(TEST_MASK, "Shown %d", 2);
+    CHECK( m_log->GetLog(wxLOG_Trace) == wxString::Format("(%s) Shown 2", TEST_MASK) );
+}
+
+#endif // wxDEBUG_LEVEL
+
+TEST_CASE("wxLog::DeferredRecord", "[log][deferred]")
+{
+    // Log target storing the deferred records without formatting them.
+    class DeferredLog : public wxLog
+    {
+    public:
+        std::vector<wxLogDeferredRecord> records;
+        int numFormatted = 0;
+
+    protected:
+        virtual void DoLogRecord(wxLogLevel,
+                                 const wxString&,
+                                 const wxLogRecordInfo&) override
+        {
+            numFormatted++;
+        }
+
+        virtual void DoLogDeferredRecord(const wxLogDeferredRecord& rec) override
+        {
+            records.push_back(rec);
+        }
+    };
+
+    DeferredLog* const log = new DeferredLog;
+    ActiveLogSetter setLog(log);
+
+    enum Color { Red, Green };
+
+    wxLogGenericDeferred(wxLOG_Message, "%d %u %f %p %s %d",
+                         -1, 2u, 3.5, log, "four", Green);
+    wxLogMessage("Formatted");
+
+    CHECK( log->numFormatted == 1 );
+    REQUIRE( log->records.size() == 1 );
+
+    const wxLogDeferredRecord& rec = log->records[0];
+    CHECK( rec.level == wxLOG_Message );
+    CHECK( wxString(rec.format) == "%d %u %f %p %s %d" );
+    REQUIRE( rec.GetArgCount() == 6 );
+    CHECK( rec.GetArgType(0) == wxLogDeferredRecord::Arg_Int );
+    CHECK( rec.GetIntArg(0) == -1 );
+    CHECK( rec.GetArgType(1) == wxLogDeferredRecord::Arg_UInt );
+    CHECK( rec.GetUIntArg(1) == 2 );
+    CHECK( rec.GetArgType(2) == wxLogDeferredRecord::Arg_Double );
+    CHECK( rec.GetDoubleArg(2) == 3.5 );
+    CHECK( rec.GetArgType(3) == wxLogDeferredRecord::Arg_Pointer );
+    CHECK( rec.GetPointerArg(3) == wxPtrToUInt(log) );
+    CHECK( rec.GetArgType(4) == wxLogDeferredRecord::Arg_String );
+    CHECK( rec.GetStringArg(4) == "four" );
+    CHECK( rec.GetIntArg(5) == Green );
+
+    CHECK( rec.Format() == wxString::Format("-1 2 3.500000 %p four 1", log) );
+
+    // Repetition counting requires formatting the messages.
+    wxLog::SetRepetitionCounting(true);
+    wxON_BLOCK_EXIT1(wxLog::SetRepetitionCounting, false);
+
+    wxLogGenericDeferred(wxLOG_Message, "%d", 1);
+    CHECK( log->numFormatted == 2 );
+    CHECK( log->records.size() == 1 );
+}
+
+#if wxUSE_FFILE
+
+TEST_CASE("wxLogBinaryFile", "[log][deferred][binary]")
+{
+    TempFile file("logtest.wxlog");
+
+    int line1, line2, line3;
+    {
+        wxLogBinaryFile* const log = new wxLogBinaryFile(file.GetName());
+        REQUIRE( log->IsOk() );
+
+        ActiveLogSetter setLog(log);
+
+        for ( int n = 0; n < 3; n++ )
+        {
+            line1 = __LINE__ + 1;
+            wxLogGenericDeferred(wxLOG_Info, "Iteration %d: %s=%.1f",
+                                 n, wxString("value"), n/2.);
+        }
+
+        line2 = __LINE__ + 1;
+        wxLogWarning("Already formatted %s", "warning");
+
+        line3 = __LINE__ + 1;
+        wxLogGenericDeferred(wxLOG_Error, "%lld %llu %s %s",
+                             -1234567890123ll, 1234567890123ull,
+                             L"wide \u00e9", "");
+
+        CHECK( log->Close() );
+    }
+
+    wxLogBinaryReader reader(file.GetName());
+    REQUIRE( reader.IsOk() );
+
+    wxLogLevel level;
+    wxString msg;
+    wxLogRecordInfo info;
+    for ( int n = 0; n < 3; n++ )
+    {
+        REQUIRE( reader.ReadRecord(level, msg, info) );
+        CHECK( level == wxLOG_Info );
+        CHECK( msg == wxString::Format("Iteration %d: value=%.1f", n, n/2.) );
+        CHECK( wxString(info.filename) == __FILE__ );
+        CHECK( info.line == line1 );
+        CHECK( wxString(info.component) == "test" );
+        CHECK( info.timestampMS != 0 );
+#if wxUSE_THREADS
+        CHECK( info.threadId == wxThread::GetCurrentId() );
+#endif // wxUSE_THREADS
+    }
+
+    REQUIRE( reader.ReadRecord(level, msg, info) );
+    CHECK( level == wxLOG_Warning );
+    CHECK( msg == "Already formatted warning" );
+    CHECK( info.line == line2 );
+
+    REQUIRE( reader.ReadRecord(level, msg, info) );
+    CHECK( level == wxLOG_Error );
+    CHECK( msg == wxString::FromUTF8("-1234567890123 1234567890123 wide \xc3\xa9 ") );
+    CHECK( info.line == line3 );
+
+    CHECK( !reader.ReadRecord(level, msg, info) );
+    CHECK( !reader.HasError() );
+}
+
+TEST_CASE("wxLogBinaryReader::Invalid", "[log][deferred][binary]")
+{
+    TempFile file("logtest.txt");
+    {
+        wxFFile f(file.GetName(), "wb");
+        REQUIRE( f.Write(wxString("This is not a log file")) );
+    }
+
+    wxLogNull noLog;
+
+    wxLogBinaryReader reader(file.GetName());
+    CHECK( !reader.IsOk() );
+    CHECK( reader.HasError() );
+}
+
+TEST_CASE("wxLogBinaryReader::Corrupted", "[log][deferred][binary]")
+{
+    TempFile file("logtest.bin");
+    {
+        // Valid header followed by a string definition with the length much
+        // greater than the file size, which must not be allocated.
+        static const char data[] =
+            "wxLOGBIN\x01"
+            "\x01\x01\xff\xff\xff\xff\xff\xff\xff\xff\xff\x01"
+            "abc";
+
+        wxFFile f(file.GetName(), "wb");
+        REQUIRE( f.Write(data, sizeof(data) - 1) == sizeof(data) - 1 );
+    }
+
+    wxLogBinaryReader reader(file.GetName());
+    REQUIRE( reader.IsOk() );
+
+    wxLogLevel level;
+    wxString msg;
+    wxLogRecordInfo info;
+    CHECK( !reader.ReadRecord(level, msg, info) );
+    CHECK( reader.HasError() );
+}
+
+#endif // wxUSE_FFILE
+
+namespace
+{
+
+// Log target storing all the messages logged to it.
+class MessagesLog : public wxLog
+{
+public:
+    MessagesLog() = default;
+
+    const std::vector<wxString>& GetMessages() const { return m_messages; }
+
+protected:
+    virtual void DoLogRecord(wxLogLevel WXUNUSED(level),
+                             const wxString& msg,
+                             const wxLogRecordInfo& WXUNUSED(info)) override
+    {
+        m_messages.push_back(msg);
+    }
+
+private:
+    std::vector<wxString> m_messages;
+};
+
+// Remove the rate limits of the given component on scope exit.
+class RateLimitResetter
+{
+public:
+    explicit RateLimitResetter(const char* component)
+        : m_component(component)
+    {
+    }
+
+    ~RateLimitResetter()
+    {
+        wxLog::SetComponentRateLimit(m_component, 0);
+        wxLog::SetComponentSampling(m_component, 1);
+        wxLog::SetSuppressedSummaryInterval(10000);
+    }
+
+private:
+    const char* const m_component;
+};
+
+} // anonymous namespace
+
+TEST_CASE("wxLog::RateLimit", "[log][ratelimit]")
+{
+    MessagesLog* const log = new MessagesLog;
+    ActiveLogSetter setLog(log);
+
+    const std::vector<wxString>& messages = log->GetMessages();
+
+    RateLimitResetter resetLimits("test/limited");
+    wxLog::SetComponentRateLimit("test/limited", 0.001, 3);
+    wxLog::SetSuppressedSummaryInterval(0);
+
+    #undef wxLOG_COMPONENT
+    #define wxLOG_COMPONENT "test/limited/sub"
+
+    for ( int n = 0; n < 10; n++ )
+        wxLogMessage("Message %d", n);
+
+    REQUIRE( messages.size() == 3 );
+    CHECK( messages.back() == "Message 2" );
+
+    // Messages from another location are limited independently.
+    wxLogMessage("Another message");
+    REQUIRE( messages.size() == 4 );
+
+    // The number of suppressed messages is logged when flushing.
+    wxLog::FlushActive();
+    REQUIRE( messages.size() == 5 );
+    CHECK( messages.back() == "7 messages from the same location were suppressed." );
+
+    // But only once.
+    wxLog::FlushActive();
+    CHECK( messages.size() == 5 );
+
+    // Sampling can be used to drop all messages too.
+    wxLog::SetComponentSampling("test/limited", 0);
+    for ( int n = 0; n < 3; n++ )
+    {
+        // Disable both sampling and the rate limit before the last message:
+        // the number of suppressed messages must be logged before it.
+        if ( n == 2 )
+        {
+            wxLog::SetComponentSampling("test/limited", 1);
+            wxLog::SetComponentRateLimit("test/limited", 0);
+        }
+
+        wxLogMessage("Sampled %d", n);
+    }
+
+    REQUIRE( messages.size() == 7 );
+    CHECK( messages[5] == "2 messages from the same location were suppressed." );
+    CHECK( messages[6] == "Sampled 2" );
+
+    #undef wxLOG_COMPONENT
+    #define wxLOG_COMPONENT "test"
+
+    // Other components are not affected.
+    wxLog::SetComponentSampling("test/limited", 0);
+    for ( int n = 0; n < 5; n++ )
+        wxLogMessage("Unlimited %d", n);
+
+    CHECK( messages.size() == 12 );
+}
+
+TEST_CASE("wxLog::Sampling", "[log][ratelimit]")
+{
+    MessagesLog* const log = new MessagesLog;
+    ActiveLogSetter setLog(log);
+
+    RateLimitResetter resetLimits("");
+    wxLog::SetComponentSampling("", 0.25);
+
+    for ( int n = 0; n < 10000; n++ )
+        wxLogMessage("Sampled");
+
+    const size_t count = log->GetMessages().size();
+    CHECK( count > 2000 );
+    CHECK( count < 3000 );
+
+    // The number of suppressed messages is not logged before the interval
+    // expires.
+    wxLog::FlushActive();
+    CHECK( log->GetMessages().back() == "Sampled" );
+
+    wxLog::SetSuppressedSummaryInterval(0);
+    wxLog::FlushActive();
+    CHECK( log->GetMessages().back() ==
+            wxString::Format("%zu messages from the same location were suppressed.",
+                             10000 - count) );
+}
+
 // The following two functions (v, macroCompilabilityTest) are not run by
 // any test, and their purpose is merely to guarantee that the wx(V)LogXXX
 // macros compile without 'dangling else' warnings.
@@ -249,6 +667,10 @@ void macroCompilabilityTest()
         wxLogSysError("hello syserror %d", 42);
     if (true)
         wxLogDebug("hello debug %d", 42);
+    if (true)
+        wxLogGenericDeferred(wxLOG_Info, "hello generic deferred %d", 42);
+    if (true)
+        wxLogTraceDeferred(wxTRACE_Messages, "hello trace deferred %d", 42);
 }
 
 // This allows to check wxLogTrace() interactively by running this test with
@@ -263,4 +685,398 @@ TEST_CASE("wxLog::WXTRACE", "[log][.]")
     wxLogTrace("logtest", "Ending test 1/4s later");
 }
 
+#if wxUSE_THREADS
+
+// ----------------------------------------------------------------------------
+// wxLogAsync tests
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+// Log target storing all messages in the vector provided by the caller, as
+// wxLogAsync takes ownership of the log target and destroys it.
+class AsyncTestLog : public wxLog
+{
+public:
+    explicit AsyncTestLog(std::vector<wxString>& msgs)
+        : m_msgs(msgs)
+    {
+    }
+
+    // Block the writer thread when writing the next message until Unblock()
+    // is called and return only once it does block.
+    void BlockNext()
+    {
+        m_blockNext = true;
+    }
+
+    void WaitUntilBlocked() { m_semBlocked.Wait(); }
+    void Unblock() { m_semUnblock.Post(); }
+
+    int GetCountFromMain() const { return m_countFromMain; }
+
+protected:
+    virtual void DoLogRecord(wxLogLevel WXUNUSED(level),
+                             const wxString& msg,
+                             const wxLogRecordInfo& WXUNUSED(info)) override
+    {
+        if ( m_blockNext.exchange(false) )
+        {
+            m_semBlocked.Post();
+            m_semUnblock.Wait();
+        }
+
+        if ( wxThread::IsMain() )
+            m_countFromMain++;
+
+        wxCriticalSectionLocker lock(m_cs);
+        m_msgs.push_back(msg);
+    }
+
+private:
+    std::vector<wxString>& m_msgs;
+
+    std::atomic<bool> m_blockNext{false};
+    std::atomic<int> m_countFromMain{0};
+    wxSemaphore m_semBlocked;
+    wxSemaphore m_semUnblock;
+    wxCriticalSection m_cs;
+};
+
+} // anonymous namespace
+
+TEST_CASE("wxLogAsync::Basic", "[log][async]")
+{
+    std::vector<wxString> msgs;
+    AsyncTestLog* const testLog = new AsyncTestLog(msgs);
+
+    {
+        wxLogAsync* const log = new wxLogAsync(testLog);
+        ActiveLogSetter setLog(log);
+
+        CHECK( log->GetLog() == testLog );
+
+        for ( int n = 0; n < 100; n++ )
+            wxLogMessage("%d", n);
+
+        CHECK( log->FlushAndWait() );
+        REQUIRE( msgs.size() == 100 );
+        CHECK( msgs[0] == "0" );
+        CHECK( msgs[99] == "99" );
+
+        // All messages were written from the writer thread.
+        CHECK( testLog->GetCountFromMain() == 0 );
+
+        // Messages logged just before destroying the target are not lost.
+        wxLogMessage("Last");
+    }
+
+    REQUIRE( msgs.size() == 101 );
+    CHECK( msgs.back() == "Last" );
+}
+
+TEST_CASE("wxLogAsync::Overflow", "[log][async]")
+{
+    std::vector<wxString> msgs;
+    AsyncTestLog* const testLog = new AsyncTestLog(msgs);
+
+    wxLogAsync* const log = new wxLogAsync(testLog, 4, wxLOG_ASYNC_DROP);
+    ActiveLogSetter setLog(log);
+
+    // Block the writer thread while it writes the first message.
+    testLog->BlockNext();
+    wxLogMessage("First");
+    testLog->WaitUntilBlocked();
+
+    SECTION("Drop")
+    {
+        for ( int n = 0; n < 10; n++ )
+            wxLogMessage("%d", n);
+
+        testLog->Unblock();
+        CHECK( log->FlushAndWait() );
+
+        CHECK( log->GetDroppedCount() == 6 );
+
+        // There must be the first message, the warning about the dropped
+        // messages and the 4 messages which fit into the queue.
+        REQUIRE( msgs.size() == 6 );
+        CHECK( msgs[0] == "First" );
+        CHECK( msgs[1].Contains("6 log messages were dropped") );
+        CHECK( msgs[2] == "0" );
+        CHECK( msgs[5] == "3" );
+    }
+
+    SECTION("DropOldest")
+    {
+        log->SetOverflowPolicy(wxLOG_ASYNC_DROP_OLDEST);
+
+        for ( int n = 0; n < 10; n++ )
+            wxLogMessage("%d", n);
+
+        testLog->Unblock();
+        CHECK( log->FlushAndWait() );
+
+        CHECK( log->GetDroppedCount() == 6 );
+
+        REQUIRE( msgs.size() == 6 );
+        CHECK( msgs[2] == "6" );
+        CHECK( msgs[5] == "9" );
+    }
+
+    SECTION("DropOldestFlush")
+    {
+        log->SetOverflowPolicy(wxLOG_ASYNC_DROP_OLDEST);
+
+        for ( int n = 0; n < 4; n++ )
+            wxLogMessage("%d", n);
+
+        // Wait for the flush from another thread: its request can only be
+        // queued once some space is freed by dropping the oldest messages,
+        // and it must not be lost when it becomes the oldest one itself.
+        class FlushThread : public wxThread
+        {
+        public:
+            explicit FlushThread(wxLogAsync* log)
+                : wxThread(wxTHREAD_JOINABLE),
+                  m_log(log)
+            {
+            }
+
+            std::atomic<bool> flushed{false};
+
+        protected:
+            virtual void* Entry() override
+            {
+                flushed = m_log->FlushAndWait();
+                return nullptr;
+            }
+
+        private:
+            wxLogAsync* const m_log;
+        };
+
+        FlushThread thread(log);
+        REQUIRE( thread.Run() == wxTHREAD_NO_ERROR );
+
+        for ( int n = 4; n < 1000; n++ )
+            wxLogMessage("%d", n);
+
+        testLog->Unblock();
+        thread.Wait();
+        CHECK( thread.flushed );
+
+        CHECK( log->FlushAndWait() );
+        CHECK( msgs.back() == "999" );
+    }
+
+    SECTION("Block")
+    {
+        log->SetOverflowPolicy(wxLOG_ASYNC_BLOCK);
+
+        for ( int n = 0; n < 4; n++ )
+            wxLogMessage("%d", n);
+
+        // The queue is full now, so flushing it must time out.
+        CHECK( !log->FlushAndWait(10) );
+
+        testLog->Unblock();
+        CHECK( log->FlushAndWait() );
+
+        CHECK( log->GetDroppedCount() == 0 );
+        CHECK( msgs.size() == 5 );
+    }
+}
+
+TEST_CASE("wxLogAsync::Threads", "[log][async]")
+{
+    std::vector<wxString> msgs;
+    wxLogAsync* const log = new wxLogAsync(new AsyncTestLog(msgs), 16);
+    ActiveLogSetter setLog(log);
+
+    // Use the asynchronous target in the worker threads directly instead of
+    // buffering the messages until they're flushed by the main thread.
+    class LoggingThread : public wxThread
+    {
+    public:
+        explicit LoggingThread(wxLog* log)
+            : wxThread(wxTHREAD_JOINABLE),
+              m_log(log)
+        {
+        }
+
+    protected:
+        virtual void* Entry() override
+        {
+            wxLog::SetThreadActiveTarget(m_log);
+
+            for ( int n = 0; n < 1000; n++ )
+                wxLogMessage("%d", n);
+
+            wxLog::SetThreadActiveTarget(nullptr);
+
+            return nullptr;
+        }
+
+    private:
+        wxLog* const m_log;
+    };
+
+    LoggingThread thread1(log), thread2(log);
+    REQUIRE( thread1.Run() == wxTHREAD_NO_ERROR );
+    REQUIRE( thread2.Run() == wxTHREAD_NO_ERROR );
+    thread1.Wait();
+    thread2.Wait();
+
+    CHECK( log->FlushAndWait() );
+    CHECK( msgs.size() == 2000 );
+}
+
+TEST_CASE("wxLog::ThreadMessages", "[log]")
+{
+    // Collects the messages logged from the worker threads, which are only
+    // passed to it from the main thread by FlushThreadMessages().
+    class ThreadMessagesLog : public wxLog
+    {
+    public:
+        struct Record
+        {
+            wxString msg;
+            wxThreadIdType threadId;
+            wxLongLong_t timestampMS;
+        };
+
+        std::vector<Record> records;
+
+    protected:
+        virtual void DoLogRecord(wxLogLevel,
+                                 const wxString& msg,
+                                 const wxLogRecordInfo& info) override
+        {
+            records.push_back({msg, info.threadId, info.timestampMS});
+        }
+    };
+
+    class LoggingThread : public wxThread
+    {
+    public:
+        explicit LoggingThread(int id)
+            : wxThread(wxTHREAD_JOINABLE),
+              m_id(id)
+        {
+        }
+
+    protected:
+        virtual void* Entry() override
+        {
+            for ( int n = 0; n < 500; n++ )
+                wxLogMessage("%d:%d", m_id, n);
+
+            return nullptr;
+        }
+
+    private:
+        const int m_id;
+    };
+
+    ThreadMessagesLog* const log = new ThreadMessagesLog;
+    ActiveLogSetter setLog(log);
+
+    // Flush the messages once while some of the threads are still running
+    // and then again after all of them terminate.
+    std::vector< std::unique_ptr<LoggingThread> > threads;
+    for ( int n = 0; n < 4; n++ )
+    {
+        threads.emplace_back(new LoggingThread(n));
+        REQUIRE( threads.back()->Run() == wxTHREAD_NO_ERROR );
+    }
+
+    wxLog::FlushActive();
+
+    for ( auto& thread : threads )
+        thread->Wait();
+
+    const size_t numFirst = log->records.size();
+
+    wxLog::FlushActive();
+
+    const auto& records = log->records;
+    REQUIRE( records.size() == 2000 );
+
+    // The messages of each thread must be in order and the messages of all
+    // threads must be ordered by their time stamps.
+    int next[4] = { 0, 0, 0, 0 };
+    for ( size_t n = 0; n < records.size(); n++ )
+    {
+        int id = -1,
+            num = -1;
+        REQUIRE( records[n].msg.BeforeFirst(':').ToInt(&id) );
+        REQUIRE( records[n].msg.AfterFirst(':').ToInt(&num) );
+        REQUIRE( id >= 0 );
+        REQUIRE( id < 4 );
+        CHECK( num == next[id]++ );
+        CHECK( records[n].threadId != wxThread::GetMainId() );
+
+        // The order is only guaranteed inside each flushed batch.
+        if ( n && n != numFirst )
+            CHECK( records[n - 1].timestampMS <= records[n].timestampMS );
+    }
+}
+
+TEST_CASE("wxLog::RateLimitThreads", "[log][ratelimit]")
+{
+    MessagesLog* const log = new MessagesLog;
+    ActiveLogSetter setLog(log);
+
+    RateLimitResetter resetLimits("test/threads");
+    wxLog::SetComponentRateLimit("test/threads", 0.001, 10);
+    wxLog::SetSuppressedSummaryInterval(0);
+
+    // All threads log from the same location, so they share the same limit.
+    class LoggingThread : public wxThread
+    {
+    public:
+        LoggingThread() : wxThread(wxTHREAD_JOINABLE) { }
+
+    protected:
+        virtual void* Entry() override
+        {
+            #undef wxLOG_COMPONENT
+            #define wxLOG_COMPONENT "test/threads"
+
+            for ( int n = 0; n < 1000; n++ )
+                wxLogMessage("Limited");
+
+            #undef wxLOG_COMPONENT
+            #define wxLOG_COMPONENT "test"
+
+            // And this one is not limited at all.
+            for ( int n = 0; n < 100; n++ )
+                wxLogMessage("Unlimited");
+
+            return nullptr;
+        }
+    };
+
+    std::vector< std::unique_ptr<LoggingThread> > threads;
+    for ( int n = 0; n < 4; n++ )
+    {
+        threads.emplace_back(new LoggingThread);
+        REQUIRE( threads.back()->Run() == wxTHREAD_NO_ERROR );
+    }
+
+    for ( auto& thread : threads )
+        thread->Wait();
+
+    wxLog::FlushActive();
+
+    const std::vector<wxString>& messages = log->GetMessages();
+    CHECK( std::count(messages.begin(), messages.end(), "Limited") == 10 );
+    CHECK( std::count(messages.begin(), messages.end(), "Unlimited") == 400 );
+    CHECK( messages.back() == "3990 messages from the same location were suppressed." );
+}
+
+#endif // wxUSE_THREADS
+
 #endif // wxUSE_LOG
@@ -74,6 +74,7 @@ private:
         CPPUNIT_TEST( IconvTests );
         CPPUNIT_TEST( Latin1Tests );
         CPPUNIT_TEST( FontmapTests );
+        CPPUNIT_TEST( SBCSTests );
         CPPUNIT_TEST( BufSize );
         CPPUNIT_TEST( FromWCharTests );
         CPPUNIT_TEST( NonBMPCharTests );
@@ -108,6 +109,7 @@ private:
     void CP1252Tests();
     void LibcTests();
     void FontmapTests();
+    void SBCSTests();
     void BufSize();
     void FromWCharTests();
     void NonBMPCharTests();
@@ -831,6 +833,39 @@ void MBConvTestCase::FontmapTests()
 #endif
 }
 
+WXDLLIMPEXP_BASE wxMBConv* new_wxMBConv_sbcs( wxFontEncoding enc );
+
+void MBConvTestCase::SBCSTests()
+{
+    wxMBConv* converter = new_wxMBConv_sbcs(wxFONTENCODING_CP1252);
+    if ( !converter )
+    {
+        return;
+    }
+    TestCoder(
+        (const char*)CP1252,
+        sizeof(CP1252),
+        (const char*)CP1252_utf8,
+        sizeof(CP1252_utf8),
+        *converter,
+        1
+        );
+
+    // 0x81 is not defined in CP1252.
+    CPPUNIT_ASSERT_EQUAL( wxCONV_FAILED, converter->ToWChar(nullptr, 0, "\x81") );
+
+    // And U+00FF is, but U+0100 isn't.
+    char buf[2];
+    CPPUNIT_ASSERT_EQUAL( size_t(2), converter->FromWChar(buf, 2, L"\xff") );
+    CPPUNIT_ASSERT_EQUAL( '\xff', buf[0] );
+    CPPUNIT_ASSERT_EQUAL( wxCONV_FAILED, converter->FromWChar(buf, 2, L"\x100") );
+
+    delete converter;
+
+    // Multibyte encodings are not supported by this converter.
+    CPPUNIT_ASSERT( !new_wxMBConv_sbcs(wxFONTENCODING_UTF8) );
+}
+
 void MBConvTestCase::BufSize()
 {
     wxCSConv conv1251(wxT("CP1251"));
@@ -1501,3 +1536,77 @@ TEST_CASE("wxMBConv::cMB2WC", "[mbconv][mb2wc]")
     // just rejected as an invalid encoded chunk.
     CHECK( wxConvUTF7.cMB2WC("+\xc3").length() == 0 );
 }
+
+TEST_CASE("wxMBConv::ToWCharInto", "[mbconv][mb2wc]")
+{
+    wxWCharBuffer buf;
+
+    // Converting empty input must work even when the buffer is empty too.
+    CHECK( wxConvUTF8.ToWCharInto(buf, "", 0) == 0 );
+    CHECK( buf.data() );
+
+    CHECK( wxConvUTF8.ToWCharInto(buf, "Hello") == 6 );
+    CHECK( buf.length() == 6 );
+    CHECK( wxString(buf.data()) == "Hello" );
+
+    // The buffer is reused if it is big enough.
+    const wchar_t* const data = buf.data();
+    CHECK( wxConvUTF8.ToWCharInto(buf, "\xc3\xa9t\xc3\xa9", 5) == 3 );
+    CHECK( buf.data() == data );
+    CHECK( buf.length() == 3 );
+    CHECK( wxString(buf.data(), buf.length()) == wxString::FromUTF8("\xc3\xa9t\xc3\xa9") );
+
+    // And reallocated if it isn't.
+    const wxString big(wxUniChar(0x20ac), 1000);
+    CHECK( wxConvUTF8.ToWCharInto(buf, big.utf8_str()) == 1001 );
+    CHECK( wxString(buf.data()) == big );
+
+    CHECK( wxConvUTF8.ToWCharInto(buf, "\xff") == wxCONV_FAILED );
+
+    wxMBConvUTF16 convUTF16;
+    CHECK( convUTF16.ToWCharInto(buf, "H\0i\0\0") == 3 );
+    CHECK( wxString(buf.data()) == "Hi" );
+}
+
+TEST_CASE("wxMBConv::FromWCharInto", "[mbconv][wc2mb]")
+{
+    wxCharBuffer buf;
+
+    CHECK( wxConvUTF8.FromWCharInto(buf, L"Hello") == 6 );
+    CHECK( buf.length() == 6 );
+    CHECK( strcmp(buf, "Hello") == 0 );
+
+    // Output longer than the input, even for the long strings for which we
+    // don't reserve the maximal possible space initially.
+    const wxString big(wxUniChar(0x20ac), 100000);
+    CHECK( wxConvUTF8.FromWCharInto(buf, big.wc_str()) == 300001 );
+    CHECK( wxString::FromUTF8(buf.data()) == big );
+
+    const char* const data = buf.data();
+    CHECK( wxConvUTF8.FromWCharInto(buf, L"Hello", 5) == 5 );
+    CHECK( buf.data() == data );
+    CHECK( buf.length() == 5 );
+
+    CHECK( wxConvISO8859_1.FromWCharInto(buf, L"\x20ac") == wxCONV_FAILED );
+
+    wxCSConv convCP1252(wxFONTENCODING_CP1252);
+    CHECK( convCP1252.FromWCharInto(buf, L"\x20ac") == 2 );
+    CHECK( strcmp(buf, "\x80") == 0 );
+}
+
+TEST_CASE("wxString::mb_str", "[mbconv][wc2mb]")
+{
+    wxCSConv convCP1252(wxFONTENCODING_CP1252);
+
+    wxString s(L"caf\xe9");
+    CHECK( strcmp(s.mb_str(convCP1252), "caf\xe9") == 0 );
+
+    // Converting the string with the characters not representable in the
+    // target encoding must still fail, which results in an empty string.
+    s += L"\x100";
+    CHECK( s.mb_str(convCP1252).length() == 0 );
+
+    // And the output longer than the input must still work.
+    CHECK( strcmp(s.mb_str(wxConvUTF8), "caf\xc3\xa9\xc4\x80") == 0 );
+    CHECK( s.mb_str(wxConvUTF8).length() == 7 );
+}
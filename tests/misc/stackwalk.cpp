@@ -0,0 +1,184 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        tests/misc/stackwalk.cpp
+// Purpose:     Test wxStackWalker
+// Author:      wxWidgets team
+// Created:     2026-10-19
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+// ----------------------------------------------------------------------------
+// headers
+// ----------------------------------------------------------------------------
+
+#include "testprec.h"
+
+#if wxUSE_STACKWALKER && defined(__LINUX__)
+
+#include "wx/stackwalk.h"
+#include "wx/sysopt.h"
+
+#include "wx/unix/private/elfsymbols.h"
+
+#include <vector>
+
+#include <dlfcn.h>
+#include <link.h>
+#include <stdlib.h>
+
+namespace
+{
+
+class CollectingStackWalker : public wxStackWalker
+{
+public:
+    const std::vector<wxString>& GetNames() const { return m_names; }
+
+protected:
+    virtual void OnStackFrame(const wxStackFrame& frame) override
+    {
+        m_names.push_back(frame.GetName());
+    }
+
+private:
+    std::vector<wxString> m_names;
+};
+
+// Check that the frames contain wxStackWalker::Walk() itself: we can't check
+// for our own functions here, as the test program may be stripped, but this
+// one is always exported from wxBase and so must be found.
+void CheckWalkFound(const CollectingStackWalker& walker)
+{
+    bool found = false;
+    for ( const auto& name : walker.GetNames() )
+    {
+        if ( name.StartsWith("wxStackWalker::Walk(") )
+        {
+            found = true;
+            break;
+        }
+    }
+
+    CHECK( found );
+}
+
+// Find the module containing the given address and the address in it.
+const wxElfModule& GetModule(const void* addr, wxUIntPtr& addrInModule)
+{
+    Dl_info info;
+    link_map* lm;
+    REQUIRE( dladdr1(addr, &info, (void**)&lm, RTLD_DL_LINKMAP) );
+
+    addrInModule = wxPtrToUInt(addr) - lm->l_addr;
+
+    // Check that the modules are cached.
+    const wxElfModule& module = wxElfModule::Get(info.dli_fname);
+    CHECK( &wxElfModule::Get(info.dli_fname) == &module );
+
+    return module;
+}
+
+} // anonymous namespace
+
+// This function is intentionally not inline, so that it has its own entry in
+// the symbol table.
+__attribute__((noinline)) size_t WalkFromHere(CollectingStackWalker& walker)
+{
+    walker.Walk(0);
+
+    // Do something after the call to prevent it from being a tail call.
+    return walker.GetNames().size();
+}
+
+TEST_CASE("wxStackWalker::Walk", "[stackwalker]")
+{
+    // Check that both our own symbols reader and addr2line, when it's
+    // available, work.
+    int useAddr2line = 0;
+    SECTION("Default") { useAddr2line = 0; }
+    SECTION("addr2line")
+    {
+        if ( system("addr2line --version > /dev/null 2>&1") != 0 )
+        {
+            WARN("Skipping test requiring addr2line.");
+            return;
+        }
+
+        useAddr2line = 1;
+    }
+
+    wxSystemOptions::SetOption("unix.stackwalk.use_addr2line", useAddr2line);
+    struct ResetUseAddr2line
+    {
+        ~ResetUseAddr2line()
+        {
+            wxSystemOptions::SetOption("unix.stackwalk.use_addr2line", 0);
+        }
+    } resetUseAddr2line;
+
+    CollectingStackWalker walker;
+    REQUIRE( WalkFromHere(walker) > 1 );
+
+    CheckWalkFound(walker);
+}
+
+TEST_CASE("wxStackWalker::WalkAddresses", "[stackwalker]")
+{
+    // Use the address inside the function, as it would be the case for the
+    // real stack frames.
+    void* const address = reinterpret_cast<wxUint8*>(&qsort) + 1;
+
+    CollectingStackWalker walker;
+    walker.WalkAddresses(&address, 1);
+
+    REQUIRE( walker.GetNames().size() == 1 );
+    CHECK( walker.GetNames()[0] == "qsort" );
+}
+
+TEST_CASE("wxElfModule::Lookup", "[stackwalker]")
+{
+    wxElfLocation loc;
+    wxUIntPtr addr;
+
+    SECTION("Exported")
+    {
+        // The functions exported from shared libraries must always be found,
+        // even if they are stripped.
+        const wxElfModule& module = GetModule(reinterpret_cast<void*>(&qsort), addr);
+        REQUIRE( module.IsOk() );
+        REQUIRE( module.Lookup(addr, loc) );
+        CHECK( loc.name == "qsort" );
+    }
+
+    SECTION("Local")
+    {
+        const wxElfModule&
+            module = GetModule(reinterpret_cast<void*>(&WalkFromHere), addr);
+        if ( !module.Lookup(addr + 1, loc) )
+        {
+            WARN("Skipping test as the test program is stripped.");
+            return;
+        }
+
+        INFO("Function \"" << loc.name << "\" "
+             "at " << loc.filename << ":" << loc.line);
+
+        CHECK( loc.name.StartsWith("WalkFromHere(") );
+
+        // The line information is only available if the test was compiled
+        // with debug information.
+        if ( !loc.filename.empty() )
+        {
+            CHECK( loc.filename.EndsWith("stackwalk.cpp") );
+            CHECK( loc.line > 0 );
+        }
+    }
+
+    SECTION("Invalid")
+    {
+        const wxElfModule& module = wxElfModule::Get("/nonexistent/file");
+        CHECK( !module.IsOk() );
+        CHECK( !module.Lookup(0x1000, loc) );
+    }
+}
+
+#endif // wxUSE_STACKWALKER && __LINUX__
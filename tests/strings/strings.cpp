@@ -392,6 +392,26 @@ TEST_CASE("StringCaseChanges", "[wxString]")
     CHECK( wxString("ABC").Capitalize() == "Abc" );
 
     CHECK( wxString().Capitalize() == "" );
+
+    // Check that long strings, including those with non-ASCII characters in
+    // the middle, are handled correctly too.
+    wxString s4("The Quick Brown Fox Jumps Over The Lazy Dog [@`{]");
+    CHECK( s4.Lower() == "the quick brown fox jumps over the lazy dog [@`{]" );
+    CHECK( s4.Upper() == "THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG [@`{]" );
+
+    // Non-ASCII characters case mapping depends on the locale, so just check
+    // that it's consistent with wxTolower() and wxToupper().
+    const wxString s5 = wxString::FromUTF8("Stra\xc3\x9f" "e \xc3\x84pfel \xc3\xbc" "ber "
+                                           "\xd0\x9c\xd0\xbe\xd1\x81\xd0\xba\xd0\xb2\xd0\xb0");
+    wxString s5l, s5u;
+    for ( wxString::const_iterator it = s5.begin(); it != s5.end(); ++it )
+    {
+        s5l += wxTolower(*it);
+        s5u += wxToupper(*it);
+    }
+
+    CHECK( s5.Lower() == s5l );
+    CHECK( s5.Upper() == s5u );
 }
 
 TEST_CASE("StringCompare", "[wxString]")
@@ -517,6 +537,49 @@ TEST_CASE("StringCompareNoCase", "[wxString]")
     CHECK( wxString("\n").CmpNoCase(" ") < 0 );
     CHECK( wxString("'").CmpNoCase("!") > 0);
     CHECK( wxString("!").Cmp("Z") < 0 );
+
+    // Long strings, differing in case only or in their last characters.
+    const wxString
+        long1("Some Longer String Which Is Compared Without Case: 0123456789"),
+        long2("some longer string which is compared without case: 0123456789"),
+        long3("some longer string which is compared without case: 0123456780"),
+        long4("some longer string which is compared without case: 01234567");
+
+    CHECK_EQ_NO_CASE( long1, long2 );
+    CHECK( long1.CmpNoCase(long3) > 0 );
+    CHECK( long3.CmpNoCase(long1) < 0 );
+    CHECK( long1.CmpNoCase(long4) > 0 );
+    CHECK( long4.CmpNoCase(long1) < 0 );
+
+    // Check wxStricmp() for the wide strings, which uses the same fast path.
+    CHECK( wxStricmp(long1.wc_str(), long2.wc_str()) == 0 );
+    CHECK( wxStricmp(long1.wc_str(), long3.wc_str()) > 0 );
+    CHECK( wxStricmp(long3.wc_str(), long1.wc_str()) < 0 );
+    CHECK( wxStricmp(long1.wc_str(), long4.wc_str()) > 0 );
+    CHECK( wxStricmp(long4.wc_str(), long1.wc_str()) < 0 );
+    CHECK( wxStricmp(L"0123456789_abc", L"0123456789[ABC") > 0 );
+
+    // Letters are greater than the punctuation between the upper and lower
+    // case ASCII letters when comparing without case.
+    CHECK( wxString("0123456789_abc").CmpNoCase("0123456789[ABC") > 0 );
+    CHECK( wxString("0123456789ABC_").CmpNoCase("0123456789abc[") > 0 );
+
+    // Non-ASCII characters.
+    const wxString
+        nonAscii1 = wxString::FromUTF8("\xc3\x84pfel und Birnen, \xc3\x84pfel"),
+        nonAscii2 = wxString::FromUTF8("\xc3\x84PFEL UND BIRNEN, \xc3\x84PFEL"),
+        nonAscii3 = wxString::FromUTF8("\xc3\x84PFEL UND BIRNEN, \xc3\x84PFEX");
+
+    CHECK_EQ_NO_CASE( nonAscii1, nonAscii2 );
+    CHECK( nonAscii1.CmpNoCase(nonAscii3) < 0 );
+    CHECK( nonAscii1.IsSameAs(nonAscii2, false) );
+    CHECK_FALSE( nonAscii1.IsSameAs(nonAscii3, false) );
+
+    wxString withNUL1(long1), withNUL2(long2);
+    withNUL1.insert(20, 1, '\0');
+    withNUL2.insert(20, 1, '\0');
+    CHECK_EQ_NO_CASE( withNUL1, withNUL2 );
+    CHECK_NEQ_NO_CASE( withNUL1, long2 );
 }
 
 TEST_CASE("StringContains", "[wxString]")
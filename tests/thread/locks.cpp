@@ -0,0 +1,197 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        tests/thread/locks.cpp
+// Purpose:     Unit test for wxSharedMutex and wxSpinMutex
+// Author:      wxWidgets team
+// Created:     2026-10-19
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+// ----------------------------------------------------------------------------
+// headers
+// ----------------------------------------------------------------------------
+
+#include "testprec.h"
+
+
+#ifndef WX_PRECOMP
+    #include "wx/thread.h"
+#endif // WX_PRECOMP
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+// helpers
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+// Thread executing the given function.
+class FunctionThread : public wxThread
+{
+public:
+    explicit FunctionThread(const std::function<void()>& func)
+        : wxThread(wxTHREAD_JOINABLE),
+          m_func(func)
+    {
+    }
+
+protected:
+    virtual void* Entry() override
+    {
+        m_func();
+        return nullptr;
+    }
+
+private:
+    const std::function<void()> m_func;
+};
+
+// Run the given function in the given number of threads concurrently and
+// wait until all of them finish.
+void RunInThreads(int numThreads, const std::function<void()>& func)
+{
+    std::vector< std::unique_ptr<FunctionThread> > threads;
+    for ( int n = 0; n < numThreads; n++ )
+    {
+        threads.emplace_back(new FunctionThread(func));
+        REQUIRE( threads.back()->Run() == wxTHREAD_NO_ERROR );
+    }
+
+    for ( auto& thread : threads )
+        thread->Wait();
+}
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------------
+// tests
+// ----------------------------------------------------------------------------
+
+TEST_CASE("wxSharedMutex", "[thread][lock]")
+{
+    wxSharedMutex mutex;
+    REQUIRE( mutex.IsOk() );
+
+    SECTION("Shared")
+    {
+        // Any number of threads can lock it in shared mode.
+        CHECK( mutex.LockShared() == wxMUTEX_NO_ERROR );
+
+        std::atomic<int> numLocked{0};
+        RunInThreads(2, [&]()
+            {
+                if ( mutex.TryLockShared() == wxMUTEX_NO_ERROR )
+                {
+                    numLocked++;
+                    mutex.UnlockShared();
+                }
+            });
+        CHECK( numLocked == 2 );
+
+        // But not exclusively.
+        std::atomic<int> numBusy{0};
+        RunInThreads(1, [&]()
+            {
+                if ( mutex.TryLock() == wxMUTEX_BUSY )
+                    numBusy++;
+            });
+        CHECK( numBusy == 1 );
+
+        CHECK( mutex.UnlockShared() == wxMUTEX_NO_ERROR );
+    }
+
+    SECTION("Exclusive")
+    {
+        CHECK( mutex.Lock() == wxMUTEX_NO_ERROR );
+
+        std::atomic<int> numBusy{0};
+        RunInThreads(2, [&]()
+            {
+                if ( mutex.TryLockShared() == wxMUTEX_BUSY )
+                    numBusy++;
+                if ( mutex.TryLock() == wxMUTEX_BUSY )
+                    numBusy++;
+            });
+        CHECK( numBusy == 4 );
+
+        CHECK( mutex.Unlock() == wxMUTEX_NO_ERROR );
+
+        CHECK( mutex.TryLock() == wxMUTEX_NO_ERROR );
+        CHECK( mutex.Unlock() == wxMUTEX_NO_ERROR );
+    }
+
+    SECTION("Lockers")
+    {
+        // Check that the data modified by the writers is always consistent
+        // when seen by the readers.
+        int values[2] = { 0, 0 };
+        std::atomic<int> numInconsistent{0};
+
+        RunInThreads(4, [&]()
+            {
+                for ( int n = 0; n < 10000; n++ )
+                {
+                    if ( n % 10 == 0 )
+                    {
+                        wxWriteLocker lock(mutex);
+                        values[0]++;
+                        values[1]++;
+                    }
+                    else
+                    {
+                        wxReadLocker lock(mutex);
+                        if ( values[0] != values[1] )
+                            numInconsistent++;
+                    }
+                }
+            });
+
+        CHECK( numInconsistent == 0 );
+        CHECK( values[0] == 4000 );
+        CHECK( values[1] == 4000 );
+    }
+}
+
+TEST_CASE("wxSpinMutex", "[thread][lock]")
+{
+    wxSpinMutex mutex;
+
+    CHECK( mutex.TryLock() );
+    CHECK( !mutex.TryLock() );
+    mutex.Unlock();
+
+    // Increment a non-atomic counter from several threads.
+    int counter = 0;
+    RunInThreads(4, [&]()
+        {
+            for ( int n = 0; n < 100000; n++ )
+            {
+                wxSpinMutexLocker lock(mutex);
+                counter++;
+            }
+        });
+
+    CHECK( counter == 400000 );
+
+    // Check that waiting for the mutex held for a long time works too.
+    mutex.Lock();
+
+    std::atomic<bool> locked{false};
+    std::unique_ptr<FunctionThread> thread(new FunctionThread([&]()
+        {
+            wxSpinMutexLocker lock(mutex);
+            locked = true;
+        }));
+    REQUIRE( thread->Run() == wxTHREAD_NO_ERROR );
+
+    wxMilliSleep(50);
+    CHECK( !locked );
+
+    mutex.Unlock();
+    thread->Wait();
+    CHECK( locked );
+}
@@ -19,6 +19,7 @@
 #include "wx/thread.h"
 #include "wx/utils.h"
 
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -418,3 +419,87 @@ void MiscThreadTestCase::TestThreadConditions()
         nFinished++;
     }
 }
+
+// ----------------------------------------------------------------------------
+// scheduling and statistics tests
+// ----------------------------------------------------------------------------
+
+#if defined(__LINUX__) || defined(__WINDOWS__)
+
+namespace
+{
+
+// Thread using the CPU until it's told to stop.
+class BusyThread : public wxThread
+{
+public:
+    BusyThread() : wxThread(wxTHREAD_JOINABLE) { }
+
+    void Stop() { m_stop = true; }
+
+    std::vector<int> m_affinity;
+    wxThreadCPUStats m_stats;
+
+protected:
+    virtual void *Entry() override
+    {
+        GetAffinityForCurrent(m_affinity);
+
+        volatile unsigned x = 0;
+        while ( !m_stop )
+            x = x + 1;
+
+        GetCPUStatsForCurrent(m_stats);
+
+        return nullptr;
+    }
+
+private:
+    std::atomic<bool> m_stop{false};
+};
+
+} // anonymous namespace
+
+TEST_CASE("wxThread::Scheduling", "[thread]")
+{
+    std::vector<int> cpus;
+    REQUIRE( wxThread::GetAffinityForCurrent(cpus) );
+    REQUIRE( !cpus.empty() );
+
+    // Setting the same affinity must work.
+    CHECK( wxThread::SetAffinityForCurrent(cpus) );
+
+    BusyThread thread;
+    REQUIRE( thread.Create() == wxTHREAD_NO_ERROR );
+
+    const std::vector<int> firstCPU(1, cpus[0]);
+    CHECK( thread.SetAffinity(firstCPU) );
+    CHECK( thread.SetSchedPolicy(wxTHREAD_SCHED_BATCH) );
+
+    std::vector<int> threadCPUs;
+    CHECK( thread.GetAffinity(threadCPUs) );
+    CHECK( threadCPUs == firstCPU );
+
+    REQUIRE( thread.Run() == wxTHREAD_NO_ERROR );
+
+    wxMilliSleep(100);
+
+    wxThreadCPUStats stats;
+    CHECK( thread.GetCPUStats(stats) );
+
+    thread.Stop();
+    thread.Wait();
+
+    // The thread affinity was set before it started running.
+    CHECK( thread.m_affinity == firstCPU );
+
+    // And it must have used some CPU time by now, but allow for the
+    // statistics not being updated immediately.
+    CHECK( thread.m_stats.userTime + thread.m_stats.systemTime > 0 );
+    CHECK( thread.m_stats.userTime >= stats.userTime );
+
+    wxThreadCPUStats statsMain;
+    CHECK( wxThread::GetCPUStatsForCurrent(statsMain) );
+}
+
+#endif // __LINUX__ || __WINDOWS__
@@ -0,0 +1,180 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        tests/thread/parallel.cpp
+// Purpose:     Unit test for the parallel algorithms
+// Author:      wxWidgets team
+// Created:     2026-10-19
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+// ----------------------------------------------------------------------------
+// headers
+// ----------------------------------------------------------------------------
+
+#include "testprec.h"
+
+
+#ifndef WX_PRECOMP
+    #include "wx/thread.h"
+#endif // WX_PRECOMP
+
+#include "wx/parallel.h"
+
+#include <atomic>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+// helpers
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+// Use the given concurrency limit for the lifetime of this object.
+class ConcurrencySetter
+{
+public:
+    explicit ConcurrencySetter(unsigned numThreads)
+    {
+        wxSetParallelConcurrency(numThreads);
+    }
+
+    ~ConcurrencySetter()
+    {
+        wxSetParallelConcurrency(0);
+    }
+};
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------------
+// tests
+// ----------------------------------------------------------------------------
+
+TEST_CASE("wxParallelFor", "[thread][parallel]")
+{
+    // Use more than one thread even when testing on a single CPU machine.
+    ConcurrencySetter setConcurrency(4);
+    CHECK( wxGetParallelConcurrency() == 4 );
+
+    std::vector<int> v(10000);
+    wxParallelFor(0, v.size(), [&v](size_t i) { v[i] += static_cast<int>(i); });
+
+    for ( size_t i = 0; i < v.size(); i++ )
+    {
+        if ( v[i] != static_cast<int>(i) )
+            FAIL_CHECK( "Wrong value at " << i << ": " << v[i] );
+    }
+
+    // Check that the chunks are big enough when the grain size is given.
+    // Notice that we can't use CHECK() from inside the function as it can be
+    // called from the other threads.
+    std::atomic<int> numChunks{0};
+    std::atomic<int> numSmallChunks{0};
+    wxParallelForRange(10, 1010, [&](size_t from, size_t to)
+        {
+            if ( to - from < 100 )
+                numSmallChunks++;
+            numChunks++;
+        }, 100);
+    CHECK( numChunks <= 10 );
+    CHECK( numSmallChunks == 0 );
+
+    // Empty ranges are allowed.
+    std::atomic<int> numCalls{0};
+    wxParallelFor(5, 5, [&numCalls](size_t) { numCalls++; });
+    CHECK( numCalls == 0 );
+}
+
+TEST_CASE("wxParallelFor::Serial", "[thread][parallel]")
+{
+    ConcurrencySetter setConcurrency(1);
+
+    std::atomic<int> numOtherThreads{0};
+    wxParallelFor(0, 1000, [&numOtherThreads](size_t)
+        {
+            if ( !wxThread::IsMain() )
+                numOtherThreads++;
+        });
+
+    CHECK( numOtherThreads == 0 );
+}
+
+#if wxUSE_EXCEPTIONS
+
+TEST_CASE("wxParallelFor::Exception", "[thread][parallel]")
+{
+    ConcurrencySetter setConcurrency(4);
+
+    std::atomic<int> numCalls{0};
+    CHECK_THROWS_AS
+    (
+        wxParallelFor(0, 1000, [&numCalls](size_t i)
+            {
+                numCalls++;
+                if ( i == 10 )
+                    throw std::runtime_error("Exception in parallel loop");
+            }),
+        std::runtime_error
+    );
+
+    // The chunk containing the index for which the exception was thrown was
+    // processed up to this index.
+    CHECK( numCalls >= 11 );
+}
+
+#endif // wxUSE_EXCEPTIONS
+
+TEST_CASE("wxParallelReduce", "[thread][parallel]")
+{
+    ConcurrencySetter setConcurrency(4);
+
+    const size_t count = 100000;
+    const wxUint64 sum = wxParallelReduce(0, count, wxUint64(0),
+                                          [](size_t i) { return wxUint64(i); },
+                                          std::plus<wxUint64>());
+    CHECK( sum == wxUint64(count)*(count - 1)/2 );
+
+    // Check that the order of the chunks is preserved for non-commutative
+    // operations.
+    const wxString s = wxParallelReduce(0, 26, wxString(),
+        [](size_t i) { return wxString(static_cast<char>('a' + i)); },
+        [](const wxString& s1, const wxString& s2) { return s1 + s2; });
+    CHECK( s == "abcdefghijklmnopqrstuvwxyz" );
+
+    CHECK( wxParallelReduce(3, 3, 17, [](size_t) { return 0; },
+                            std::plus<int>()) == 17 );
+}
+
+TEST_CASE("wxParallelSort", "[thread][parallel]")
+{
+    ConcurrencySetter setConcurrency(4);
+
+    // Make the range big enough to be sorted in parallel.
+    std::vector<unsigned> v(100000);
+    unsigned x = 1;
+    for ( auto& n : v )
+    {
+        x = x*1103515245 + 12345;
+        n = x >> 8;
+    }
+
+    std::vector<unsigned> expected = v;
+    std::sort(expected.begin(), expected.end());
+
+    std::vector<unsigned> sorted = v;
+    wxParallelSort(sorted.begin(), sorted.end());
+    CHECK( sorted == expected );
+
+    std::reverse(expected.begin(), expected.end());
+    wxParallelSort(v.begin(), v.end(), std::greater<unsigned>());
+    CHECK( v == expected );
+
+    // Small ranges work too, of course.
+    int a[] = { 3, 1, 2 };
+    wxParallelSort(a, a + WXSIZEOF(a));
+    CHECK( a[0] == 1 );
+    CHECK( a[1] == 2 );
+    CHECK( a[2] == 3 );
+}
@@ -19,6 +19,7 @@
 #endif // WX_PRECOMP
 
 #include "wx/msgqueue.h"
+#include "wx/stopwatch.h"
 
 // ----------------------------------------------------------------------------
 // thread class used in the tests
@@ -215,3 +216,211 @@ TEST_CASE("wxMessageQueue::NonCopyable", "[msgqueue]")
 
     CHECK( queue.ReceiveTimeout(0, nc2) == wxMSGQUEUE_TIMEOUT );
 }
+
+// ----------------------------------------------------------------------------
+// wxBoundedMessageQueue tests
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+// Thread posting the given number of consecutive integers to the queue,
+// starting with the given one, and waiting no longer than the given timeout
+// for each of them if it's not negative.
+template <typename Q>
+class ProducerThread : public wxThread
+{
+public:
+    ProducerThread(Q& queue, int first, int count, long timeout = -1)
+        : wxThread(wxTHREAD_JOINABLE),
+          m_queue(queue), m_first(first), m_count(count), m_timeout(timeout)
+    {
+    }
+
+    virtual void *Entry() override
+    {
+        for ( int n = 0; n < m_count; n++ )
+        {
+            if ( m_queue.PostTimeout(m_timeout, m_first + n)
+                    != wxMSGQUEUE_NO_ERROR )
+                return (wxThread::ExitCode)wxMSGQUEUE_MISC_ERROR;
+        }
+
+        return (wxThread::ExitCode)wxMSGQUEUE_NO_ERROR;
+    }
+
+private:
+    Q& m_queue;
+    const int m_first;
+    const int m_count;
+    const long m_timeout;
+};
+
+} // anonymous namespace
+
+TEST_CASE("wxBoundedMessageQueue::Basic", "[msgqueue]")
+{
+    wxBoundedMessageQueue<int> queue(3);
+    REQUIRE( queue.IsOk() );
+    CHECK( queue.GetCapacity() == 4 );
+
+    int n;
+    CHECK( !queue.TryReceive(n) );
+    CHECK( queue.ReceiveTimeout(10, n) == wxMSGQUEUE_TIMEOUT );
+
+    for ( int i = 0; i < 4; i++ )
+        CHECK( queue.TryPost(i) );
+
+    // The queue is full now.
+    CHECK( !queue.TryPost(4) );
+    CHECK( queue.PostTimeout(10, 4) == wxMSGQUEUE_TIMEOUT );
+
+    CHECK( queue.Receive(n) == wxMSGQUEUE_NO_ERROR );
+    CHECK( n == 0 );
+
+    CHECK( queue.TryPost(4) );
+
+    std::vector<int> batch;
+    CHECK( queue.TryReceiveBatch(batch, 2) == 2 );
+    CHECK( queue.ReceiveBatch(batch, 10) == wxMSGQUEUE_NO_ERROR );
+    CHECK( batch == std::vector<int>({1, 2, 3, 4}) );
+
+    CHECK( queue.TryReceiveBatch(batch, 10) == 0 );
+}
+
+TEST_CASE("wxBoundedMessageQueue::NonCopyable", "[msgqueue]")
+{
+    wxSPSCMessageQueue< std::unique_ptr<int> > queue(2);
+
+    CHECK( queue.Post(std::unique_ptr<int>(new int(17))) == wxMSGQUEUE_NO_ERROR );
+    CHECK( queue.Post(std::unique_ptr<int>(new int(18))) == wxMSGQUEUE_NO_ERROR );
+
+    // A message not posted into a full queue is not lost.
+    std::unique_ptr<int> p(new int(19));
+    CHECK( !queue.TryPost(std::move(p)) );
+    REQUIRE( p );
+    CHECK( *p == 19 );
+
+    std::unique_ptr<int> p2;
+    CHECK( queue.Receive(p2) == wxMSGQUEUE_NO_ERROR );
+    CHECK( *p2 == 17 );
+
+    // The remaining message is destroyed together with the queue.
+}
+
+TEST_CASE("wxBoundedMessageQueue::SPSC", "[msgqueue]")
+{
+    typedef wxSPSCMessageQueue<int> SPSCQueue;
+
+    // Use small capacity to exercise blocking when the queue is full too.
+    SPSCQueue queue(16);
+
+    const int count = 100000;
+    ProducerThread<SPSCQueue> producer(queue, 0, count);
+    REQUIRE( producer.Run() == wxTHREAD_NO_ERROR );
+
+    int numWrong = 0;
+    for ( int n = 0; n < count; n++ )
+    {
+        int value = -1;
+        if ( queue.Receive(value) != wxMSGQUEUE_NO_ERROR || value != n )
+            numWrong++;
+    }
+
+    CHECK( producer.Wait() == (wxThread::ExitCode)wxMSGQUEUE_NO_ERROR );
+    CHECK( numWrong == 0 );
+}
+
+TEST_CASE("wxBoundedMessageQueue::MPMC", "[msgqueue]")
+{
+    typedef wxBoundedMessageQueue<int> MPMCQueue;
+
+    MPMCQueue queue(16);
+
+    const int numProducers = 4;
+    const int countPerProducer = 20000;
+
+    std::vector<std::unique_ptr<ProducerThread<MPMCQueue>>> producers;
+    for ( int n = 0; n < numProducers; n++ )
+    {
+        producers.emplace_back(new ProducerThread<MPMCQueue>
+                                   (
+                                    queue,
+                                    n*countPerProducer,
+                                    countPerProducer
+                                   ));
+        REQUIRE( producers.back()->Run() == wxTHREAD_NO_ERROR );
+    }
+
+    // Receive the messages in batches in this thread and check that all of
+    // them were received exactly once and in order for each producer.
+    std::vector<int> last(numProducers, -1);
+    int numWrong = 0;
+    int received = 0;
+    std::vector<int> batch;
+    while ( received < numProducers*countPerProducer )
+    {
+        batch.clear();
+        REQUIRE( queue.ReceiveBatch(batch, 10) == wxMSGQUEUE_NO_ERROR );
+
+        for ( auto value : batch )
+        {
+            int& prev = last[value / countPerProducer];
+            if ( prev != -1 && value != prev + 1 )
+                numWrong++;
+            prev = value;
+        }
+
+        received += static_cast<int>(batch.size());
+    }
+
+    for ( auto& producer : producers )
+        CHECK( producer->Wait() == (wxThread::ExitCode)wxMSGQUEUE_NO_ERROR );
+
+    CHECK( numWrong == 0 );
+    CHECK( received == numProducers*countPerProducer );
+
+    int n;
+    CHECK( !queue.TryReceive(n) );
+}
+
+TEST_CASE("wxBoundedMessageQueue::WakeAll", "[msgqueue]")
+{
+    typedef wxBoundedMessageQueue<int> MPMCQueue;
+
+    MPMCQueue queue(4);
+    for ( int n = 0; n < 4; n++ )
+        REQUIRE( queue.TryPost(n) );
+
+    // Start several producers which block because the queue is full.
+    const int numProducers = 4;
+    std::vector<std::unique_ptr<ProducerThread<MPMCQueue>>> producers;
+    for ( int n = 0; n < numProducers; n++ )
+    {
+        producers.emplace_back(new ProducerThread<MPMCQueue>
+                                   (
+                                    queue,
+                                    4 + n,
+                                    1,
+                                    10000
+                                   ));
+        REQUIRE( producers.back()->Run() == wxTHREAD_NO_ERROR );
+    }
+
+    wxMilliSleep(100);
+
+    // Freeing all slots at once must wake up all of them and not just one,
+    // otherwise the others would remain blocked until their timeout expires.
+    wxStopWatch sw;
+
+    std::vector<int> batch;
+    CHECK( queue.TryReceiveBatch(batch, 4) == 4 );
+
+    for ( auto& producer : producers )
+        CHECK( producer->Wait() == (wxThread::ExitCode)wxMSGQUEUE_NO_ERROR );
+
+    CHECK( sw.Time() < 5000 );
+
+    batch.clear();
+    CHECK( queue.TryReceiveBatch(batch, 10) == numProducers );
+}
@@ -0,0 +1,269 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        tests/thread/threadpool.cpp
+// Purpose:     wxThreadPool unit test
+// Author:      wxWidgets team
+// Created:     2026-10-19
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+// ----------------------------------------------------------------------------
+// headers
+// ----------------------------------------------------------------------------
+
+#include "testprec.h"
+
+
+#ifndef WX_PRECOMP
+    #include "wx/app.h"
+    #include "wx/thread.h"
+#endif // WX_PRECOMP
+
+#include "wx/threadpool.h"
+
+#include <atomic>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+// helpers
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+// Submit a task blocking the (only) thread of the pool for the lifetime of
+// this object, this allows to submit other tasks while it's busy.
+class PoolBlocker
+{
+public:
+    explicit PoolBlocker(wxThreadPool& pool)
+    {
+        m_task = pool.Submit([this]()
+            {
+                m_started.Post();
+                m_semaphore.Wait();
+            });
+
+        m_started.Wait();
+    }
+
+    ~PoolBlocker()
+    {
+        m_semaphore.Post();
+        m_task.Wait();
+    }
+
+private:
+    wxSemaphore m_started;
+    wxSemaphore m_semaphore;
+    wxTask m_task;
+};
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------------
+// tests
+// ----------------------------------------------------------------------------
+
+TEST_CASE("wxThreadPool::Submit", "[thread][threadpool]")
+{
+    wxThreadPool pool(4);
+    CHECK( pool.GetThreadCount() == 4 );
+
+    std::atomic<int> count{0};
+
+    std::vector<wxTask> tasks;
+    for ( int n = 0; n < 100; n++ )
+        tasks.push_back(pool.Submit([&count]() { count++; }));
+
+    tasks[0].Wait();
+    CHECK( tasks[0].GetState() == wxTASK_COMPLETED );
+
+    pool.WaitAll();
+    CHECK( count == 100 );
+
+    for ( const auto& task : tasks )
+        CHECK( task.IsDone() );
+
+    CHECK( !wxTask().IsOk() );
+    CHECK( !wxThreadPool::IsCancelRequested() );
+}
+
+TEST_CASE("wxThreadPool::Nested", "[thread][threadpool]")
+{
+    // Use a single thread to check that waiting for a task from inside the
+    // pool doesn't deadlock.
+    wxThreadPool pool(1);
+
+    std::atomic<int> count{0};
+    wxTask task = pool.Submit([&pool, &count]()
+        {
+            std::vector<wxTask> subtasks;
+            for ( int n = 0; n < 10; n++ )
+                subtasks.push_back(pool.Submit([&count]() { count++; }));
+
+            for ( const auto& subtask : subtasks )
+                subtask.Wait();
+
+            count += 100;
+        });
+
+    task.Wait();
+    CHECK( count == 110 );
+}
+
+TEST_CASE("wxThreadPool::Priority", "[thread][threadpool]")
+{
+    wxThreadPool pool(1);
+
+    std::vector<int> order;
+    {
+        PoolBlocker blocker(pool);
+
+        pool.Submit([&order]() { order.push_back(wxTASK_PRIORITY_LOW); },
+                    wxTASK_PRIORITY_LOW);
+        pool.Submit([&order]() { order.push_back(wxTASK_PRIORITY_NORMAL); });
+        pool.Submit([&order]() { order.push_back(wxTASK_PRIORITY_HIGH); },
+                    wxTASK_PRIORITY_HIGH);
+    }
+
+    pool.WaitAll();
+
+    REQUIRE( order.size() == 3 );
+    CHECK( order[0] == wxTASK_PRIORITY_HIGH );
+    CHECK( order[1] == wxTASK_PRIORITY_NORMAL );
+    CHECK( order[2] == wxTASK_PRIORITY_LOW );
+}
+
+TEST_CASE("wxThreadPool::Cancel", "[thread][threadpool]")
+{
+    wxThreadPool pool(1);
+
+    SECTION("Pending")
+    {
+        bool executed = false;
+        wxTask task, cont;
+        {
+            PoolBlocker blocker(pool);
+
+            task = pool.Submit([&executed]() { executed = true; });
+            cont = task.Then([&executed]() { executed = true; });
+
+            CHECK( task.GetState() == wxTASK_PENDING );
+            CHECK( task.Cancel() );
+            CHECK( task.IsCancelRequested() );
+        }
+
+        pool.WaitAll();
+
+        CHECK( !executed );
+        CHECK( task.GetState() == wxTASK_CANCELLED );
+        CHECK( cont.GetState() == wxTASK_CANCELLED );
+
+        // Continuations of an already cancelled task are cancelled too.
+        CHECK( task.Then([]() { }).GetState() == wxTASK_CANCELLED );
+    }
+
+    SECTION("Running")
+    {
+        wxSemaphore started;
+        wxTask task = pool.Submit([&started]()
+            {
+                started.Post();
+                while ( !wxThreadPool::IsCancelRequested() )
+                    wxMilliSleep(1);
+            });
+
+        started.Wait();
+        CHECK( task.GetState() == wxTASK_RUNNING );
+        CHECK( !task.Cancel() );
+
+        task.Wait();
+        CHECK( task.GetState() == wxTASK_COMPLETED );
+    }
+
+    SECTION("Destroy")
+    {
+        bool executed = false;
+        wxTask task;
+        {
+            wxThreadPool poolTemp(1);
+
+            wxSemaphore started;
+            poolTemp.Submit([&started]()
+                {
+                    started.Post();
+                    wxMilliSleep(50);
+                });
+            started.Wait();
+
+            task = poolTemp.Submit([&executed]() { executed = true; });
+        }
+
+        // The pending task must have been cancelled by the pool destructor.
+        CHECK( task.GetState() == wxTASK_CANCELLED );
+        CHECK( !executed );
+    }
+}
+
+TEST_CASE("wxThreadPool::Then", "[thread][threadpool]")
+{
+    wxThreadPool pool(2);
+
+    std::vector<int> order;
+    wxTask last = pool.Submit([&order]() { order.push_back(1); })
+                      .Then([&order]() { order.push_back(2); })
+                      .Then([&order]() { order.push_back(3); });
+
+    last.Wait();
+
+    REQUIRE( order.size() == 3 );
+    CHECK( order[0] == 1 );
+    CHECK( order[1] == 2 );
+    CHECK( order[2] == 3 );
+
+    // Continuation of an already completed task is executed immediately.
+    bool executed = false;
+    last.Then([&executed]() { executed = true; }).Wait();
+    CHECK( executed );
+}
+
+TEST_CASE("wxThreadPool::ThenInMainThread", "[thread][threadpool]")
+{
+    wxThreadPool pool(1);
+
+    bool inMainThread = false;
+    wxTask cont = pool.Submit([]() { })
+                      .ThenInMainThread([&inMainThread]()
+                        {
+                            inMainThread = wxThread::IsMain();
+                        });
+
+    // The continuation is executed from the event loop, so we need to
+    // process pending events until it runs.
+    for ( int n = 0; n < 1000 && !cont.IsDone(); n++ )
+    {
+        wxMilliSleep(1);
+        wxTheApp->ProcessPendingEvents();
+    }
+
+    CHECK( cont.GetState() == wxTASK_COMPLETED );
+    CHECK( inMainThread );
+}
+
+TEST_CASE("wxThreadPool::Get", "[thread][threadpool]")
+{
+    wxThreadPool& pool = wxThreadPool::Get();
+    CHECK( &pool == &wxThreadPool::Get() );
+    CHECK( pool.GetThreadCount() > 0 );
+
+    std::atomic<int> count{0};
+    for ( int n = 0; n < 10; n++ )
+        pool.Submit([&count]() { count++; });
+
+    pool.WaitAll();
+    CHECK( count == 10 );
+
+    wxTask task = pool.Submit([]() { wxMilliSleep(100); });
+    CHECK( !task.WaitTimeout(1) );
+    CHECK( task.WaitTimeout(10000) );
+}
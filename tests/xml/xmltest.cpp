@@ -612,6 +612,46 @@ void XmlTestCase::Doctype()
     CPPUNIT_ASSERT( !dt.IsValid() );
 }
 
+TEST_CASE("XML::Attributes", "[xml]")
+{
+    wxXmlNode node(wxXML_ELEMENT_NODE, "node");
+    node.AddAttribute("first", "1");
+    node.AddAttribute("second", "2");
+
+    CHECK( node.GetName() == "node" );
+
+    wxString value;
+    CHECK( node.GetAttribute("second", &value) );
+    CHECK( value == "2" );
+    CHECK( node.GetAttribute("first", &value) );
+    CHECK( value == "1" );
+
+    CHECK( node.HasAttribute("first") );
+    CHECK( !node.HasAttribute("First") );
+    CHECK( !node.HasAttribute("no such attribute used anywhere") );
+    CHECK( node.GetAttribute("third", "default") == "default" );
+
+    CHECK( node.DeleteAttribute("first") );
+    CHECK( !node.DeleteAttribute("first") );
+    CHECK( !node.HasAttribute("first") );
+    CHECK( node.GetAttributes()->GetName() == "second" );
+
+    // Check that copying the node preserves the attributes.
+    wxXmlNode copy(node);
+    CHECK( copy.GetName() == "node" );
+    CHECK( copy.GetAttribute("second") == "2" );
+
+    // And that they can still be modified.
+    copy.GetAttributes()->SetName("renamed");
+    CHECK( copy.GetAttribute("renamed") == "2" );
+    CHECK( !copy.HasAttribute("second") );
+    CHECK( node.HasAttribute("second") );
+
+    // Default constructed objects have empty names.
+    CHECK( wxXmlNode().GetName().empty() );
+    CHECK( wxXmlAttribute().GetName().empty() );
+}
+
 // This test is disabled by default as it requires the environment variable
 // below to be defined to point to a XML file to load.
 TEST_CASE("XML::Load", "[xml][.]")
@@ -0,0 +1,158 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        utils/logdecode/logdecode.cpp
+// Purpose:     Decoder of the binary log files written by wxLogBinaryFile
+// Author:      wxWidgets team
+// Created:     2026-10-19
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+// For compilers that support precompilation, includes "wx/wx.h".
+#include "wx/wxprec.h"
+
+#ifndef WX_PRECOMP
+    #include "wx/app.h"
+    #include "wx/log.h"
+    #include "wx/wxcrtvararg.h"
+#endif
+
+#include "wx/cmdline.h"
+#include "wx/datetime.h"
+#include "wx/logbinary.h"
+
+namespace
+{
+
+wxString GetLevelName(wxLogLevel level)
+{
+    switch ( level )
+    {
+        case wxLOG_FatalError:  return "fatal";
+        case wxLOG_Error:       return "error";
+        case wxLOG_Warning:     return "warning";
+        case wxLOG_Message:     return "message";
+        case wxLOG_Status:      return "status";
+        case wxLOG_Info:        return "info";
+        case wxLOG_Debug:       return "debug";
+        case wxLOG_Trace:       return "trace";
+        case wxLOG_Progress:    return "progress";
+    }
+
+    return wxString::Format("level %lu", level);
+}
+
+} // anonymous namespace
+
+class LogDecodeApp : public wxAppConsole
+{
+public:
+    // don't use the standard command line processing, it's done in OnRun()
+    virtual bool OnInit() override { return true; }
+    virtual int OnRun() override;
+
+private:
+    // decode the given file, return false on error
+    bool Decode(const wxString& filename);
+
+    bool m_verbose = false;
+    bool m_withTime = true;
+};
+
+wxIMPLEMENT_APP_CONSOLE(LogDecodeApp);
+
+int LogDecodeApp::OnRun()
+{
+    wxGCC_WARNING_SUPPRESS(missing-field-initializers)
+
+    static const wxCmdLineEntryDesc cmdLineDesc[] =
+    {
+        { wxCMD_LINE_SWITCH, "h", "help",  "show help message", wxCMD_LINE_VAL_NONE, wxCMD_LINE_OPTION_HELP },
+        { wxCMD_LINE_SWITCH, "v", "verbose", "show the location, thread and component of each record" },
+        { wxCMD_LINE_SWITCH, "",  "no-time", "don't show the time stamps" },
+        { wxCMD_LINE_PARAM,  nullptr, nullptr, "binary log file(s)",
+              wxCMD_LINE_VAL_STRING,
+              wxCMD_LINE_PARAM_MULTIPLE | wxCMD_LINE_OPTION_MANDATORY },
+
+        wxCMD_LINE_DESC_END
+    };
+
+    wxGCC_WARNING_RESTORE(missing-field-initializers)
+
+    wxCmdLineParser parser(cmdLineDesc, argc, argv);
+
+    switch ( parser.Parse() )
+    {
+        case -1:
+            return 0;
+
+        case 0:
+            {
+                m_verbose = parser.Found("v");
+                m_withTime = !parser.Found("no-time");
+
+                int rc = 0;
+                for ( size_t n = 0; n < parser.GetParamCount(); n++ )
+                {
+                    if ( !Decode(parser.GetParam(n)) )
+                        rc = 2;
+                }
+
+                return rc;
+            }
+    }
+
+    return 1;
+}
+
+bool LogDecodeApp::Decode(const wxString& filename)
+{
+    wxLogBinaryReader reader(filename);
+    if ( !reader.IsOk() )
+        return false;
+
+    wxLogLevel level;
+    wxString msg;
+    wxLogRecordInfo info;
+    while ( reader.ReadRecord(level, msg, info) )
+    {
+        wxString line;
+
+        if ( m_withTime )
+        {
+            const wxDateTime dt(wxLongLong(info.timestampMS));
+            line << dt.Format("%Y-%m-%d %H:%M:%S.%l ");
+        }
+
+        line << GetLevelName(level) << ": ";
+
+        if ( m_verbose )
+        {
+#if wxUSE_THREADS
+            line << wxString::Format("[%llx] ",
+                                     static_cast<wxULongLong_t>(info.threadId));
+#endif // wxUSE_THREADS
+
+            if ( info.component && *info.component )
+                line << "[" << info.component << "] ";
+
+            if ( info.filename )
+            {
+                line << info.filename << "(" << info.line << ")";
+                if ( info.func )
+                    line << " in " << info.func << "()";
+                line << ": ";
+            }
+        }
+
+        line << msg;
+
+        wxPrintf("%s\n", line);
+    }
+
+    if ( reader.HasError() )
+    {
+        wxLogError("File \"%s\" is corrupted or truncated.", filename);
+        return false;
+    }
+
+    return true;
+}